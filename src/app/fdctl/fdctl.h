@@ -46,8 +46,10 @@ generate_keypair( char const * keyfile,
 void run1_cmd_args        ( int * pargc, char *** pargv, args_t * args );
 void keys_cmd_args        ( int * pargc, char *** pargv, args_t * args );
 void set_identity_cmd_args( int * pargc, char *** pargv, args_t * args );
+void rss_balance_cmd_args ( int * pargc, char *** pargv, args_t * args );
 
 void set_identity_cmd_perm( args_t * args, fd_cap_chk_t * chk, config_t const * config );
+void rss_balance_cmd_perm ( args_t * args, fd_cap_chk_t * chk, config_t const * config );
 
 void run1_cmd_fn        ( args_t * args, config_t * config );
 void run_agave_cmd_fn   ( args_t * args, config_t * config );
@@ -56,6 +58,7 @@ void set_identity_cmd_fn( args_t * args, config_t * config );
 void ready_cmd_fn       ( args_t * args, config_t * config );
 void mem_cmd_fn         ( args_t * args, config_t * config );
 void netconf_cmd_fn     ( args_t * args, config_t * config );
+void rss_balance_cmd_fn ( args_t * args, config_t * config );
 void help_cmd_fn        ( args_t * args, config_t * config );
 void version_cmd_fn     ( args_t * args, config_t * config );
 
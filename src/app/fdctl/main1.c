@@ -3,6 +3,7 @@
 
 #include "fdctl.h"
 #include "topos/topos.h"
+#include "../../disco/topo/fd_topob.h"
 
 #include "../shared/commands/configure/configure.h"
 #include "../shared/commands/run/run.h"
@@ -22,6 +23,7 @@ action_t ACTIONS[] = {
   { .name = "mem",          .args = NULL,                  .fn = mem_cmd_fn,          .perm = NULL,                  .description = "Print workspace memory and tile topology information" },
   { .name = "netconf",      .args = NULL,                  .fn = netconf_cmd_fn,      .perm = NULL,                  .description = "Print network configuration" },
   { .name = "set-identity", .args = set_identity_cmd_args, .fn = set_identity_cmd_fn, .perm = set_identity_cmd_perm, .description = "Change the identity of a running validator" },
+  { .name = "rss-balance",  .args = rss_balance_cmd_args,  .fn = rss_balance_cmd_fn,  .perm = rss_balance_cmd_perm,  .description = "Rebalance network device RSS queues across net tiles" },
   { .name = "help",         .args = NULL,                  .fn = help_cmd_fn,         .perm = NULL,                  .description = "Print this help message" },
   { .name = "version",      .args = NULL,                  .fn = version_cmd_fn,      .perm = NULL,                  .description = "Show the current software version" },
   {0}
@@ -85,71 +87,6 @@ should_colorize( void ) {
   return 0;
 }
 
-static void
-initialize_numa_assignments( fd_topo_t * topo ) {
-  /* Assign workspaces to NUMA nodes.  The heuristic here is pretty
-     simple for now: workspaces go on the NUMA node of the first
-     tile which maps the largest object in the workspace. */
-
-  for( ulong i=0UL; i<topo->wksp_cnt; i++ ) {
-    ulong max_footprint = 0UL;
-    ulong max_obj = ULONG_MAX;
-
-    for( ulong j=0UL; j<topo->obj_cnt; j++ ) {
-      fd_topo_obj_t * obj = &topo->objs[ j ];
-      if( obj->wksp_id!=i ) continue;
-
-      if( FD_UNLIKELY( !max_footprint || obj->footprint>max_footprint ) ) {
-        max_footprint = obj->footprint;
-        max_obj = j;
-      }
-    }
-
-    if( FD_UNLIKELY( max_obj==ULONG_MAX ) ) FD_LOG_ERR(( "no object found for workspace %s", topo->workspaces[ i ].name ));
-
-    int found_strict = 0;
-    int found_lazy   = 1;
-    for( ulong j=0UL; j<topo->tile_cnt; j++ ) {
-      fd_topo_tile_t * tile = &topo->tiles[ j ];
-      if( FD_UNLIKELY( tile->tile_obj_id==max_obj && tile->cpu_idx!=ULONG_MAX ) ) {
-        topo->workspaces[ i ].numa_idx = fd_shmem_numa_idx( tile->cpu_idx );
-        FD_TEST( topo->workspaces[ i ].numa_idx!=ULONG_MAX );
-        found_strict = 1;
-        found_lazy = 1;
-        break;
-      } else if( FD_UNLIKELY( tile->tile_obj_id==max_obj && tile->cpu_idx==ULONG_MAX ) ) {
-        topo->workspaces[ i ].numa_idx = 0;
-        found_lazy = 1;
-        break;
-      }
-    }
-
-    if( FD_LIKELY( !found_strict ) ) {
-      for( ulong j=0UL; j<topo->tile_cnt; j++ ) {
-        fd_topo_tile_t * tile = &topo->tiles[ j ];
-        for( ulong k=0UL; k<tile->uses_obj_cnt; k++ ) {
-          if( FD_LIKELY( tile->uses_obj_id[ k ]==max_obj && tile->cpu_idx!=ULONG_MAX ) ) {
-            topo->workspaces[ i ].numa_idx = fd_shmem_numa_idx( tile->cpu_idx );
-            FD_TEST( topo->workspaces[ i ].numa_idx!=ULONG_MAX );
-            found_lazy = 1;
-            break;
-          } else if( FD_UNLIKELY( tile->uses_obj_id[ k ]==max_obj ) && tile->cpu_idx==ULONG_MAX ) {
-            topo->workspaces[ i ].numa_idx = 0;
-            found_lazy = 1;
-            /* Don't break, keep looking -- a tile with a CPU assignment
-               might also use object in which case we want to use that
-               NUMA node. */
-          }
-        }
-
-        if( FD_UNLIKELY( found_lazy ) ) break;
-      }
-    }
-
-    if( FD_UNLIKELY( !found_lazy ) ) FD_LOG_ERR(( "no tile uses object %s for workspace %s", topo->objs[ max_obj ].name, topo->workspaces[ i ].name ));
-  }
-}
-
 void
 fdctl_boot( int *        pargc,
             char ***     pargv,
@@ -240,7 +177,7 @@ fdctl_boot( int *        pargc,
      boot. */
 
   if( FD_LIKELY( -1==config_fd ) ) {
-    initialize_numa_assignments( &config->topo );
+    fd_topob_auto_numa( &config->topo );
   }
 
   fd_log_level_logfile_set( config->log.level_logfile1 );
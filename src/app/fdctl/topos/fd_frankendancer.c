@@ -109,7 +109,7 @@ fd_topo_initialize( config_t * config ) {
   }
 
   fd_topos_net_tiles( topo, config->layout.net_tile_count, config->tiles.netlink.max_routes, config->tiles.netlink.max_neighbors, config->development.net.provider, config->tiles.net.interface, config->tiles.net.flush_timeout_micros,
-    config->tiles.net.xdp_rx_queue_size, config->tiles.net.xdp_tx_queue_size, config->tiles.net.xdp_zero_copy, config->tiles.net.xdp_mode, tile_to_cpu );
+    config->tiles.net.xdp_rx_queue_size, config->tiles.net.xdp_tx_queue_size, config->tiles.net.xdp_zero_copy, config->tiles.net.xdp_mode, config->development.net.udp_gro, tile_to_cpu );
 
   FOR(net_tile_cnt) fd_topos_net_rx_link( topo, "net_quic",  i, config->tiles.net.send_buffer_size );
   FOR(net_tile_cnt) fd_topos_net_rx_link( topo, "net_shred", i, config->tiles.net.send_buffer_size );
@@ -136,6 +136,10 @@ fd_topo_initialize( config_t * config ) {
 
   FOR(quic_tile_cnt) for( ulong j=0UL; j<net_tile_cnt; j++ )
                        fd_topob_tile_in(  topo, "quic",    i,            "metric_in", "net_quic",     j,            FD_TOPOB_UNRELIABLE, FD_TOPOB_POLLED ); /* No reliable consumers of networking fragments, may be dropped or overrun */
+  FOR(quic_tile_cnt)   fd_topob_tile_in(  topo, "quic",    i,            "metric_in", "stake_out",    0UL,          FD_TOPOB_UNRELIABLE, FD_TOPOB_POLLED );
+  FOR(quic_tile_cnt)   fd_topob_tile_in(  topo, "quic",    i,            "metric_in", "crds_shred",   0UL,          FD_TOPOB_UNRELIABLE, FD_TOPOB_POLLED );
+  /**/                 fd_topob_tile_in(  topo, "netlnk",  0UL,          "metric_in", "stake_out",    0UL,          FD_TOPOB_UNRELIABLE, FD_TOPOB_POLLED ); /* neighbor prefetch */
+  /**/                 fd_topob_tile_in(  topo, "netlnk",  0UL,          "metric_in", "crds_shred",   0UL,          FD_TOPOB_UNRELIABLE, FD_TOPOB_POLLED );
   FOR(quic_tile_cnt)   fd_topob_tile_out( topo, "quic",    i,                         "quic_verify",  i                                                  );
   FOR(quic_tile_cnt)   fd_topob_tile_out( topo, "quic",    i,                         "quic_net",     i                                                  );
   /* All verify tiles read from all QUIC tiles, packets are round robin. */
@@ -345,6 +349,13 @@ fd_topo_initialize( config_t * config ) {
 
   FOR(net_tile_cnt) fd_topos_net_tile_finish( topo, i );
 
+  /* All quic tiles share the same retry token keys, such that a retry
+     token issued by one quic tile can be validated by any other. */
+  uchar quic_retry_secret[ 16 ];
+  uchar quic_retry_iv    [ 12 ];
+  FD_TEST( fd_rng_secure( quic_retry_secret, sizeof(quic_retry_secret) ) );
+  FD_TEST( fd_rng_secure( quic_retry_iv,     sizeof(quic_retry_iv)     ) );
+
   for( ulong i=0UL; i<topo->tile_cnt; i++ ) {
     fd_topo_tile_t * tile = &topo->tiles[ i ];
 
@@ -368,6 +379,13 @@ fd_topo_initialize( config_t * config ) {
       tile->quic.idle_timeout_millis            = config->tiles.quic.idle_timeout_millis;
       tile->quic.ack_delay_millis               = config->tiles.quic.ack_delay_millis;
       tile->quic.retry                          = config->tiles.quic.retry;
+      tile->quic.admit_staked_initial_rate         = config->tiles.quic.admit_staked_initial_rate;
+      tile->quic.admit_unstaked_initial_rate       = config->tiles.quic.admit_unstaked_initial_rate;
+      tile->quic.admit_unstaked_source_initial_max = config->tiles.quic.admit_unstaked_source_initial_max;
+      tile->quic.admit_staked_stream_rate          = config->tiles.quic.admit_staked_stream_rate;
+      tile->quic.admit_unstaked_stream_rate        = config->tiles.quic.admit_unstaked_stream_rate;
+      fd_memcpy( tile->quic.retry_secret, quic_retry_secret, sizeof(tile->quic.retry_secret) );
+      fd_memcpy( tile->quic.retry_iv,     quic_retry_iv,     sizeof(tile->quic.retry_iv)     );
 
     } else if( FD_UNLIKELY( !strcmp( tile->name, "bundle" ) ) ) {
       strncpy( tile->bundle.url, config->tiles.bundle.url, sizeof(tile->bundle.url) );
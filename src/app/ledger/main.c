@@ -125,6 +125,7 @@ struct fd_ledger_args {
   fd_valloc_t           valloc; /* wksp valloc that should NOT be used for runtime allocations */
 
   char const *          lthash;
+  int                   replay_sched;            /* how txns are scheduled onto exec workers (FD_RUNTIME_REPLAY_SCHED_*) */
 };
 typedef struct fd_ledger_args fd_ledger_args_t;
 
@@ -724,6 +725,7 @@ fd_ledger_main_setup( fd_ledger_args_t * args ) {
   args->slot_ctx->snapshot_freq      = args->snapshot_freq;
   args->slot_ctx->incremental_freq   = args->incremental_freq;
   args->slot_ctx->last_snapshot_slot = 0UL;
+  args->slot_ctx->replay_sched       = args->replay_sched;
   args->last_snapshot_slot           = 0UL;
 
   /* Finish other runtime setup steps */
@@ -1423,6 +1425,7 @@ initial_setup( int argc, char ** argv, fd_ledger_args_t * args ) {
   int          snapshot_mismatch     = fd_env_strip_cmdline_int   ( &argc, &argv, "--snapshot-mismatch",     NULL, 0                                                  );
   ulong        thread_mem_bound      = fd_env_strip_cmdline_ulong ( &argc, &argv, "--thread-mem-bound",      NULL, FD_RUNTIME_TRANSACTION_EXECUTION_FOOTPRINT_DEFAULT );
   ulong        runtime_mem_bound     = fd_env_strip_cmdline_ulong ( &argc, &argv, "--runtime-mem-bound",     NULL, FD_RUNTIME_BLOCK_EXECUTION_FOOTPRINT               );
+  char const * replay_sched          = fd_env_strip_cmdline_cstr  ( &argc, &argv, "--replay-sched",          NULL, "dag"                                              );
 
   if( FD_UNLIKELY( !verify_acc_hash ) ) {
     /* We've got full snapshots that contain all 0s for the account
@@ -1527,6 +1530,12 @@ initial_setup( int argc, char ** argv, fd_ledger_args_t * args ) {
   args->snapshot_mismatch       = snapshot_mismatch;
   args->thread_mem_bound        = thread_mem_bound ? thread_mem_bound : FD_RUNTIME_BORROWED_ACCOUNT_FOOTPRINT;
   args->runtime_mem_bound       = runtime_mem_bound;
+
+  if(      !strcmp( replay_sched, "auto"       ) ) args->replay_sched = FD_RUNTIME_REPLAY_SCHED_AUTO;
+  else if( !strcmp( replay_sched, "dag"        ) ) args->replay_sched = FD_RUNTIME_REPLAY_SCHED_DAG;
+  else if( !strcmp( replay_sched, "optimistic" ) ) args->replay_sched = FD_RUNTIME_REPLAY_SCHED_OPTIMISTIC;
+  else FD_LOG_ERR(( "unknown --replay-sched %s (expected auto, dag or optimistic)", replay_sched ));
+
   parse_one_off_features( args, one_off_features );
   parse_rocksdb_list( args, rocksdb_list, rocksdb_list_starts );
 
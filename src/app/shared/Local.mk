@@ -18,6 +18,7 @@ $(call add-objs,commands/keys,fdctl_shared)
 $(call add-objs,commands/mem,fdctl_shared)
 $(call add-objs,commands/netconf,fdctl_shared)
 $(call add-objs,commands/ready,fdctl_shared)
+$(call add-objs,commands/rss_balance,fdctl_shared)
 $(call add-objs,commands/set_identity,fdctl_shared)
 $(call add-objs,commands/version,fdctl_shared)
 $(call add-objs,commands/configure/configure,fdctl_shared)
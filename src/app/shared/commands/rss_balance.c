@@ -0,0 +1,108 @@
+#include "../fd_config.h"
+#include "../../../disco/metrics/fd_metrics.h"
+#include "../../../waltz/xdp/fd_xdp_rss.h"
+
+#include <errno.h>
+#include <linux/capability.h>
+
+/* rss-balance periodically samples the receive load of each net tile
+   and moves RSS hash buckets of the network device from hot to cold
+   queues.  Net tile i serves RX queue i of the device (see the
+   ethtool-channels configure stage), so the load of queue i is the
+   number of packets received by net tile i. */
+
+void
+rss_balance_cmd_args( int *    pargc,
+                      char *** pargv,
+                      args_t * args ) {
+  double interval = fd_env_strip_cmdline_double( pargc, pargv, "--interval",  NULL, 10.0 );
+  double tolerance = fd_env_strip_cmdline_double( pargc, pargv, "--tolerance", NULL,  0.1 );
+  if( FD_UNLIKELY( interval<=0.0 ) ) FD_LOG_ERR(( "--interval must be positive" ));
+  if( FD_UNLIKELY( tolerance<0.0 ) ) FD_LOG_ERR(( "--tolerance must not be negative" ));
+
+  args->rss_balance.interval  = (long)( interval*1e9 );
+  args->rss_balance.tolerance = tolerance;
+  args->rss_balance.dry_run   = fd_env_strip_cmdline_contains( pargc, pargv, "--dry-run" );
+}
+
+void
+rss_balance_cmd_perm( args_t *         args,
+                      fd_cap_chk_t *   chk,
+                      config_t const * config FD_PARAM_UNUSED ) {
+  if( args->rss_balance.dry_run ) return;
+  fd_cap_chk_cap( chk, "rss-balance", CAP_NET_ADMIN, "modify the RSS indirection table of the network device with `ethtool --set-rxfh-indir`" );
+}
+
+void
+rss_balance_cmd_fn( args_t *   args,
+                    config_t * config ) {
+  if( FD_UNLIKELY( strcmp( config->development.net.provider, "xdp" ) ) ) {
+    FD_LOG_ERR(( "rss-balance requires the XDP network stack ([development.net.provider] is `%s`)", config->development.net.provider ));
+  }
+
+  fd_topo_t *  topo    = &config->topo;
+  char const * if_name = config->tiles.net.interface;
+
+  ulong net_tile_cnt = fd_topo_tile_name_cnt( topo, "net" );
+  if( FD_UNLIKELY( !net_tile_cnt || net_tile_cnt>FD_XDP_RSS_QUEUE_MAX ) ) FD_LOG_ERR(( "unsupported net tile count %lu", net_tile_cnt ));
+  if( FD_UNLIKELY( net_tile_cnt==1UL ) ) {
+    FD_LOG_NOTICE(( "only one net tile is configured, nothing to balance" ));
+    return;
+  }
+
+  static uint indir[ FD_XDP_RSS_INDIR_MAX ];
+  ulong       indir_sz = 0UL;
+  int err = fd_xdp_rss_indir_get( if_name, indir, FD_XDP_RSS_INDIR_MAX, &indir_sz );
+  if( FD_UNLIKELY( err ) ) {
+    FD_LOG_ERR(( "failed to read the RSS indirection table of interface %s (%i-%s).  Bonded and virtual "
+                 "devices (such as veth) typically do not support RSS.", if_name, err, fd_io_strerror( err ) ));
+  }
+
+  fd_topo_join_workspaces( topo, FD_SHMEM_JOIN_MODE_READ_ONLY );
+  fd_topo_fill( topo );
+
+  ulong volatile const * net_metrics[ FD_XDP_RSS_QUEUE_MAX ];
+  for( ulong i=0UL; i<net_tile_cnt; i++ ) {
+    ulong tile_idx = fd_topo_find_tile( topo, "net", i );
+    FD_TEST( tile_idx!=ULONG_MAX );
+    net_metrics[ i ] = fd_metrics_tile( topo->tiles[ tile_idx ].metrics );
+  }
+
+  ulong rx_pkt_prev[ FD_XDP_RSS_QUEUE_MAX ];
+  ulong load       [ FD_XDP_RSS_QUEUE_MAX ];
+  for( ulong i=0UL; i<net_tile_cnt; i++ ) rx_pkt_prev[ i ] = net_metrics[ i ][ MIDX( COUNTER, NET, RX_PKT_CNT ) ];
+
+  FD_LOG_NOTICE(( "balancing %lu RSS buckets of interface %s across %lu net tiles every %.1f s",
+                  indir_sz, if_name, net_tile_cnt, (double)args->rss_balance.interval/1e9 ));
+
+  for(;;) {
+    fd_log_sleep( args->rss_balance.interval );
+
+    for( ulong i=0UL; i<net_tile_cnt; i++ ) {
+      ulong rx_pkt = net_metrics[ i ][ MIDX( COUNTER, NET, RX_PKT_CNT ) ];
+      load[ i ]        = rx_pkt - rx_pkt_prev[ i ];
+      rx_pkt_prev[ i ] = rx_pkt;
+    }
+
+    /* Re-read the table in case it was changed externally */
+
+    err = fd_xdp_rss_indir_get( if_name, indir, FD_XDP_RSS_INDIR_MAX, &indir_sz );
+    if( FD_UNLIKELY( err ) ) FD_LOG_ERR(( "failed to read the RSS indirection table of interface %s (%i-%s)", if_name, err, fd_io_strerror( err ) ));
+
+    ulong move_cnt = fd_xdp_rss_rebalance( indir, indir_sz, load, net_tile_cnt, args->rss_balance.tolerance );
+    if( !move_cnt ) continue;
+
+    ulong load_min = ULONG_MAX;
+    ulong load_max = 0UL;
+    for( ulong i=0UL; i<net_tile_cnt; i++ ) {
+      load_min = fd_ulong_min( load_min, load[ i ] );
+      load_max = fd_ulong_max( load_max, load[ i ] );
+    }
+    FD_LOG_NOTICE(( "%smoving %lu of %lu RSS buckets (net tile rx packets per interval: min %lu max %lu)",
+                    args->rss_balance.dry_run ? "dry run: " : "", move_cnt, indir_sz, load_min, load_max ));
+    if( args->rss_balance.dry_run ) continue;
+
+    err = fd_xdp_rss_indir_set( if_name, indir, indir_sz );
+    if( FD_UNLIKELY( err ) ) FD_LOG_ERR(( "failed to update the RSS indirection table of interface %s (%i-%s)", if_name, err, fd_io_strerror( err ) ));
+  }
+}
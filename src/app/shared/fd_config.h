@@ -40,6 +40,12 @@ union fdctl_args {
     uchar * keypair;
   } set_identity;
 
+  struct {
+    long   interval;
+    double tolerance;
+    int    dry_run;
+  } rss_balance;
+
   struct {
     int  parent_pipefd;
     int  monitor;
@@ -256,6 +262,7 @@ struct fd_config {
 
     struct {
       char provider[ 8 ];
+      int  udp_gro;
     } net;
 
     struct {
@@ -328,6 +335,11 @@ struct fd_config {
       uint ack_delay_millis;
       int  retry;
 
+      uint admit_staked_initial_rate;
+      uint admit_unstaked_initial_rate;
+      uint admit_unstaked_source_initial_max;
+      uint admit_staked_stream_rate;
+      uint admit_unstaked_stream_rate;
     } quic;
 
     struct {
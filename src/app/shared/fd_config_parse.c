@@ -304,6 +304,11 @@ fdctl_pod_to_cfg( config_t * config,
   CFG_POP      ( uint,   tiles.quic.idle_timeout_millis                   );
   CFG_POP      ( uint,   tiles.quic.ack_delay_millis                      );
   CFG_POP      ( bool,   tiles.quic.retry                                 );
+  CFG_POP      ( uint,   tiles.quic.admit_staked_initial_rate             );
+  CFG_POP      ( uint,   tiles.quic.admit_unstaked_initial_rate           );
+  CFG_POP      ( uint,   tiles.quic.admit_unstaked_source_initial_max     );
+  CFG_POP      ( uint,   tiles.quic.admit_staked_stream_rate              );
+  CFG_POP      ( uint,   tiles.quic.admit_unstaked_stream_rate            );
 
   CFG_POP      ( uint,   tiles.verify.signature_cache_size                );
   CFG_POP      ( uint,   tiles.verify.receive_buffer_size                 );
@@ -341,6 +346,7 @@ fdctl_pod_to_cfg( config_t * config,
   CFG_POP      ( bool,   development.bootstrap                            );
 
   CFG_POP      ( cstr,   development.net.provider                         );
+  CFG_POP      ( bool,   development.net.udp_gro                          );
 
   CFG_POP      ( bool,   development.netns.enabled                        );
   CFG_POP      ( cstr,   development.netns.interface0                     );
@@ -9,6 +9,92 @@ fd_poh_append( void * poh,
   return poh;
 }
 
+#if FD_SHA256_BATCH_IMPL==2 || (FD_SHA256_BATCH_IMPL==1 && !FD_HAS_SHANI)
+
+void
+fd_poh_append_batch( void * const * poh,
+                     ulong const *  n,
+                     ulong          cnt ) {
+
+  /* Each lane holds the state of one chain, double buffered such that
+     the messages and the hashes of a batch never overlap. */
+
+  uchar lane_state[ FD_SHA256_BATCH_MAX ][ 2 ][ FD_SHA256_HASH_SZ ] __attribute__((aligned(64)));
+  ulong lane_chain[ FD_SHA256_BATCH_MAX ];
+  ulong lane_rem  [ FD_SHA256_BATCH_MAX ];
+  ulong lane_cur  [ FD_SHA256_BATCH_MAX ];
+  ulong lane_cnt = 0UL;
+
+  uchar batch_mem[ FD_SHA256_BATCH_FOOTPRINT ] __attribute__((aligned(FD_SHA256_BATCH_ALIGN)));
+
+  ulong next = 0UL;
+  for(;;) {
+
+    /* Fill idle lanes with pending chains */
+
+    while( lane_cnt<FD_SHA256_BATCH_MAX && next<cnt ) {
+      ulong chain = next++;
+      if( FD_UNLIKELY( !n[ chain ] ) ) continue;
+      memcpy( lane_state[ lane_cnt ][ 0 ], poh[ chain ], FD_SHA256_HASH_SZ );
+      lane_chain[ lane_cnt ] = chain;
+      lane_rem  [ lane_cnt ] = n[ chain ];
+      lane_cur  [ lane_cnt ] = 0UL;
+      lane_cnt++;
+    }
+
+    if( FD_UNLIKELY( lane_cnt<=1UL ) ) break;
+
+    /* Advance all lanes until the shortest chain finishes */
+
+    ulong step = lane_rem[ 0 ];
+    for( ulong l=1UL; l<lane_cnt; l++ ) step = fd_ulong_min( step, lane_rem[ l ] );
+
+    for( ulong s=0UL; s<step; s++ ) {
+      fd_sha256_batch_t * batch = fd_sha256_batch_init( batch_mem );
+      for( ulong l=0UL; l<lane_cnt; l++ ) {
+        ulong cur = lane_cur[ l ];
+        fd_sha256_batch_add( batch, lane_state[ l ][ cur ], FD_SHA256_HASH_SZ, lane_state[ l ][ cur^1UL ] );
+        lane_cur[ l ] = cur^1UL;
+      }
+      fd_sha256_batch_fini( batch );
+    }
+
+    /* Retire finished chains */
+
+    ulong l = 0UL;
+    while( l<lane_cnt ) {
+      lane_rem[ l ] -= step;
+      if( lane_rem[ l ] ) { l++; continue; }
+      memcpy( poh[ lane_chain[ l ] ], lane_state[ l ][ lane_cur[ l ] ], FD_SHA256_HASH_SZ );
+      lane_cnt--;
+      if( l<lane_cnt ) {
+        memcpy( lane_state[ l ], lane_state[ lane_cnt ], sizeof(lane_state[ l ]) );
+        lane_chain[ l ] = lane_chain[ lane_cnt ];
+        lane_rem  [ l ] = lane_rem  [ lane_cnt ];
+        lane_cur  [ l ] = lane_cur  [ lane_cnt ];
+      }
+    }
+  }
+
+  /* Batching a single chain does not pay off */
+
+  if( lane_cnt ) {
+    memcpy( poh[ lane_chain[ 0 ] ], lane_state[ 0 ][ lane_cur[ 0 ] ], FD_SHA256_HASH_SZ );
+    fd_poh_append( poh[ lane_chain[ 0 ] ], lane_rem[ 0 ] );
+  }
+}
+
+#else
+
+void
+fd_poh_append_batch( void * const * poh,
+                     ulong const *  n,
+                     ulong          cnt ) {
+  for( ulong i=0UL; i<cnt; i++ ) fd_poh_append( poh[ i ], n[ i ] );
+}
+
+#endif
+
 void *
 fd_poh_mixin( void *        FD_RESTRICT poh,
               uchar const * FD_RESTRICT mixin ) {
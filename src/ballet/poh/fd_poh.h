@@ -18,6 +18,23 @@ void *
 fd_poh_append( void * poh,
                ulong  n );
 
+/* fd_poh_append_batch performs fd_poh_append( poh[i], n[i] ) for i in
+   [0,cnt).  The cnt poh states are independent hashchains (e.g. the
+   entries of a block being verified, each starting from the hash of the
+   previous entry) and should not overlap.
+
+   Where the target has wide SHA-256 batching (AVX-512, or AVX without
+   SHA extensions), up to FD_SHA256_BATCH_MAX chains are advanced in
+   lockstep through the SHA-256 batch API.  A chain that finishes is
+   replaced by the next pending one, and the last chain standing is
+   finished with fd_poh_append.  Otherwise, this is equivalent to
+   calling fd_poh_append on each chain. */
+
+void
+fd_poh_append_batch( void * const * poh,
+                     ulong const *  n,
+                     ulong          cnt );
+
 /* fd_poh_mixin mixes in a 32-byte value.
 
    poh points to a 32 byte memory region which stores the current poh state
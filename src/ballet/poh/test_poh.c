@@ -81,6 +81,31 @@ test_poh_mixin( void ) {
   }
 }
 
+/* Ensure that fd_poh_append_batch matches fd_poh_append on every chain. */
+static void
+test_poh_append_batch( fd_rng_t * rng ) {
+# define CHAIN_MAX (37UL)
+  uchar  poh   [ CHAIN_MAX ][ FD_SHA256_HASH_SZ ];
+  uchar  want  [ CHAIN_MAX ][ FD_SHA256_HASH_SZ ];
+  void * poh_p [ CHAIN_MAX ];
+  ulong  n     [ CHAIN_MAX ];
+
+  fd_poh_append_batch( NULL, NULL, 0UL );
+
+  for( ulong cnt=1UL; cnt<=CHAIN_MAX; cnt++ ) {
+    for( ulong i=0UL; i<cnt; i++ ) {
+      for( ulong j=0UL; j<FD_SHA256_HASH_SZ; j++ ) poh[ i ][ j ] = fd_rng_uchar( rng );
+      n[ i ] = fd_rng_uint_roll( rng, 4U )==0U ? 0UL : fd_rng_ulong_roll( rng, 2000UL );
+      memcpy( want[ i ], poh[ i ], FD_SHA256_HASH_SZ );
+      fd_poh_append( want[ i ], n[ i ] );
+      poh_p[ i ] = poh[ i ];
+    }
+    fd_poh_append_batch( poh_p, n, cnt );
+    for( ulong i=0UL; i<cnt; i++ ) FD_TEST( !memcmp( poh[ i ], want[ i ], FD_SHA256_HASH_SZ ) );
+  }
+# undef CHAIN_MAX
+}
+
 struct fd_poh_test_step {
   /* mixin: Value to pass to fd_poh_mixin */
   uchar mixin[FD_SHA256_HASH_SZ] __attribute__((aligned(32)));
@@ -189,6 +214,35 @@ bench_poh_sequential( void ) {
   FD_LOG_NOTICE(( "PoH sequential: ~%.3f MH/s", ((double)hashes/secs)/1e6 ));
 }
 
+/* Benchmarks verification-style hashing of many independent chains,
+   such as the ticks of a block (12500 hashes each on mainnet). */
+static void
+bench_poh_batch( void ) {
+# define CHAIN_CNT (64UL)
+  static uchar poh[ CHAIN_CNT ][ FD_SHA256_HASH_SZ ];
+  void * poh_p[ CHAIN_CNT ];
+  ulong  n    [ CHAIN_CNT ];
+  for( ulong i=0UL; i<CHAIN_CNT; i++ ) {
+    poh[ i ][ 0 ] = (uchar)i;
+    poh_p[ i ] = poh[ i ];
+    n    [ i ] = 12500UL;
+  }
+
+  /* warmup */
+  fd_poh_append_batch( poh_p, n, CHAIN_CNT );
+
+  /* for real */
+  ulong iter = 4UL;
+  long dt = fd_log_wallclock();
+  for( ulong rem=iter; rem; rem-- ) fd_poh_append_batch( poh_p, n, CHAIN_CNT );
+  dt = fd_log_wallclock() - dt;
+
+  ulong hashes = iter*CHAIN_CNT*12500UL;
+  double secs = (double)dt / 1e9;
+  FD_LOG_NOTICE(( "PoH batch (%lu chains): ~%.3f MH/s", CHAIN_CNT, ((double)hashes/secs)/1e6 ));
+# undef CHAIN_CNT
+}
+
 int main( int argc,
           char ** argv ) {
   fd_boot( &argc, &argv );
@@ -198,11 +252,16 @@ int main( int argc,
 
   test_poh_mixin();
 
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+  test_poh_append_batch( rng );
+  fd_rng_delete( fd_rng_leave( rng ) );
+
   for( fd_poh_test_vector_t const * v = poh_test_vectors; v->name; v++ ) {
     test_poh_vector( v );
   }
 
   bench_poh_sequential();
+  bench_poh_batch();
 
   FD_LOG_NOTICE(( "pass" ));
   fd_halt();
@@ -57,6 +57,7 @@ typedef struct {
   struct {
     ulong bundle_peer_failure_cnt;
     ulong dedup_fail_cnt;
+    fd_histf_t net_rx_latency[1];
   } metrics;
 } fd_dedup_ctx_t;
 
@@ -77,6 +78,7 @@ static inline void
 metrics_write( fd_dedup_ctx_t * ctx ) {
   FD_MCNT_SET( DEDUP, TRANSACTION_BUNDLE_PEER_FAILURE, ctx->metrics.bundle_peer_failure_cnt );
   FD_MCNT_SET( DEDUP, TRANSACTION_DEDUP_FAILURE,       ctx->metrics.dedup_fail_cnt );
+  FD_MHIST_COPY( DEDUP, NET_RX_LATENCY_SECONDS,        ctx->metrics.net_rx_latency );
 }
 
 /* during_frag is called between pairs for sequence number checks, as
@@ -198,8 +200,15 @@ after_frag( fd_dedup_ctx_t *    ctx,
 
     ctx->metrics.dedup_fail_cnt++;
   } else {
+    /* Transactions from gossip, the voter and bundles carry no RX
+       timestamp */
+    long now = fd_tickcount();
+    if( FD_LIKELY( tsorig ) ) {
+      fd_histf_sample( ctx->metrics.net_rx_latency, (ulong)fd_long_max( now-fd_frag_meta_ts_decomp( tsorig, now ), 0L ) );
+    }
+
     ulong realized_sz = fd_txn_m_realized_footprint( txnm, 1, 0 );
-    ulong tspub = (ulong)fd_frag_meta_ts_comp( fd_tickcount() );
+    ulong tspub = (ulong)fd_frag_meta_ts_comp( now );
     fd_stem_publish( stem, 0UL, 0, ctx->out_chunk, realized_sz, 0UL, tsorig, tspub );
     ctx->out_chunk = fd_dcache_compact_next( ctx->out_chunk, realized_sz, ctx->out_chunk0, ctx->out_wmark );
   }
@@ -230,6 +239,8 @@ unprivileged_init( fd_topo_t *      topo,
   ctx->bundle_idx    = 0UL;
 
   memset( &ctx->metrics, 0, sizeof( ctx->metrics ) );
+  fd_histf_join( fd_histf_new( ctx->metrics.net_rx_latency, FD_MHIST_SECONDS_MIN( DEDUP, NET_RX_LATENCY_SECONDS ),
+                                                            FD_MHIST_SECONDS_MAX( DEDUP, NET_RX_LATENCY_SECONDS ) ) );
 
   ctx->tcache_depth   = fd_tcache_depth       ( tcache );
   ctx->tcache_map_cnt = fd_tcache_map_cnt     ( tcache );
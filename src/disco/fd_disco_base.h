@@ -71,6 +71,16 @@ fd_disco_netmux_sig( uint   hash_ip_addr,
   return (hash<<44) | ((hdr_sz_i&0xFUL)<<40UL) | ((proto&0xFFUL)<<32UL) | ((ulong)dst_ip_addr);
 }
 
+/* fd_disco_netmux_sig_set_hash returns sig with the hash field replaced
+   by the low 20 bits of hash.  Used to steer a packet to a specific
+   consumer (consumers typically filter by hash % consumer_cnt). */
+
+FD_FN_CONST static inline ulong
+fd_disco_netmux_sig_set_hash( ulong sig,
+                              ulong hash ) {
+  return ( sig & ((1UL<<44)-1UL) ) | ( (hash&0xfffffUL)<<44 );
+}
+
 FD_FN_CONST static inline ulong fd_disco_netmux_sig_hash  ( ulong sig ) { return (sig>>44UL); }
 FD_FN_CONST static inline ulong fd_disco_netmux_sig_proto ( ulong sig ) { return (sig>>32UL) & 0xFFUL; }
 FD_FN_CONST static inline uint  fd_disco_netmux_sig_dst_ip( ulong sig ) { return (uint)(sig & 0xFFFFFFFFUL); }
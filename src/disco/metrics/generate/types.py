@@ -25,6 +25,7 @@ class Tile(Enum):
     GOSSIP = 19
     NETLNK = 20
     SOCK = 21
+    SENDER = 22
 
 class MetricType(Enum):
     COUNTER = 0
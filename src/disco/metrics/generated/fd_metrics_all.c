@@ -52,6 +52,7 @@ const char * FD_METRICS_TILE_KIND_NAMES[FD_METRICS_TILE_KIND_CNT] = {
     "gossip",
     "netlnk",
     "sock",
+    "sender",
 };
 
 const ulong FD_METRICS_TILE_KIND_SIZES[FD_METRICS_TILE_KIND_CNT] = {
@@ -71,6 +72,7 @@ const ulong FD_METRICS_TILE_KIND_SIZES[FD_METRICS_TILE_KIND_CNT] = {
     FD_METRICS_GOSSIP_TOTAL,
     FD_METRICS_NETLNK_TOTAL,
     FD_METRICS_SOCK_TOTAL,
+    FD_METRICS_SENDER_TOTAL,
 };
 const fd_metrics_meta_t * FD_METRICS_TILE_KIND_METRICS[FD_METRICS_TILE_KIND_CNT] = {
     FD_METRICS_NET,
@@ -89,4 +91,5 @@ const fd_metrics_meta_t * FD_METRICS_TILE_KIND_METRICS[FD_METRICS_TILE_KIND_CNT]
     FD_METRICS_GOSSIP,
     FD_METRICS_NETLNK,
     FD_METRICS_SOCK,
+    FD_METRICS_SENDER,
 };
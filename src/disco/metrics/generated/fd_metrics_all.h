@@ -15,6 +15,7 @@
 #include "fd_metrics_shred.h"
 #include "fd_metrics_store.h"
 #include "fd_metrics_replay.h"
+#include "fd_metrics_sender.h"
 #include "fd_metrics_storei.h"
 #include "fd_metrics_gossip.h"
 #include "fd_metrics_netlnk.h"
@@ -152,9 +153,9 @@ extern const fd_metrics_meta_t FD_METRICS_ALL_LINK_IN[FD_METRICS_ALL_LINK_IN_TOT
 #define FD_METRICS_ALL_LINK_OUT_TOTAL (1UL)
 extern const fd_metrics_meta_t FD_METRICS_ALL_LINK_OUT[FD_METRICS_ALL_LINK_OUT_TOTAL];
 
-#define FD_METRICS_TOTAL_SZ (8UL*229UL)
+#define FD_METRICS_TOTAL_SZ (8UL*246UL)
 
-#define FD_METRICS_TILE_KIND_CNT 16
+#define FD_METRICS_TILE_KIND_CNT 17
 extern const char * FD_METRICS_TILE_KIND_NAMES[FD_METRICS_TILE_KIND_CNT];
 extern const ulong FD_METRICS_TILE_KIND_SIZES[FD_METRICS_TILE_KIND_CNT];
 extern const fd_metrics_meta_t * FD_METRICS_TILE_KIND_METRICS[FD_METRICS_TILE_KIND_CNT];
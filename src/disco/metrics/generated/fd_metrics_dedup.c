@@ -5,4 +5,5 @@ const fd_metrics_meta_t FD_METRICS_DEDUP[FD_METRICS_DEDUP_TOTAL] = {
     DECLARE_METRIC( DEDUP_TRANSACTION_BUNDLE_PEER_FAILURE, COUNTER ),
     DECLARE_METRIC( DEDUP_TRANSACTION_DEDUP_FAILURE, COUNTER ),
     DECLARE_METRIC( DEDUP_GOSSIPED_VOTES_RECEIVED, COUNTER ),
+    DECLARE_METRIC_HISTOGRAM_SECONDS( DEDUP_NET_RX_LATENCY_SECONDS ),
 };
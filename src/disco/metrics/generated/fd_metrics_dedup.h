@@ -21,5 +21,13 @@
 #define FD_METRICS_COUNTER_DEDUP_GOSSIPED_VOTES_RECEIVED_DESC "Count of simple vote transactions received over gossip instead of via the normal TPU path"
 #define FD_METRICS_COUNTER_DEDUP_GOSSIPED_VOTES_RECEIVED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_DEDUP_TOTAL (3UL)
+#define FD_METRICS_HISTOGRAM_DEDUP_NET_RX_LATENCY_SECONDS_OFF  (19UL)
+#define FD_METRICS_HISTOGRAM_DEDUP_NET_RX_LATENCY_SECONDS_NAME "dedup_net_rx_latency_seconds"
+#define FD_METRICS_HISTOGRAM_DEDUP_NET_RX_LATENCY_SECONDS_TYPE (FD_METRICS_TYPE_HISTOGRAM)
+#define FD_METRICS_HISTOGRAM_DEDUP_NET_RX_LATENCY_SECONDS_DESC "Time from a net tile reading the first packet of a transaction off the NIC until the transaction passed deduplication"
+#define FD_METRICS_HISTOGRAM_DEDUP_NET_RX_LATENCY_SECONDS_CVT  (FD_METRICS_CONVERTER_SECONDS)
+#define FD_METRICS_HISTOGRAM_DEDUP_NET_RX_LATENCY_SECONDS_MIN  (1e-06)
+#define FD_METRICS_HISTOGRAM_DEDUP_NET_RX_LATENCY_SECONDS_MAX  (0.1)
+
+#define FD_METRICS_DEDUP_TOTAL (4UL)
 extern const fd_metrics_meta_t FD_METRICS_DEDUP[FD_METRICS_DEDUP_TOTAL];
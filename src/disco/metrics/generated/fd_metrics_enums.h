@@ -28,6 +28,13 @@
 #define FD_METRICS_ENUM_TPU_RECV_TYPE_V_QUIC_FRAG_IDX  2
 #define FD_METRICS_ENUM_TPU_RECV_TYPE_V_QUIC_FRAG_NAME "quic_frag"
 
+#define FD_METRICS_ENUM_TPU_ADMIT_CLASS_NAME "tpu_admit_class"
+#define FD_METRICS_ENUM_TPU_ADMIT_CLASS_CNT (2UL)
+#define FD_METRICS_ENUM_TPU_ADMIT_CLASS_V_STAKED_IDX  0
+#define FD_METRICS_ENUM_TPU_ADMIT_CLASS_V_STAKED_NAME "staked"
+#define FD_METRICS_ENUM_TPU_ADMIT_CLASS_V_UNSTAKED_IDX  1
+#define FD_METRICS_ENUM_TPU_ADMIT_CLASS_V_UNSTAKED_NAME "unstaked"
+
 #define FD_METRICS_ENUM_QUIC_FRAME_TYPE_NAME "quic_frame_type"
 #define FD_METRICS_ENUM_QUIC_FRAME_TYPE_CNT (22UL)
 #define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_UNKNOWN_IDX  0
@@ -9,6 +9,7 @@ const fd_metrics_meta_t FD_METRICS_NET[FD_METRICS_NET_TOTAL] = {
     DECLARE_METRIC( NET_RX_BACKPRESSURE_CNT, COUNTER ),
     DECLARE_METRIC( NET_RX_BUSY_CNT, GAUGE ),
     DECLARE_METRIC( NET_RX_IDLE_CNT, GAUGE ),
+    DECLARE_METRIC_HISTOGRAM_NONE( NET_RX_BACKLOG_CNT ),
     DECLARE_METRIC( NET_TX_SUBMIT_CNT, COUNTER ),
     DECLARE_METRIC( NET_TX_COMPLETE_CNT, COUNTER ),
     DECLARE_METRIC( NET_TX_BYTES_TOTAL, COUNTER ),
@@ -15,4 +15,7 @@ const fd_metrics_meta_t FD_METRICS_NETLNK[FD_METRICS_NETLNK_TOTAL] = {
     DECLARE_METRIC( NETLNK_NEIGH_PROBE_FAILS, COUNTER ),
     DECLARE_METRIC( NETLNK_NEIGH_PROBE_RATE_LIMIT_HOST, COUNTER ),
     DECLARE_METRIC( NETLNK_NEIGH_PROBE_RATE_LIMIT_GLOBAL, COUNTER ),
+    DECLARE_METRIC( NETLNK_NEIGH_TX_MISSES, COUNTER ),
+    DECLARE_METRIC( NETLNK_NEIGH_PREFETCH_LOOKUPS, COUNTER ),
+    DECLARE_METRIC( NETLNK_NEIGH_PREFETCH_PROBES, COUNTER ),
 };
@@ -72,5 +72,23 @@
 #define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_RATE_LIMIT_GLOBAL_DESC "Number of neighbor solicit that exceeded the global rate limit"
 #define FD_METRICS_COUNTER_NETLNK_NEIGH_PROBE_RATE_LIMIT_GLOBAL_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_NETLNK_TOTAL (13UL)
+#define FD_METRICS_COUNTER_NETLNK_NEIGH_TX_MISSES_OFF  (29UL)
+#define FD_METRICS_COUNTER_NETLNK_NEIGH_TX_MISSES_NAME "netlnk_neigh_tx_misses"
+#define FD_METRICS_COUNTER_NETLNK_NEIGH_TX_MISSES_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_NETLNK_NEIGH_TX_MISSES_DESC "Number of neighbor table misses reported by net tiles on the TX path"
+#define FD_METRICS_COUNTER_NETLNK_NEIGH_TX_MISSES_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_NETLNK_NEIGH_PREFETCH_LOOKUPS_OFF  (30UL)
+#define FD_METRICS_COUNTER_NETLNK_NEIGH_PREFETCH_LOOKUPS_NAME "netlnk_neigh_prefetch_lookups"
+#define FD_METRICS_COUNTER_NETLNK_NEIGH_PREFETCH_LOOKUPS_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_NETLNK_NEIGH_PREFETCH_LOOKUPS_DESC "Number of cluster peer addresses checked by neighbor prefetch"
+#define FD_METRICS_COUNTER_NETLNK_NEIGH_PREFETCH_LOOKUPS_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_NETLNK_NEIGH_PREFETCH_PROBES_OFF  (31UL)
+#define FD_METRICS_COUNTER_NETLNK_NEIGH_PREFETCH_PROBES_NAME "netlnk_neigh_prefetch_probes"
+#define FD_METRICS_COUNTER_NETLNK_NEIGH_PREFETCH_PROBES_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_NETLNK_NEIGH_PREFETCH_PROBES_DESC "Number of neighbor solicit requests sent by prefetch ahead of TX"
+#define FD_METRICS_COUNTER_NETLNK_NEIGH_PREFETCH_PROBES_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_NETLNK_TOTAL (16UL)
 extern const fd_metrics_meta_t FD_METRICS_NETLNK[FD_METRICS_NETLNK_TOTAL];
@@ -63,6 +63,7 @@ const fd_metrics_meta_t FD_METRICS_QUIC[FD_METRICS_QUIC_TOTAL] = {
     DECLARE_METRIC_ENUM( QUIC_ACK_TX, COUNTER, QUIC_ACK_TX, CANCEL ),
     DECLARE_METRIC_HISTOGRAM_SECONDS( QUIC_SERVICE_DURATION_SECONDS ),
     DECLARE_METRIC_HISTOGRAM_SECONDS( QUIC_RECEIVE_DURATION_SECONDS ),
+    DECLARE_METRIC_HISTOGRAM_SECONDS( QUIC_NET_RX_LATENCY_SECONDS ),
     DECLARE_METRIC( QUIC_FRAME_FAIL_PARSE, COUNTER ),
     DECLARE_METRIC_ENUM( QUIC_PKT_CRYPTO_FAILED, COUNTER, QUIC_ENC_LEVEL, INITIAL ),
     DECLARE_METRIC_ENUM( QUIC_PKT_CRYPTO_FAILED, COUNTER, QUIC_ENC_LEVEL, EARLY ),
@@ -78,4 +79,15 @@ const fd_metrics_meta_t FD_METRICS_QUIC[FD_METRICS_QUIC_TOTAL] = {
     DECLARE_METRIC( QUIC_PKT_OVERSZ, COUNTER ),
     DECLARE_METRIC( QUIC_PKT_VERNEG, COUNTER ),
     DECLARE_METRIC( QUIC_RETRY_SENT, COUNTER ),
+    DECLARE_METRIC( QUIC_HANDSHAKE_BACKLOG, GAUGE ),
+    DECLARE_METRIC( QUIC_HANDSHAKE_BACKLOG_DROPPED, COUNTER ),
+    DECLARE_METRIC( QUIC_ADMIT_STAKED_PEERS, GAUGE ),
+    DECLARE_METRIC_ENUM( QUIC_ADMIT_INITIAL_ACCEPTED, COUNTER, TPU_ADMIT_CLASS, STAKED ),
+    DECLARE_METRIC_ENUM( QUIC_ADMIT_INITIAL_ACCEPTED, COUNTER, TPU_ADMIT_CLASS, UNSTAKED ),
+    DECLARE_METRIC_ENUM( QUIC_ADMIT_INITIAL_THROTTLED, COUNTER, TPU_ADMIT_CLASS, STAKED ),
+    DECLARE_METRIC_ENUM( QUIC_ADMIT_INITIAL_THROTTLED, COUNTER, TPU_ADMIT_CLASS, UNSTAKED ),
+    DECLARE_METRIC_ENUM( QUIC_ADMIT_STREAMS_ACCEPTED, COUNTER, TPU_ADMIT_CLASS, STAKED ),
+    DECLARE_METRIC_ENUM( QUIC_ADMIT_STREAMS_ACCEPTED, COUNTER, TPU_ADMIT_CLASS, UNSTAKED ),
+    DECLARE_METRIC_ENUM( QUIC_ADMIT_STREAMS_THROTTLED, COUNTER, TPU_ADMIT_CLASS, STAKED ),
+    DECLARE_METRIC_ENUM( QUIC_ADMIT_STREAMS_THROTTLED, COUNTER, TPU_ADMIT_CLASS, UNSTAKED ),
 };
@@ -247,71 +247,137 @@
 #define FD_METRICS_HISTOGRAM_QUIC_RECEIVE_DURATION_SECONDS_MIN  (1e-08)
 #define FD_METRICS_HISTOGRAM_QUIC_RECEIVE_DURATION_SECONDS_MAX  (0.1)
 
-#define FD_METRICS_COUNTER_QUIC_FRAME_FAIL_PARSE_OFF  (109UL)
+#define FD_METRICS_HISTOGRAM_QUIC_NET_RX_LATENCY_SECONDS_OFF  (109UL)
+#define FD_METRICS_HISTOGRAM_QUIC_NET_RX_LATENCY_SECONDS_NAME "quic_net_rx_latency_seconds"
+#define FD_METRICS_HISTOGRAM_QUIC_NET_RX_LATENCY_SECONDS_TYPE (FD_METRICS_TYPE_HISTOGRAM)
+#define FD_METRICS_HISTOGRAM_QUIC_NET_RX_LATENCY_SECONDS_DESC "Time from a net tile reading the first packet of a transaction off the NIC until the transaction was passed on to verify"
+#define FD_METRICS_HISTOGRAM_QUIC_NET_RX_LATENCY_SECONDS_CVT  (FD_METRICS_CONVERTER_SECONDS)
+#define FD_METRICS_HISTOGRAM_QUIC_NET_RX_LATENCY_SECONDS_MIN  (1e-06)
+#define FD_METRICS_HISTOGRAM_QUIC_NET_RX_LATENCY_SECONDS_MAX  (0.1)
+
+#define FD_METRICS_COUNTER_QUIC_FRAME_FAIL_PARSE_OFF  (126UL)
 #define FD_METRICS_COUNTER_QUIC_FRAME_FAIL_PARSE_NAME "quic_frame_fail_parse"
 #define FD_METRICS_COUNTER_QUIC_FRAME_FAIL_PARSE_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_FRAME_FAIL_PARSE_DESC "Number of QUIC frames failed to parse."
 #define FD_METRICS_COUNTER_QUIC_FRAME_FAIL_PARSE_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_OFF  (110UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_OFF  (127UL)
 #define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_NAME "quic_pkt_crypto_failed"
 #define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_DESC "Number of packets that failed decryption."
 #define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_CNT  (4UL)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_INITIAL_OFF (110UL)
-#define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_EARLY_OFF (111UL)
-#define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_HANDSHAKE_OFF (112UL)
-#define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_APP_OFF (113UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_INITIAL_OFF (127UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_EARLY_OFF (128UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_HANDSHAKE_OFF (129UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_CRYPTO_FAILED_APP_OFF (130UL)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_OFF  (114UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_OFF  (131UL)
 #define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_NAME "quic_pkt_no_key"
 #define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_DESC "Number of packets that failed decryption due to missing key."
 #define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_CNT  (4UL)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_INITIAL_OFF (114UL)
-#define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_EARLY_OFF (115UL)
-#define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_HANDSHAKE_OFF (116UL)
-#define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_APP_OFF (117UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_INITIAL_OFF (131UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_EARLY_OFF (132UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_HANDSHAKE_OFF (133UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_NO_KEY_APP_OFF (134UL)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_NET_HEADER_INVALID_OFF  (118UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_NET_HEADER_INVALID_OFF  (135UL)
 #define FD_METRICS_COUNTER_QUIC_PKT_NET_HEADER_INVALID_NAME "quic_pkt_net_header_invalid"
 #define FD_METRICS_COUNTER_QUIC_PKT_NET_HEADER_INVALID_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_PKT_NET_HEADER_INVALID_DESC "Number of packets dropped due to weird IP or UDP header."
 #define FD_METRICS_COUNTER_QUIC_PKT_NET_HEADER_INVALID_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_QUIC_HEADER_INVALID_OFF  (119UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_QUIC_HEADER_INVALID_OFF  (136UL)
 #define FD_METRICS_COUNTER_QUIC_PKT_QUIC_HEADER_INVALID_NAME "quic_pkt_quic_header_invalid"
 #define FD_METRICS_COUNTER_QUIC_PKT_QUIC_HEADER_INVALID_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_PKT_QUIC_HEADER_INVALID_DESC "Number of packets dropped due to weird QUIC header."
 #define FD_METRICS_COUNTER_QUIC_PKT_QUIC_HEADER_INVALID_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_UNDERSZ_OFF  (120UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_UNDERSZ_OFF  (137UL)
 #define FD_METRICS_COUNTER_QUIC_PKT_UNDERSZ_NAME "quic_pkt_undersz"
 #define FD_METRICS_COUNTER_QUIC_PKT_UNDERSZ_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_PKT_UNDERSZ_DESC "Number of QUIC packets dropped due to being too small."
 #define FD_METRICS_COUNTER_QUIC_PKT_UNDERSZ_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_OVERSZ_OFF  (121UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_OVERSZ_OFF  (138UL)
 #define FD_METRICS_COUNTER_QUIC_PKT_OVERSZ_NAME "quic_pkt_oversz"
 #define FD_METRICS_COUNTER_QUIC_PKT_OVERSZ_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_PKT_OVERSZ_DESC "Number of QUIC packets dropped due to being too large."
 #define FD_METRICS_COUNTER_QUIC_PKT_OVERSZ_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_PKT_VERNEG_OFF  (122UL)
+#define FD_METRICS_COUNTER_QUIC_PKT_VERNEG_OFF  (139UL)
 #define FD_METRICS_COUNTER_QUIC_PKT_VERNEG_NAME "quic_pkt_verneg"
 #define FD_METRICS_COUNTER_QUIC_PKT_VERNEG_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_PKT_VERNEG_DESC "Number of QUIC version negotiation packets received."
 #define FD_METRICS_COUNTER_QUIC_PKT_VERNEG_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_QUIC_RETRY_SENT_OFF  (123UL)
+#define FD_METRICS_COUNTER_QUIC_RETRY_SENT_OFF  (140UL)
 #define FD_METRICS_COUNTER_QUIC_RETRY_SENT_NAME "quic_retry_sent"
 #define FD_METRICS_COUNTER_QUIC_RETRY_SENT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_QUIC_RETRY_SENT_DESC "Number of QUIC Retry packets sent."
 #define FD_METRICS_COUNTER_QUIC_RETRY_SENT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_QUIC_TOTAL (76UL)
+#define FD_METRICS_GAUGE_QUIC_HANDSHAKE_BACKLOG_OFF  (141UL)
+#define FD_METRICS_GAUGE_QUIC_HANDSHAKE_BACKLOG_NAME "quic_handshake_backlog"
+#define FD_METRICS_GAUGE_QUIC_HANDSHAKE_BACKLOG_TYPE (FD_METRICS_TYPE_GAUGE)
+#define FD_METRICS_GAUGE_QUIC_HANDSHAKE_BACKLOG_DESC "Number of QUIC Initial (handshake) packets waiting to be processed."
+#define FD_METRICS_GAUGE_QUIC_HANDSHAKE_BACKLOG_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_QUIC_HANDSHAKE_BACKLOG_DROPPED_OFF  (142UL)
+#define FD_METRICS_COUNTER_QUIC_HANDSHAKE_BACKLOG_DROPPED_NAME "quic_handshake_backlog_dropped"
+#define FD_METRICS_COUNTER_QUIC_HANDSHAKE_BACKLOG_DROPPED_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_QUIC_HANDSHAKE_BACKLOG_DROPPED_DESC "Number of QUIC Initial (handshake) packets dropped because the handshake backlog was full."
+#define FD_METRICS_COUNTER_QUIC_HANDSHAKE_BACKLOG_DROPPED_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_GAUGE_QUIC_ADMIT_STAKED_PEERS_OFF  (143UL)
+#define FD_METRICS_GAUGE_QUIC_ADMIT_STAKED_PEERS_NAME "quic_admit_staked_peers"
+#define FD_METRICS_GAUGE_QUIC_ADMIT_STAKED_PEERS_TYPE (FD_METRICS_TYPE_GAUGE)
+#define FD_METRICS_GAUGE_QUIC_ADMIT_STAKED_PEERS_DESC "Number of staked peers with a known IP address."
+#define FD_METRICS_GAUGE_QUIC_ADMIT_STAKED_PEERS_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_QUIC_ADMIT_INITIAL_ACCEPTED_OFF  (144UL)
+#define FD_METRICS_COUNTER_QUIC_ADMIT_INITIAL_ACCEPTED_NAME "quic_admit_initial_accepted"
+#define FD_METRICS_COUNTER_QUIC_ADMIT_INITIAL_ACCEPTED_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_QUIC_ADMIT_INITIAL_ACCEPTED_DESC "Number of QUIC Initial packets accepted by stake-weighted admission control."
+#define FD_METRICS_COUNTER_QUIC_ADMIT_INITIAL_ACCEPTED_CVT  (FD_METRICS_CONVERTER_NONE)
+#define FD_METRICS_COUNTER_QUIC_ADMIT_INITIAL_ACCEPTED_CNT  (2UL)
+
+#define FD_METRICS_COUNTER_QUIC_ADMIT_INITIAL_ACCEPTED_STAKED_OFF (144UL)
+#define FD_METRICS_COUNTER_QUIC_ADMIT_INITIAL_ACCEPTED_UNSTAKED_OFF (145UL)
+
+#define FD_METRICS_COUNTER_QUIC_ADMIT_INITIAL_THROTTLED_OFF  (146UL)
+#define FD_METRICS_COUNTER_QUIC_ADMIT_INITIAL_THROTTLED_NAME "quic_admit_initial_throttled"
+#define FD_METRICS_COUNTER_QUIC_ADMIT_INITIAL_THROTTLED_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_QUIC_ADMIT_INITIAL_THROTTLED_DESC "Number of QUIC Initial packets dropped by stake-weighted admission control."
+#define FD_METRICS_COUNTER_QUIC_ADMIT_INITIAL_THROTTLED_CVT  (FD_METRICS_CONVERTER_NONE)
+#define FD_METRICS_COUNTER_QUIC_ADMIT_INITIAL_THROTTLED_CNT  (2UL)
+
+#define FD_METRICS_COUNTER_QUIC_ADMIT_INITIAL_THROTTLED_STAKED_OFF (146UL)
+#define FD_METRICS_COUNTER_QUIC_ADMIT_INITIAL_THROTTLED_UNSTAKED_OFF (147UL)
+
+#define FD_METRICS_COUNTER_QUIC_ADMIT_STREAMS_ACCEPTED_OFF  (148UL)
+#define FD_METRICS_COUNTER_QUIC_ADMIT_STREAMS_ACCEPTED_NAME "quic_admit_streams_accepted"
+#define FD_METRICS_COUNTER_QUIC_ADMIT_STREAMS_ACCEPTED_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_QUIC_ADMIT_STREAMS_ACCEPTED_DESC "Number of txn streams accepted by stake-weighted admission control."
+#define FD_METRICS_COUNTER_QUIC_ADMIT_STREAMS_ACCEPTED_CVT  (FD_METRICS_CONVERTER_NONE)
+#define FD_METRICS_COUNTER_QUIC_ADMIT_STREAMS_ACCEPTED_CNT  (2UL)
+
+#define FD_METRICS_COUNTER_QUIC_ADMIT_STREAMS_ACCEPTED_STAKED_OFF (148UL)
+#define FD_METRICS_COUNTER_QUIC_ADMIT_STREAMS_ACCEPTED_UNSTAKED_OFF (149UL)
+
+#define FD_METRICS_COUNTER_QUIC_ADMIT_STREAMS_THROTTLED_OFF  (150UL)
+#define FD_METRICS_COUNTER_QUIC_ADMIT_STREAMS_THROTTLED_NAME "quic_admit_streams_throttled"
+#define FD_METRICS_COUNTER_QUIC_ADMIT_STREAMS_THROTTLED_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_QUIC_ADMIT_STREAMS_THROTTLED_DESC "Number of txn streams dropped by stake-weighted admission control."
+#define FD_METRICS_COUNTER_QUIC_ADMIT_STREAMS_THROTTLED_CVT  (FD_METRICS_CONVERTER_NONE)
+#define FD_METRICS_COUNTER_QUIC_ADMIT_STREAMS_THROTTLED_CNT  (2UL)
+
+#define FD_METRICS_COUNTER_QUIC_ADMIT_STREAMS_THROTTLED_STAKED_OFF (150UL)
+#define FD_METRICS_COUNTER_QUIC_ADMIT_STREAMS_THROTTLED_UNSTAKED_OFF (151UL)
+
+#define FD_METRICS_QUIC_TOTAL (88UL)
 extern const fd_metrics_meta_t FD_METRICS_QUIC[FD_METRICS_QUIC_TOTAL];
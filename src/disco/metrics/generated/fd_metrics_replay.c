@@ -4,4 +4,5 @@
 const fd_metrics_meta_t FD_METRICS_REPLAY[FD_METRICS_REPLAY_TOTAL] = {
     DECLARE_METRIC( REPLAY_SLOT, GAUGE ),
     DECLARE_METRIC( REPLAY_LAST_VOTED_SLOT, GAUGE ),
+    DECLARE_METRIC_HISTOGRAM_SECONDS( REPLAY_REWARDS_DISTRIBUTION_DURATION_SECONDS ),
 };
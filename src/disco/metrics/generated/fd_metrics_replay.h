@@ -15,5 +15,13 @@
 #define FD_METRICS_GAUGE_REPLAY_LAST_VOTED_SLOT_DESC ""
 #define FD_METRICS_GAUGE_REPLAY_LAST_VOTED_SLOT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_REPLAY_TOTAL (2UL)
+#define FD_METRICS_HISTOGRAM_REPLAY_REWARDS_DISTRIBUTION_DURATION_SECONDS_OFF  (18UL)
+#define FD_METRICS_HISTOGRAM_REPLAY_REWARDS_DISTRIBUTION_DURATION_SECONDS_NAME "replay_rewards_distribution_duration_seconds"
+#define FD_METRICS_HISTOGRAM_REPLAY_REWARDS_DISTRIBUTION_DURATION_SECONDS_TYPE (FD_METRICS_TYPE_HISTOGRAM)
+#define FD_METRICS_HISTOGRAM_REPLAY_REWARDS_DISTRIBUTION_DURATION_SECONDS_DESC "Duration of distributing the partitioned epoch rewards of one slot in the reward interval"
+#define FD_METRICS_HISTOGRAM_REPLAY_REWARDS_DISTRIBUTION_DURATION_SECONDS_CVT  (FD_METRICS_CONVERTER_SECONDS)
+#define FD_METRICS_HISTOGRAM_REPLAY_REWARDS_DISTRIBUTION_DURATION_SECONDS_MIN  (0.0001)
+#define FD_METRICS_HISTOGRAM_REPLAY_REWARDS_DISTRIBUTION_DURATION_SECONDS_MAX  (1.0)
+
+#define FD_METRICS_REPLAY_TOTAL (3UL)
 extern const fd_metrics_meta_t FD_METRICS_REPLAY[FD_METRICS_REPLAY_TOTAL];
@@ -0,0 +1,10 @@
+/* THIS FILE IS GENERATED BY gen_metrics.py. DO NOT HAND EDIT. */
+#include "fd_metrics_sender.h"
+
+const fd_metrics_meta_t FD_METRICS_SENDER[FD_METRICS_SENDER_TOTAL] = {
+    DECLARE_METRIC( SENDER_VOTE_TXN_SENT, COUNTER ),
+    DECLARE_METRIC( SENDER_VOTE_TXN_NO_LEADER, COUNTER ),
+    DECLARE_METRIC( SENDER_LEADER_CONTACT_MISSING, COUNTER ),
+    DECLARE_METRIC( SENDER_LEADER_CACHE_REFRESHED, COUNTER ),
+    DECLARE_METRIC( SENDER_LEADER_CACHE_SIZE, GAUGE ),
+};
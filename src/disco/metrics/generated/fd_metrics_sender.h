@@ -0,0 +1,37 @@
+/* THIS FILE IS GENERATED BY gen_metrics.py. DO NOT HAND EDIT. */
+
+#include "../fd_metrics_base.h"
+#include "fd_metrics_enums.h"
+
+#define FD_METRICS_COUNTER_SENDER_VOTE_TXN_SENT_OFF  (16UL)
+#define FD_METRICS_COUNTER_SENDER_VOTE_TXN_SENT_NAME "sender_vote_txn_sent"
+#define FD_METRICS_COUNTER_SENDER_VOTE_TXN_SENT_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_SENDER_VOTE_TXN_SENT_DESC "Number of vote txn packets sent to upcoming leaders."
+#define FD_METRICS_COUNTER_SENDER_VOTE_TXN_SENT_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_SENDER_VOTE_TXN_NO_LEADER_OFF  (17UL)
+#define FD_METRICS_COUNTER_SENDER_VOTE_TXN_NO_LEADER_NAME "sender_vote_txn_no_leader"
+#define FD_METRICS_COUNTER_SENDER_VOTE_TXN_NO_LEADER_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_SENDER_VOTE_TXN_NO_LEADER_DESC "Number of vote txns not sent to any leader, because the leader schedule or leader contact info was unknown."
+#define FD_METRICS_COUNTER_SENDER_VOTE_TXN_NO_LEADER_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_SENDER_LEADER_CONTACT_MISSING_OFF  (18UL)
+#define FD_METRICS_COUNTER_SENDER_LEADER_CONTACT_MISSING_NAME "sender_leader_contact_missing"
+#define FD_METRICS_COUNTER_SENDER_LEADER_CONTACT_MISSING_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_SENDER_LEADER_CONTACT_MISSING_DESC "Number of upcoming leaders skipped because their TPU vote address was unknown."
+#define FD_METRICS_COUNTER_SENDER_LEADER_CONTACT_MISSING_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_SENDER_LEADER_CACHE_REFRESHED_OFF  (19UL)
+#define FD_METRICS_COUNTER_SENDER_LEADER_CACHE_REFRESHED_NAME "sender_leader_cache_refreshed"
+#define FD_METRICS_COUNTER_SENDER_LEADER_CACHE_REFRESHED_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_SENDER_LEADER_CACHE_REFRESHED_DESC "Number of times the upcoming leader address cache was rebuilt."
+#define FD_METRICS_COUNTER_SENDER_LEADER_CACHE_REFRESHED_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_GAUGE_SENDER_LEADER_CACHE_SIZE_OFF  (20UL)
+#define FD_METRICS_GAUGE_SENDER_LEADER_CACHE_SIZE_NAME "sender_leader_cache_size"
+#define FD_METRICS_GAUGE_SENDER_LEADER_CACHE_SIZE_TYPE (FD_METRICS_TYPE_GAUGE)
+#define FD_METRICS_GAUGE_SENDER_LEADER_CACHE_SIZE_DESC "Number of upcoming leaders with a known TPU vote address."
+#define FD_METRICS_GAUGE_SENDER_LEADER_CACHE_SIZE_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_SENDER_TOTAL (5UL)
+extern const fd_metrics_meta_t FD_METRICS_SENDER[FD_METRICS_SENDER_TOTAL];
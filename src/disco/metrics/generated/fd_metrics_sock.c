@@ -7,4 +7,6 @@ const fd_metrics_meta_t FD_METRICS_SOCK[FD_METRICS_SOCK_TOTAL] = {
     DECLARE_METRIC( SOCK_RX_PKT_CNT, COUNTER ),
     DECLARE_METRIC( SOCK_TX_PKT_CNT, COUNTER ),
     DECLARE_METRIC( SOCK_TX_DROP_CNT, COUNTER ),
+    DECLARE_METRIC( SOCK_RX_GRO_MSG_CNT, COUNTER ),
+    DECLARE_METRIC( SOCK_RX_DROP_CNT, COUNTER ),
 };
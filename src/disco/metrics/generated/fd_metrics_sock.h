@@ -33,5 +33,17 @@
 #define FD_METRICS_COUNTER_SOCK_TX_DROP_CNT_DESC "Number of packets failed to send"
 #define FD_METRICS_COUNTER_SOCK_TX_DROP_CNT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_SOCK_TOTAL (5UL)
+#define FD_METRICS_COUNTER_SOCK_RX_GRO_MSG_CNT_OFF  (21UL)
+#define FD_METRICS_COUNTER_SOCK_RX_GRO_MSG_CNT_NAME "sock_rx_gro_msg_cnt"
+#define FD_METRICS_COUNTER_SOCK_RX_GRO_MSG_CNT_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_SOCK_RX_GRO_MSG_CNT_DESC "Number of coalesced UDP_GRO messages received (only with development.net.udp_gro)"
+#define FD_METRICS_COUNTER_SOCK_RX_GRO_MSG_CNT_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_SOCK_RX_DROP_CNT_OFF  (22UL)
+#define FD_METRICS_COUNTER_SOCK_RX_DROP_CNT_NAME "sock_rx_drop_cnt"
+#define FD_METRICS_COUNTER_SOCK_RX_DROP_CNT_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_SOCK_RX_DROP_CNT_DESC "Number of received packets dropped because they exceeded the MTU"
+#define FD_METRICS_COUNTER_SOCK_RX_DROP_CNT_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_SOCK_TOTAL (7UL)
 extern const fd_metrics_meta_t FD_METRICS_SOCK[FD_METRICS_SOCK_TOTAL];
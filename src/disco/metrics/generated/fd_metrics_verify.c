@@ -6,4 +6,5 @@ const fd_metrics_meta_t FD_METRICS_VERIFY[FD_METRICS_VERIFY_TOTAL] = {
     DECLARE_METRIC( VERIFY_TRANSACTION_PARSE_FAILURE, COUNTER ),
     DECLARE_METRIC( VERIFY_TRANSACTION_DEDUP_FAILURE, COUNTER ),
     DECLARE_METRIC( VERIFY_TRANSACTION_VERIFY_FAILURE, COUNTER ),
+    DECLARE_METRIC_HISTOGRAM_SECONDS( VERIFY_NET_RX_LATENCY_SECONDS ),
 };
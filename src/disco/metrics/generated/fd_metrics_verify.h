@@ -27,5 +27,13 @@
 #define FD_METRICS_COUNTER_VERIFY_TRANSACTION_VERIFY_FAILURE_DESC "Count of transactions that failed to deduplicate in the verify stage"
 #define FD_METRICS_COUNTER_VERIFY_TRANSACTION_VERIFY_FAILURE_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_VERIFY_TOTAL (4UL)
+#define FD_METRICS_HISTOGRAM_VERIFY_NET_RX_LATENCY_SECONDS_OFF  (20UL)
+#define FD_METRICS_HISTOGRAM_VERIFY_NET_RX_LATENCY_SECONDS_NAME "verify_net_rx_latency_seconds"
+#define FD_METRICS_HISTOGRAM_VERIFY_NET_RX_LATENCY_SECONDS_TYPE (FD_METRICS_TYPE_HISTOGRAM)
+#define FD_METRICS_HISTOGRAM_VERIFY_NET_RX_LATENCY_SECONDS_DESC "Time from a net tile reading the first packet of a transaction off the NIC until the transaction passed verification"
+#define FD_METRICS_HISTOGRAM_VERIFY_NET_RX_LATENCY_SECONDS_CVT  (FD_METRICS_CONVERTER_SECONDS)
+#define FD_METRICS_HISTOGRAM_VERIFY_NET_RX_LATENCY_SECONDS_MIN  (1e-06)
+#define FD_METRICS_HISTOGRAM_VERIFY_NET_RX_LATENCY_SECONDS_MAX  (0.1)
+
+#define FD_METRICS_VERIFY_TOTAL (5UL)
 extern const fd_metrics_meta_t FD_METRICS_VERIFY[FD_METRICS_VERIFY_TOTAL];
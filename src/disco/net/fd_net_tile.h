@@ -6,10 +6,41 @@
 
 #include "../fd_disco_base.h"
 #include "../../tango/dcache/fd_dcache.h"
+#include "../../waltz/quic/fd_quic_conn_id.h"
 
 struct fd_topo;
 typedef struct fd_topo fd_topo_t;
 
+/* Helpers for producers of net tile RX packets */
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_net_rx_sig returns the netmux sig of an incoming UDP packet.
+   Consumers partition RX packets by the sig hash field.  By default,
+   the hash is derived from the UDP src flow.  QUIC packets whose dest
+   conn ID was issued by a sharded fd_quic instance are instead steered
+   to the quic tile owning the conn (the hash field is set to the shard
+   index, see fd_quic_pkt_shard), such that conns stay on the same quic
+   tile even if the peer's address changes.  payload points to the UDP
+   payload of payload_sz bytes. */
+
+static inline ulong
+fd_net_rx_sig( uint          src_ip_addr,
+               ushort        src_port,
+               ulong         proto,
+               ulong         hdr_sz,
+               uchar const * payload,
+               ulong         payload_sz ) {
+  ulong sig = fd_disco_netmux_sig( src_ip_addr, src_port, 0U, proto, hdr_sz );
+  if( proto==DST_PROTO_TPU_QUIC ) {
+    ulong shard = fd_quic_pkt_shard( payload, payload_sz );
+    if( shard!=ULONG_MAX ) sig = fd_disco_netmux_sig_set_hash( sig, shard );
+  }
+  return sig;
+}
+
+FD_PROTOTYPES_END
+
 /* Helpers for consumers of net tile RX packets */
 
 struct fd_net_rx_bounds {
@@ -80,6 +111,7 @@ FD_PROTOTYPES_BEGIN
                        ulong            xdp_tx_queue_size,
                        int              xdp_zero_copy,
                        char const *     xdp_mode,
+                       int              sock_udp_gro,
                        ulong const      tile_to_cpu[ FD_TILE_MAX ] );
 
 /* fd_topos_net_rx_link is like fd_topob_link, but for net->app tile
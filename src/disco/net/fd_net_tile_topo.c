@@ -56,9 +56,11 @@ setup_xdp_tile( fd_topo_t *      topo,
 
 static void
 setup_sock_tile( fd_topo_t *   topo,
-                 ulong const * tile_to_cpu ) {
+                 ulong const * tile_to_cpu,
+                 int           udp_gro ) {
   fd_topo_tile_t * tile = fd_topob_tile( topo, "sock", "sock", "metric_in", tile_to_cpu[ topo->tile_cnt ], 0, 0 );
   strcpy( tile->net.provider, "socket" );
+  tile->net.sock_udp_gro = !!udp_gro;
 }
 
 void
@@ -73,6 +75,7 @@ fd_topos_net_tiles( fd_topo_t *  topo,
                     ulong        xdp_tx_queue_size,
                     int          xdp_zero_copy,
                     char const * xdp_mode,
+                    int          sock_udp_gro,
                     ulong const  tile_to_cpu[ FD_TILE_MAX ] ) {
   /* net_umem: Packet buffers */
   fd_topob_wksp( topo, "net_umem" );
@@ -103,7 +106,7 @@ fd_topos_net_tiles( fd_topo_t *  topo,
     fd_topob_wksp( topo, "sock" );
 
     for( ulong i=0UL; i<net_tile_cnt; i++ ) {
-      setup_sock_tile( topo, tile_to_cpu );
+      setup_sock_tile( topo, tile_to_cpu, sock_udp_gro );
     }
 
   } else {
@@ -1,5 +1,6 @@
 #define _GNU_SOURCE /* dup3 */
 #include "fd_sock_tile_private.h"
+#include "../fd_net_tile.h"
 #include "../../topo/fd_topo.h"
 #include "../../../util/net/fd_eth.h"
 #include "../../../util/net/fd_ip4.h"
@@ -11,6 +12,7 @@
 #include <fcntl.h> /* fcntl */
 #include <unistd.h> /* dup3, close */
 #include <netinet/in.h> /* sockaddr_in */
+#include <netinet/udp.h> /* UDP_GRO */
 #include <sys/socket.h> /* socket */
 #include "generated/sock_seccomp.h"
 #include "../../metrics/fd_metrics.h"
@@ -27,6 +29,14 @@
    Must be aligned by alignof(struct cmsghdr) */
 #define FD_SOCK_CMSG_MAX (64UL)
 
+/* Older libc headers lack the UDP_GRO socket option (Linux 5.0) */
+#ifndef SOL_UDP
+#define SOL_UDP (17)
+#endif
+#ifndef UDP_GRO
+#define UDP_GRO (104)
+#endif
+
 static ulong
 populate_allowed_seccomp( fd_topo_t const *      topo,
                           fd_topo_tile_t const * tile,
@@ -76,7 +86,7 @@ scratch_align( void ) {
 }
 
 FD_FN_PURE static inline ulong
-scratch_footprint( fd_topo_tile_t const * tile FD_PARAM_UNUSED ) {
+scratch_footprint( fd_topo_tile_t const * tile ) {
   ulong l = FD_LAYOUT_INIT;
   l = FD_LAYOUT_APPEND( l, alignof(fd_sock_tile_t),     sizeof(fd_sock_tile_t)                );
   l = FD_LAYOUT_APPEND( l, alignof(struct iovec),       STEM_BURST*sizeof(struct iovec)       );
@@ -84,15 +94,24 @@ scratch_footprint( fd_topo_tile_t const * tile FD_PARAM_UNUSED ) {
   l = FD_LAYOUT_APPEND( l, alignof(struct sockaddr_in), STEM_BURST*sizeof(struct sockaddr_in) );
   l = FD_LAYOUT_APPEND( l, alignof(struct mmsghdr),     STEM_BURST*sizeof(struct mmsghdr)     );
   l = FD_LAYOUT_APPEND( l, FD_CHUNK_ALIGN,              tx_scratch_footprint()                );
+  if( tile->net.sock_udp_gro ) {
+    l = FD_LAYOUT_APPEND( l, alignof(struct iovec),       FD_SOCK_GRO_MSG_MAX*sizeof(struct iovec)       );
+    l = FD_LAYOUT_APPEND( l, alignof(struct cmsghdr),     FD_SOCK_GRO_MSG_MAX*FD_SOCK_CMSG_MAX           );
+    l = FD_LAYOUT_APPEND( l, alignof(struct sockaddr_in), FD_SOCK_GRO_MSG_MAX*sizeof(struct sockaddr_in) );
+    l = FD_LAYOUT_APPEND( l, alignof(struct mmsghdr),     FD_SOCK_GRO_MSG_MAX*sizeof(struct mmsghdr)     );
+    l = FD_LAYOUT_APPEND( l, FD_CHUNK_ALIGN,              FD_SOCK_GRO_MSG_MAX*FD_SOCK_GRO_BUF_SZ         );
+  }
   return FD_LAYOUT_FINI( l, scratch_align() );
 }
 
 /* create_udp_socket creates and configures a new UDP socket for the
-   sock tile at the given file descriptor ID. */
+   sock tile at the given file descriptor ID.  If udp_gro is set, the
+   kernel may coalesce incoming datagrams (see poll_rx_gro). */
 
 static void
 create_udp_socket( int    sock_fd,
-                   ushort udp_port ) {
+                   ushort udp_port,
+                   int    udp_gro ) {
 
   if( fcntl( sock_fd, F_GETFD, 0 )!=-1 ) {
     FD_LOG_ERR(( "file descriptor %d already exists", sock_fd ));
@@ -115,6 +134,14 @@ create_udp_socket( int    sock_fd,
     FD_LOG_ERR(( "setsockopt(IPPROTO_IP,IP_PKTINFO,1) failed (%i-%s)", errno, fd_io_strerror( errno ) ));
   }
 
+  if( udp_gro ) {
+    int gro = 1;
+    if( FD_UNLIKELY( setsockopt( orig_fd, SOL_UDP, UDP_GRO, &gro, sizeof(int) )<0 ) ) {
+      FD_LOG_ERR(( "setsockopt(SOL_UDP,UDP_GRO,1) failed (%i-%s). UDP_GRO requires Linux 5.0 or newer, "
+                   "consider disabling [development.net.udp_gro]", errno, fd_io_strerror( errno ) ));
+    }
+  }
+
   /* TODO SO_RCVBUF */
 
   struct sockaddr_in saddr = {
@@ -169,6 +196,19 @@ privileged_init( fd_topo_t *      topo,
   ctx->tx_scratch1 = tx_scratch + tx_scratch_footprint();
   ctx->tx_ptr      = tx_scratch;
 
+  if( tile->net.sock_udp_gro ) {
+    ctx->udp_gro  = 1;
+    ctx->gro_iov  = FD_SCRATCH_ALLOC_APPEND( l, alignof(struct iovec),       FD_SOCK_GRO_MSG_MAX*sizeof(struct iovec)       );
+    ctx->gro_cmsg = FD_SCRATCH_ALLOC_APPEND( l, alignof(struct cmsghdr),     FD_SOCK_GRO_MSG_MAX*FD_SOCK_CMSG_MAX           );
+    ctx->gro_sa   = FD_SCRATCH_ALLOC_APPEND( l, alignof(struct sockaddr_in), FD_SOCK_GRO_MSG_MAX*sizeof(struct sockaddr_in) );
+    ctx->gro_msg  = FD_SCRATCH_ALLOC_APPEND( l, alignof(struct mmsghdr),     FD_SOCK_GRO_MSG_MAX*sizeof(struct mmsghdr)     );
+    ctx->gro_buf  = FD_SCRATCH_ALLOC_APPEND( l, FD_CHUNK_ALIGN,              FD_SOCK_GRO_MSG_MAX*FD_SOCK_GRO_BUF_SZ         );
+    for( ulong j=0UL; j<FD_SOCK_GRO_MSG_MAX; j++ ) {
+      ctx->gro_iov[ j ].iov_base = ctx->gro_buf + j*FD_SOCK_GRO_BUF_SZ;
+      ctx->gro_iov[ j ].iov_len  = FD_SOCK_GRO_BUF_SZ;
+    }
+  }
+
   /* Create receive sockets.  Incrementally assign them to file
      descriptors starting at sock_fd_min. */
 
@@ -218,7 +258,7 @@ privileged_init( fd_topo_t *      topo,
     }
 
     int sock_fd = sock_fd_min + (int)sock_idx;
-    create_udp_socket( sock_fd, port );
+    create_udp_socket( sock_fd, port, ctx->udp_gro );
     ctx->pollfd[ sock_idx ].fd     = sock_fd;
     ctx->pollfd[ sock_idx ].events = POLLIN;
     ctx->sock_cnt++;
@@ -276,6 +316,37 @@ unprivileged_init( fd_topo_t *      topo,
 /* FIXME Pace RX polling and interleave it with TX jobs to reduce TX
          tail latency */
 
+/* rx_frame_hdrs writes Ethernet, IPv4, and UDP headers for a datagram
+   received on a socket into the 42 bytes preceding payload. */
+
+static inline void
+rx_frame_hdrs( uchar *                    payload,
+               ulong                      payload_sz,
+               struct sockaddr_in const * sa,
+               uint                       daddr,
+               ushort                     dport ) {
+  fd_eth_hdr_t * eth_hdr = (fd_eth_hdr_t *)( payload-42UL );
+  fd_ip4_hdr_t * ip_hdr  = (fd_ip4_hdr_t *)( payload-28UL );
+  fd_udp_hdr_t * udp_hdr = (fd_udp_hdr_t *)( payload- 8UL );
+  memset( eth_hdr->dst, 0, 6 );
+  memset( eth_hdr->src, 0, 6 );
+  eth_hdr->net_type = fd_ushort_bswap( FD_ETH_HDR_TYPE_IP );
+  *ip_hdr = (fd_ip4_hdr_t) {
+    .verihl      = FD_IP4_VERIHL( 4, 5 ),
+    .net_tot_len = fd_ushort_bswap( (ushort)( payload_sz+28UL ) ),
+    .ttl         = 1,
+    .protocol    = FD_IP4_HDR_PROTOCOL_UDP,
+  };
+  memcpy( ip_hdr->saddr_c, &sa->sin_addr.s_addr, 4 );
+  memcpy( ip_hdr->daddr_c, &daddr,               4 );
+  *udp_hdr = (fd_udp_hdr_t) {
+    .net_sport = sa->sin_port,
+    .net_dport = (ushort)fd_ushort_bswap( (ushort)dport ),
+    .net_len   = (ushort)fd_ushort_bswap( (ushort)( payload_sz+8UL ) ),
+    .check     = 0
+  };
+}
+
 /* poll_rx_socket does one recvmmsg batch receive on the given socket
    index.  Returns the number of packets returned by recvmmsg. */
 
@@ -352,34 +423,14 @@ poll_rx_socket( fd_sock_tile_t *    ctx,
       FD_LOG_ERR(( "Missing IP_PKTINFO on incoming packet" ));
     }
 
-    ulong          frame_sz   = payload_sz + hdr_sz;
-    fd_eth_hdr_t * eth_hdr    = (fd_eth_hdr_t *)( payload-42UL );
-    fd_ip4_hdr_t * ip_hdr     = (fd_ip4_hdr_t *)( payload-28UL );
-    fd_udp_hdr_t * udp_hdr    = (fd_udp_hdr_t *)( payload- 8UL );
-    memset( eth_hdr->dst, 0, 6 );
-    memset( eth_hdr->src, 0, 6 );
-    eth_hdr->net_type = fd_ushort_bswap( FD_ETH_HDR_TYPE_IP );
-    *ip_hdr = (fd_ip4_hdr_t) {
-      .verihl      = FD_IP4_VERIHL( 4, 5 ),
-      .net_tot_len = fd_ushort_bswap( (ushort)( payload_sz+28UL ) ),
-      .ttl         = 1,
-      .protocol    = FD_IP4_HDR_PROTOCOL_UDP,
-    };
-    uint daddr_ = (uint)(ulong)daddr;
-    memcpy( ip_hdr->saddr_c, &sa->sin_addr.s_addr, 4 );
-    memcpy( ip_hdr->daddr_c, &daddr_,              4 );
-    *udp_hdr = (fd_udp_hdr_t) {
-      .net_sport = sa->sin_port,
-      .net_dport = (ushort)fd_ushort_bswap( (ushort)dport ),
-      .net_len   = (ushort)fd_ushort_bswap( (ushort)( payload_sz+8UL ) ),
-      .check     = 0
-    };
+    ulong frame_sz = payload_sz + hdr_sz;
+    rx_frame_hdrs( payload, payload_sz, sa, (uint)(ulong)daddr, dport );
 
     ctx->metrics.rx_pkt_cnt++;
-    ulong chunk = fd_laddr_to_chunk( base, eth_hdr );
-    ulong sig   = fd_disco_netmux_sig( sa->sin_addr.s_addr, fd_ushort_bswap( sa->sin_port ), 0U, proto, hdr_sz );
+    ulong chunk = fd_laddr_to_chunk( base, payload-hdr_sz );
+    ulong sig   = fd_net_rx_sig( sa->sin_addr.s_addr, fd_ushort_bswap( sa->sin_port ), proto, hdr_sz, payload, payload_sz );
     ulong tspub = fd_frag_meta_ts_comp( ts );
-    fd_stem_publish( stem, rx_link, sig, chunk, frame_sz, 0UL, 0UL, tspub );
+    fd_stem_publish( stem, rx_link, sig, chunk, frame_sz, 0UL, tspub, tspub ); /* tsorig is the RX timestamp */
   }
   return (ulong)msg_cnt;
 }
@@ -408,6 +459,147 @@ poll_rx( fd_sock_tile_t *    ctx,
   return pkt_cnt;
 }
 
+/* UDP_GRO RX path.  With UDP_GRO, the kernel merges consecutive
+   datagrams of the same flow (same size, except the last which may be
+   shorter) into one message and reports the datagram size via a
+   SOL_UDP/UDP_GRO cmsg.  A single recvmmsg call can thus return up to
+   FD_SOCK_GRO_MSG_MAX*64 datagrams, which exceeds the burst depth of
+   the RX links.  The messages are received into gro_buf and split into
+   frags across multiple after_credit calls instead. */
+
+/* gro_msg_load prepares publishing the datagrams of message
+   gro_msg_idx. */
+
+static void
+gro_msg_load( fd_sock_tile_t * ctx ) {
+  struct msghdr * hdr    = &ctx->gro_msg[ ctx->gro_msg_idx ].msg_hdr;
+  ulong           msg_sz = ctx->gro_msg[ ctx->gro_msg_idx ].msg_len;
+  ulong           seg_sz = msg_sz;
+
+  long daddr = -1;
+  for( struct cmsghdr * cmsg = CMSG_FIRSTHDR( hdr ); cmsg; cmsg = CMSG_NXTHDR( hdr, cmsg ) ) {
+    if( (cmsg->cmsg_level==IPPROTO_IP) & (cmsg->cmsg_type==IP_PKTINFO) ) {
+      struct in_pktinfo const * pi = (struct in_pktinfo const *)CMSG_DATA( cmsg );
+      daddr = pi->ipi_addr.s_addr;
+    } else if( (cmsg->cmsg_level==SOL_UDP) & (cmsg->cmsg_type==UDP_GRO) ) {
+      int gso_sz = FD_LOAD( int, CMSG_DATA( cmsg ) );
+      if( FD_LIKELY( gso_sz>0 ) ) seg_sz = (ulong)gso_sz;
+    }
+  }
+  if( FD_UNLIKELY( daddr<0L ) ) {
+    /* unreachable because IP_PKTINFO was set */
+    FD_LOG_ERR(( "Missing IP_PKTINFO on incoming packet" ));
+  }
+  if( FD_UNLIKELY( ((struct sockaddr_in const *)hdr->msg_name)->sin_family!=AF_INET ) ) {
+    /* unreachable */
+    FD_LOG_ERR(( "Received packet with unexpected sin_family %i", ((struct sockaddr_in const *)hdr->msg_name)->sin_family ));
+  }
+
+  ctx->metrics.rx_gro_msg_cnt += (ulong)( seg_sz<msg_sz );
+  ctx->gro_off    = 0UL;
+  ctx->gro_seg_sz = seg_sz;
+  ctx->gro_daddr  = (uint)(ulong)daddr;
+}
+
+/* gro_drain publishes up to STEM_BURST pending datagrams.  Returns the
+   number of frags published. */
+
+static ulong
+gro_drain( fd_sock_tile_t *    ctx,
+           fd_stem_context_t * stem ) {
+  ulong  hdr_sz      = sizeof(fd_eth_hdr_t) + sizeof(fd_ip4_hdr_t) + sizeof(fd_udp_hdr_t);
+  ulong  payload_max = FD_NET_MTU-hdr_sz;
+  uint   sock_idx    = ctx->gro_sock_idx;
+  uchar  rx_link     = ctx->link_rx_map [ sock_idx ];
+  ushort dport       = ctx->rx_sock_port[ sock_idx ];
+  ushort proto       = ctx->proto_id    [ sock_idx ];
+
+  fd_sock_link_rx_t * link = ctx->link_rx + rx_link;
+  ulong tspub   = fd_frag_meta_ts_comp( fd_tickcount() );
+  ulong pub_cnt = 0UL;
+  while( (ctx->gro_msg_idx<ctx->gro_msg_cnt) & (pub_cnt<STEM_BURST) ) {
+    ulong                      msg_idx = ctx->gro_msg_idx;
+    ulong                      msg_sz  = ctx->gro_msg[ msg_idx ].msg_len;
+    uchar const *              data    = ctx->gro_iov[ msg_idx ].iov_base;
+    struct sockaddr_in const * sa      = ctx->gro_sa + msg_idx;
+    ulong                      seg_sz  = fd_ulong_min( ctx->gro_seg_sz, msg_sz-ctx->gro_off );
+
+    if( FD_UNLIKELY( seg_sz>payload_max ) ) {
+      ctx->metrics.rx_drop_cnt++;
+    } else {
+      uchar * frame   = fd_chunk_to_laddr( link->base, link->chunk );
+      uchar * payload = frame + hdr_sz;
+      fd_memcpy( payload, data + ctx->gro_off, seg_sz );
+      rx_frame_hdrs( payload, seg_sz, sa, ctx->gro_daddr, dport );
+
+      ulong sig = fd_net_rx_sig( sa->sin_addr.s_addr, fd_ushort_bswap( sa->sin_port ), proto, hdr_sz, payload, seg_sz );
+      fd_stem_publish( stem, rx_link, sig, link->chunk, seg_sz+hdr_sz, 0UL, tspub, tspub );
+      link->chunk = fd_dcache_compact_next( link->chunk, FD_NET_MTU, link->chunk0, link->wmark );
+      ctx->metrics.rx_pkt_cnt++;
+      pub_cnt++;
+    }
+
+    ctx->gro_off += seg_sz;
+    if( ctx->gro_off>=msg_sz ) {
+      ctx->gro_msg_idx++;
+      if( ctx->gro_msg_idx<ctx->gro_msg_cnt ) gro_msg_load( ctx );
+    }
+  }
+  return pub_cnt;
+}
+
+/* poll_rx_gro does one recvmmsg batch receive on the next ready socket
+   (round robin) and publishes the first STEM_BURST datagrams.  Must not
+   be called while datagrams are pending.  Returns the number of frags
+   published. */
+
+static ulong
+poll_rx_gro( fd_sock_tile_t *    ctx,
+             fd_stem_context_t * stem ) {
+  ctx->tx_idle_cnt = 0; /* restart TX polling */
+  ctx->gro_msg_cnt = 0UL;
+  ctx->gro_msg_idx = 0UL;
+
+  uint sock_cnt = ctx->sock_cnt;
+  if( FD_UNLIKELY( !sock_cnt ) ) return 0UL;
+  poll( ctx->pollfd, sock_cnt, 0 );
+  uint sock_idx = UINT_MAX;
+  for( uint k=0U; k<sock_cnt; k++ ) {
+    uint j = ( ctx->gro_sock_next + k ) % sock_cnt;
+    if( (sock_idx==UINT_MAX) && ( ctx->pollfd[ j ].revents & (POLLIN|POLLERR) ) ) sock_idx = j;
+    ctx->pollfd[ j ].revents = 0;
+  }
+  if( sock_idx==UINT_MAX ) return 0UL;
+  ctx->gro_sock_next = ( sock_idx + 1U ) % sock_cnt;
+
+  uchar * cmsg_next = ctx->gro_cmsg;
+  for( ulong j=0UL; j<FD_SOCK_GRO_MSG_MAX; j++ ) {
+    ctx->gro_msg[ j ].msg_hdr = (struct msghdr) {
+      .msg_iov        = ctx->gro_iov+j,
+      .msg_iovlen     = 1,
+      .msg_name       = ctx->gro_sa+j,
+      .msg_namelen    = sizeof(struct sockaddr_in),
+      .msg_control    = cmsg_next,
+      .msg_controllen = FD_SOCK_CMSG_MAX,
+    };
+    cmsg_next += FD_SOCK_CMSG_MAX;
+  }
+
+  int msg_cnt = recvmmsg( ctx->pollfd[ sock_idx ].fd, ctx->gro_msg, FD_SOCK_GRO_MSG_MAX, MSG_DONTWAIT, NULL );
+  if( FD_UNLIKELY( msg_cnt<0 ) ) {
+    if( FD_LIKELY( errno==EAGAIN ) ) return 0UL;
+    /* unreachable if socket is in a valid state */
+    FD_LOG_ERR(( "recvmmsg failed (%i-%s)", errno, fd_io_strerror( errno ) ));
+  }
+  ctx->metrics.sys_recvmmsg_cnt++;
+  if( FD_UNLIKELY( !msg_cnt ) ) return 0UL;
+
+  ctx->gro_sock_idx = sock_idx;
+  ctx->gro_msg_cnt  = (ulong)msg_cnt;
+  gro_msg_load( ctx );
+  return gro_drain( ctx, stem );
+}
+
 /* TX PATH (tango->socket) ********************************************/
 
 static void
@@ -557,11 +749,14 @@ after_credit( fd_sock_tile_t *    ctx,
               fd_stem_context_t * stem,
               int *               poll_in FD_PARAM_UNUSED,
               int *               charge_busy ) {
-  if( ctx->tx_idle_cnt > 512 ) {
+  if( FD_UNLIKELY( ctx->gro_msg_idx<ctx->gro_msg_cnt ) ) {
+    /* Publish remaining datagrams of coalesced messages */
+    *charge_busy = gro_drain( ctx, stem )!=0;
+  } else if( ctx->tx_idle_cnt > 512 ) {
     if( ctx->batch_cnt ) {
       flush_tx_batch( ctx );
     }
-    ulong pkt_cnt = poll_rx( ctx, stem );
+    ulong pkt_cnt = ctx->udp_gro ? poll_rx_gro( ctx, stem ) : poll_rx( ctx, stem );
     *charge_busy = pkt_cnt!=0;
   }
   ctx->tx_idle_cnt++;
@@ -574,6 +769,8 @@ metrics_write( fd_sock_tile_t * ctx ) {
   FD_MCNT_SET( SOCK, RX_PKT_CNT,        ctx->metrics.rx_pkt_cnt       );
   FD_MCNT_SET( SOCK, TX_PKT_CNT,        ctx->metrics.tx_pkt_cnt       );
   FD_MCNT_SET( SOCK, TX_DROP_CNT,       ctx->metrics.tx_drop_cnt      );
+  FD_MCNT_SET( SOCK, RX_GRO_MSG_CNT,    ctx->metrics.rx_gro_msg_cnt   );
+  FD_MCNT_SET( SOCK, RX_DROP_CNT,       ctx->metrics.rx_drop_cnt      );
 }
 
 #define STEM_CALLBACK_CONTEXT_TYPE  fd_sock_tile_t
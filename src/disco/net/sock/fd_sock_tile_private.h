@@ -22,6 +22,14 @@
 
 #define MAX_NET_OUTS (4UL)
 
+/* FD_SOCK_GRO_MSG_MAX is the max number of coalesced messages received
+   per recvmmsg call in UDP_GRO mode.  FD_SOCK_GRO_BUF_SZ is the buffer
+   size of each message (the largest possible UDP payload, rounded up).
+   The kernel coalesces at most 64 datagrams into one message. */
+
+#define FD_SOCK_GRO_MSG_MAX (16UL)
+#define FD_SOCK_GRO_BUF_SZ  (65536UL)
+
 /* Local metrics.  Periodically copied to the metric_in shm region. */
 
 struct fd_sock_tile_metrics {
@@ -30,6 +38,8 @@ struct fd_sock_tile_metrics {
   ulong rx_pkt_cnt;
   ulong tx_pkt_cnt;
   ulong tx_drop_cnt;
+  ulong rx_gro_msg_cnt;
+  ulong rx_drop_cnt;
 };
 
 typedef struct fd_sock_tile_metrics fd_sock_tile_metrics_t;
@@ -79,6 +89,24 @@ struct fd_sock_tile {
   /* TX links */
   fd_sock_link_tx_t link_tx[ MAX_NET_INS ];
 
+  /* UDP_GRO RX state.  Coalesced messages received by the last
+     recvmmsg on socket gro_sock_idx are split into datagrams and
+     published across after_credit calls, at most STEM_BURST at a time.
+     gro_msg_idx and gro_off point to the next datagram to publish. */
+  int                  udp_gro;
+  uint                 gro_sock_idx;
+  uint                 gro_sock_next; /* first socket to poll next */
+  ulong                gro_msg_cnt;
+  ulong                gro_msg_idx;
+  ulong                gro_off;
+  ulong                gro_seg_sz;    /* datagram size of msg gro_msg_idx */
+  uint                 gro_daddr;     /* dst address of msg gro_msg_idx */
+  uchar *              gro_buf;
+  struct iovec *       gro_iov;
+  void *               gro_cmsg;
+  struct sockaddr_in * gro_sa;
+  struct mmsghdr *     gro_msg;
+
   /* TX scratch memory */
   uchar * tx_scratch0;
   uchar * tx_scratch1;
@@ -8,6 +8,7 @@
 #include <sys/socket.h> /* MSG_DONTWAIT needed before importing the net seccomp filter */
 #include <linux/if_xdp.h>
 
+#include "../fd_net_tile.h"
 #include "../../metrics/fd_metrics.h"
 #include "../../netlink/fd_netlink_tile.h" /* neigh4_solicit */
 #include "../../topo/fd_topo.h"
@@ -219,6 +220,7 @@ typedef struct {
     ulong rx_backp_cnt;
     long  rx_busy_cnt;
     long  rx_idle_cnt;
+    fd_histf_t rx_backlog[1];
 
     ulong tx_submit_cnt;
     ulong tx_complete_cnt;
@@ -257,6 +259,7 @@ metrics_write( fd_net_ctx_t * ctx ) {
   FD_MCNT_SET(   NET, RX_BACKPRESSURE_CNT, ctx->metrics.rx_backp_cnt        );
   FD_MGAUGE_SET( NET, RX_BUSY_CNT, (ulong)fd_long_max( ctx->metrics.rx_busy_cnt, 0L ) );
   FD_MGAUGE_SET( NET, RX_IDLE_CNT, (ulong)fd_long_max( ctx->metrics.rx_idle_cnt, 0L ) );
+  FD_MHIST_COPY( NET, RX_BACKLOG_CNT, ctx->metrics.rx_backlog );
   FD_MGAUGE_SET( NET, TX_BUSY_CNT, (ulong)fd_long_max( ctx->metrics.tx_busy_cnt, 0L ) );
   FD_MGAUGE_SET( NET, TX_IDLE_CNT, (ulong)fd_long_max( ctx->metrics.tx_idle_cnt, 0L ) );
 
@@ -748,16 +751,21 @@ net_rx_packet( fd_net_ctx_t *      ctx,
                   ctx->repair_serve_listen_port ));
   }
 
-  /* tile can decide how to partition based on src ip addr and src port */
-  ulong sig = fd_disco_netmux_sig( ip_srcaddr, udp_srcport, 0U, proto, 14UL+8UL+iplen );
+  /* tile can decide how to partition based on src ip addr and src port
+     (or QUIC conn ID) */
+  ulong sig = fd_net_rx_sig( ip_srcaddr, udp_srcport, proto, 14UL+8UL+iplen, udp+8U, (ulong)( packet_end-(udp+8U) ) );
 
   /* Peek the mline for an old frame */
   fd_frag_meta_t * mline = out->mcache + fd_mcache_line_idx( out->seq, out->depth );
   *freed_chunk = mline->chunk;
 
-  /* Overwrite the mline with the new frame */
+  /* Overwrite the mline with the new frame.  tsorig is the RX
+     timestamp of the packet, which downstream tiles use to measure
+     latency.  This is the time the packet was read from the RX ring.
+     (AF_XDP does not support SO_TIMESTAMPING, and NIC timestamps are
+     only exposed to XDP programs via kfuncs.) */
   ulong tspub = (ulong)fd_frag_meta_ts_comp( fd_tickcount() );
-  fd_mcache_publish( out->mcache, out->depth, out->seq, sig, chunk, sz, umem_lowbits, 0, tspub );
+  fd_mcache_publish( out->mcache, out->depth, out->seq, sig, chunk, sz, umem_lowbits, tspub, tspub );
 
   /* Wind up for the next iteration */
   *stem->cr_avail -= stem->cr_decrement_amount;
@@ -901,6 +909,7 @@ before_credit( fd_net_ctx_t *      ctx,
   uint rx_prod = FD_VOLATILE_CONST( *rr_xsk->ring_rx.prod );
   if( rx_cons!=rx_prod ) {
     *charge_busy = 1;
+    fd_histf_sample( ctx->metrics.rx_backlog, (ulong)(uint)( rx_prod-rx_cons ) );
     rr_xsk->ring_rx.cached_prod = rx_prod;
     net_rx_event( ctx, stem, rr_xsk, rx_cons );
   } else {
@@ -1112,6 +1121,9 @@ unprivileged_init( fd_topo_t *      topo,
   ctx->net_tile_id  = (uint)tile->kind_id;
   ctx->net_tile_cnt = (uint)fd_topo_tile_name_cnt( topo, tile->name );
 
+  fd_histf_join( fd_histf_new( ctx->metrics.rx_backlog, FD_MHIST_MIN( NET, RX_BACKLOG_CNT ),
+                                                        FD_MHIST_MAX( NET, RX_BACKLOG_CNT ) ) );
+
   ctx->shred_listen_port              = tile->net.shred_listen_port;
   ctx->quic_transaction_listen_port   = tile->net.quic_transaction_listen_port;
   ctx->legacy_transaction_listen_port = tile->net.legacy_transaction_listen_port;
@@ -7,6 +7,7 @@
 #include "../../waltz/mib/fd_netdev_netlink.h"
 #include "../../waltz/neigh/fd_neigh4_netlink.h"
 #include "../../util/log/fd_dtrace.h"
+#include "../fd_disco.h"
 
 #include <errno.h>
 #include <net/if.h>
@@ -23,6 +24,14 @@
 #define NETDEV_MAX      (256U)
 #define BOND_MASTER_MAX (256U)
 
+/* Input link kinds */
+#define IN_KIND_SOLICIT (0)
+#define IN_KIND_STAKE   (1)
+#define IN_KIND_CONTACT (2)
+
+/* Max number of peers visited by neighbor prefetch per loop iteration */
+#define PREFETCH_BURST (16UL)
+
 void
 fd_netlink_topo_create( fd_topo_tile_t * netlink_tile,
                         fd_topo_t *      topo,
@@ -87,7 +96,7 @@ fd_netlink_topo_join( fd_topo_t *      topo,
 
 FD_FN_CONST static inline ulong
 scratch_align( void ) {
-  return fd_ulong_max( alignof(fd_netlink_tile_ctx_t), FD_NETDEV_TBL_ALIGN );
+  return fd_ulong_max( fd_ulong_max( alignof(fd_netlink_tile_ctx_t), FD_NETDEV_TBL_ALIGN ), fd_stake_ci_align() );
 }
 
 FD_FN_PURE static inline ulong
@@ -96,6 +105,7 @@ scratch_footprint( fd_topo_tile_t const * tile ) {
   ulong l = FD_LAYOUT_INIT;
   l = FD_LAYOUT_APPEND( l, alignof(fd_netlink_tile_ctx_t), sizeof(fd_netlink_tile_ctx_t) );
   l = FD_LAYOUT_APPEND( l, fd_netdev_tbl_align(), fd_netdev_tbl_footprint( NETDEV_MAX, BOND_MASTER_MAX ) );
+  l = FD_LAYOUT_APPEND( l, fd_stake_ci_align(),   fd_stake_ci_footprint() );
   return FD_LAYOUT_FINI( l, scratch_align() );
 }
 
@@ -200,9 +210,32 @@ unprivileged_init( fd_topo_t *      topo,
   ctx->fib4_local = fd_fib4_join( fd_topo_obj_laddr( topo, tile->netlink.fib4_local_obj_id ) ); FD_TEST( ctx->fib4_local );
   ctx->fib4_main  = fd_fib4_join( fd_topo_obj_laddr( topo, tile->netlink.fib4_main_obj_id  ) ); FD_TEST( ctx->fib4_main  );
 
+  /* The stake_ci identity is irrelevant, as it is only used to look
+     up the addresses of cluster peers. */
+  fd_pubkey_t const null_identity = {0};
+  ctx->prefetch.stake_ci = fd_stake_ci_join( fd_stake_ci_new( FD_SCRATCH_ALLOC_APPEND( l, fd_stake_ci_align(), fd_stake_ci_footprint() ), &null_identity ) );
+  FD_TEST( ctx->prefetch.stake_ci );
+  ctx->prefetch.cursor = ULONG_MAX;
+
   for( ulong i=0UL; i<tile->in_cnt; i++ ) {
     fd_topo_link_t * link = &topo->links[ tile->in_link_id[ i ] ];
+    if( !strcmp( link->name, "stake_out" ) || !strcmp( link->name, "crds_shred" ) ) {
+      int stake = !strcmp( link->name, "stake_out" );
+      ctx->in_kind[ i ] = stake ? IN_KIND_STAKE : IN_KIND_CONTACT;
+      fd_wksp_t * mem = topo->workspaces[ topo->objs[ link->dcache_obj_id ].wksp_id ].wksp;
+      if( stake ) {
+        ctx->stake_in.mem      = mem;
+        ctx->stake_in.chunk0   = fd_dcache_compact_chunk0( mem, link->dcache );
+        ctx->stake_in.wmark    = fd_dcache_compact_wmark ( mem, link->dcache, link->mtu );
+      } else {
+        ctx->contact_in.mem    = mem;
+        ctx->contact_in.chunk0 = fd_dcache_compact_chunk0( mem, link->dcache );
+        ctx->contact_in.wmark  = fd_dcache_compact_wmark ( mem, link->dcache, link->mtu );
+      }
+      continue;
+    }
     if( FD_UNLIKELY( link->mtu!=0UL ) ) FD_LOG_ERR(( "netlink solicit links must have an MTU of zero" ));
+    ctx->in_kind[ i ] = IN_KIND_SOLICIT;
   }
 
   ctx->action |= FD_NET_TILE_ACTION_LINK_UPDATE;
@@ -232,6 +265,9 @@ metrics_write( fd_netlink_tile_ctx_t * ctx ) {
   FD_MCNT_SET(       NETLNK, NEIGH_PROBE_FAILS,       ctx->metrics.neigh_solicits_fails );
   FD_MCNT_SET(       NETLNK, NEIGH_PROBE_RATE_LIMIT_HOST,   ctx->prober->local_rate_limited_cnt  );
   FD_MCNT_SET(       NETLNK, NEIGH_PROBE_RATE_LIMIT_GLOBAL, ctx->prober->global_rate_limited_cnt );
+  FD_MCNT_SET(       NETLNK, NEIGH_TX_MISSES,         ctx->metrics.neigh_tx_misses        );
+  FD_MCNT_SET(       NETLNK, NEIGH_PREFETCH_LOOKUPS,  ctx->metrics.neigh_prefetch_lookups );
+  FD_MCNT_SET(       NETLNK, NEIGH_PREFETCH_PROBES,   ctx->metrics.neigh_prefetch_probes  );
 }
 
 /* netlink_monitor_read calls recvfrom to process a link, route, or
@@ -311,6 +347,98 @@ during_housekeeping( fd_netlink_tile_ctx_t * ctx ) {
   }
 }
 
+/* neigh4_solicit inserts a placeholder neighbor table entry for
+   ip4_addr and triggers a neighbor solicitation via the kernel.  Does
+   nothing if an entry already exists (the kernel is already working on
+   the request).  Returns 1 if a probe was sent, 0 otherwise. */
+
+static int
+neigh4_solicit( fd_netlink_tile_ctx_t * ctx,
+                uint                    ip4_addr,
+                long                    now ) {
+
+  /* Drop if the kernel is already working on the request */
+
+  fd_neigh4_hmap_query_t query[1];
+  int spec_res = fd_neigh4_hmap_query_try( ctx->neigh4, &ip4_addr, NULL, query, 0 );
+  if( spec_res==FD_MAP_SUCCESS ) {
+    ctx->metrics.neigh_solicits_fails++;
+    return 0;
+  }
+
+  /* Insert placeholder (take above branch next time) */
+
+  int prepare_res = fd_neigh4_hmap_prepare( ctx->neigh4, &ip4_addr, NULL, query, 0 );
+  if( FD_UNLIKELY( prepare_res!=FD_MAP_SUCCESS ) ) {
+    ctx->metrics.neigh_solicits_fails++;
+    return 0;
+  }
+  fd_neigh4_entry_t * ele = fd_neigh4_hmap_query_ele( query );
+  ele->state    = FD_NEIGH4_STATE_INCOMPLETE;
+  ele->ip4_addr = ip4_addr;
+  memset( ele->mac_addr, 0, 6UL );
+  fd_neigh4_hmap_publish( query );
+
+  /* Trigger neighbor solicit via netlink */
+
+  int probe_res = fd_neigh4_probe_rate_limited( ctx->prober, ele, ip4_addr, now );
+  if( probe_res==0 ) {
+    ctx->metrics.neigh_solicits_sent++;
+  } else if( probe_res>0 ) {
+    ctx->metrics.neigh_solicits_fails++;
+  }
+  return probe_res==0;
+}
+
+/* neigh4_prefetch visits up to PREFETCH_BURST cluster peers and
+   solicits the next hop neighbor of each peer that is not yet in the
+   neighbor table.  Prefetch never takes a probe that would leave less
+   than half of the global probe budget, leaving the rest to on-demand
+   requests from net tiles.  Peers that would need a probe beyond that
+   are revisited later.  Returns 1 if any work was done. */
+
+static int
+neigh4_prefetch( fd_netlink_tile_ctx_t * ctx,
+                 long                    now ) {
+  float reserve = 0.5f*ctx->prober->rate_limit.burst;
+  if( !fd_neigh4_prober_has_spare( ctx->prober, reserve, now ) ) return 0;
+
+  fd_shred_dest_t * sdest = fd_stake_ci_get_sdest_for_slot( ctx->prefetch.stake_ci, ctx->prefetch.stake_slot );
+  if( FD_UNLIKELY( !sdest ) ) {
+    ctx->prefetch.cursor = ULONG_MAX;
+    return 0;
+  }
+  ulong dest_cnt = fd_shred_dest_cnt_all( sdest );
+
+  ulong cursor = ctx->prefetch.cursor;
+  for( ulong j=0UL; j<PREFETCH_BURST && cursor<dest_cnt; j++, cursor++ ) {
+    fd_shred_dest_weighted_t const * dest = fd_shred_dest_idx_to_dest( sdest, (fd_shred_dest_idx_t)cursor );
+    uint dst_ip = dest->ip4;
+    if( FD_UNLIKELY( !dst_ip ) ) continue;
+    ctx->metrics.neigh_prefetch_lookups++;
+
+    /* Route lookup (see net_tx_route in fd_xdp_tile.c) */
+
+    fd_fib4_hop_t hop[2] = {0};
+    fd_fib4_lookup( ctx->fib4_local, hop+0, dst_ip, 0UL );
+    fd_fib4_lookup( ctx->fib4_main,  hop+1, dst_ip, 0UL );
+    fd_fib4_hop_t const * next_hop = fd_fib4_hop_or( hop+0, hop+1 );
+    if( next_hop->rtype!=FD_FIB4_RTYPE_UNICAST  ) continue;
+    if( next_hop->if_idx!=ctx->neigh4_ifidx     ) continue;
+
+    uint neigh_ip = next_hop->ip4_gw;
+    if( !neigh_ip ) neigh_ip = dst_ip;
+
+    fd_neigh4_hmap_query_t query[1];
+    if( FD_LIKELY( fd_neigh4_hmap_query_try( ctx->neigh4, &neigh_ip, NULL, query, 0 )==FD_MAP_SUCCESS ) ) continue;
+    if( !fd_neigh4_prober_has_spare( ctx->prober, reserve, now ) ) break; /* retry this peer later */
+    ctx->metrics.neigh_prefetch_probes += (ulong)neigh4_solicit( ctx, neigh_ip, now );
+  }
+
+  ctx->prefetch.cursor = cursor<dest_cnt ? cursor : ULONG_MAX;
+  return 1;
+}
+
 /* before_credit is called once per loop iteration */
 
 static void
@@ -324,6 +452,13 @@ before_credit( fd_netlink_tile_ctx_t * ctx,
     *charge_busy = 1;
   }
 
+  if( FD_UNLIKELY( ctx->prefetch.cursor!=ULONG_MAX ) ) {
+    if( neigh4_prefetch( ctx, fd_tickcount() ) ) {
+      *charge_busy  = 1;
+      ctx->idle_cnt = -1L;
+    }
+  }
+
   ctx->idle_cnt++;
   if( FD_UNLIKELY( ctx->idle_cnt >= 128L ) ) {
     /* Blocking read (yield to scheduler) */
@@ -343,7 +478,49 @@ after_poll_overrun( fd_netlink_tile_ctx_t * ctx ) {
   ctx->idle_cnt = -1L;
 }
 
-/* after_frag handles a neighbor solicit request */
+/* during_frag stages a stake weight or contact info update */
+
+static void
+during_frag( fd_netlink_tile_ctx_t * ctx,
+             ulong                   in_idx,
+             ulong                   seq,
+             ulong                   sig,
+             ulong                   chunk,
+             ulong                   sz,
+             ulong                   ctl ) {
+  (void)seq; (void)sig; (void)ctl;
+
+  int in_kind = ctx->in_kind[ in_idx ];
+  if( in_kind==IN_KIND_STAKE ) {
+    if( FD_UNLIKELY( chunk<ctx->stake_in.chunk0 || chunk>ctx->stake_in.wmark ) ) {
+      FD_LOG_ERR(( "chunk %lu %lu corrupt, not in range [%lu,%lu]", chunk, sz, ctx->stake_in.chunk0, ctx->stake_in.wmark ));
+    }
+    uchar const * dcache_entry = fd_chunk_to_laddr_const( ctx->stake_in.mem, chunk );
+    ctx->prefetch.stake_slot_pending = FD_LOAD( ulong, dcache_entry+16UL ); /* start_slot */
+    fd_stake_ci_stake_msg_init( ctx->prefetch.stake_ci, dcache_entry );
+  } else if( in_kind==IN_KIND_CONTACT ) {
+    if( FD_UNLIKELY( chunk<ctx->contact_in.chunk0 || chunk>ctx->contact_in.wmark ) ) {
+      FD_LOG_ERR(( "chunk %lu %lu corrupt, not in range [%lu,%lu]", chunk, sz, ctx->contact_in.chunk0, ctx->contact_in.wmark ));
+    }
+    uchar const * dcache_entry = fd_chunk_to_laddr_const( ctx->contact_in.mem, chunk );
+    ulong const * header   = fd_type_pun_const( dcache_entry );
+    ulong         dest_cnt = header[ 0 ];
+    if( FD_UNLIKELY( dest_cnt>=MAX_SHRED_DESTS ) ) {
+      FD_LOG_ERR(( "Cluster nodes had %lu destinations, which was more than the max of %lu", dest_cnt, MAX_SHRED_DESTS ));
+    }
+    fd_shred_dest_wire_t const * in_dests = fd_type_pun_const( header+1UL );
+    fd_shred_dest_weighted_t *   dests    = fd_stake_ci_dest_add_init( ctx->prefetch.stake_ci );
+    for( ulong i=0UL; i<dest_cnt; i++ ) {
+      memcpy( dests[i].pubkey.uc, in_dests[i].pubkey, 32UL );
+      dests[i].ip4  = in_dests[i].ip4_addr;
+      dests[i].port = in_dests[i].udp_port;
+    }
+    ctx->prefetch.contact_cnt_pending = dest_cnt;
+  }
+}
+
+/* after_frag handles a neighbor solicit request, or restarts neighbor
+   prefetch when the set of cluster peers changed. */
 
 static void
 after_frag( fd_netlink_tile_ctx_t * ctx,
@@ -353,11 +530,24 @@ after_frag( fd_netlink_tile_ctx_t * ctx,
             ulong                   sz,
             ulong                   tsorig,
             fd_stem_context_t *     stem ) {
-  (void)in_idx; (void)seq; (void)tsorig; (void)stem;
+  (void)seq; (void)tsorig; (void)stem;
 
   long now = fd_tickcount();
   ctx->idle_cnt = -1L;
 
+  int in_kind = ctx->in_kind[ in_idx ];
+  if( in_kind==IN_KIND_STAKE ) {
+    fd_stake_ci_stake_msg_fini( ctx->prefetch.stake_ci );
+    ctx->prefetch.stake_slot = ctx->prefetch.stake_slot_pending;
+    ctx->prefetch.cursor     = 0UL;
+    return;
+  }
+  if( in_kind==IN_KIND_CONTACT ) {
+    fd_stake_ci_dest_add_fini( ctx->prefetch.stake_ci, ctx->prefetch.contact_cnt_pending );
+    ctx->prefetch.cursor = 0UL;
+    return;
+  }
+
   /* Parse request (fully contained in sig field) */
 
   if( FD_UNLIKELY( sz!=0UL ) ) {
@@ -374,37 +564,8 @@ after_frag( fd_netlink_tile_ctx_t * ctx,
     return;
   }
 
-  /* Drop if the kernel is already working on the request */
-
-  fd_neigh4_hmap_query_t query[1];
-  int spec_res = fd_neigh4_hmap_query_try( ctx->neigh4, &ip4_addr, NULL, query, 0 );
-  if( spec_res==FD_MAP_SUCCESS ) {
-    ctx->metrics.neigh_solicits_fails++;
-    return;
-  }
-
-  /* Insert placeholder (take above branch next time) */
-
-  int prepare_res = fd_neigh4_hmap_prepare( ctx->neigh4, &ip4_addr, NULL, query, 0 );
-  if( FD_UNLIKELY( prepare_res!=FD_MAP_SUCCESS ) ) {
-    ctx->metrics.neigh_solicits_fails++;
-    return;
-  }
-  fd_neigh4_entry_t * ele = fd_neigh4_hmap_query_ele( query );
-  ele->state    = FD_NEIGH4_STATE_INCOMPLETE;
-  ele->ip4_addr = ip4_addr;
-  memset( ele->mac_addr, 0, 6UL );
-  fd_neigh4_hmap_publish( query );
-
-  /* Trigger neighbor solicit via netlink */
-
-  int probe_res = fd_neigh4_probe_rate_limited( ctx->prober, ele, ip4_addr, now );
-  if( probe_res==0 ) {
-    ctx->metrics.neigh_solicits_sent++;
-  } else if( probe_res>0 ) {
-    ctx->metrics.neigh_solicits_fails++;
-  }
-
+  ctx->metrics.neigh_tx_misses++;
+  neigh4_solicit( ctx, ip4_addr, now );
 }
 
 #define STEM_BURST (1UL)
@@ -417,6 +578,7 @@ after_frag( fd_netlink_tile_ctx_t * ctx,
 #define STEM_CALLBACK_DURING_HOUSEKEEPING during_housekeeping
 #define STEM_CALLBACK_BEFORE_CREDIT       before_credit
 #define STEM_CALLBACK_AFTER_POLL_OVERRUN  after_poll_overrun
+#define STEM_CALLBACK_DURING_FRAG         during_frag
 #define STEM_CALLBACK_AFTER_FRAG          after_frag
 
 #include "../stem/fd_stem.c"
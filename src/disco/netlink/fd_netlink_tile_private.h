@@ -8,11 +8,13 @@
 #include "../../waltz/mib/fd_netdev_tbl.h"
 #include "../../waltz/neigh/fd_neigh4_map.h"
 #include "../../waltz/neigh/fd_neigh4_probe.h"
+#include "../shred/fd_stake_ci.h"
+#include "../topo/fd_topo.h"
 
 /* FD_NETLINK_TILE_CTX_MAGIC uniquely identifies a fd_netlink_tile_ctx_t.
    CHange this whenever the fd_netlink_tile_ctx_t struct changes. */
 
-#define FD_NETLINK_TILE_CTX_MAGIC (0xec431bf97929c691UL) /* random */
+#define FD_NETLINK_TILE_CTX_MAGIC (0xe3adef78d61228fdUL) /* random */
 
 struct fd_netlink_tile_ctx {
   ulong magic; /* ==FD_NETLINK_TILE_CTX_MAGIC */
@@ -49,12 +51,35 @@ struct fd_netlink_tile_ctx {
   /* Neighbor table prober */
   fd_neigh4_prober_t prober[1];
 
+  /* Neighbor prefetch.  Walks the cluster peers known to stake_ci
+     (highest stake first, i.e. in turbine tree order) and resolves the
+     next hop of each ahead of the first packet sent to it.  cursor is
+     the next fd_shred_dest idx to visit, ULONG_MAX if done. */
+  struct {
+    fd_stake_ci_t * stake_ci;
+    ulong           stake_slot;
+    ulong           stake_slot_pending;
+    ulong           contact_cnt_pending;
+    ulong           cursor;
+  } prefetch;
+
+  /* Input links */
+  uchar in_kind[ FD_TOPO_MAX_TILE_IN_LINKS ];
+  struct {
+    fd_wksp_t * mem;
+    ulong       chunk0;
+    ulong       wmark;
+  } stake_in, contact_in;
+
   struct {
     ulong link_full_syncs;
     ulong route_full_syncs;
     ulong update_cnt[ FD_METRICS_COUNTER_NETLNK_UPDATES_CNT ];
     ulong neigh_solicits_sent;
     ulong neigh_solicits_fails;
+    ulong neigh_tx_misses;
+    ulong neigh_prefetch_lookups;
+    ulong neigh_prefetch_probes;
   } metrics;
 };
 
@@ -228,6 +228,7 @@ typedef struct {
   fd_histf_t no_sched_duration[ 1 ];
   fd_histf_t insert_duration  [ 1 ];
   fd_histf_t complete_duration[ 1 ];
+  fd_histf_t net_rx_latency   [ 1 ];
 
   struct {
     uint metric_state;
@@ -364,6 +365,7 @@ metrics_write( fd_pack_ctx_t * ctx ) {
   FD_MHIST_COPY( PACK, NO_SCHED_MICROBLOCK_DURATION_SECONDS, ctx->no_sched_duration );
   FD_MHIST_COPY( PACK, INSERT_TRANSACTION_DURATION_SECONDS,  ctx->insert_duration   );
   FD_MHIST_COPY( PACK, COMPLETE_MICROBLOCK_DURATION_SECONDS, ctx->complete_duration );
+  FD_MHIST_COPY( PACK, NET_RX_LATENCY_SECONDS,               ctx->net_rx_latency    );
 
   fd_pack_metrics_write( ctx->pack );
 }
@@ -904,7 +906,6 @@ after_frag( fd_pack_ctx_t *     ctx,
             fd_stem_context_t * stem ) {
   (void)seq;
   (void)sz;
-  (void)tsorig;
   (void)stem;
 
   long now = fd_tickcount();
@@ -929,6 +930,12 @@ after_frag( fd_pack_ctx_t *     ctx,
     break;
   }
   case IN_KIND_RESOLV: {
+    /* Transactions not received from a net tile (bundles, gossiped
+       votes) carry no RX timestamp */
+    if( FD_LIKELY( tsorig ) ) {
+      fd_histf_sample( ctx->net_rx_latency, (ulong)fd_long_max( now-fd_frag_meta_ts_decomp( tsorig, now ), 0L ) );
+    }
+
     /* Normal transaction case */
 #if FD_PACK_USE_EXTRA_STORAGE
     if( FD_LIKELY( !ctx->insert_to_extra ) ) {
@@ -1145,6 +1152,8 @@ unprivileged_init( fd_topo_t *      topo,
                                                        FD_MHIST_SECONDS_MAX( PACK, INSERT_TRANSACTION_DURATION_SECONDS  ) ) );
   fd_histf_join( fd_histf_new( ctx->complete_duration, FD_MHIST_SECONDS_MIN( PACK, COMPLETE_MICROBLOCK_DURATION_SECONDS ),
                                                        FD_MHIST_SECONDS_MAX( PACK, COMPLETE_MICROBLOCK_DURATION_SECONDS  ) ) );
+  fd_histf_join( fd_histf_new( ctx->net_rx_latency,    FD_MHIST_SECONDS_MIN( PACK, NET_RX_LATENCY_SECONDS               ),
+                                                       FD_MHIST_SECONDS_MAX( PACK, NET_RX_LATENCY_SECONDS               ) ) );
   ctx->metric_state = 0;
   ctx->metric_state_begin = fd_tickcount();
   memset( ctx->metric_timing,      '\0', 16*sizeof(long)                 );
@@ -1,7 +1,11 @@
-$(call add-hdrs,fd_tpu.h)
-$(call add-objs,fd_tpu_reasm,fd_disco)
+$(call add-hdrs,fd_tpu.h fd_tpu_admit.h fd_quic_hs_backlog.h)
+$(call add-objs,fd_tpu_reasm fd_tpu_admit,fd_disco)
 $(call make-unit-test,test_tpu_reasm,test_tpu_reasm,fd_disco fd_tango fd_ballet fd_util)
 $(call run-unit-test,test_tpu_reasm)
+$(call make-unit-test,test_tpu_admit,test_tpu_admit,fd_disco fd_util)
+$(call run-unit-test,test_tpu_admit)
+$(call make-unit-test,test_quic_hs_backlog,test_quic_hs_backlog,fd_disco fd_util)
+$(call run-unit-test,test_quic_hs_backlog)
 ifdef FD_HAS_DOUBLE
 $(call make-unit-test,test_quic_metrics,test_quic_metrics,fd_disco fd_tango fd_ballet fd_util)
 $(call run-unit-test,test_quic_metrics)
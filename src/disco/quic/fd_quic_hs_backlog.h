@@ -0,0 +1,141 @@
+#ifndef HEADER_fd_src_disco_quic_fd_quic_hs_backlog_h
+#define HEADER_fd_src_disco_quic_fd_quic_hs_backlog_h
+
+/* fd_quic_hs_backlog defers QUIC Initial packets (new connection
+   attempts) to a FIFO ring, such that handshake crypto does not delay
+   processing of packets on established conns.
+
+   Only Initial packets are deferred.  Handshake and 0-RTT packets, and
+   any packet with a short header, are processed inline.  A conn only
+   carries 1-RTT traffic once the server processed the client's first
+   Initial, so packets of conns with established traffic are never
+   queued behind the backlog.  The remaining reordering (e.g. a
+   retransmitted client Initial overtaken by a later Handshake packet
+   of the same conn) is no different from reordering in the network,
+   which QUIC tolerates.
+
+   FD_QUIC_HS_BACKLOG_DEPTH is the max number of buffered packets.
+   Power of 2.
+
+   FD_QUIC_HS_BACKLOG_{BURST,RATIO} control how deferred packets are
+   scheduled: While the net input link is busy, one backlog packet is
+   processed every RATIO stem iterations.  Once the net input link is
+   idle, up to BURST backlog packets are processed per iteration.
+   Thus, while busy, the packet at backlog position k is processed
+   within (k+1)*RATIO iterations. */
+
+#include "../fd_disco_base.h"
+
+#define FD_QUIC_HS_BACKLOG_DEPTH (256UL)
+#define FD_QUIC_HS_BACKLOG_BURST (  8UL)
+#define FD_QUIC_HS_BACKLOG_RATIO (  4UL)
+
+/* fd_quic_hs_backlog_t is the backlog state.  head and tail are
+   sequence numbers, pkt points to DEPTH entries of FD_NET_MTU bytes
+   each (FD_QUIC_HS_BACKLOG_DATA_SZ). */
+
+#define FD_QUIC_HS_BACKLOG_DATA_SZ (FD_QUIC_HS_BACKLOG_DEPTH*FD_NET_MTU)
+
+struct fd_quic_hs_backlog {
+  uchar * pkt;
+  ushort  sz    [ FD_QUIC_HS_BACKLOG_DEPTH ];
+  uint    tsorig[ FD_QUIC_HS_BACKLOG_DEPTH ];
+  ulong   head;
+  ulong   tail;
+  ulong   skip;     /* iterations since last backlog packet */
+  int     rx_busy;  /* net frag received since last drain */
+};
+
+typedef struct fd_quic_hs_backlog fd_quic_hs_backlog_t;
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_quic_hs_backlog_init initializes an empty backlog backed by the
+   FD_QUIC_HS_BACKLOG_DATA_SZ byte region at pkt. */
+
+static inline fd_quic_hs_backlog_t *
+fd_quic_hs_backlog_init( fd_quic_hs_backlog_t * backlog,
+                         uchar *                pkt ) {
+  fd_memset( backlog, 0, sizeof(fd_quic_hs_backlog_t) );
+  backlog->pkt = pkt;
+  return backlog;
+}
+
+/* fd_quic_hs_backlog_defer returns 1 if the QUIC packet (UDP payload)
+   at quic_pkt should be deferred, i.e. if it is an Initial packet. */
+
+FD_FN_PURE static inline int
+fd_quic_hs_backlog_defer( uchar const * quic_pkt,
+                          ulong         sz ) {
+  /* Long header with packet type 0 */
+  return sz>0UL && (quic_pkt[0]&0xb0U)==0x80U;
+}
+
+FD_FN_PURE static inline ulong
+fd_quic_hs_backlog_cnt( fd_quic_hs_backlog_t const * backlog ) {
+  return backlog->tail - backlog->head;
+}
+
+/* fd_quic_hs_backlog_push appends a copy of the packet at pkt (sz
+   bytes, at most FD_NET_MTU) received at tsorig.  Returns 0 if the
+   backlog is full, in which case the packet is not queued. */
+
+static inline int
+fd_quic_hs_backlog_push( fd_quic_hs_backlog_t * backlog,
+                         uchar const *          pkt,
+                         ulong                  sz,
+                         ulong                  tsorig ) {
+  if( FD_UNLIKELY( fd_quic_hs_backlog_cnt( backlog )>=FD_QUIC_HS_BACKLOG_DEPTH ) ) return 0;
+  ulong idx = backlog->tail & (FD_QUIC_HS_BACKLOG_DEPTH-1UL);
+  fd_memcpy( backlog->pkt + idx*FD_NET_MTU, pkt, sz );
+  backlog->sz    [ idx ] = (ushort)sz;
+  backlog->tsorig[ idx ] = (uint)tsorig;
+  backlog->tail++;
+  return 1;
+}
+
+/* fd_quic_hs_backlog_rx notes that a net frag was received. */
+
+static inline void
+fd_quic_hs_backlog_rx( fd_quic_hs_backlog_t * backlog ) {
+  backlog->rx_busy = 1;
+}
+
+/* fd_quic_hs_backlog_sched is called once per stem iteration.  Returns
+   the max number of packets to pop in this iteration (see BURST and
+   RATIO above). */
+
+static inline ulong
+fd_quic_hs_backlog_sched( fd_quic_hs_backlog_t * backlog ) {
+  int rx_busy = backlog->rx_busy;
+  backlog->rx_busy = 0;
+  if( FD_LIKELY( backlog->head==backlog->tail ) ) return 0UL;
+
+  ulong burst = FD_QUIC_HS_BACKLOG_BURST;
+  if( rx_busy ) {
+    if( ++backlog->skip < FD_QUIC_HS_BACKLOG_RATIO ) return 0UL;
+    burst = 1UL;
+  }
+  backlog->skip = 0UL;
+  return burst;
+}
+
+/* fd_quic_hs_backlog_pop removes the oldest packet.  Returns a pointer
+   to its payload, valid until the next push, and stores its size and
+   tsorig to *sz and *tsorig.  Returns NULL if the backlog is empty. */
+
+static inline uchar *
+fd_quic_hs_backlog_pop( fd_quic_hs_backlog_t * backlog,
+                        ulong *                sz,
+                        ulong *                tsorig ) {
+  if( FD_UNLIKELY( backlog->head==backlog->tail ) ) return NULL;
+  ulong idx = backlog->head & (FD_QUIC_HS_BACKLOG_DEPTH-1UL);
+  backlog->head++;
+  *sz     = backlog->sz    [ idx ];
+  *tsorig = backlog->tsorig[ idx ];
+  return backlog->pkt + idx*FD_NET_MTU;
+}
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_disco_quic_fd_quic_hs_backlog_h */
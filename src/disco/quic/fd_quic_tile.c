@@ -5,6 +5,7 @@
 #include "fd_tpu.h"
 #include "../../waltz/quic/fd_quic_private.h"
 #include "generated/quic_seccomp.h"
+#include "../fd_disco.h"
 #include "../../util/net/fd_eth.h"
 
 #include <errno.h>
@@ -28,6 +29,10 @@
    (multiplexer).  An arbitrary number of QUIC tiles can be run.  Each
    UDP flow must stick to one QUIC tile. */
 
+#define IN_KIND_NET     (0)
+#define IN_KIND_STAKE   (1)
+#define IN_KIND_CONTACT (2)
+
 static inline fd_quic_limits_t
 quic_limits( fd_topo_tile_t const * tile ) {
   fd_quic_limits_t limits = {
@@ -61,9 +66,24 @@ scratch_footprint( fd_topo_tile_t const * tile ) {
   l = FD_LAYOUT_APPEND( l, alignof( fd_quic_ctx_t ), sizeof( fd_quic_ctx_t )                        );
   l = FD_LAYOUT_APPEND( l, fd_quic_align(),          fd_quic_footprint( &limits )                   );
   l = FD_LAYOUT_APPEND( l, fd_tpu_reasm_align(),     fd_tpu_reasm_footprint( out_depth, reasm_max ) );
+  l = FD_LAYOUT_APPEND( l, fd_tpu_admit_align(),     fd_tpu_admit_footprint( MAX_SHRED_DESTS )      );
+  l = FD_LAYOUT_APPEND( l, alignof(fd_tpu_admit_conn_t), limits.conn_cnt*sizeof(fd_tpu_admit_conn_t) );
+  l = FD_LAYOUT_APPEND( l, fd_stake_ci_align(),      fd_stake_ci_footprint()                        );
+  l = FD_LAYOUT_APPEND( l, FD_CHUNK_ALIGN,           FD_QUIC_HS_BACKLOG_DATA_SZ                     );
   return FD_LAYOUT_FINI( l, scratch_align() );
 }
 
+/* net_rx_latency_sample records the time between a transaction's
+   packet being received by a net tile (tsorig) and the transaction
+   being published to verify (tspub). */
+
+static inline void
+net_rx_latency_sample( fd_quic_ctx_t * ctx,
+                       long            tsorig,
+                       long            tspub ) {
+  fd_histf_sample( ctx->metrics.net_rx_latency, (ulong)fd_long_max( tspub-tsorig, 0L ) );
+}
+
 /* legacy_stream_notify is called for transactions sent via TPU/UDP. For
    now both QUIC and non-QUIC transactions are accepted, with traffic
    type determined by port.
@@ -77,17 +97,56 @@ legacy_stream_notify( fd_quic_ctx_t * ctx,
                       ulong           packet_sz ) {
 
   long                tspub    = fd_tickcount();
+  long                tsorig   = fd_frag_meta_ts_decomp( ctx->rx_tsorig, tspub );
   fd_tpu_reasm_t *    reasm    = ctx->reasm;
   fd_stem_context_t * stem     = ctx->stem;
   fd_frag_meta_t *    mcache   = stem->mcaches[0];
   void *              base     = ctx->verify_out_mem;
   ulong               seq      = stem->seqs[0];
 
-  int err = fd_tpu_reasm_publish_fast( reasm, packet, packet_sz, mcache, base, seq, tspub );
+  int err = fd_tpu_reasm_publish_fast( reasm, packet, packet_sz, mcache, base, seq, tsorig, tspub );
   if( FD_LIKELY( err==FD_TPU_REASM_SUCCESS ) ) {
     fd_stem_advance( stem, 0UL );
     ctx->metrics.txns_received_udp++;
+    net_rx_latency_sample( ctx, tsorig, tspub );
+  }
+}
+
+/* quic_rx_packet passes a QUIC packet (starting at the Ethernet
+   header) to fd_quic. */
+
+static void
+quic_rx_packet( fd_quic_ctx_t * ctx,
+                uchar *         pkt,
+                ulong           sz ) {
+  uchar * ip_pkt = pkt + sizeof(fd_eth_hdr_t);
+  ulong   ip_sz  = sz  - sizeof(fd_eth_hdr_t);
+
+  fd_quic_t * quic = ctx->quic;
+  long dt = -fd_tickcount();
+  fd_quic_process_packet( quic, ip_pkt, ip_sz );
+  dt += fd_tickcount();
+  fd_histf_sample( quic->metrics.receive_duration, (ulong)dt );
+  quic->metrics.net_rx_byte_cnt += sz;
+  quic->metrics.net_rx_pkt_cnt++;
+}
+
+/* hs_backlog_drain processes deferred handshake packets as scheduled
+   by fd_quic_hs_backlog_sched.  Returns 1 if any packet was
+   processed. */
+
+static int
+hs_backlog_drain( fd_quic_ctx_t * ctx ) {
+  ulong burst = fd_quic_hs_backlog_sched( ctx->hs_backlog );
+  for( ulong j=0UL; j<burst; j++ ) {
+    ulong   sz;
+    ulong   tsorig;
+    uchar * pkt = fd_quic_hs_backlog_pop( ctx->hs_backlog, &sz, &tsorig );
+    if( !pkt ) break;
+    ctx->rx_tsorig = tsorig;
+    quic_rx_packet( ctx, pkt, sz );
   }
+  return burst>0UL;
 }
 
 /* Because of the separate mcache for publishing network fragments
@@ -110,8 +169,10 @@ before_credit( fd_quic_ctx_t *     ctx,
                int *               charge_busy ) {
   ctx->stem = stem;
 
+  int drained = hs_backlog_drain( ctx );
+
   /* Publishes to mcache via callbacks */
-  *charge_busy = fd_quic_service( ctx->quic );
+  *charge_busy = fd_quic_service( ctx->quic ) | drained;
 }
 
 static inline void
@@ -171,6 +232,16 @@ metrics_write( fd_quic_ctx_t * ctx ) {
 
   FD_MHIST_COPY( QUIC, SERVICE_DURATION_SECONDS, ctx->quic->metrics.service_duration );
   FD_MHIST_COPY( QUIC, RECEIVE_DURATION_SECONDS, ctx->quic->metrics.receive_duration );
+  FD_MHIST_COPY( QUIC, NET_RX_LATENCY_SECONDS,   ctx->metrics.net_rx_latency          );
+
+  FD_MGAUGE_SET( QUIC, HANDSHAKE_BACKLOG,         fd_quic_hs_backlog_cnt( ctx->hs_backlog ) );
+  FD_MCNT_SET  ( QUIC, HANDSHAKE_BACKLOG_DROPPED, ctx->metrics.hs_backlog_dropped );
+
+  FD_MGAUGE_SET    ( QUIC, ADMIT_STAKED_PEERS,      ctx->admit->staked_cnt );
+  FD_MCNT_ENUM_COPY( QUIC, ADMIT_INITIAL_ACCEPTED,  ctx->admit->metrics.initial_admit );
+  FD_MCNT_ENUM_COPY( QUIC, ADMIT_INITIAL_THROTTLED, ctx->admit->metrics.initial_drop  );
+  FD_MCNT_ENUM_COPY( QUIC, ADMIT_STREAMS_ACCEPTED,  ctx->admit->metrics.stream_admit  );
+  FD_MCNT_ENUM_COPY( QUIC, ADMIT_STREAMS_THROTTLED, ctx->admit->metrics.stream_drop   );
 }
 
 static int
@@ -178,9 +249,10 @@ before_frag( fd_quic_ctx_t * ctx,
              ulong           in_idx,
              ulong           seq,
              ulong           sig ) {
-  (void)in_idx;
   (void)seq;
 
+  if( FD_UNLIKELY( ctx->in_kind[ in_idx ]!=IN_KIND_NET ) ) return 0;
+
   ulong proto = fd_disco_netmux_sig_proto( sig );
   if( FD_UNLIKELY( proto!=DST_PROTO_TPU_UDP && proto!=DST_PROTO_TPU_QUIC ) ) return 1;
 
@@ -190,20 +262,115 @@ before_frag( fd_quic_ctx_t * ctx,
   return 0;
 }
 
+/* during_frag_contact stages a contact info update (cluster node
+   addresses) in stake_ci.  Same wire format as consumed by the shred
+   tile. */
+
+static void
+during_frag_contact( fd_quic_ctx_t * ctx,
+                     uchar const *   buf ) {
+  ulong const * header   = fd_type_pun_const( buf );
+  ulong         dest_cnt = header[ 0 ];
+  if( FD_UNLIKELY( dest_cnt>=MAX_SHRED_DESTS ) ) {
+    FD_LOG_ERR(( "Cluster nodes had %lu destinations, which was more than the max of %lu", dest_cnt, MAX_SHRED_DESTS ));
+  }
+
+  fd_shred_dest_wire_t const * in_dests = fd_type_pun_const( header+1UL );
+  fd_shred_dest_weighted_t *   dests    = fd_stake_ci_dest_add_init( ctx->stake_ci );
+  for( ulong i=0UL; i<dest_cnt; i++ ) {
+    memcpy( dests[i].pubkey.uc, in_dests[i].pubkey, 32UL );
+    dests[i].ip4  = in_dests[i].ip4_addr;
+    dests[i].port = in_dests[i].udp_port;
+  }
+  ctx->contact_cnt_pending = dest_cnt;
+}
+
+/* admit_refresh updates the admission control stake table from the
+   staked nodes in stake_ci that have a known address.  This runs on
+   every stake and contact info update, but only touches the peer table
+   (and token bucket balances) if the staked set actually changed. */
+
+static void
+admit_refresh( fd_quic_ctx_t * ctx ) {
+  fd_shred_dest_t * sdest = fd_stake_ci_get_sdest_for_slot( ctx->stake_ci, ctx->stake_slot );
+  if( FD_UNLIKELY( !sdest ) ) return;
+
+  fd_tpu_admit_t * admit      = ctx->admit;
+  ulong            staked_cnt = fd_shred_dest_cnt_staked( sdest );
+  fd_tpu_admit_stakes_init( admit );
+  for( ulong i=0UL; i<staked_cnt; i++ ) {
+    fd_shred_dest_weighted_t const * dest = fd_shred_dest_idx_to_dest( sdest, (fd_shred_dest_idx_t)i );
+    fd_tpu_admit_stakes_add( admit, dest->ip4, dest->stake_lamports );
+  }
+  fd_tpu_admit_stakes_fini( admit, fd_tickcount() );
+}
+
 static void
 during_frag( fd_quic_ctx_t * ctx,
-             ulong           in_idx FD_PARAM_UNUSED,
+             ulong           in_idx,
              ulong           seq    FD_PARAM_UNUSED,
-             ulong           sig    FD_PARAM_UNUSED,
+             ulong           sig,
              ulong           chunk,
              ulong           sz,
              ulong           ctl ) {
+  int in_kind = ctx->in_kind[ in_idx ];
+  if( FD_UNLIKELY( in_kind!=IN_KIND_NET ) ) {
+    if( FD_UNLIKELY( chunk<ctx->in[ in_idx ].chunk0 || chunk>ctx->in[ in_idx ].wmark ) )
+      FD_LOG_ERR(( "chunk %lu %lu corrupt, not in range [%lu,%lu]", chunk, sz,
+                   ctx->in[ in_idx ].chunk0, ctx->in[ in_idx ].wmark ));
+    uchar const * dcache_entry = fd_chunk_to_laddr_const( ctx->in[ in_idx ].mem, chunk );
+    if( in_kind==IN_KIND_STAKE ) {
+      ctx->stake_slot_pending = FD_LOAD( ulong, dcache_entry+16UL ); /* start_slot */
+      fd_stake_ci_stake_msg_init( ctx->stake_ci, dcache_entry );
+    } else {
+      during_frag_contact( ctx, dcache_entry );
+    }
+    return;
+  }
+
   void const * src = fd_net_rx_translate_frag( &ctx->net_in_bounds, chunk, ctl, sz );
 
+  /* TPU/UDP transactions are copied straight into the reasm slot that
+     publish_fast will use next, saving a copy per transaction.  This is
+     safe against overruns since the slot is not visible to consumers
+     until after_frag publishes it, and no other reasm call happens in
+     between. */
+  ctx->udp_buf = NULL;
+  if( fd_disco_netmux_sig_proto( sig )==DST_PROTO_TPU_UDP ) {
+    ulong network_hdr_sz = fd_disco_netmux_sig_hdr_sz( sig );
+    if( FD_LIKELY( sz>network_hdr_sz && sz-network_hdr_sz<=FD_TPU_MTU ) ) {
+      uchar * buf = fd_tpu_reasm_fast_buf( ctx->reasm );
+      if( FD_LIKELY( buf ) ) {
+        fd_memcpy( buf, (uchar const *)src+network_hdr_sz, sz-network_hdr_sz );
+        ctx->udp_buf = buf;
+        return;
+      }
+    }
+  }
+
   /* FIXME this copy could be eliminated by combining it with the decrypt operation */
   fd_memcpy( ctx->buffer, src, sz );
 }
 
+/* quic_admit_initial applies stake-weighted admission control to QUIC
+   Initial packets (new connection attempts) before fd_quic spends any
+   work on them.  Returns 0 if the packet should be dropped. */
+
+static int
+quic_admit_initial( fd_quic_ctx_t * ctx,
+                    ulong           sig,
+                    ulong           sz ) {
+  ulong hdr_sz = fd_disco_netmux_sig_hdr_sz( sig );
+  if( FD_UNLIKELY( sz<=hdr_sz ) ) return 1; /* fd_quic counts these */
+
+  /* Long header with packet type 0 */
+  uint b0 = ctx->buffer[ hdr_sz ];
+  if( FD_LIKELY( (b0&0xb0U)!=0x80U ) ) return 1;
+
+  uint ip4_saddr = FD_LOAD( uint, ctx->buffer+sizeof(fd_eth_hdr_t)+offsetof( fd_ip4_hdr_t, saddr_c ) );
+  return fd_tpu_admit_initial( ctx->admit, ip4_saddr, fd_tickcount() );
+}
+
 static void
 after_frag( fd_quic_ctx_t *     ctx,
             ulong               in_idx,
@@ -212,25 +379,41 @@ after_frag( fd_quic_ctx_t *     ctx,
             ulong               sz,
             ulong               tsorig,
             fd_stem_context_t * stem ) {
-  (void)in_idx;
   (void)seq;
-  (void)tsorig;
   (void)stem;
 
+  int in_kind = ctx->in_kind[ in_idx ];
+  if( FD_UNLIKELY( in_kind==IN_KIND_STAKE ) ) {
+    fd_stake_ci_stake_msg_fini( ctx->stake_ci );
+    ctx->stake_slot = ctx->stake_slot_pending;
+    admit_refresh( ctx );
+    return;
+  }
+  if( FD_UNLIKELY( in_kind==IN_KIND_CONTACT ) ) {
+    fd_stake_ci_dest_add_fini( ctx->stake_ci, ctx->contact_cnt_pending );
+    admit_refresh( ctx );
+    return;
+  }
+
   ulong proto = fd_disco_netmux_sig_proto( sig );
 
+  fd_quic_hs_backlog_rx( ctx->hs_backlog );
+  ctx->rx_tsorig = tsorig;
+
   if( FD_LIKELY( proto==DST_PROTO_TPU_QUIC ) ) {
     if( FD_UNLIKELY( sz<sizeof(fd_eth_hdr_t) ) ) FD_LOG_ERR(( "QUIC packet too small" ));
-    uchar * ip_pkt = ctx->buffer + sizeof(fd_eth_hdr_t);
-    ulong   ip_sz  = sz - sizeof(fd_eth_hdr_t);
-
-    fd_quic_t * quic = ctx->quic;
-    long dt = -fd_tickcount();
-    fd_quic_process_packet( quic, ip_pkt, ip_sz );
-    dt += fd_tickcount();
-    fd_histf_sample( quic->metrics.receive_duration, (ulong)dt );
-    quic->metrics.net_rx_byte_cnt += sz;
-    quic->metrics.net_rx_pkt_cnt++;
+    if( FD_UNLIKELY( !quic_admit_initial( ctx, sig, sz ) ) ) return;
+
+    /* Defer Initial packets (new handshakes) */
+    ulong hdr_sz = fd_disco_netmux_sig_hdr_sz( sig );
+    if( FD_UNLIKELY( sz>hdr_sz && fd_quic_hs_backlog_defer( ctx->buffer+hdr_sz, sz-hdr_sz ) ) ) {
+      if( FD_UNLIKELY( !fd_quic_hs_backlog_push( ctx->hs_backlog, ctx->buffer, sz, tsorig ) ) ) {
+        ctx->metrics.hs_backlog_dropped++;
+      }
+      return;
+    }
+
+    quic_rx_packet( ctx, ctx->buffer, sz );
   } else if( FD_LIKELY( proto==DST_PROTO_TPU_UDP ) ) {
     ulong network_hdr_sz = fd_disco_netmux_sig_hdr_sz( sig );
     if( FD_UNLIKELY( sz<=network_hdr_sz ) ) {
@@ -255,7 +438,8 @@ after_frag( fd_quic_ctx_t *     ctx,
       return;
     }
 
-    legacy_stream_notify( ctx, ctx->buffer+network_hdr_sz, data_sz );
+    uchar * data = ctx->udp_buf ? ctx->udp_buf : ctx->buffer+network_hdr_sz;
+    legacy_stream_notify( ctx, data, data_sz );
   }
 }
 
@@ -264,6 +448,23 @@ quic_now( void * ctx FD_PARAM_UNUSED ) {
   return (ulong)fd_tickcount();
 }
 
+static void
+quic_conn_new( fd_quic_conn_t * conn,
+               void *           quic_ctx ) {
+  fd_quic_ctx_t * ctx = quic_ctx;
+  fd_tpu_admit_conn_init( ctx->admit, ctx->admit_conns + conn->conn_idx, fd_tickcount() );
+}
+
+/* quic_admit_stream applies stake-weighted admission control to a new
+   stream (txn).  Returns 0 if the txn should be dropped. */
+
+static inline int
+quic_admit_stream( fd_quic_ctx_t *  ctx,
+                   fd_quic_conn_t * conn,
+                   long             now ) {
+  return fd_tpu_admit_stream( ctx->admit, ctx->admit_conns + conn->conn_idx, conn->peer->ip_addr, now );
+}
+
 static void
 quic_conn_final( fd_quic_conn_t * conn,
                  void *           quic_ctx ) {
@@ -304,10 +505,15 @@ quic_stream_rx( fd_quic_conn_t * conn,
       ctx->metrics.quic_txn_too_large++;
       return FD_QUIC_SUCCESS; /* drop */
     }
-    int err = fd_tpu_reasm_publish_fast( reasm, data, data_sz, mcache, base, seq, tspub );
+    if( FD_UNLIKELY( !quic_admit_stream( ctx, conn, tspub ) ) ) {
+      return FD_QUIC_SUCCESS; /* drop */
+    }
+    long tsorig = fd_frag_meta_ts_decomp( ctx->rx_tsorig, tspub );
+    int  err    = fd_tpu_reasm_publish_fast( reasm, data, data_sz, mcache, base, seq, tsorig, tspub );
     if( FD_LIKELY( err==FD_TPU_REASM_SUCCESS ) ) {
       fd_stem_advance( stem, 0UL );
       ctx->metrics.txns_received_quic_fast++;
+      net_rx_latency_sample( ctx, tsorig, tspub );
     }
     return FD_QUIC_SUCCESS;
   }
@@ -326,6 +532,9 @@ quic_stream_rx( fd_quic_conn_t * conn,
       ctx->metrics.quic_txn_too_large++;
       return FD_QUIC_SUCCESS; /* drop */
     }
+    if( FD_UNLIKELY( !quic_admit_stream( ctx, conn, tspub ) ) ) {
+      return FD_QUIC_SUCCESS; /* drop */
+    }
 
     /* Was the reasm buffer we evicted busy? */
     fd_tpu_reasm_slot_t * victim      = fd_tpu_reasm_peek_tail( reasm );
@@ -344,7 +553,7 @@ quic_stream_rx( fd_quic_conn_t * conn,
       ctx->metrics.reasm_active           -= victim_exists;
     }
 
-    slot = fd_tpu_reasm_prepare( reasm, conn_uid, stream_id, tspub ); /* infallible */
+    slot = fd_tpu_reasm_prepare( reasm, conn_uid, stream_id, fd_frag_meta_ts_decomp( ctx->rx_tsorig, tspub ) ); /* infallible */
     ctx->metrics.reasm_started++;
     ctx->metrics.reasm_active++;
     conn->srx->rx_streams_active++;
@@ -368,8 +577,10 @@ quic_stream_rx( fd_quic_conn_t * conn,
       ctx->metrics.quic_txn_too_small++;
       return FD_QUIC_SUCCESS; /* ignore */
     }
-    int pub_err = fd_tpu_reasm_publish( reasm, slot, mcache, base, seq, tspub );
+    long tsorig  = fd_frag_meta_ts_decomp( slot->tsorig_comp, tspub );
+    int  pub_err = fd_tpu_reasm_publish( reasm, slot, mcache, base, seq, tspub );
     if( FD_UNLIKELY( pub_err!=FD_TPU_REASM_SUCCESS ) ) return FD_QUIC_SUCCESS; /* unreachable */
+    net_rx_latency_sample( ctx, tsorig, tspub );
     ulong * rcv_cnt = (offset==0UL && fin) ? &ctx->metrics.txns_received_quic_fast : &ctx->metrics.txns_received_quic_frag;
     (*rcv_cnt)++;
     ctx->metrics.reasm_active--;
@@ -466,11 +677,8 @@ unprivileged_init( fd_topo_t *      topo,
   if( FD_UNLIKELY( tile->in_cnt==0 ) ) {
     FD_LOG_ERR(( "quic tile has no input links" ));
   }
-  for( ulong i=0; i<tile->in_cnt; i++ ) {
-    fd_topo_link_t * link = &topo->links[ tile->in_link_id[ i ] ];
-    if( FD_UNLIKELY( 0!=strcmp( link->name, "net_quic" ) ) ) {
-      FD_LOG_ERR(( "unexpected input link %s", link->name ));
-    }
+  if( FD_UNLIKELY( tile->in_cnt>32UL ) ) {
+    FD_LOG_ERR(( "quic tile has too many input links (%lu)", tile->in_cnt ));
   }
 
   if( FD_UNLIKELY( tile->out_cnt!=2UL ||
@@ -491,6 +699,28 @@ unprivileged_init( fd_topo_t *      topo,
   fd_quic_ctx_t * ctx = FD_SCRATCH_ALLOC_APPEND( l, alignof( fd_quic_ctx_t ), sizeof( fd_quic_ctx_t ) );
   fd_memset( ctx, 0, sizeof(fd_quic_ctx_t) );
 
+  ulong net_in_idx = ULONG_MAX;
+  for( ulong i=0; i<tile->in_cnt; i++ ) {
+    fd_topo_link_t * link = &topo->links[ tile->in_link_id[ i ] ];
+    if( FD_LIKELY( !strcmp( link->name, "net_quic" ) ) ) {
+      ctx->in_kind[ i ] = IN_KIND_NET;
+      net_in_idx = fd_ulong_min( net_in_idx, i );
+      continue;
+    } else if( !strcmp( link->name, "stake_out" ) ) {
+      ctx->in_kind[ i ] = IN_KIND_STAKE;
+    } else if( !strcmp( link->name, "crds_shred" ) ) {
+      ctx->in_kind[ i ] = IN_KIND_CONTACT;
+    } else {
+      FD_LOG_ERR(( "unexpected input link %s", link->name ));
+    }
+    ctx->in[ i ].mem    = topo->workspaces[ topo->objs[ link->dcache_obj_id ].wksp_id ].wksp;
+    ctx->in[ i ].chunk0 = fd_dcache_compact_chunk0( ctx->in[ i ].mem, link->dcache );
+    ctx->in[ i ].wmark  = fd_dcache_compact_wmark ( ctx->in[ i ].mem, link->dcache, link->mtu );
+  }
+  if( FD_UNLIKELY( net_in_idx==ULONG_MAX ) ) {
+    FD_LOG_ERR(( "quic tile has no net_quic input link" ));
+  }
+
   if( FD_UNLIKELY( getrandom( ctx->tls_priv_key, ED25519_PRIV_KEY_SZ, 0 )!=ED25519_PRIV_KEY_SZ ) ) {
     FD_LOG_ERR(( "getrandom failed (%i-%s)", errno, fd_io_strerror( errno ) ));
   }
@@ -511,6 +741,33 @@ unprivileged_init( fd_topo_t *      topo,
   ctx->reasm       = fd_tpu_reasm_join( fd_tpu_reasm_new( reasm_mem, out_depth, reasm_max, orig, txn_dcache ) );
   if( FD_UNLIKELY( !ctx->reasm ) ) FD_LOG_ERR(( "fd_tpu_reasm_new failed" ));
 
+  fd_tpu_admit_limits_t admit_limits = {
+    .staked_initial_rate      = tile->quic.admit_staked_initial_rate,
+    .unstaked_initial_rate    = tile->quic.admit_unstaked_initial_rate,
+    .unstaked_src_initial_max = tile->quic.admit_unstaked_source_initial_max,
+    .staked_stream_rate       = tile->quic.admit_staked_stream_rate,
+    .unstaked_stream_rate     = tile->quic.admit_unstaked_stream_rate,
+    .window_ns                = 100000000UL /* 100ms */
+  };
+  ulong  admit_seed = 0UL;
+  if( FD_UNLIKELY( getrandom( &admit_seed, sizeof(ulong), 0 )!=sizeof(ulong) ) ) {
+    FD_LOG_ERR(( "getrandom failed (%i-%s)", errno, fd_io_strerror( errno ) ));
+  }
+  void * admit_mem = FD_SCRATCH_ALLOC_APPEND( l, fd_tpu_admit_align(), fd_tpu_admit_footprint( MAX_SHRED_DESTS ) );
+  ctx->admit       = fd_tpu_admit_join( fd_tpu_admit_new( admit_mem, MAX_SHRED_DESTS, &admit_limits, fd_tempo_tick_per_ns( NULL ), admit_seed ) );
+  if( FD_UNLIKELY( !ctx->admit ) ) FD_LOG_ERR(( "fd_tpu_admit_new failed" ));
+  ctx->admit_conns = FD_SCRATCH_ALLOC_APPEND( l, alignof(fd_tpu_admit_conn_t), limits.conn_cnt*sizeof(fd_tpu_admit_conn_t) );
+  fd_memset( ctx->admit_conns, 0, limits.conn_cnt*sizeof(fd_tpu_admit_conn_t) );
+
+  /* stake_ci is only used to look up stakes and addresses of peers, so
+     the local identity does not matter.  Use the TLS key, which is not
+     part of the cluster. */
+  void * stake_ci_mem = FD_SCRATCH_ALLOC_APPEND( l, fd_stake_ci_align(), fd_stake_ci_footprint() );
+  ctx->stake_ci       = fd_stake_ci_join( fd_stake_ci_new( stake_ci_mem, fd_type_pun_const( ctx->tls_pub_key ) ) );
+  if( FD_UNLIKELY( !ctx->stake_ci ) ) FD_LOG_ERR(( "fd_stake_ci_new failed" ));
+
+  fd_quic_hs_backlog_init( ctx->hs_backlog, FD_SCRATCH_ALLOC_APPEND( l, FD_CHUNK_ALIGN, FD_QUIC_HS_BACKLOG_DATA_SZ ) );
+
   if( FD_UNLIKELY( tile->quic.ack_delay_millis == 0 ) ) {
     FD_LOG_ERR(( "Invalid `ack_delay_millis`: must be greater than zero" ));
   }
@@ -525,9 +782,20 @@ unprivileged_init( fd_topo_t *      topo,
   quic->config.retry                      = tile->quic.retry;
   fd_memcpy( quic->config.identity_public_key, ctx->tls_pub_key, ED25519_PUB_KEY_SZ );
 
+  /* Each quic tile issues conn IDs encoding its tile index, such that
+     net tiles can steer packets to the quic tile owning the conn.  All
+     quic tiles share the same retry token keys. */
+  quic->config.shard_idx = tile->kind_id;
+  quic->config.shard_cnt = fd_topo_tile_name_cnt( topo, tile->name );
+  FD_STATIC_ASSERT( sizeof(tile->quic.retry_secret)==FD_QUIC_RETRY_SECRET_SZ, layout );
+  FD_STATIC_ASSERT( sizeof(tile->quic.retry_iv    )==FD_QUIC_RETRY_IV_SZ,     layout );
+  fd_memcpy( quic->config.retry_secret, tile->quic.retry_secret, FD_QUIC_RETRY_SECRET_SZ );
+  fd_memcpy( quic->config.retry_iv,     tile->quic.retry_iv,     FD_QUIC_RETRY_IV_SZ     );
+
   quic->config.sign         = quic_tls_cv_sign;
   quic->config.sign_ctx     = ctx;
 
+  quic->cb.conn_new         = quic_conn_new;
   quic->cb.conn_final       = quic_conn_final;
   quic->cb.stream_rx        = quic_stream_rx;
   quic->cb.now              = quic_now;
@@ -538,7 +806,7 @@ unprivileged_init( fd_topo_t *      topo,
   fd_quic_set_clock_tickcount( quic );
   if( FD_UNLIKELY( !fd_quic_init( quic ) ) ) FD_LOG_ERR(( "fd_quic_init failed" ));
 
-  fd_topo_link_t * net_in = &topo->links[ tile->in_link_id[ 0 ] ];
+  fd_topo_link_t * net_in = &topo->links[ tile->in_link_id[ net_in_idx ] ];
   fd_net_rx_bounds_init( &ctx->net_in_bounds, net_in->dcache );
 
   fd_topo_link_t * net_out = &topo->links[ tile->out_link_id[ 1 ] ];
@@ -572,6 +840,8 @@ unprivileged_init( fd_topo_t *      topo,
                                                                     FD_MHIST_SECONDS_MAX( QUIC, SERVICE_DURATION_SECONDS ) ) );
   fd_histf_join( fd_histf_new( ctx->quic->metrics.receive_duration, FD_MHIST_SECONDS_MIN( QUIC, RECEIVE_DURATION_SECONDS ),
                                                                     FD_MHIST_SECONDS_MAX( QUIC, RECEIVE_DURATION_SECONDS ) ) );
+  fd_histf_join( fd_histf_new( ctx->metrics.net_rx_latency,         FD_MHIST_SECONDS_MIN( QUIC, NET_RX_LATENCY_SECONDS   ),
+                                                                    FD_MHIST_SECONDS_MAX( QUIC, NET_RX_LATENCY_SECONDS   ) ) );
 }
 
 static ulong
@@ -2,6 +2,9 @@
 #define HEADER_fd_src_app_fdctl_run_tiles_fd_quic_tile_h
 
 #include "fd_tpu.h"
+#include "fd_tpu_admit.h"
+#include "fd_quic_hs_backlog.h"
+#include "../shred/fd_stake_ci.h"
 #include "../stem/fd_stem.h"
 #include "../net/fd_net_tile.h"
 #include "../../waltz/quic/fd_quic.h"
@@ -22,11 +25,46 @@ typedef struct {
 
   uchar buffer[ FD_NET_MTU ];
 
+  /* udp_buf points to the TPU/UDP payload of the current frag if
+     during_frag copied it straight into the next tpu_reasm slot, NULL
+     otherwise. */
+  uchar * udp_buf;
+
   ulong round_robin_cnt;
   ulong round_robin_id;
 
   fd_net_rx_bounds_t net_in_bounds;
 
+  /* Stake-weighted admission control.  admit_conns is indexed by conn
+     idx.  Stakes and peer addresses come from stake_ci, which tracks
+     the stake_out and crds_shred links. */
+
+  fd_tpu_admit_t *      admit;
+  fd_tpu_admit_conn_t * admit_conns;
+  fd_stake_ci_t *       stake_ci;
+  ulong                 stake_slot;
+  ulong                 stake_slot_pending;
+  ulong                 contact_cnt_pending;
+
+  /* Handshake backlog.  Initial packets are deferred such that
+     handshake crypto does not delay processing of packets on
+     established conns. */
+
+  fd_quic_hs_backlog_t hs_backlog[1];
+
+  /* Compressed RX timestamp (see fd_frag_meta_ts_comp) of the packet
+     currently being processed.  Published as the tsorig of
+     transactions, such that downstream tiles can measure latency since
+     the packet was received. */
+  ulong rx_tsorig;
+
+  int in_kind[ 32 ];
+  struct {
+    fd_wksp_t * mem;
+    ulong       chunk0;
+    ulong       wmark;
+  } in[ 32 ];
+
   fd_frag_meta_t * net_out_mcache;
   ulong *          net_out_sync;
   ulong            net_out_depth;
@@ -54,6 +92,8 @@ typedef struct {
     ulong udp_pkt_too_large;
     ulong quic_txn_too_small;
     ulong quic_txn_too_large;
+    ulong hs_backlog_dropped;
+    fd_histf_t net_rx_latency[1];
   } metrics;
 } fd_quic_ctx_t;
 
@@ -240,20 +240,25 @@ fd_tpu_reasm_peek_tail( fd_tpu_reasm_t * reasm ) {
   return tail;
 }
 
+/* fd_tpu_reasm_prepare starts a new stream reassembly.  tsorig is the
+   time the first stream frag was received (e.g. the RX timestamp of
+   the packet carrying it).  It is published as the tsorig of the
+   reassembled message. */
+
 fd_tpu_reasm_slot_t *
 fd_tpu_reasm_prepare( fd_tpu_reasm_t * reasm,
                       ulong            conn_uid,
                       ulong            stream_id,
-                      long             tspub );
+                      long             tsorig );
 
 static inline fd_tpu_reasm_slot_t *
 fd_tpu_reasm_acquire( fd_tpu_reasm_t * reasm,
                       ulong            conn_uid,
                       ulong            stream_id,
-                      long             tspub ) {
+                      long             tsorig ) {
   fd_tpu_reasm_slot_t * slot = fd_tpu_reasm_query( reasm, conn_uid, stream_id );
   if( !slot ) {
-    slot = fd_tpu_reasm_prepare( reasm, conn_uid, stream_id, tspub );
+    slot = fd_tpu_reasm_prepare( reasm, conn_uid, stream_id, tsorig );
   }
   return slot;
 }
@@ -297,7 +302,9 @@ fd_tpu_reasm_publish( fd_tpu_reasm_t *      reasm,
                       long                  tspub );
 
 /* fd_tpu_reasm_publish_fast is a streamlined version of acquire/frag/
-   publish. */
+   publish.  tsorig is the time the message was received (see
+   fd_tpu_reasm_prepare).  If data is the buffer returned by
+   fd_tpu_reasm_fast_buf, publishes the message without copying. */
 
 int
 fd_tpu_reasm_publish_fast( fd_tpu_reasm_t * reasm,
@@ -306,8 +313,21 @@ fd_tpu_reasm_publish_fast( fd_tpu_reasm_t * reasm,
                            fd_frag_meta_t * mcache,
                            void *           base,  /* Assumed aligned FD_CHUNK_ALIGN */
                            ulong            seq,
+                           long             tsorig,
                            long             tspub );
 
+/* fd_tpu_reasm_fast_buf returns the data buffer of the slot that the
+   next call to fd_tpu_reasm_publish_fast will use.  The caller may
+   write up to FD_TPU_REASM_MTU bytes to it (e.g. directly from a
+   speculatively read frag) and then publish them without a copy.  The
+   buffer is not visible to consumers until published, so it is fine to
+   abandon a partial write.  Returns NULL if the slot currently holds an
+   active reassembly.  The returned pointer is invalidated by any other
+   tpu_reasm call. */
+
+uchar *
+fd_tpu_reasm_fast_buf( fd_tpu_reasm_t * reasm );
+
 /* fd_tpu_reasm_cancel cancels the given stream reassembly. */
 
 void
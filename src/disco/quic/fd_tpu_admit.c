@@ -0,0 +1,390 @@
+#include "fd_tpu_admit.h"
+
+#define MAP_NAME              fd_tpu_admit_peer_map
+#define MAP_T                 fd_tpu_admit_peer_t
+#define MAP_KEY               ip4
+#define MAP_KEY_T             uint
+#define MAP_KEY_NULL          0U
+#define MAP_KEY_INVAL(k)      !(k)
+#define MAP_KEY_EQUAL(k0,k1)  (k0)==(k1)
+#define MAP_KEY_EQUAL_IS_SLOW 0
+#define MAP_KEY_HASH(k)       ((uint)fd_ulong_hash( (ulong)(k) ))
+#define MAP_MEMOIZE           0
+#include "../../util/tmpl/fd_map_dynamic.c"
+
+/* FD_TPU_ADMIT_PEER_MAX bounds peer_max such that the peer map slot
+   count fits comfortably into an int. */
+
+#define FD_TPU_ADMIT_PEER_MAX (1UL<<24)
+
+static int
+fd_tpu_admit_lg_slot_cnt( ulong peer_max ) {
+  /* Keep the map at most half full */
+  return fd_ulong_find_msb( peer_max ) + 2;
+}
+
+FD_FN_CONST ulong
+fd_tpu_admit_align( void ) {
+  return fd_ulong_max( FD_TPU_ADMIT_ALIGN, fd_tpu_admit_peer_map_align() );
+}
+
+FD_FN_CONST ulong
+fd_tpu_admit_footprint( ulong peer_max ) {
+  if( FD_UNLIKELY( (!peer_max) | (peer_max>FD_TPU_ADMIT_PEER_MAX) ) ) return 0UL;
+  ulong l = FD_LAYOUT_INIT;
+  l = FD_LAYOUT_APPEND( l, FD_TPU_ADMIT_ALIGN,                  sizeof(fd_tpu_admit_t) );
+  l = FD_LAYOUT_APPEND( l, fd_tpu_admit_peer_map_align(),
+                           fd_tpu_admit_peer_map_footprint( fd_tpu_admit_lg_slot_cnt( peer_max ) ) );
+  l = FD_LAYOUT_APPEND( l, alignof(fd_tpu_admit_stake_t),       peer_max*sizeof(fd_tpu_admit_stake_t) );
+  l = FD_LAYOUT_APPEND( l, alignof(fd_tpu_admit_stake_t),       peer_max*sizeof(fd_tpu_admit_stake_t) );
+  return FD_LAYOUT_FINI( l, fd_tpu_admit_align() );
+}
+
+/* rate_per_tick converts a rate in units per second to units per tick */
+
+static float
+rate_per_tick( ulong  rate,
+               double tick_per_ns ) {
+  return (float)( (double)rate / ( tick_per_ns * 1e9 ) );
+}
+
+/* bucket_reset configures a token bucket to refill at the given rate
+   (per tick), holding up to one window of tokens.  Starts out full. */
+
+static void
+bucket_reset( fd_token_bucket_t * bucket,
+              float               rate,
+              long                window,
+              long                now ) {
+  float burst = fmaxf( rate*(float)window, 1.0f );
+  bucket->ts      = now;
+  bucket->rate    = rate;
+  bucket->burst   = burst;
+  bucket->balance = burst;
+}
+
+/* bucket_update reconfigures a token bucket like bucket_reset, but
+   keeps its balance (refilled up to now at the old rate, capped to the
+   new burst).  Buckets with a zero burst were never configured and
+   start out full. */
+
+static void
+bucket_update( fd_token_bucket_t * bucket,
+               float               rate,
+               long                window,
+               long                now ) {
+  if( bucket->burst<=0.0f ) {
+    bucket_reset( bucket, rate, window, now );
+    return;
+  }
+  float balance = fminf( bucket->balance + (float)( now - bucket->ts )*bucket->rate, bucket->burst );
+  float burst   = fmaxf( rate*(float)window, 1.0f );
+  bucket->ts      = now;
+  bucket->rate    = rate;
+  bucket->burst   = burst;
+  bucket->balance = fminf( balance, burst );
+}
+
+/* bucket_consume consumes a token.  Buckets with a zero rate are
+   unlimited. */
+
+static inline int
+bucket_consume( fd_token_bucket_t * bucket,
+                long                now ) {
+  if( bucket->rate<=0.0f ) return 1;
+  return fd_token_bucket_consume( bucket, 1.0f, now );
+}
+
+void *
+fd_tpu_admit_new( void *                        shmem,
+                  ulong                         peer_max,
+                  fd_tpu_admit_limits_t const * limits,
+                  double                        tick_per_ns,
+                  ulong                         seed ) {
+
+  if( FD_UNLIKELY( !shmem ) ) {
+    FD_LOG_WARNING(( "NULL shmem" ));
+    return NULL;
+  }
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shmem, fd_tpu_admit_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shmem" ));
+    return NULL;
+  }
+  if( FD_UNLIKELY( !fd_tpu_admit_footprint( peer_max ) ) ) {
+    FD_LOG_WARNING(( "invalid peer_max %lu", peer_max ));
+    return NULL;
+  }
+  if( FD_UNLIKELY( !limits->window_ns ) ) {
+    FD_LOG_WARNING(( "zero window_ns" ));
+    return NULL;
+  }
+  if( FD_UNLIKELY( !(tick_per_ns>0.0) ) ) {
+    FD_LOG_WARNING(( "invalid tick_per_ns" ));
+    return NULL;
+  }
+
+  int lg_slot_cnt = fd_tpu_admit_lg_slot_cnt( peer_max );
+
+  FD_SCRATCH_ALLOC_INIT( l, shmem );
+  fd_tpu_admit_t * admit    = FD_SCRATCH_ALLOC_APPEND( l, FD_TPU_ADMIT_ALIGN,            sizeof(fd_tpu_admit_t) );
+  void *           map_mem  = FD_SCRATCH_ALLOC_APPEND( l, fd_tpu_admit_peer_map_align(), fd_tpu_admit_peer_map_footprint( lg_slot_cnt ) );
+  void *           list0    = FD_SCRATCH_ALLOC_APPEND( l, alignof(fd_tpu_admit_stake_t),  peer_max*sizeof(fd_tpu_admit_stake_t) );
+  void *           list1    = FD_SCRATCH_ALLOC_APPEND( l, alignof(fd_tpu_admit_stake_t),  peer_max*sizeof(fd_tpu_admit_stake_t) );
+  FD_SCRATCH_ALLOC_FINI( l, fd_tpu_admit_align() );
+
+  fd_memset( admit, 0, sizeof(fd_tpu_admit_t) );
+
+  fd_tpu_admit_peer_t * map = fd_tpu_admit_peer_map_join( fd_tpu_admit_peer_map_new( map_mem, lg_slot_cnt ) );
+  if( FD_UNLIKELY( !map ) ) {
+    FD_LOG_WARNING(( "fd_tpu_admit_peer_map_new failed" ));
+    return NULL;
+  }
+
+  admit->peer_map_off = (ulong)map - (ulong)admit;
+  admit->peer_max     = peer_max;
+
+  admit->stake_list_off[ 0 ] = (ulong)list0 - (ulong)admit;
+  admit->stake_list_off[ 1 ] = (ulong)list1 - (ulong)admit;
+
+  admit->staked_initial_rate      = rate_per_tick( limits->staked_initial_rate,   tick_per_ns );
+  admit->unstaked_initial_rate    = rate_per_tick( limits->unstaked_initial_rate, tick_per_ns );
+  admit->staked_stream_rate       = rate_per_tick( limits->staked_stream_rate,    tick_per_ns );
+  admit->unstaked_stream_rate     = rate_per_tick( limits->unstaked_stream_rate,  tick_per_ns );
+  admit->unstaked_src_initial_max = (uint)fd_ulong_min( limits->unstaked_src_initial_max, USHORT_MAX );
+  admit->window                   = fd_long_max( (long)( (double)limits->window_ns * tick_per_ns ), 1L );
+
+  bucket_reset( &admit->unstaked_initial, admit->unstaked_initial_rate, admit->window, 0L );
+
+  admit->sketch_seed = seed;
+
+  FD_COMPILER_MFENCE();
+  admit->magic = FD_TPU_ADMIT_MAGIC;
+  FD_COMPILER_MFENCE();
+
+  return admit;
+}
+
+fd_tpu_admit_t *
+fd_tpu_admit_join( void * shadmit ) {
+  if( FD_UNLIKELY( !shadmit ) ) {
+    FD_LOG_WARNING(( "NULL shadmit" ));
+    return NULL;
+  }
+  fd_tpu_admit_t * admit = shadmit;
+  if( FD_UNLIKELY( admit->magic!=FD_TPU_ADMIT_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+  return admit;
+}
+
+void *
+fd_tpu_admit_leave( fd_tpu_admit_t * admit ) {
+  return admit;
+}
+
+void *
+fd_tpu_admit_delete( void * shadmit ) {
+  if( FD_UNLIKELY( !shadmit ) ) return NULL;
+  fd_tpu_admit_t * admit = shadmit;
+  if( FD_UNLIKELY( admit->magic!=FD_TPU_ADMIT_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+  FD_COMPILER_MFENCE();
+  admit->magic = 0UL;
+  FD_COMPILER_MFENCE();
+  return shadmit;
+}
+
+static inline fd_tpu_admit_peer_t *
+fd_tpu_admit_peer_map( fd_tpu_admit_t * admit ) {
+  return (fd_tpu_admit_peer_t *)( (ulong)admit + admit->peer_map_off );
+}
+
+static inline fd_tpu_admit_stake_t *
+fd_tpu_admit_stake_list( fd_tpu_admit_t * admit,
+                         uint             idx ) {
+  return (fd_tpu_admit_stake_t *)( (ulong)admit + admit->stake_list_off[ idx ] );
+}
+
+void
+fd_tpu_admit_stakes_init( fd_tpu_admit_t * admit ) {
+  admit->stake_cnt[ !admit->stake_idx ] = 0UL;
+}
+
+void
+fd_tpu_admit_stakes_add( fd_tpu_admit_t * admit,
+                         uint             ip4,
+                         ulong            stake ) {
+  if( FD_UNLIKELY( (!ip4) | (!stake) ) ) return;
+
+  uint  idx = !admit->stake_idx;
+  ulong cnt = admit->stake_cnt[ idx ];
+  if( FD_UNLIKELY( cnt>=admit->peer_max ) ) return;
+  fd_tpu_admit_stake_list( admit, idx )[ cnt ] = (fd_tpu_admit_stake_t){ .ip4 = ip4, .stake = stake };
+  admit->stake_cnt[ idx ] = cnt+1UL;
+}
+
+void
+fd_tpu_admit_stakes_fini( fd_tpu_admit_t * admit,
+                          long             now ) {
+  uint                         prev_idx = admit->stake_idx;
+  uint                         next_idx = !prev_idx;
+  fd_tpu_admit_stake_t const * prev     = fd_tpu_admit_stake_list( admit, prev_idx );
+  fd_tpu_admit_stake_t const * next     = fd_tpu_admit_stake_list( admit, next_idx );
+  ulong                        prev_cnt = admit->stake_cnt[ prev_idx ];
+  ulong                        next_cnt = admit->stake_cnt[ next_idx ];
+
+  /* Contact info and stake updates mostly repeat the current set */
+  if( next_cnt==prev_cnt ) {
+    ulong i;
+    for( i=0UL; i<next_cnt; i++ ) {
+      if( (next[i].ip4!=prev[i].ip4) | (next[i].stake!=prev[i].stake) ) break;
+    }
+    if( i==next_cnt ) return;
+  }
+
+  fd_tpu_admit_peer_t * map = fd_tpu_admit_peer_map( admit );
+
+  /* Forget the stake of current peers, but keep their token buckets */
+  for( ulong i=0UL; i<prev_cnt; i++ ) {
+    fd_tpu_admit_peer_t * peer = fd_tpu_admit_peer_map_query( map, prev[i].ip4, NULL );
+    if( peer ) peer->stake = 0UL;
+  }
+
+  /* Apply new stakes.  Newly staked peers get unconfigured buckets.
+     The map has room for both the old and the new peers. */
+  ulong staked_cnt  = 0UL;
+  ulong stake_total = 0UL;
+  for( ulong i=0UL; i<next_cnt; i++ ) {
+    fd_tpu_admit_peer_t * peer = fd_tpu_admit_peer_map_query( map, next[i].ip4, NULL );
+    if( !peer ) {
+      if( FD_UNLIKELY( staked_cnt>=admit->peer_max ) ) continue;
+      peer = fd_tpu_admit_peer_map_insert( map, next[i].ip4 );
+      peer->stake = 0UL;
+      fd_memset( &peer->initial, 0, sizeof(fd_token_bucket_t) );
+      fd_memset( &peer->stream,  0, sizeof(fd_token_bucket_t) );
+    }
+    staked_cnt  += (ulong)!peer->stake;
+    peer->stake += next[i].stake;
+    stake_total += next[i].stake;
+  }
+
+  /* Remove peers that are no longer staked */
+  for( ulong i=0UL; i<prev_cnt; i++ ) {
+    fd_tpu_admit_peer_t * peer = fd_tpu_admit_peer_map_query( map, prev[i].ip4, NULL );
+    if( peer && !peer->stake ) fd_tpu_admit_peer_map_remove( map, peer );
+  }
+
+  admit->stake_total = stake_total;
+  admit->staked_cnt  = staked_cnt;
+  admit->stake_idx   = next_idx;
+
+  /* Recompute rates.  Peers listed multiple times are updated multiple
+     times, which is harmless. */
+  float  initial_min = (float)admit->unstaked_src_initial_max / (float)admit->window;
+  double stake_div   = (double)fd_ulong_max( stake_total, 1UL );
+  for( ulong i=0UL; i<next_cnt; i++ ) {
+    fd_tpu_admit_peer_t * peer = fd_tpu_admit_peer_map_query( map, next[i].ip4, NULL );
+    if( !peer ) continue;
+    float share = (float)( (double)peer->stake / stake_div );
+
+    /* Staked peers get at least the Initial budget of an unstaked
+       source.  The per-connection stream floor is applied by
+       fd_tpu_admit_stream. */
+    float initial_rate = admit->staked_initial_rate>0.0f ? fmaxf( admit->staked_initial_rate*share, initial_min ) : 0.0f;
+    float stream_rate  = admit->staked_stream_rate*share;
+    bucket_update( &peer->initial, initial_rate, admit->window, now );
+    bucket_update( &peer->stream,  stream_rate,  admit->window, now );
+  }
+}
+
+ulong
+fd_tpu_admit_stake( fd_tpu_admit_t * admit,
+                    uint             ip4 ) {
+  if( FD_UNLIKELY( !ip4 ) ) return 0UL;
+  fd_tpu_admit_peer_t * peer = fd_tpu_admit_peer_map_query( fd_tpu_admit_peer_map( admit ), ip4, NULL );
+  return peer ? peer->stake : 0UL;
+}
+
+/* sketch_admit counts an Initial packet from unstaked source ip4 in the
+   current window.  Returns 0 if the source is over budget. */
+
+static int
+sketch_admit( fd_tpu_admit_t * admit,
+              uint             ip4,
+              long             now ) {
+  uint max = admit->unstaked_src_initial_max;
+  if( !max ) return 1;
+
+  if( FD_UNLIKELY( now - admit->sketch_ts >= admit->window ) ) {
+    fd_memset( admit->sketch, 0, sizeof(admit->sketch) );
+    admit->sketch_ts = now;
+  }
+
+  ulong    hash = fd_ulong_hash( admit->sketch_seed ^ (ulong)ip4 );
+  ushort * c0   = &admit->sketch[ 0 ][  hash      & (FD_TPU_ADMIT_SKETCH_WIDTH-1UL) ];
+  ushort * c1   = &admit->sketch[ 1 ][ (hash>>32) & (FD_TPU_ADMIT_SKETCH_WIDTH-1UL) ];
+  uint     est  = fd_uint_min( *c0, *c1 );
+  if( est>=max ) return 0;
+
+  /* Conservative update: only bump counters at the estimate */
+  est++;
+  *c0 = (ushort)fd_uint_max( *c0, est );
+  *c1 = (ushort)fd_uint_max( *c1, est );
+  return 1;
+}
+
+int
+fd_tpu_admit_initial( fd_tpu_admit_t * admit,
+                      uint             ip4,
+                      long             now ) {
+  fd_tpu_admit_peer_t * peer = NULL;
+  if( admit->staked_cnt && ip4 ) {
+    peer = fd_tpu_admit_peer_map_query( fd_tpu_admit_peer_map( admit ), ip4, NULL );
+  }
+
+  /* The source address is not authenticated, so over-budget packets
+     of staked peers fall back to the unstaked path rather than being
+     dropped (see header) */
+  if( peer && bucket_consume( &peer->initial, now ) ) {
+    admit->metrics.initial_admit[ FD_TPU_ADMIT_CLASS_STAKED ]++;
+    return 1;
+  }
+
+  int cls = FD_TPU_ADMIT_CLASS_UNSTAKED;
+  int ok  = sketch_admit( admit, ip4, now ) && bucket_consume( &admit->unstaked_initial, now );
+
+  admit->metrics.initial_admit[ cls ] += (ulong)ok;
+  admit->metrics.initial_drop [ cls ] += (ulong)!ok;
+  return ok;
+}
+
+void
+fd_tpu_admit_conn_init( fd_tpu_admit_t *      admit,
+                        fd_tpu_admit_conn_t * conn,
+                        long                  now ) {
+  bucket_reset( &conn->stream, admit->unstaked_stream_rate, admit->window, now );
+}
+
+int
+fd_tpu_admit_stream( fd_tpu_admit_t *      admit,
+                     fd_tpu_admit_conn_t * conn,
+                     uint                  ip4,
+                     long                  now ) {
+  fd_tpu_admit_peer_t * peer = NULL;
+  if( admit->staked_cnt && ip4 ) {
+    peer = fd_tpu_admit_peer_map_query( fd_tpu_admit_peer_map( admit ), ip4, NULL );
+  }
+
+  /* Every conn gets the unstaked rate.  Staked peers additionally get
+     their share of the staked rate across all of their conns. */
+  int cls = peer ? FD_TPU_ADMIT_CLASS_STAKED : FD_TPU_ADMIT_CLASS_UNSTAKED;
+  int ok  = ( peer && bucket_consume( &peer->stream, now ) ) ||
+            bucket_consume( &conn->stream, now );
+
+  admit->metrics.stream_admit[ cls ] += (ulong)ok;
+  admit->metrics.stream_drop [ cls ] += (ulong)!ok;
+  return ok;
+}
@@ -0,0 +1,245 @@
+#ifndef HEADER_fd_src_disco_quic_fd_tpu_admit_h
+#define HEADER_fd_src_disco_quic_fd_tpu_admit_h
+
+/* fd_tpu_admit provides stake-weighted admission control for TPU/QUIC.
+
+   Without it, the QUIC tile serves handshakes and streams first come
+   first serve, such that spam from unstaked sources can starve staked
+   peers of CPU time.  fd_tpu_admit sits in front of fd_quic and decides
+   which new connection attempts (QUIC Initial packets) and which new
+   streams (txns) get processed.
+
+   Peers are identified by source IPv4 address.  The QUIC server does
+   not request client certificates, so the stake of a peer is looked up
+   via the IP address the peer advertises in gossip.
+
+   ### Initial packets
+
+   Each staked peer gets a token bucket refilled at a rate proportional
+   to its share of total stake.  Unstaked sources share a single token
+   bucket.  Additionally, each unstaked source may only send a bounded
+   number of Initial packets per window.  This is tracked via a
+   count-min sketch over source IP addresses, which is cleared at the
+   start of each window.  Over-budget packets are dropped before they
+   reach fd_quic, i.e. before any decryption or handshake work.
+
+   The source address of an Initial packet is not authenticated, so
+   anyone can spend the budget of a staked peer by spoofing its
+   address.  Packets exceeding a staked peer's budget therefore fall
+   back to the unstaked path (source sketch and shared bucket) instead
+   of being dropped outright.  A spoofer can thus at most demote a
+   staked peer to unstaked treatment.
+
+   ### Streams
+
+   Each staked peer gets a token bucket for new streams refilled at a
+   rate proportional to its share of total stake, shared across all of
+   its connections.  Each connection, staked or not, additionally gets
+   a fixed rate.  Streams exceeding a staked peer's budget fall back to
+   the per-connection rate, such that no connection of a staked peer is
+   ever rate limited below an unstaked connection.
+
+   All rates are configured in units per second.  A rate of zero
+   disables the respective limit.  Token buckets hold up to one window
+   worth of tokens. */
+
+#include "../fd_disco_base.h"
+#include "../../waltz/fd_token_bucket.h"
+
+/* FD_TPU_ADMIT_CLASS_{...} identify traffic classes.  Match the
+   TpuAdmitClass metrics enum. */
+
+#define FD_TPU_ADMIT_CLASS_STAKED   (0)
+#define FD_TPU_ADMIT_CLASS_UNSTAKED (1)
+#define FD_TPU_ADMIT_CLASS_CNT      (2)
+
+/* FD_TPU_ADMIT_SKETCH_{DEPTH,WIDTH} give the dimensions of the
+   unstaked source sketch. */
+
+#define FD_TPU_ADMIT_SKETCH_DEPTH (2UL)
+#define FD_TPU_ADMIT_SKETCH_WIDTH (4096UL)
+
+#define FD_TPU_ADMIT_ALIGN (64UL)
+
+#define FD_TPU_ADMIT_MAGIC (0xf17eda2ce7ad3170UL)
+
+struct fd_tpu_admit_limits {
+  ulong staked_initial_rate;      /* Initial pkts/s, shared by staked peers pro rata */
+  ulong unstaked_initial_rate;    /* Initial pkts/s, shared by all unstaked sources  */
+  ulong unstaked_src_initial_max; /* Initial pkts per unstaked source per window     */
+  ulong staked_stream_rate;       /* streams/s, shared by staked peers pro rata      */
+  ulong unstaked_stream_rate;     /* streams/s per unstaked conn                     */
+  ulong window_ns;                /* sketch window and token bucket burst period     */
+};
+
+typedef struct fd_tpu_admit_limits fd_tpu_admit_limits_t;
+
+/* fd_tpu_admit_conn_t is the per-connection admission state.  Owned by
+   the caller, initialized with fd_tpu_admit_conn_init. */
+
+struct fd_tpu_admit_conn {
+  fd_token_bucket_t stream;
+};
+
+typedef struct fd_tpu_admit_conn fd_tpu_admit_conn_t;
+
+struct fd_tpu_admit_peer {
+  uint              ip4;  /* map key, 0 is null */
+  ulong             stake;
+  fd_token_bucket_t initial;
+  fd_token_bucket_t stream;
+};
+
+typedef struct fd_tpu_admit_peer fd_tpu_admit_peer_t;
+
+/* fd_tpu_admit_stake_t is an (address,stake) pair as passed to
+   fd_tpu_admit_stakes_add. */
+
+struct fd_tpu_admit_stake {
+  uint  ip4;
+  ulong stake;
+};
+
+typedef struct fd_tpu_admit_stake fd_tpu_admit_stake_t;
+
+struct __attribute__((aligned(FD_TPU_ADMIT_ALIGN))) fd_tpu_admit {
+  ulong magic;
+
+  ulong peer_map_off;
+  ulong peer_max;
+
+  /* stake_list[ stake_idx ] is the stake list the peer map was built
+     from, stake_list[ !stake_idx ] is the one being staged */
+  ulong stake_list_off[ 2 ];
+  ulong stake_cnt     [ 2 ];
+  uint  stake_idx;
+
+  ulong stake_total;
+  ulong staked_cnt;
+
+  /* Limits converted to tokens per tick */
+  float staked_initial_rate;
+  float unstaked_initial_rate;
+  float staked_stream_rate;
+  float unstaked_stream_rate;
+  uint  unstaked_src_initial_max;
+  long  window;  /* in ticks */
+
+  fd_token_bucket_t unstaked_initial;
+
+  ulong sketch_seed;
+  long  sketch_ts;
+
+  struct {
+    ulong initial_admit  [ FD_TPU_ADMIT_CLASS_CNT ];
+    ulong initial_drop   [ FD_TPU_ADMIT_CLASS_CNT ];
+    ulong stream_admit   [ FD_TPU_ADMIT_CLASS_CNT ];
+    ulong stream_drop    [ FD_TPU_ADMIT_CLASS_CNT ];
+  } metrics;
+
+  ushort sketch[ FD_TPU_ADMIT_SKETCH_DEPTH ][ FD_TPU_ADMIT_SKETCH_WIDTH ];
+
+  /* peer map follows */
+};
+
+typedef struct fd_tpu_admit fd_tpu_admit_t;
+
+FD_PROTOTYPES_BEGIN
+
+FD_FN_CONST ulong
+fd_tpu_admit_align( void );
+
+/* fd_tpu_admit_footprint returns the footprint of an fd_tpu_admit_t
+   tracking up to peer_max staked peers.  Returns 0 if peer_max is
+   invalid. */
+
+FD_FN_CONST ulong
+fd_tpu_admit_footprint( ulong peer_max );
+
+/* fd_tpu_admit_new formats a memory region as an fd_tpu_admit_t.
+   tick_per_ns is the rate of the clock used for 'now' arguments (e.g.
+   fd_tempo_tick_per_ns( NULL ) for fd_tickcount).  seed randomizes the
+   source sketch hash.  Initially, no peers are staked. */
+
+void *
+fd_tpu_admit_new( void *                        shmem,
+                  ulong                         peer_max,
+                  fd_tpu_admit_limits_t const * limits,
+                  double                        tick_per_ns,
+                  ulong                         seed );
+
+fd_tpu_admit_t *
+fd_tpu_admit_join( void * shadmit );
+
+void *
+fd_tpu_admit_leave( fd_tpu_admit_t * admit );
+
+void *
+fd_tpu_admit_delete( void * shadmit );
+
+/* fd_tpu_admit_stakes_{init,add,fini} replace the set of staked peers.
+   init starts staging a new set.  add adds the stake of a peer
+   reachable at ip4.  Stake of peers sharing an IP address is summed.
+   Ignores peers without stake or address, and peers beyond peer_max.
+   fini replaces the current set with the staged one at time now.
+   Admission decisions made between init and fini use the current set.
+
+   fini is cheap if the staged set is identical (same peers and stakes
+   added in the same order) to the current one, in which case nothing
+   changes.  Otherwise, token bucket rates are recomputed from the new
+   stake distribution.  Peers that remain staked keep their token
+   bucket balances (capped to the new burst size), newly staked peers
+   start with full buckets.  The cost of fini is proportional to the
+   number of staked peers, not to peer_max. */
+
+void
+fd_tpu_admit_stakes_init( fd_tpu_admit_t * admit );
+
+void
+fd_tpu_admit_stakes_add( fd_tpu_admit_t * admit,
+                         uint             ip4,
+                         ulong            stake );
+
+void
+fd_tpu_admit_stakes_fini( fd_tpu_admit_t * admit,
+                          long             now );
+
+/* fd_tpu_admit_stake returns the stake of the peer at ip4, or 0 if it
+   is unstaked. */
+
+ulong
+fd_tpu_admit_stake( fd_tpu_admit_t * admit,
+                    uint             ip4 );
+
+/* fd_tpu_admit_initial decides whether to process a QUIC Initial packet
+   received from ip4 at time now.  Returns 1 if the packet should be
+   processed, 0 if it should be dropped.  Packets of a staked peer that
+   are admitted or dropped by the unstaked fallback count towards the
+   unstaked class in metrics. */
+
+int
+fd_tpu_admit_initial( fd_tpu_admit_t * admit,
+                      uint             ip4,
+                      long             now );
+
+/* fd_tpu_admit_conn_init initializes the admission state of a new conn
+   at time now. */
+
+void
+fd_tpu_admit_conn_init( fd_tpu_admit_t *      admit,
+                        fd_tpu_admit_conn_t * conn,
+                        long                  now );
+
+/* fd_tpu_admit_stream decides whether to accept a new stream on conn,
+   with peer address ip4, at time now.  Returns 1 if the stream should
+   be accepted, 0 if it should be dropped. */
+
+int
+fd_tpu_admit_stream( fd_tpu_admit_t *      admit,
+                     fd_tpu_admit_conn_t * conn,
+                     uint                  ip4,
+                     long                  now );
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_disco_quic_fd_tpu_admit_h */
@@ -306,6 +306,14 @@ fd_tpu_reasm_cancel( fd_tpu_reasm_t *      reasm,
   slotq_push_tail( reasm, slot );
 }
 
+uchar *
+fd_tpu_reasm_fast_buf( fd_tpu_reasm_t * reasm ) {
+  uint                  tail_idx = reasm->tail;
+  fd_tpu_reasm_slot_t * tail     = fd_tpu_reasm_slots_laddr( reasm ) + tail_idx;
+  if( FD_UNLIKELY( tail->k.state!=FD_TPU_REASM_STATE_FREE ) ) return NULL;
+  return slot_get_data( reasm, tail_idx );
+}
+
 int
 fd_tpu_reasm_publish_fast( fd_tpu_reasm_t * reasm,
                            uchar const *    data,
@@ -313,6 +321,7 @@ fd_tpu_reasm_publish_fast( fd_tpu_reasm_t * reasm,
                            fd_frag_meta_t * mcache,
                            void *           base,  /* Assumed aligned FD_CHUNK_ALIGN */
                            ulong            seq,
+                           long             tsorig,
                            long             tspub ) {
 
   ulong depth = reasm->depth;
@@ -346,10 +355,11 @@ fd_tpu_reasm_publish_fast( fd_tpu_reasm_t * reasm,
     return FD_TPU_REASM_ERR_STATE;
   }
 
-  /* Copy data into new slot */
+  /* Copy data into new slot (unless written via fd_tpu_reasm_fast_buf) */
   FD_COMPILER_MFENCE();
-  slot->k.sz = sz & FD_TPU_REASM_SZ_MASK;
-  fd_memcpy( buf, data, sz );
+  slot->k.sz        = sz & FD_TPU_REASM_SZ_MASK;
+  slot->tsorig_comp = (uint)fd_frag_meta_ts_comp( tsorig );
+  if( data!=buf ) fd_memcpy( buf, data, sz );
   FD_COMPILER_MFENCE();
   slot->k.state = FD_TPU_REASM_STATE_PUB;
   FD_COMPILER_MFENCE();
@@ -0,0 +1,164 @@
+#include "fd_quic_hs_backlog.h"
+
+static uchar backlog_data[ FD_QUIC_HS_BACKLOG_DATA_SZ ];
+
+/* push_seq pushes a packet tagged with sequence number seq */
+
+static int
+push_seq( fd_quic_hs_backlog_t * backlog,
+          ulong                  seq ) {
+  uchar pkt[ 64 ];
+  fd_memset( pkt, 0, sizeof(pkt) );
+  FD_STORE( ulong, pkt, seq );
+  return fd_quic_hs_backlog_push( backlog, pkt, 8UL+(seq&31UL), seq );
+}
+
+/* pop_seq pops a packet and returns its sequence number */
+
+static ulong
+pop_seq( fd_quic_hs_backlog_t * backlog ) {
+  ulong   sz;
+  ulong   tsorig;
+  uchar * pkt = fd_quic_hs_backlog_pop( backlog, &sz, &tsorig );
+  FD_TEST( pkt );
+  ulong seq = FD_LOAD( ulong, pkt );
+  FD_TEST( sz==8UL+(seq&31UL) );
+  FD_TEST( tsorig==(ulong)(uint)seq );
+  return seq;
+}
+
+static void
+test_defer( void ) {
+  uchar pkt[1];
+  FD_TEST( !fd_quic_hs_backlog_defer( pkt, 0UL ) );
+  pkt[0] = 0xc0; FD_TEST(  fd_quic_hs_backlog_defer( pkt, 1UL ) );  /* Initial   */
+  pkt[0] = 0xd0; FD_TEST( !fd_quic_hs_backlog_defer( pkt, 1UL ) );  /* 0-RTT     */
+  pkt[0] = 0xe0; FD_TEST( !fd_quic_hs_backlog_defer( pkt, 1UL ) );  /* Handshake */
+  pkt[0] = 0xf0; FD_TEST( !fd_quic_hs_backlog_defer( pkt, 1UL ) );  /* Retry     */
+  pkt[0] = 0x40; FD_TEST( !fd_quic_hs_backlog_defer( pkt, 1UL ) );  /* 1-RTT     */
+}
+
+/* test_overflow fills the backlog past its depth across ring wrap
+   around, and checks that excess packets are rejected and FIFO order
+   is preserved. */
+
+static void
+test_overflow( fd_quic_hs_backlog_t * backlog ) {
+  fd_quic_hs_backlog_init( backlog, backlog_data );
+  FD_TEST( !fd_quic_hs_backlog_sched( backlog ) );
+
+  /* Offset the ring such that it wraps around */
+  for( ulong j=0UL; j<100UL; j++ ) FD_TEST( push_seq( backlog, j ) );
+  for( ulong j=0UL; j<100UL; j++ ) FD_TEST( pop_seq( backlog )==j );
+
+  ulong seq = 100UL;
+  for( ulong j=0UL; j<FD_QUIC_HS_BACKLOG_DEPTH; j++ ) FD_TEST( push_seq( backlog, seq++ ) );
+  FD_TEST( fd_quic_hs_backlog_cnt( backlog )==FD_QUIC_HS_BACKLOG_DEPTH );
+  FD_TEST( !push_seq( backlog, 9999UL ) );
+  FD_TEST( fd_quic_hs_backlog_cnt( backlog )==FD_QUIC_HS_BACKLOG_DEPTH );
+
+  /* Freeing one slot admits one more packet */
+  FD_TEST( pop_seq( backlog )==100UL );
+  FD_TEST( push_seq( backlog, seq++ ) );
+  FD_TEST( !push_seq( backlog, 9999UL ) );
+
+  for( ulong j=101UL; j<seq; j++ ) FD_TEST( pop_seq( backlog )==j );
+  FD_TEST( !fd_quic_hs_backlog_cnt( backlog ) );
+  ulong sz; ulong tsorig;
+  FD_TEST( !fd_quic_hs_backlog_pop( backlog, &sz, &tsorig ) );
+}
+
+/* test_sched checks burst and ratio scheduling. */
+
+static void
+test_sched( fd_quic_hs_backlog_t * backlog ) {
+  fd_quic_hs_backlog_init( backlog, backlog_data );
+  for( ulong j=0UL; j<64UL; j++ ) FD_TEST( push_seq( backlog, j ) );
+
+  /* While net frags keep arriving, one packet every RATIO iterations */
+  ulong next = 0UL;
+  for( ulong iter=1UL; iter<=4UL*FD_QUIC_HS_BACKLOG_RATIO; iter++ ) {
+    fd_quic_hs_backlog_rx( backlog );
+    ulong burst = fd_quic_hs_backlog_sched( backlog );
+    FD_TEST( burst==( (iter%FD_QUIC_HS_BACKLOG_RATIO)==0UL ? 1UL : 0UL ) );
+    for( ulong j=0UL; j<burst; j++ ) FD_TEST( pop_seq( backlog )==next++ );
+  }
+  FD_TEST( next==4UL );
+
+  /* Once idle, BURST packets per iteration */
+  FD_TEST( fd_quic_hs_backlog_sched( backlog )==FD_QUIC_HS_BACKLOG_BURST );
+  for( ulong j=0UL; j<FD_QUIC_HS_BACKLOG_BURST; j++ ) FD_TEST( pop_seq( backlog )==next++ );
+
+  /* Going busy again restarts the ratio count */
+  for( ulong iter=1UL; iter<FD_QUIC_HS_BACKLOG_RATIO; iter++ ) {
+    fd_quic_hs_backlog_rx( backlog );
+    FD_TEST( !fd_quic_hs_backlog_sched( backlog ) );
+  }
+  fd_quic_hs_backlog_rx( backlog );
+  FD_TEST( fd_quic_hs_backlog_sched( backlog )==1UL );
+  FD_TEST( pop_seq( backlog )==next++ );
+
+  /* Drain the rest while idle */
+  while( fd_quic_hs_backlog_cnt( backlog ) ) {
+    ulong burst = fd_quic_hs_backlog_sched( backlog );
+    FD_TEST( burst==FD_QUIC_HS_BACKLOG_BURST );
+    for( ulong j=0UL; j<burst && fd_quic_hs_backlog_cnt( backlog ); j++ ) FD_TEST( pop_seq( backlog )==next++ );
+  }
+  FD_TEST( next==64UL );
+  FD_TEST( !fd_quic_hs_backlog_sched( backlog ) );
+}
+
+/* test_latency simulates a saturated net link delivering one Initial
+   packet every iteration, and checks the queueing delay bound from the
+   header: a packet pushed at backlog position k is processed within
+   (k+1)*RATIO iterations.  Reports the p99 delay. */
+
+static void
+test_latency( fd_quic_hs_backlog_t * backlog ) {
+  fd_quic_hs_backlog_init( backlog, backlog_data );
+
+# define ITER_CNT (4096UL)
+  static ulong delay[ ITER_CNT ];
+  static ulong bound[ ITER_CNT ];
+  ulong pop_cnt  = 0UL;
+  ulong drop_cnt = 0UL;
+  for( ulong iter=0UL; iter<ITER_CNT; iter++ ) {
+    fd_quic_hs_backlog_rx( backlog );
+    ulong pos = fd_quic_hs_backlog_cnt( backlog );
+    if( push_seq( backlog, iter ) ) bound[ iter ] = (pos+1UL)*FD_QUIC_HS_BACKLOG_RATIO;
+    else                            drop_cnt++;
+    ulong burst = fd_quic_hs_backlog_sched( backlog );
+    for( ulong j=0UL; j<burst; j++ ) {
+      ulong seq = pop_seq( backlog );
+      delay[ pop_cnt++ ] = iter - seq;
+      FD_TEST( iter-seq<=bound[ seq ] );
+    }
+  }
+# undef ITER_CNT
+
+  /* Arrivals exceed the busy drain rate, so the backlog fills up and
+     sheds load instead of growing delay without bound */
+  FD_TEST( drop_cnt );
+  FD_TEST( fd_quic_hs_backlog_cnt( backlog )>=FD_QUIC_HS_BACKLOG_DEPTH-1UL );
+
+  ulong rnk = (pop_cnt*99UL)/100UL;
+  ulong p99 = fd_sort_up_ulong_select( delay, pop_cnt, rnk )[ rnk ];
+  FD_TEST( p99<=FD_QUIC_HS_BACKLOG_DEPTH*FD_QUIC_HS_BACKLOG_RATIO );
+  FD_LOG_INFO(( "saturated: processed %lu, dropped %lu, p99 delay %lu iterations", pop_cnt, drop_cnt, p99 ));
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  fd_quic_hs_backlog_t backlog[1];
+  test_defer();
+  test_overflow( backlog );
+  test_sched( backlog );
+  test_latency( backlog );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -0,0 +1,215 @@
+#include "fd_tpu_admit.h"
+
+/* Times in this test are in nanoseconds (tick_per_ns==1) */
+
+#define WINDOW (100000000L)
+
+static uchar __attribute__((aligned(FD_TPU_ADMIT_ALIGN))) admit_mem[ 1UL<<20 ];
+
+static uint const staked_ip0 = 0x0100000aU;  /* 10.0.0.1 */
+static uint const staked_ip1 = 0x0200000aU;  /* 10.0.0.2 */
+
+static void
+test_unstaked_source( fd_tpu_admit_t * admit ) {
+  uint ip4 = 0x0101a8c0U;
+  long now = 1000L;
+
+  /* A single source is capped by the sketch */
+  for( ulong j=0UL; j<10UL; j++ ) FD_TEST( fd_tpu_admit_initial( admit, ip4, now ) );
+  FD_TEST( !fd_tpu_admit_initial( admit, ip4, now ) );
+  FD_TEST( !fd_tpu_admit_initial( admit, ip4, now+WINDOW/2L ) );
+
+  /* Other sources are unaffected */
+  FD_TEST( fd_tpu_admit_initial( admit, ip4+1U, now ) );
+
+  /* The sketch resets every window */
+  FD_TEST( fd_tpu_admit_initial( admit, ip4, now+WINDOW ) );
+
+  FD_TEST( admit->metrics.initial_admit[ FD_TPU_ADMIT_CLASS_UNSTAKED ]==12UL );
+  FD_TEST( admit->metrics.initial_drop [ FD_TPU_ADMIT_CLASS_UNSTAKED ]== 2UL );
+  FD_TEST( admit->metrics.initial_admit[ FD_TPU_ADMIT_CLASS_STAKED   ]== 0UL );
+}
+
+/* test_flood simulates one second of Initial packets: both staked
+   peers and ten random unstaked sources send one packet every 100us. */
+
+static void
+test_flood( fd_tpu_admit_t * admit,
+            fd_rng_t *       rng,
+            long             t0 ) {
+  ulong admit_cnt[3] = {0};
+  for( long t=t0; t<t0+1000000000L; t+=100000L ) {
+    admit_cnt[0] += (ulong)fd_tpu_admit_initial( admit, staked_ip0, t );
+    admit_cnt[1] += (ulong)fd_tpu_admit_initial( admit, staked_ip1, t );
+    for( ulong j=0UL; j<10UL; j++ ) {
+      uint ip4 = fd_rng_uint( rng ) | 0x80000000U;
+      admit_cnt[2] += (ulong)fd_tpu_admit_initial( admit, ip4, t );
+    }
+  }
+  FD_LOG_INFO(( "admitted staked0=%lu staked1=%lu unstaked=%lu", admit_cnt[0], admit_cnt[1], admit_cnt[2] ));
+
+  /* 3/4 and 1/4 of the 1000/s staked budget, plus one window of burst.
+     The unstaked fallback adds little, as the source sketch counts
+     every attempt. */
+  FD_TEST( admit_cnt[0]>= 800UL && admit_cnt[0]<= 850UL );
+  FD_TEST( admit_cnt[1]>= 265UL && admit_cnt[1]<= 285UL );
+  /* 1000/s unstaked budget, plus one window of burst */
+  FD_TEST( admit_cnt[2]>=1050UL && admit_cnt[2]<=1110UL );
+}
+
+static void
+test_streams( fd_tpu_admit_t * admit,
+              long             now ) {
+  fd_tpu_admit_conn_t conn[4];
+  for( ulong j=0UL; j<4UL; j++ ) fd_tpu_admit_conn_init( admit, conn+j, now );
+
+  /* Unstaked conns get 1000/s each */
+  ulong cnt = 0UL;
+  for( ulong j=0UL; j<1000UL; j++ ) cnt += (ulong)fd_tpu_admit_stream( admit, conn+0, 0x01010101U, now );
+  FD_TEST( cnt==100UL );
+  FD_TEST( fd_tpu_admit_stream( admit, conn+0, 0x01010101U, now+1000000L ) );
+
+  /* Staked peers get 3/4 of 100000/s across all conns, plus 1000/s
+     per conn */
+  cnt = 0UL;
+  for( ulong j=0UL; j<10000UL; j++ ) cnt += (ulong)fd_tpu_admit_stream( admit, conn+(j&1UL)+1UL, staked_ip0, now );
+  FD_TEST( cnt>=7699UL && cnt<=7700UL );  /* float rounding */
+
+  /* Once the shared budget is spent, each conn still gets the unstaked
+     rate */
+  ulong conn_cnt = 0UL;
+  for( ulong j=0UL; j<1000UL; j++ ) conn_cnt += (ulong)fd_tpu_admit_stream( admit, conn+3, staked_ip0, now );
+  FD_TEST( conn_cnt==100UL );
+  cnt += conn_cnt;
+  FD_TEST( admit->metrics.stream_admit[ FD_TPU_ADMIT_CLASS_STAKED   ]==cnt );
+  FD_TEST( admit->metrics.stream_drop [ FD_TPU_ADMIT_CLASS_STAKED   ]==11000UL-cnt );
+  FD_TEST( admit->metrics.stream_admit[ FD_TPU_ADMIT_CLASS_UNSTAKED ]== 101UL );
+}
+
+/* test_fallback checks that Initial packets exceeding a staked peer's
+   budget take the unstaked path, and that stake updates preserve token
+   bucket balances.  Expects staked_ip0 and staked_ip1 with 3/4 and 1/4
+   of stake, and all buckets full at now. */
+
+static void
+test_fallback( fd_tpu_admit_t * admit,
+               long             now ) {
+  ulong staked_admit0   = admit->metrics.initial_admit[ FD_TPU_ADMIT_CLASS_STAKED   ];
+  ulong unstaked_admit0 = admit->metrics.initial_admit[ FD_TPU_ADMIT_CLASS_UNSTAKED ];
+  ulong unstaked_drop0  = admit->metrics.initial_drop [ FD_TPU_ADMIT_CLASS_UNSTAKED ];
+
+  /* A spoofed flood from staked_ip0 spends its budget (75 per window),
+     then gets unstaked treatment (10 per source per window) */
+  ulong cnt = 0UL;
+  for( ulong j=0UL; j<1000UL; j++ ) cnt += (ulong)fd_tpu_admit_initial( admit, staked_ip0, now );
+  ulong staked_cnt = admit->metrics.initial_admit[ FD_TPU_ADMIT_CLASS_STAKED ] - staked_admit0;
+  FD_TEST( staked_cnt>=74UL && staked_cnt<=75UL );  /* float rounding */
+  FD_TEST( cnt==staked_cnt+10UL );
+  FD_TEST( admit->metrics.initial_admit[ FD_TPU_ADMIT_CLASS_UNSTAKED ]==unstaked_admit0+10UL );
+  FD_TEST( admit->metrics.initial_drop [ FD_TPU_ADMIT_CLASS_UNSTAKED ]==unstaked_drop0+1000UL-cnt );
+  FD_TEST( !fd_tpu_admit_initial( admit, staked_ip0, now ) );
+
+  /* Repeating the same stake set changes nothing */
+  fd_tpu_admit_stakes_init( admit );
+  fd_tpu_admit_stakes_add( admit, staked_ip0, 3UL );
+  fd_tpu_admit_stakes_add( admit, staked_ip1, 1UL );
+  fd_tpu_admit_stakes_fini( admit, now );
+  staked_admit0 = admit->metrics.initial_admit[ FD_TPU_ADMIT_CLASS_STAKED ];
+  FD_TEST( !fd_tpu_admit_initial( admit, staked_ip0, now ) );
+  FD_TEST( admit->metrics.initial_admit[ FD_TPU_ADMIT_CLASS_STAKED ]==staked_admit0 );
+
+  /* A changed stake set keeps the balances of existing peers */
+  uint staked_ip2 = 0x0300000aU;
+  fd_tpu_admit_stakes_init( admit );
+  fd_tpu_admit_stakes_add( admit, staked_ip0, 3UL );
+  fd_tpu_admit_stakes_add( admit, staked_ip1, 1UL );
+  fd_tpu_admit_stakes_add( admit, staked_ip2, 4UL );
+  FD_TEST( fd_tpu_admit_stake( admit, staked_ip2 )==0UL );  /* staged */
+  fd_tpu_admit_stakes_fini( admit, now );
+  FD_TEST( admit->staked_cnt==3UL );
+  FD_TEST( admit->stake_total==8UL );
+  FD_TEST( fd_tpu_admit_stake( admit, staked_ip2 )==4UL );
+  FD_TEST( !fd_tpu_admit_initial( admit, staked_ip0, now ) );
+  FD_TEST(  fd_tpu_admit_initial( admit, staked_ip1, now ) );
+  FD_TEST(  fd_tpu_admit_initial( admit, staked_ip2, now ) );
+  FD_TEST( admit->metrics.initial_admit[ FD_TPU_ADMIT_CLASS_STAKED ]==staked_admit0+2UL );
+
+  /* Refills at the new rate (3/8 of 1000/s) */
+  FD_TEST(  fd_tpu_admit_initial( admit, staked_ip0, now+WINDOW ) );
+  FD_TEST( admit->metrics.initial_admit[ FD_TPU_ADMIT_CLASS_STAKED ]==staked_admit0+3UL );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  fd_tpu_admit_limits_t limits = {
+    .staked_initial_rate      =   1000UL,
+    .unstaked_initial_rate    =   1000UL,
+    .unstaked_src_initial_max =     10UL,
+    .staked_stream_rate       = 100000UL,
+    .unstaked_stream_rate     =   1000UL,
+    .window_ns                = (ulong)WINDOW
+  };
+
+  ulong peer_max = 1024UL;
+  FD_TEST( fd_tpu_admit_footprint( peer_max )<=sizeof(admit_mem) );
+  FD_TEST( !fd_tpu_admit_footprint( 0UL ) );
+  FD_TEST( !fd_tpu_admit_new( admit_mem, 0UL, &limits, 1.0, 0UL ) );
+
+  fd_tpu_admit_t * admit = fd_tpu_admit_join( fd_tpu_admit_new( admit_mem, peer_max, &limits, 1.0, 42UL ) );
+  FD_TEST( admit );
+
+  FD_LOG_INFO(( "Test unstaked source limit" ));
+  test_unstaked_source( admit );
+
+  FD_LOG_INFO(( "Test fd_tpu_admit_stakes" ));
+  fd_tpu_admit_stakes_init( admit );
+  fd_tpu_admit_stakes_add( admit, staked_ip0, 2UL );
+  fd_tpu_admit_stakes_add( admit, staked_ip1, 1UL );
+  fd_tpu_admit_stakes_add( admit, staked_ip0, 1UL );  /* same IP */
+  fd_tpu_admit_stakes_add( admit, 0U,         5UL );  /* no contact info */
+  fd_tpu_admit_stakes_add( admit, 0x0300000aU, 0UL ); /* no stake */
+  long t0 = 10L*WINDOW;
+  fd_tpu_admit_stakes_fini( admit, t0 );
+  FD_TEST( admit->staked_cnt==2UL );
+  FD_TEST( admit->stake_total==4UL );
+  FD_TEST( fd_tpu_admit_stake( admit, staked_ip0  )==3UL );
+  FD_TEST( fd_tpu_admit_stake( admit, staked_ip1  )==1UL );
+  FD_TEST( fd_tpu_admit_stake( admit, 0x0300000aU )==0UL );
+
+  FD_LOG_INFO(( "Test Initial flood" ));
+  test_flood( admit, rng, t0 );
+
+  FD_LOG_INFO(( "Test stream limits" ));
+  long t1 = t0 + 2000000000L;
+  fd_tpu_admit_stakes_init( admit );
+  fd_tpu_admit_stakes_add( admit, staked_ip0, 3UL );
+  fd_tpu_admit_stakes_add( admit, staked_ip1, 1UL );
+  fd_tpu_admit_stakes_fini( admit, t1 );
+  test_streams( admit, t1 );
+
+  FD_LOG_INFO(( "Test staked fallback and stake updates" ));
+  long t2 = t1 + 10L*WINDOW;
+  test_fallback( admit, t2 );
+
+  FD_LOG_INFO(( "Test stake removal" ));
+  long t3 = t2 + 10L*WINDOW;
+  fd_tpu_admit_stakes_init( admit );
+  fd_tpu_admit_stakes_fini( admit, t3 );
+  FD_TEST( admit->staked_cnt==0UL );
+  FD_TEST( fd_tpu_admit_stake( admit, staked_ip0 )==0UL );
+  ulong unstaked_cnt = admit->metrics.initial_admit[ FD_TPU_ADMIT_CLASS_UNSTAKED ];
+  FD_TEST( fd_tpu_admit_initial( admit, staked_ip0, t3 ) );
+  FD_TEST( admit->metrics.initial_admit[ FD_TPU_ADMIT_CLASS_UNSTAKED ]==unstaked_cnt+1UL );
+
+  FD_TEST( fd_tpu_admit_delete( fd_tpu_admit_leave( admit ) )==admit_mem );
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -212,6 +212,25 @@ main( int     argc,
     seq = fd_seq_inc( seq, 1UL );
   } while(0);
 
+  FD_LOG_INFO(( "Test fd_tpu_reasm_fast_buf" ));
+
+  do {
+    uchar * buf = fd_tpu_reasm_fast_buf( reasm );
+    FD_TEST( buf );
+    fd_memcpy( buf, transaction4, transaction4_sz );
+    FD_TEST( fd_tpu_reasm_publish_fast( reasm, buf, transaction4_sz, mcache, base, seq, 0L, 0L )
+             == FD_TPU_REASM_SUCCESS );
+    verify_state( reasm, mcache );
+
+    fd_frag_meta_t * mline = mcache + fd_mcache_line_idx( seq, depth );
+    FD_TEST( mline->seq == seq );
+    FD_TEST( mline->sz == transaction4_sz );
+    FD_TEST( fd_chunk_to_laddr_const( base, mline->chunk )==buf );
+    FD_TEST( 0==memcmp( buf, transaction4, transaction4_sz ) );
+
+    seq = fd_seq_inc( seq, 1UL );
+  } while(0);
+
   FD_LOG_INFO(( "Test fd_tpu_reasm_prepare" ));
 
   uint free_cnt;
@@ -222,6 +241,9 @@ main( int     argc,
     FD_TEST( (long)free_cnt==fd_long_max( (long)burst-(long)j-1L, 0L ) );
   }
 
+  /* No free slots left, so there is no fast path buffer */
+  FD_TEST( !fd_tpu_reasm_fast_buf( reasm ) );
+
   FD_LOG_INFO(( "Test fd_tpu_reasm_{cancel,publish}" ));
 
 # define check_free_diff( free_cnt_new, diff ) do {        \
@@ -80,14 +80,22 @@ fd_topo_create_workspace( fd_topo_t *      topo,
   char name[ PATH_MAX ];
   FD_TEST( fd_cstr_printf_check( name, PATH_MAX, NULL, "%s_%s.wksp", topo->app_name, wksp->name ) );
 
-  ulong sub_page_cnt[ 1 ] = { wksp->page_cnt };
-  ulong sub_cpu_idx [ 1 ] = { fd_shmem_cpu_idx( wksp->numa_idx ) };
+  ulong sub_cnt = 1UL;
+  ulong sub_page_cnt[ FD_TOPO_MAX_WKSP_SUBS ] = { wksp->page_cnt };
+  ulong sub_cpu_idx [ FD_TOPO_MAX_WKSP_SUBS ] = { fd_shmem_cpu_idx( wksp->numa_idx ) };
+  if( FD_UNLIKELY( wksp->sub_cnt ) ) {
+    sub_cnt = wksp->sub_cnt;
+    for( ulong i=0UL; i<sub_cnt; i++ ) {
+      sub_page_cnt[ i ] = wksp->sub_page_cnt[ i ];
+      sub_cpu_idx [ i ] = fd_shmem_cpu_idx( wksp->sub_numa_idx[ i ] );
+    }
+  }
 
   int err;
   if( FD_UNLIKELY( update_existing ) ) {
-    err = fd_shmem_update_multi( name, wksp->page_sz, 1, sub_page_cnt, sub_cpu_idx, S_IRUSR | S_IWUSR ); /* logs details */
+    err = fd_shmem_update_multi( name, wksp->page_sz, sub_cnt, sub_page_cnt, sub_cpu_idx, S_IRUSR | S_IWUSR ); /* logs details */
   } else {
-    err = fd_shmem_create_multi( name, wksp->page_sz, 1, sub_page_cnt, sub_cpu_idx, S_IRUSR | S_IWUSR ); /* logs details */
+    err = fd_shmem_create_multi( name, wksp->page_sz, sub_cnt, sub_page_cnt, sub_cpu_idx, S_IRUSR | S_IWUSR ); /* logs details */
   }
   if( FD_UNLIKELY( err && errno==ENOMEM ) ) return -1;
   else if( FD_UNLIKELY( err ) ) FD_LOG_ERR(( "fd_shmem_create_multi failed" ));
@@ -254,16 +262,64 @@ fd_topo_mlock_max_tile( fd_topo_t const * topo ) {
   return highest_tile_mem;
 }
 
+/* fd_topo_wksp_numa_page_cnt returns the number of pages of the
+   workspace that are allocated from the given NUMA node. */
+
+FD_FN_PURE static ulong
+fd_topo_wksp_numa_page_cnt( fd_topo_wksp_t const * wksp,
+                            ulong                  numa_idx ) {
+  if( FD_LIKELY( !wksp->sub_cnt ) ) return fd_ulong_if( wksp->numa_idx==numa_idx, wksp->page_cnt, 0UL );
+
+  ulong result = 0UL;
+  for( ulong i=0UL; i<wksp->sub_cnt; i++ ) {
+    if( FD_LIKELY( wksp->sub_numa_idx[ i ]==numa_idx ) ) result += wksp->sub_page_cnt[ i ];
+  }
+  return result;
+}
+
+FD_FN_PURE ulong
+fd_topo_wksp_page_numa_idx( fd_topo_wksp_t const * wksp,
+                            ulong                  page_idx ) {
+  for( ulong i=0UL; i<wksp->sub_cnt; i++ ) {
+    if( FD_LIKELY( page_idx<wksp->sub_page_cnt[ i ] ) ) return wksp->sub_numa_idx[ i ];
+    page_idx -= wksp->sub_page_cnt[ i ];
+  }
+  return wksp->numa_idx;
+}
+
+FD_FN_PURE ulong
+fd_topo_obj_numa_idx( fd_topo_t const *     topo,
+                      fd_topo_obj_t const * obj ) {
+  fd_topo_wksp_t const * wksp = &topo->workspaces[ obj->wksp_id ];
+  if( FD_LIKELY( !wksp->sub_cnt || !wksp->page_sz ) ) return wksp->numa_idx;
+
+  /* Pick the node holding the most bytes of the object */
+
+  ulong best_numa_idx = wksp->numa_idx;
+  ulong best_sz       = 0UL;
+  ulong sub_lo        = 0UL;
+  for( ulong i=0UL; i<wksp->sub_cnt; i++ ) {
+    ulong sub_hi = sub_lo + wksp->sub_page_cnt[ i ]*wksp->page_sz;
+    ulong lo     = fd_ulong_max( sub_lo, obj->offset                  );
+    ulong hi     = fd_ulong_min( sub_hi, obj->offset + obj->footprint );
+    if( lo<hi && (hi-lo)>best_sz ) {
+      best_numa_idx = wksp->sub_numa_idx[ i ];
+      best_sz       = hi - lo;
+    }
+    sub_lo = sub_hi;
+  }
+  return best_numa_idx;
+}
+
 FD_FN_PURE ulong
 fd_topo_gigantic_page_cnt( fd_topo_t const * topo,
                            ulong             numa_idx ) {
   ulong result = 0UL;
   for( ulong i=0UL; i<topo->wksp_cnt; i++ ) {
     fd_topo_wksp_t const * wksp = &topo->workspaces[ i ];
-    if( FD_LIKELY( wksp->numa_idx!=numa_idx ) ) continue;
 
     if( FD_LIKELY( wksp->page_sz==FD_SHMEM_GIGANTIC_PAGE_SZ ) ) {
-      result += wksp->page_cnt;
+      result += fd_topo_wksp_numa_page_cnt( wksp, numa_idx );
     }
   }
   return result;
@@ -276,10 +332,9 @@ fd_topo_huge_page_cnt( fd_topo_t const * topo,
   ulong result = 0UL;
   for( ulong i=0UL; i<topo->wksp_cnt; i++ ) {
     fd_topo_wksp_t const * wksp = &topo->workspaces[ i ];
-    if( FD_LIKELY( wksp->numa_idx!=numa_idx ) ) continue;
 
     if( FD_LIKELY( wksp->page_sz==FD_SHMEM_HUGE_PAGE_SZ ) ) {
-      result += wksp->page_cnt;
+      result += fd_topo_wksp_numa_page_cnt( wksp, numa_idx );
     }
   }
 
@@ -396,7 +451,13 @@ fd_topo_print_log( int         stdout,
 
     char size[ 24 ];
     fd_topo_mem_sz_string( wksp->page_sz * wksp->page_cnt, size );
-    PRINT( "  %2lu (%7s): %12s  page_cnt=%lu  page_sz=%-8s  numa_idx=%-2lu  footprint=%-10lu  loose=%lu\n", i, size, wksp->name, wksp->page_cnt, fd_shmem_page_sz_to_cstr( wksp->page_sz ), wksp->numa_idx, wksp->known_footprint, wksp->total_footprint - wksp->known_footprint );
+    PRINT( "  %2lu (%7s): %12s  page_cnt=%lu  page_sz=%-8s  numa_idx=%-2lu  footprint=%-10lu  loose=%lu", i, size, wksp->name, wksp->page_cnt, fd_shmem_page_sz_to_cstr( wksp->page_sz ), wksp->numa_idx, wksp->known_footprint, wksp->total_footprint - wksp->known_footprint );
+    if( FD_UNLIKELY( wksp->sub_cnt>1UL ) ) {
+      PRINT( "  numa_subs=[" );
+      for( ulong j=0UL; j<wksp->sub_cnt; j++ ) PRINT( "%s%lu:%lu", j ? ", " : "", wksp->sub_numa_idx[ j ], wksp->sub_page_cnt[ j ] );
+      PRINT( "]" );
+    }
+    PRINT( "\n" );
   }
 
   PRINT( "\nOBJECTS\n" );
@@ -405,9 +466,9 @@ fd_topo_print_log( int         stdout,
 
     char size[ 24 ];
     fd_topo_mem_sz_string( obj->footprint, size );
-    PRINT( "  %3lu: %12s %12s  wksp_id=%-2lu  footprint=%7s  offset=%lu",
+    PRINT( "  %3lu: %12s %12s  wksp_id=%-2lu  footprint=%7s  offset=%lu  numa_idx=%lu",
            i, topo->workspaces[ obj->wksp_id ].name, obj->name,
-           obj->wksp_id, size, obj->offset );
+           obj->wksp_id, size, obj->offset, fd_topo_obj_numa_idx( topo, obj ) );
     for( fd_pod_iter_t iter=fd_pod_iter_init( fd_pod_queryf_subpod( topo->props, "obj.%lu", obj->id ) );
          !fd_pod_iter_done( iter );
          iter=fd_pod_iter_next( iter ) ) {
@@ -485,6 +546,23 @@ fd_topo_print_log( int         stdout,
       PRINT( "floating" );
     }
     PRINT( "  in=[%s]  out=[%s]", in, out );
+
+    /* Report how much of the memory used by the tile lives on a remote
+       NUMA node (i.e. is accessed across the socket interconnect). */
+
+    if( FD_LIKELY( tile->cpu_idx!=ULONG_MAX ) ) {
+      ulong tile_numa_idx = fd_shmem_numa_idx( tile->cpu_idx );
+      ulong remote_sz     = 0UL;
+      ulong remote_cnt    = 0UL;
+      for( ulong j=0UL; j<tile->uses_obj_cnt; j++ ) {
+        fd_topo_obj_t const * obj = &topo->objs[ tile->uses_obj_id[ j ] ];
+        if( FD_LIKELY( fd_topo_obj_numa_idx( topo, obj )==tile_numa_idx ) ) continue;
+        remote_sz += obj->footprint;
+        remote_cnt++;
+      }
+      fd_topo_mem_sz_string( remote_sz, size );
+      PRINT( "  numa_idx=%lu  remote_objs=%lu (%s)", tile_numa_idx, remote_cnt, size );
+    }
     if( FD_LIKELY( i != topo->tile_cnt-1 ) ) PRINT( "\n" );
   }
 
@@ -21,6 +21,8 @@
 #define FD_TOPO_MAX_TILE_OUT_LINKS ( 32UL)
 /* Maximum number of objects that a tile can use. */
 #define FD_TOPO_MAX_TILE_OBJS      ( 256UL)
+/* Maximum number of NUMA sub-regions a workspace can be split into. */
+#define FD_TOPO_MAX_WKSP_SUBS      (   8UL)
 
 /* Maximum number of additional ip addresses */
 #define FD_NET_MAX_SRC_ADDR 4
@@ -34,6 +36,16 @@ typedef struct {
 
   ulong numa_idx;     /* The index of the NUMA node on the system that this workspace should be allocated from. */
 
+  /* A workspace can be backed by sub_cnt sub-regions of consecutive
+     pages, each allocated from a different NUMA node, so that objects
+     in a workspace shared by tiles on different NUMA nodes are local to
+     the tiles consuming them.  Sub-region i has sub_page_cnt[i] pages
+     on NUMA node sub_numa_idx[i].  If sub_cnt is zero, all pages are
+     allocated from numa_idx. */
+  ulong sub_cnt;
+  ulong sub_page_cnt[ FD_TOPO_MAX_WKSP_SUBS ];
+  ulong sub_numa_idx[ FD_TOPO_MAX_WKSP_SUBS ];
+
   /* Computed fields.  These are not supplied as configuration but calculated as needed. */
   struct {
     ulong page_sz;  /* The size of the pages that this workspace is backed by.  One of FD_PAGE_SIZE_*. */
@@ -135,6 +147,7 @@ typedef struct {
       long   tx_flush_timeout_ns;
       char   xdp_mode[8];
       int    zero_copy;
+      int    sock_udp_gro; /* sock tile requests UDP_GRO on RX sockets */
 
       ushort shred_listen_port;
       ushort quic_transaction_listen_port;
@@ -169,6 +182,13 @@ typedef struct {
       ulong  idle_timeout_millis;
       uint   ack_delay_millis;
       int    retry;
+      uchar  retry_secret[ 16 ]; /* shared by all quic tiles */
+      uchar  retry_iv    [ 12 ];
+      uint   admit_staked_initial_rate;
+      uint   admit_unstaked_initial_rate;
+      uint   admit_unstaked_source_initial_max;
+      uint   admit_staked_stream_rate;
+      uint   admit_unstaked_stream_rate;
     } quic;
 
     struct {
@@ -408,6 +428,8 @@ typedef struct {
 
   ulong offset;
   ulong footprint;
+
+  ulong numa_idx; /* The NUMA node of the tiles consuming this object, or ULONG_MAX if not known.  This is a placement hint, see fd_topob_auto_numa. */
 } fd_topo_obj_t;
 
 /* An fd_topo_t represents the overall structure of a Firedancer
@@ -841,6 +863,21 @@ fd_topo_huge_page_cnt( fd_topo_t const * topo,
                        ulong             numa_idx,
                        int               include_anonymous );
 
+/* fd_topo_wksp_page_numa_idx returns the NUMA node that the page_idx
+   page of the workspace is allocated from.  page_idx should be in
+   [0,wksp->page_cnt). */
+
+FD_FN_PURE ulong
+fd_topo_wksp_page_numa_idx( fd_topo_wksp_t const * wksp,
+                            ulong                  page_idx );
+
+/* fd_topo_obj_numa_idx returns the NUMA node that the memory of the
+   object is (predominantly) allocated from. */
+
+FD_FN_PURE ulong
+fd_topo_obj_numa_idx( fd_topo_t const *     topo,
+                      fd_topo_obj_t const * obj );
+
 /* Check all invariants of the given topology to make sure it is valid.
    An invalid topology will cause the program to abort with an error
    message. */
@@ -58,8 +58,9 @@ fd_topob_obj( fd_topo_t *  topo,
 
   fd_topo_obj_t * obj = &topo->objs[ topo->obj_cnt ];
   strncpy( obj->name, obj_name, sizeof(obj->name) );
-  obj->id      = topo->obj_cnt;
-  obj->wksp_id = wksp_id;
+  obj->id       = topo->obj_cnt;
+  obj->wksp_id  = wksp_id;
+  obj->numa_idx = ULONG_MAX;
   topo->obj_cnt++;
 
   return obj;
@@ -223,6 +224,150 @@ fd_topob_tile_out( fd_topo_t *  topo,
   }
 }
 
+/* fd_topob_obj_numa_idx returns the NUMA node of the tiles consuming
+   obj.  The consumers are the tiles that map obj read only (e.g. the
+   readers of a link's mcache and dcache) or, if there are none, the
+   tiles that map it read write (e.g. the tile owning a tile object or
+   the reader writing an fseq).  If consumers are on multiple nodes, the
+   node with the most consumers wins (ties go to the lowest node).
+   Floating tiles don't have a node and are ignored.  Returns ULONG_MAX
+   if no consumer has a node. */
+
+static ulong
+fd_topob_obj_numa_idx( fd_topo_t const *     topo,
+                       fd_topo_obj_t const * obj,
+                       ulong *               votes ) { /* Indexed [0,fd_shmem_numa_cnt()), scratch */
+  ulong numa_cnt = fd_shmem_numa_cnt();
+
+  for( int mode=FD_SHMEM_JOIN_MODE_READ_ONLY; ; mode=FD_SHMEM_JOIN_MODE_READ_WRITE ) {
+    memset( votes, 0, numa_cnt*sizeof(ulong) );
+
+    ulong best_numa_idx = ULONG_MAX;
+    ulong best_votes    = 0UL;
+    for( ulong i=0UL; i<topo->tile_cnt; i++ ) {
+      fd_topo_tile_t const * tile = &topo->tiles[ i ];
+      if( FD_UNLIKELY( tile->cpu_idx==ULONG_MAX ) ) continue;
+
+      for( ulong j=0UL; j<tile->uses_obj_cnt; j++ ) {
+        if( FD_LIKELY( tile->uses_obj_id[ j ]!=obj->id || tile->uses_obj_mode[ j ]!=mode ) ) continue;
+        ulong numa_idx = fd_shmem_numa_idx( tile->cpu_idx );
+        if( FD_UNLIKELY( numa_idx>=numa_cnt ) ) FD_LOG_ERR(( "tile %s:%lu cpu_idx %lu has no NUMA node", tile->name, tile->kind_id, tile->cpu_idx ));
+        votes[ numa_idx ]++;
+        if( votes[ numa_idx ]>best_votes || (votes[ numa_idx ]==best_votes && numa_idx<best_numa_idx) ) {
+          best_numa_idx = numa_idx;
+          best_votes    = votes[ numa_idx ];
+        }
+        break;
+      }
+    }
+
+    if( FD_LIKELY( best_numa_idx!=ULONG_MAX ) ) return best_numa_idx;
+    if( mode==FD_SHMEM_JOIN_MODE_READ_WRITE ) return ULONG_MAX;
+  }
+}
+
+/* fd_topob_argmax returns the index of the largest of the numa_cnt
+   values (ties go to the lowest index) or ULONG_MAX if all are zero. */
+
+static ulong
+fd_topob_argmax( ulong const * val,
+                 ulong         numa_cnt ) {
+  ulong best_idx = ULONG_MAX;
+  ulong best_val = 0UL;
+  for( ulong i=0UL; i<numa_cnt; i++ ) {
+    if( val[ i ]>best_val ) {
+      best_idx = i;
+      best_val = val[ i ];
+    }
+  }
+  return best_idx;
+}
+
+void
+fd_topob_auto_numa( fd_topo_t * topo ) {
+  ulong numa_cnt = fd_shmem_numa_cnt();
+
+  static ulong scratch[ FD_SHMEM_NUMA_MAX ];
+
+  /* Place each object near the tiles consuming it */
+
+  for( ulong i=0UL; i<topo->obj_cnt; i++ ) {
+    fd_topo_obj_t * obj = &topo->objs[ i ];
+    obj->numa_idx = fd_topob_obj_numa_idx( topo, obj, scratch );
+  }
+
+  for( ulong i=0UL; i<topo->wksp_cnt; i++ ) {
+    fd_topo_wksp_t * wksp = &topo->workspaces[ i ];
+
+    /* The workspace as a whole goes on the node that holds the most
+       bytes of its objects.  This is also where any pages not holding
+       objects (e.g. the workspace header and loose data) go. */
+
+    int used = 0;
+    memset( scratch, 0, numa_cnt*sizeof(ulong) );
+    for( ulong j=0UL; j<topo->obj_cnt; j++ ) {
+      fd_topo_obj_t const * obj = &topo->objs[ j ];
+      if( FD_LIKELY( obj->wksp_id!=wksp->id ) ) continue;
+
+      for( ulong k=0UL; k<topo->tile_cnt && !used; k++ ) {
+        fd_topo_tile_t const * tile = &topo->tiles[ k ];
+        for( ulong l=0UL; l<tile->uses_obj_cnt; l++ ) used |= tile->uses_obj_id[ l ]==obj->id;
+      }
+
+      if( FD_LIKELY( obj->numa_idx!=ULONG_MAX ) ) scratch[ obj->numa_idx ] += fd_ulong_max( obj->footprint, 1UL );
+    }
+
+    if( FD_UNLIKELY( !used ) ) FD_LOG_ERR(( "no tile uses any object in workspace %s", wksp->name ));
+
+    ulong numa_idx = fd_topob_argmax( scratch, numa_cnt );
+    wksp->numa_idx = fd_ulong_if( numa_idx==ULONG_MAX, 0UL, numa_idx );
+    wksp->sub_cnt  = 0UL;
+
+    /* Then, if the workspace spans multiple pages, give each page to
+       the node holding the most bytes of objects on that page and
+       split the workspace into runs of pages on the same node.  If that
+       would need too many sub-regions, the whole workspace goes on
+       numa_idx. */
+
+    ulong sub_cnt = 0UL;
+    for( ulong page_idx=0UL; page_idx<wksp->page_cnt; page_idx++ ) {
+      ulong page_lo = page_idx*wksp->page_sz;
+      ulong page_hi = page_lo + wksp->page_sz;
+
+      memset( scratch, 0, numa_cnt*sizeof(ulong) );
+      for( ulong j=0UL; j<topo->obj_cnt; j++ ) {
+        fd_topo_obj_t const * obj = &topo->objs[ j ];
+        if( FD_LIKELY( obj->wksp_id!=wksp->id || obj->numa_idx==ULONG_MAX ) ) continue;
+        ulong lo = fd_ulong_max( page_lo, obj->offset                  );
+        ulong hi = fd_ulong_min( page_hi, obj->offset + obj->footprint );
+        if( lo<hi ) scratch[ obj->numa_idx ] += hi - lo;
+      }
+
+      ulong page_numa_idx = fd_topob_argmax( scratch, numa_cnt );
+      page_numa_idx = fd_ulong_if( page_numa_idx==ULONG_MAX, wksp->numa_idx, page_numa_idx );
+
+      if( FD_LIKELY( sub_cnt && wksp->sub_numa_idx[ sub_cnt-1UL ]==page_numa_idx ) ) {
+        wksp->sub_page_cnt[ sub_cnt-1UL ]++;
+        continue;
+      }
+
+      if( FD_UNLIKELY( sub_cnt==FD_TOPO_MAX_WKSP_SUBS ) ) {
+        FD_LOG_INFO(( "workspace %s would need more than %lu NUMA sub-regions; placing it on NUMA node %lu",
+                      wksp->name, FD_TOPO_MAX_WKSP_SUBS, wksp->numa_idx ));
+        sub_cnt = 0UL;
+        break;
+      }
+
+      wksp->sub_numa_idx[ sub_cnt ] = page_numa_idx;
+      wksp->sub_page_cnt[ sub_cnt ] = 1UL;
+      sub_cnt++;
+    }
+
+    if( FD_LIKELY( sub_cnt==1UL ) ) wksp->numa_idx = wksp->sub_numa_idx[ 0 ];
+    wksp->sub_cnt = fd_ulong_if( sub_cnt>1UL, sub_cnt, 0UL );
+  }
+}
+
 static void
 validate( fd_topo_t const * topo ) {
   /* Objects have valid wksp_ids */
@@ -146,6 +146,18 @@ fd_topob_finish( fd_topo_t * topo,
                  ulong (* footprint)( fd_topo_t const * topo, fd_topo_obj_t const * obj ),
                  ulong (* loose    )( fd_topo_t const * topo, fd_topo_obj_t const * obj) );
 
+/* Automatically place the workspaces of a finished topology onto NUMA
+   nodes.  Each object is hinted to the NUMA node of the tiles consuming
+   it (obj->numa_idx), each workspace is placed on the node holding most
+   of its object bytes and workspaces with pages predominantly used by
+   tiles on different nodes are split into per-node sub-regions of
+   consecutive pages (see fd_topo_wksp_t).  Requires the CPU to NUMA
+   mapping, so fd_shmem must be booted, and must be called after
+   fd_topob_finish. */
+
+void
+fd_topob_auto_numa( fd_topo_t * topo );
+
 FD_PROTOTYPES_END
 
 #endif /* HEADER_fd_src_disco_topo_fd_topob_h */
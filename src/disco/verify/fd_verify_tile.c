@@ -34,6 +34,7 @@ metrics_write( fd_verify_ctx_t * ctx ) {
   FD_MCNT_SET( VERIFY, TRANSACTION_PARSE_FAILURE,       ctx->metrics.parse_fail_cnt );
   FD_MCNT_SET( VERIFY, TRANSACTION_DEDUP_FAILURE,       ctx->metrics.dedup_fail_cnt );
   FD_MCNT_SET( VERIFY, TRANSACTION_VERIFY_FAILURE,      ctx->metrics.verify_fail_cnt );
+  FD_MHIST_COPY( VERIFY, NET_RX_LATENCY_SECONDS,        ctx->metrics.net_rx_latency );
 }
 
 static int
@@ -138,8 +139,14 @@ after_frag( fd_verify_ctx_t *   ctx,
     return;
   }
 
+  /* Transactions from gossip and bundles carry no RX timestamp */
+  long now = fd_tickcount();
+  if( FD_LIKELY( tsorig ) ) {
+    fd_histf_sample( ctx->metrics.net_rx_latency, (ulong)fd_long_max( now-fd_frag_meta_ts_decomp( tsorig, now ), 0L ) );
+  }
+
   ulong realized_sz = fd_txn_m_realized_footprint( txnm, 1, 0 );
-  ulong tspub = (ulong)fd_frag_meta_ts_comp( fd_tickcount() );
+  ulong tspub = (ulong)fd_frag_meta_ts_comp( now );
   fd_stem_publish( stem, 0UL, 0UL, ctx->out_chunk, realized_sz, 0UL, tsorig, tspub );
   ctx->out_chunk = fd_dcache_compact_next( ctx->out_chunk, realized_sz, ctx->out_chunk0, ctx->out_wmark );
 }
@@ -177,6 +184,8 @@ unprivileged_init( fd_topo_t *      topo,
   ctx->bundle_id     = 0UL;
 
   memset( &ctx->metrics, 0, sizeof( ctx->metrics ) );
+  fd_histf_join( fd_histf_new( ctx->metrics.net_rx_latency, FD_MHIST_SECONDS_MIN( VERIFY, NET_RX_LATENCY_SECONDS ),
+                                                            FD_MHIST_SECONDS_MAX( VERIFY, NET_RX_LATENCY_SECONDS ) ) );
 
   ctx->tcache_depth   = fd_tcache_depth       ( tcache );
   ctx->tcache_map_cnt = fd_tcache_map_cnt     ( tcache );
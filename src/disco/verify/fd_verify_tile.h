@@ -47,6 +47,7 @@ typedef struct {
     ulong verify_fail_cnt;
     ulong dedup_fail_cnt;
     ulong bundle_peer_fail_cnt;
+    fd_histf_t net_rx_latency[1];
   } metrics;
 } fd_verify_ctx_t;
 
@@ -82,8 +82,9 @@ struct fd_replay_out_ctx {
 typedef struct fd_replay_out_ctx fd_replay_out_ctx_t;
 
 struct fd_replay_tile_metrics {
-  ulong slot;
-  ulong last_voted_slot;
+  ulong      slot;
+  ulong      last_voted_slot;
+  fd_histf_t rewards_distribution_duration[ 1 ];
 };
 typedef struct fd_replay_tile_metrics fd_replay_tile_metrics_t;
 #define FD_REPLAY_TILE_METRICS_FOOTPRINT ( sizeof( fd_replay_tile_metrics_t ) )
@@ -1269,6 +1270,10 @@ prepare_new_block_execution( fd_replay_tile_ctx_t * ctx,
     FD_LOG_ERR(( "couldn't process new epoch" ));
   }
 
+  if( FD_UNLIKELY( fork->slot_ctx.rewards_distribution_ticks ) ) {
+    fd_histf_sample( ctx->metrics.rewards_distribution_duration, (ulong)fork->slot_ctx.rewards_distribution_ticks );
+  }
+
   /* We want to push on a spad frame before we start executing a block.
      Apart from allocations made at the epoch boundary, there should be no
      allocations that persist beyond the scope of a block. Before this point,
@@ -1319,20 +1324,19 @@ init_poh( fd_replay_tile_ctx_t * ctx ) {
   ctx->poh_init_done = 1;
 }
 
-/* Verifies a microblock batch validity. */
+/* Verifies a microblock batch and executes its transactions.  This is
+   called as soon as the batch is deshredded, so replay of a slot keeps
+   up with shreds arriving instead of waiting for the full block.  The
+   PoH hashes of all microblocks in the batch are verified in parallel
+   on the tpool before any of them is executed.  The hash of the last
+   entry replayed so far is kept in the block map entry of the slot, so
+   the next batch chains from it. */
 
 static int
 process_and_exec_mbatch( fd_replay_tile_ctx_t * ctx,
                          fd_stem_context_t *    stem FD_PARAM_UNUSED,
                          ulong                  mbatch_sz,
                          bool                   last_batch ) {
-  #define wait_and_check_success( worker_idx )         \
-    fd_tpool_wait( ctx->tpool, worker_idx );           \
-    if( poh_info[ worker_idx ].success ) {             \
-      FD_LOG_WARNING(( "Failed to verify tick poh" )); \
-      return -1; \
-    }
-
   fd_hash_t in_poh_hash;
   fd_block_map_query_t query[1] = { 0 } ;
   int err = FD_MAP_ERR_AGAIN;
@@ -1352,16 +1356,18 @@ process_and_exec_mbatch( fd_replay_tile_ctx_t * ctx,
     return 0;
   }
 
-  fd_poh_verifier_t     poh_info         = {0};
-  (void)poh_info;
+  /* Parse the whole batch and check its tick metadata */
 
-  fd_microblock_hdr_t * hdr              = NULL;
-  ulong                 off              = sizeof(ulong);
-  for( ulong i=0UL; i<micro_cnt; i++ ){
-    hdr = (fd_microblock_hdr_t *)fd_type_pun( ctx->mbatch + off );
+  fd_microblock_batch_info_t mbatch_info[1];
+  if( FD_UNLIKELY( fd_runtime_microblock_batch_prepare( ctx->mbatch, mbatch_sz, ctx->runtime_spad, mbatch_info ) ) ) {
+    FD_LOG_WARNING(( "failed to parse microblock batch in replay" ));
+    return -1;
+  }
+
+  for( ulong i=0UL; i<micro_cnt; i++ ) {
     int res = fd_runtime_microblock_verify_ticks( ctx->slot_ctx,
                                                   ctx->curr_slot,
-                                                  hdr,
+                                                  mbatch_info->microblock_infos[ i ].microblock.hdr,
                                                   last_batch && i == micro_cnt - 1,
                                                   ctx->slot_ctx->slot_bank.tick_height,
                                                   ctx->slot_ctx->slot_bank.max_tick_height,
@@ -1371,59 +1377,31 @@ process_and_exec_mbatch( fd_replay_tile_ctx_t * ctx,
       FD_LOG_WARNING(( "Failed to verify tick metadata" ));
       return -1;
     }
+  }
 
-    poh_info.success         = 0;
-    poh_info.in_poh_hash     = &in_poh_hash;
-    poh_info.microblock.hdr  = hdr;
-    poh_info.spad            = ctx->runtime_spad;
-    poh_info.microblk_max_sz = mbatch_sz - off;
-
-    off += sizeof(fd_microblock_hdr_t);
-
-    /* FIXME: This needs to be multithreaded. This will be reintroduced when
-       the execution model changes are made */
-    // fd_runtime_poh_verify( &poh_info );
-    // if( poh_info.success==-1 ) {
-    //   FD_LOG_WARNING(( "Failed to verify poh hash" ));
-    //   return -1;
-    // }
-
-    in_poh_hash = *(fd_hash_t *)fd_type_pun( hdr->hash );
-
-    /* seek past txns */
-    fd_txn_p_t * txn_p  = fd_spad_alloc( ctx->runtime_spad, alignof(fd_txn_p_t*), sizeof(fd_txn_p_t) * hdr->txn_cnt );
-    for( ulong t=0UL; t<hdr->txn_cnt; t++ ){
-      ulong pay_sz = 0UL;
-      ulong txn_sz = fd_txn_parse_core( ctx->mbatch + off,
-                                        fd_ulong_min( FD_TXN_MTU, mbatch_sz - off ),
-                                        TXN( &txn_p[t] ),
-                                        NULL,
-                                        &pay_sz );
-
-      if( FD_UNLIKELY( !pay_sz || !txn_sz || txn_sz > FD_TXN_MTU ) ) {
-        FD_LOG_WARNING(( "failed to parse transaction %lu in replay", t ));
-        return -1;
-      }
-      fd_memcpy( txn_p[t].payload, ctx->mbatch + off, pay_sz );
-      txn_p[t].payload_sz = pay_sz;
-      off                += pay_sz;
+  long poh_verify_time = -fd_log_wallclock();
+  if( FD_UNLIKELY( fd_runtime_microblock_batch_poh_verify_tpool( mbatch_info, &in_poh_hash, ctx->tpool, ctx->runtime_spad ) ) ) {
+    FD_LOG_WARNING(( "Failed to verify poh hash" ));
+    return -1;
+  }
+  poh_verify_time += fd_log_wallclock();
+  FD_LOG_DEBUG(( "verified microblock batch poh - slot: %lu, microblock_cnt: %lu, elapsed: %6.6f ms",
+                 ctx->curr_slot, micro_cnt, (double)poh_verify_time * 1e-6 ));
 
-      /* Execute Transaction  */
+  /* Now that we have verified the batch, execute it mblock by mblock */
 
-      /* dispatch into MCACHE / DCACHE */
-      // fd_replay_out_ctx_t * out = &ctx->exec_out[ 0 ];
-      // fd_stem_publish( stem, out->idx, 0, out->chunk, sizeof(fd_txn_p_t), 0UL, 0UL, 0UL );
-      // out->chunk = fd_dcache_compact_next( out->chunk,  sizeof(fd_txn_p_t), out->chunk0, out->wmark );
-    }
+  fd_fork_t * fork = fd_fork_frontier_ele_query( ctx->forks->frontier,
+                                                 &ctx->curr_slot,
+                                                 NULL,
+                                                 ctx->forks->pool );
+  if( FD_UNLIKELY( !fork ) ) {
+    FD_LOG_ERR(( "Unable to select a fork" ));
+  }
 
-    /* Now that we have parsed the mblock, we are ready to execute the whole mblock */
-    fd_fork_t * fork = fd_fork_frontier_ele_query( ctx->forks->frontier,
-                                                   &ctx->curr_slot,
-                                                   NULL,
-                                                   ctx->forks->pool );
-    if( FD_UNLIKELY( !fork ) ) {
-      FD_LOG_ERR(( "Unable to select a fork" ));
-    }
+  for( ulong i=0UL; i<micro_cnt; i++ ){
+    fd_microblock_info_t const * microblock_info = &mbatch_info->microblock_infos[ i ];
+    fd_microblock_hdr_t const *  hdr             = microblock_info->microblock.hdr;
+    fd_txn_p_t *                 txn_p           = microblock_info->txns;
 
     err = fd_runtime_process_txns_in_microblock_stream( &fork->slot_ctx,
                                                         ctx->capture_ctx,
@@ -1449,6 +1427,9 @@ process_and_exec_mbatch( fd_replay_tile_ctx_t * ctx,
       return -1;
     }
 
+    /* The next batch chains from the hash of this entry */
+    memcpy( &block_info->in_poh_hash, hdr->hash, sizeof(fd_hash_t) );
+
     if( last_batch && i == micro_cnt - 1 ) {
 
       // Copy block hash to slot_bank poh for updating the sysvars
@@ -1465,7 +1446,6 @@ process_and_exec_mbatch( fd_replay_tile_ctx_t * ctx,
     fd_block_map_publish( query );
   }
   return 0;
-# undef wait_and_check_success
 }
 
 static void
@@ -2266,6 +2246,7 @@ init_snapshot( fd_replay_tile_ctx_t * ctx,
   ctx->slot_ctx->blockstore   = ctx->blockstore;
   ctx->slot_ctx->epoch_ctx    = ctx->epoch_ctx;
   ctx->slot_ctx->status_cache = ctx->status_cache;
+  ctx->slot_ctx->replay_sched = FD_RUNTIME_REPLAY_SCHED_DAG;
 
   uchar is_snapshot = strlen( ctx->snapshot ) > 0;
   if( is_snapshot ) {
@@ -2917,6 +2898,9 @@ unprivileged_init( fd_topo_t *      topo,
 
   ctx->replay_public = fd_runtime_public_join( fd_topo_obj_laddr( topo, replay_obj_id ) );
   FD_TEST( ctx->replay_public!=NULL );
+
+  fd_histf_join( fd_histf_new( ctx->metrics.rewards_distribution_duration, FD_MHIST_SECONDS_MIN( REPLAY, REWARDS_DISTRIBUTION_DURATION_SECONDS ),
+                                                                           FD_MHIST_SECONDS_MAX( REPLAY, REWARDS_DISTRIBUTION_DURATION_SECONDS ) ) );
 }
 
 static ulong
@@ -2959,6 +2943,7 @@ static inline void
 metrics_write( fd_replay_tile_ctx_t * ctx ) {
   FD_MGAUGE_SET( REPLAY, LAST_VOTED_SLOT, ctx->metrics.last_voted_slot );
   FD_MGAUGE_SET( REPLAY, SLOT, ctx->metrics.slot );
+  FD_MHIST_COPY( REPLAY, REWARDS_DISTRIBUTION_DURATION_SECONDS, ctx->metrics.rewards_distribution_duration );
 }
 
 /* TODO: This is definitely not correct */
@@ -1,5 +1,12 @@
 /* Sender tile signs and sends transactions to the current leader. Currently
-   only supports transactions which require one signature. */
+   only supports transactions which require one signature.
+
+   Votes are sent to the current leader and the leaders of the next
+   few rotations, such that votes sent close to a leader rotation
+   still land promptly.  Leader TPU vote addresses are resolved once
+   per rotation (or when stake weights / contact info change) and
+   cached, keeping schedule and contact lookups off the per-vote
+   path. */
 #define _GNU_SOURCE
 
 #include "../../disco/topo/fd_topo.h"
@@ -24,6 +31,7 @@
 #include "../../flamenco/runtime/fd_runtime.h"
 #include "../../disco/fd_disco.h"
 #include "../../util/net/fd_net_headers.h"
+#include "../../disco/metrics/fd_metrics.h"
 
 #include <unistd.h>
 #include <arpa/inet.h>
@@ -36,6 +44,17 @@
 #define SCRATCH_MAX    (4UL /*KiB*/ << 10)
 #define SCRATCH_DEPTH  (4UL) /* 4 scratch frames */
 
+/* LEADER_FANOUT is the max number of distinct upcoming leaders each
+   vote is sent to (including the current leader). */
+#define LEADER_FANOUT  (3UL)
+
+struct fd_sender_leader {
+  fd_pubkey_t pubkey;
+  uint        ip4;
+  ushort      port;
+};
+typedef struct fd_sender_leader fd_sender_leader_t;
+
 struct fd_sender_tile_ctx {
   fd_pubkey_t identity_key[ 1 ];
   fd_pubkey_t vote_acct_addr[ 1 ];
@@ -45,6 +64,19 @@ struct fd_sender_tile_ctx {
   fd_shred_dest_weighted_t * new_dest_ptr;
   ulong                      new_dest_cnt;
 
+  /* Cached TPU vote addresses of upcoming leaders, valid for leader
+     rotation leader_rotation (ULONG_MAX if invalid). */
+  ulong              leader_rotation;
+  ulong              leader_cnt;
+  fd_sender_leader_t leader[ LEADER_FANOUT ];
+
+  struct {
+    ulong vote_txn_sent;
+    ulong vote_txn_no_leader;
+    ulong leader_contact_missing;
+    ulong leader_cache_refreshed;
+  } metrics;
+
   uchar txn_buf[ sizeof(fd_txn_p_t) ] __attribute__((aligned(alignof(fd_txn_p_t))));
 
   fd_gossip_peer_addr_t tpu_serve_addr;
@@ -166,27 +198,67 @@ send_packet( fd_sender_tile_ctx_t * ctx,
   ctx->net_out_chunk = fd_dcache_compact_next( ctx->net_out_chunk, packet_sz, ctx->net_out_chunk0, ctx->net_out_wmark );
 }
 
-static int
-get_current_leader_tpu_vote_contact( fd_sender_tile_ctx_t *      ctx,
-                                     fd_shred_dest_weighted_t ** out_dest ) {
-  ulong poh_slot = fd_fseq_query( ctx->poh_slot );
-  if( poh_slot==ULONG_MAX ) { return -1; }
+/* refresh_leaders rebuilds the cache of upcoming leader TPU vote
+   addresses, starting at the leader rotation containing poh_slot.
+   Each leader is cached at most once, even if it has multiple of the
+   upcoming rotations.  Leaders without known contact info are
+   skipped. */
 
-  fd_epoch_leaders_t const * lsched = fd_stake_ci_get_lsched_for_slot( ctx->stake_ci, poh_slot );
-  if( FD_UNLIKELY( !lsched      ) ) { return -1; }
+static void
+refresh_leaders( fd_sender_tile_ctx_t * ctx,
+                 ulong                  poh_slot ) {
+  ulong rotation = poh_slot / FD_EPOCH_SLOTS_PER_ROTATION;
+  ctx->leader_rotation = rotation;
+  ctx->leader_cnt      = 0UL;
+  ctx->metrics.leader_cache_refreshed++;
+
+  for( ulong i=0UL; i<LEADER_FANOUT; i++ ) {
+    ulong slot = (rotation+i) * FD_EPOCH_SLOTS_PER_ROTATION;
+
+    fd_epoch_leaders_t const * lsched = fd_stake_ci_get_lsched_for_slot( ctx->stake_ci, slot );
+    if( FD_UNLIKELY( !lsched ) ) break;
+    fd_pubkey_t const * slot_leader = fd_epoch_leaders_get( lsched, slot );
+    if( FD_UNLIKELY( !slot_leader ) ) break;
+
+    /* Upcoming rotations can have the same leader, consecutive or not */
+    ulong j;
+    for( j=0UL; j<ctx->leader_cnt; j++ ) {
+      if( !memcmp( ctx->leader[ j ].pubkey.uc, slot_leader->uc, sizeof(fd_pubkey_t) ) ) break;
+    }
+    if( j<ctx->leader_cnt ) continue;
 
-  fd_pubkey_t const * slot_leader = fd_epoch_leaders_get( lsched, poh_slot );
-  if( FD_UNLIKELY( !slot_leader ) ) { return -1 ; } /* Count this as bad slot too */
+    fd_shred_dest_t *   sdest     = fd_stake_ci_get_sdest_for_slot( ctx->stake_ci, slot );
+    fd_shred_dest_idx_t sdest_idx = sdest ? fd_shred_dest_pubkey_to_idx( sdest, slot_leader ) : FD_SHRED_DEST_NO_DEST;
+    if( FD_UNLIKELY( sdest_idx==FD_SHRED_DEST_NO_DEST ) ) {
+      ctx->metrics.leader_contact_missing++;
+      continue;
+    }
+    fd_shred_dest_weighted_t const * dest = fd_shred_dest_idx_to_dest( sdest, sdest_idx );
+    if( FD_UNLIKELY( !dest->ip4 ) ) {
+      ctx->metrics.leader_contact_missing++;
+      continue;
+    }
 
-  fd_shred_dest_t * sdest = fd_stake_ci_get_sdest_for_slot( ctx->stake_ci, poh_slot );
-  fd_shred_dest_idx_t sdest_idx = fd_shred_dest_pubkey_to_idx( sdest, slot_leader );
-  if( FD_UNLIKELY( sdest_idx==FD_SHRED_DEST_NO_DEST ) ) {
-    return -1;
+    fd_sender_leader_t * leader = &ctx->leader[ ctx->leader_cnt++ ];
+    leader->pubkey = *slot_leader;
+    leader->ip4    = dest->ip4;
+    leader->port   = dest->port;
   }
+}
 
-  *out_dest = fd_shred_dest_idx_to_dest( sdest, sdest_idx );
+/* get_upcoming_leaders returns the number of cached upcoming leader
+   TPU vote addresses, refreshing the cache if the leader rotation
+   changed. */
 
-  return 0;
+static ulong
+get_upcoming_leaders( fd_sender_tile_ctx_t * ctx ) {
+  ulong poh_slot = fd_fseq_query( ctx->poh_slot );
+  if( poh_slot==ULONG_MAX ) { return 0UL; }
+
+  if( FD_UNLIKELY( poh_slot/FD_EPOCH_SLOTS_PER_ROTATION!=ctx->leader_rotation ) ) {
+    refresh_leaders( ctx, poh_slot );
+  }
+  return ctx->leader_cnt;
 }
 
 static inline void
@@ -216,6 +288,16 @@ handle_new_cluster_contact_info( fd_sender_tile_ctx_t * ctx,
 static inline void
 finalize_new_cluster_contact_info( fd_sender_tile_ctx_t * ctx ) {
   fd_stake_ci_dest_add_fini( ctx->stake_ci, ctx->new_dest_cnt );
+  ctx->leader_rotation = ULONG_MAX;
+}
+
+static inline void
+metrics_write( fd_sender_tile_ctx_t * ctx ) {
+  FD_MCNT_SET  ( SENDER, VOTE_TXN_SENT,          ctx->metrics.vote_txn_sent          );
+  FD_MCNT_SET  ( SENDER, VOTE_TXN_NO_LEADER,     ctx->metrics.vote_txn_no_leader     );
+  FD_MCNT_SET  ( SENDER, LEADER_CONTACT_MISSING, ctx->metrics.leader_contact_missing );
+  FD_MCNT_SET  ( SENDER, LEADER_CACHE_REFRESHED, ctx->metrics.leader_cache_refreshed );
+  FD_MGAUGE_SET( SENDER, LEADER_CACHE_SIZE,      ctx->leader_cnt                     );
 }
 
 static void
@@ -279,6 +361,7 @@ after_frag( fd_sender_tile_ctx_t * ctx,
 
   if( FD_UNLIKELY( in_idx==ctx->stake_in_idx ) ) {
     fd_stake_ci_stake_msg_fini( ctx->stake_ci );
+    ctx->leader_rotation = ULONG_MAX;
     return;
   }
 
@@ -294,13 +377,13 @@ after_frag( fd_sender_tile_ctx_t * ctx,
     uchar * msg_to_gossip = fd_chunk_to_laddr( ctx->gossip_out_mem, ctx->gossip_out_chunk );
     memcpy( msg_to_gossip, txn->payload, txn->payload_sz );
 
-    /* send to leader */
-    fd_shred_dest_weighted_t * leader_dest = NULL;
-    int res = get_current_leader_tpu_vote_contact( ctx, &leader_dest );
-    /* TODO: add metrics for successful votes sent and failed votes */
-    if( res==0 ) {
-      send_packet( ctx, leader_dest->ip4, leader_dest->port, msg_to_gossip, txn->payload_sz, 0UL );
+    /* send to upcoming leaders */
+    ulong leader_cnt = get_upcoming_leaders( ctx );
+    for( ulong i=0UL; i<leader_cnt; i++ ) {
+      send_packet( ctx, ctx->leader[ i ].ip4, ctx->leader[ i ].port, msg_to_gossip, txn->payload_sz, 0UL );
     }
+    ctx->metrics.vote_txn_sent      += leader_cnt;
+    ctx->metrics.vote_txn_no_leader += (ulong)!leader_cnt;
 
     /* send to gossip */
     fd_mcache_publish( ctx->gossip_out_mcache, ctx->gossip_out_depth, ctx->gossip_out_seq, 1UL, ctx->gossip_out_chunk,
@@ -354,6 +437,10 @@ unprivileged_init( fd_topo_t *      topo,
 
   ctx->net_id = (ushort)0;
 
+  ctx->leader_rotation = ULONG_MAX;
+  ctx->leader_cnt      = 0UL;
+  memset( &ctx->metrics, 0, sizeof(ctx->metrics) );
+
   ctx->tpu_serve_addr.addr = tile->sender.ip_addr;
   ctx->tpu_serve_addr.port = fd_ushort_bswap( tile->sender.tpu_listen_port );
   fd_net_create_packet_header_template( ctx->packet_hdr, FD_TXN_MTU, ctx->tpu_serve_addr.addr, ctx->tpu_serve_addr.port );
@@ -482,6 +569,7 @@ populate_allowed_fds( fd_topo_t const *      topo,
 #define STEM_CALLBACK_CONTEXT_TYPE  fd_sender_tile_ctx_t
 #define STEM_CALLBACK_CONTEXT_ALIGN alignof(fd_sender_tile_ctx_t)
 
+#define STEM_CALLBACK_METRICS_WRITE metrics_write
 #define STEM_CALLBACK_DURING_FRAG during_frag
 #define STEM_CALLBACK_AFTER_FRAG  after_frag
 
@@ -316,7 +316,7 @@ calculate_points_tpool( void  *tpool,
                         void  *reduce FD_PARAM_UNUSED, ulong stride FD_PARAM_UNUSED,
                         ulong l0 FD_PARAM_UNUSED,      ulong l1 FD_PARAM_UNUSED,
                         ulong m0,                      ulong m1,
-                        ulong n0 FD_PARAM_UNUSED,      ulong n1 FD_PARAM_UNUSED ) {
+                        ulong n0,                      ulong n1 FD_PARAM_UNUSED ) {
   fd_epoch_info_pair_t const *      stake_infos                    = ((fd_epoch_info_pair_t const *)tpool);
   fd_calculate_points_task_args_t * task_args                      = (fd_calculate_points_task_args_t *)args;
   fd_stake_history_t const *        stake_history                  = task_args->stake_history;
@@ -352,7 +352,7 @@ calculate_points_tpool( void  *tpool,
     total_points += account_points;
   }
 
-  FD_ATOMIC_FETCH_AND_ADD( task_args->total_points, total_points );
+  task_args->worker_points[ n0 ] = total_points;
 
 }
 
@@ -365,7 +365,8 @@ calculate_reward_points_partitioned( fd_exec_slot_ctx_t *       slot_ctx,
                                      ulong                      rewards,
                                      fd_point_value_t *         result,
                                      fd_tpool_t *               tpool,
-                                     fd_epoch_info_t *          temp_info ) {
+                                     fd_epoch_info_t *          temp_info,
+                                     fd_spad_t *                runtime_spad ) {
 
   uint128 points = 0;
   ulong minimum_stake_delegation = get_minimum_stake_delegation( slot_ctx );
@@ -379,18 +380,31 @@ calculate_reward_points_partitioned( fd_exec_slot_ctx_t *       slot_ctx,
     new_warmup_cooldown_rate_epoch = NULL;
   }
 
+  FD_SPAD_FRAME_BEGIN( runtime_spad ) {
+
+  /* Each worker sums the points of its range of stake infos, the
+     partial sums are reduced in worker order below. */
+  ulong     worker_cnt    = fd_tpool_worker_cnt( tpool );
+  uint128 * worker_points = fd_spad_alloc( runtime_spad, alignof(uint128), worker_cnt*sizeof(uint128) );
+
   fd_calculate_points_task_args_t task_args = {
     .stake_history                  = stake_history,
     .new_warmup_cooldown_rate_epoch = new_warmup_cooldown_rate_epoch,
     .minimum_stake_delegation       = minimum_stake_delegation,
     .vote_states_pool               = temp_info->vote_states_pool,
     .vote_states_root               = temp_info->vote_states_root,
-    .total_points                   = &points,
+    .worker_points                  = worker_points,
   };
 
-  fd_tpool_exec_all_batch( tpool, 0UL, fd_tpool_worker_cnt( tpool ), calculate_points_tpool,
+  fd_tpool_exec_all_batch( tpool, 0UL, worker_cnt, calculate_points_tpool,
                            temp_info->stake_infos, &task_args, NULL, 1UL, 0UL, temp_info->stake_infos_len );
 
+  for( ulong i=0UL; i<worker_cnt; i++ ) {
+    points += worker_points[ i ];
+  }
+
+  } FD_SPAD_FRAME_END;
+
   if( points > 0 ) {
     result->points  = points;
     result->rewards = rewards;
@@ -661,7 +675,8 @@ calculate_validator_rewards( fd_exec_slot_ctx_t *                      slot_ctx,
                                        rewards,
                                        &result->point_value,
                                        tpool,
-                                       temp_info );
+                                       temp_info,
+                                       runtime_spad );
 
   /* Calculate the stake and vote rewards for each account */
   calculate_stake_vote_rewards( slot_ctx,
@@ -697,11 +712,48 @@ get_reward_distribution_num_blocks( fd_epoch_schedule_t const * epoch_schedule,
   return num_chunks;
 }
 
+/* Hashes the stake rewards held by the pool elements [m0,m1) into
+   their partition indices. */
+static void
+hash_rewards_into_partitions_tpool( void  *tpool FD_PARAM_UNUSED,
+                                    ulong t0 FD_PARAM_UNUSED,      ulong t1 FD_PARAM_UNUSED,
+                                    void  *args,
+                                    void  *reduce FD_PARAM_UNUSED, ulong stride FD_PARAM_UNUSED,
+                                    ulong l0 FD_PARAM_UNUSED,      ulong l1 FD_PARAM_UNUSED,
+                                    ulong m0,                      ulong m1,
+                                    ulong n0 FD_PARAM_UNUSED,      ulong n1 FD_PARAM_UNUSED ) {
+  fd_hash_rewards_task_args_t const * task_args        = (fd_hash_rewards_task_args_t const *)args;
+  fd_hash_t const *                   parent_blockhash = task_args->parent_blockhash;
+  ulong                               num_partitions   = task_args->num_partitions;
+
+  for( ulong i=m0; i<m1; i++ ) {
+    fd_stake_reward_t const * stake_reward = fd_stake_reward_pool_ele_const( task_args->pool, i );
+    if( FD_UNLIKELY( !stake_reward->valid ) ) {
+      continue;
+    }
+
+    /* https://github.com/firedancer-io/solana/blob/dab3da8e7b667d7527565bddbdbecf7ec1fb868e/runtime/src/epoch_rewards_hasher.rs#L43C31-L61 */
+    fd_siphash13_t  _sip[1] = {0};
+    fd_siphash13_t * hasher = fd_siphash13_init( _sip, 0UL, 0UL );
+
+    hasher = fd_siphash13_append( hasher, parent_blockhash->hash, sizeof(fd_hash_t) );
+    fd_siphash13_append( hasher, (const uchar *) stake_reward->stake_pubkey.key, sizeof(fd_pubkey_t) );
+
+    ulong hash64 = fd_siphash13_fini( hasher );
+    /* hash_to_partition */
+    /* FIXME: should be saturating add */
+    task_args->partition_idxs[ i ] = (ulong)((uint128) num_partitions *
+                                             (uint128) hash64 /
+                                             ((uint128)ULONG_MAX + 1));
+  }
+}
+
 static void
 hash_rewards_into_partitions( fd_exec_slot_ctx_t *                        slot_ctx,
                               fd_stake_reward_calculation_t *             stake_reward_calculation,
                               fd_hash_t const *                           parent_blockhash,
                               fd_stake_reward_calculation_partitioned_t * result,
+                              fd_tpool_t *                                tpool,
                               fd_spad_t *                                 runtime_spad ) {
 
   /* Initialize a dlist for every partition.
@@ -721,6 +773,26 @@ hash_rewards_into_partitions( fd_exec_slot_ctx_t *                        slot_c
     fd_stake_reward_dlist_new( &result->partitioned_stake_rewards.partitions[ i ] );
   }
 
+  FD_SPAD_FRAME_BEGIN( runtime_spad ) {
+
+  /* Hashing the stake pubkeys dominates this step, so the partition
+     index of every stake reward is computed via the tpool first.  The
+     stake rewards are then moved into their partitions serially, in the
+     order of the stake rewards dlist, such that the order within each
+     partition does not depend on the number of workers. */
+  ulong   pool_max       = fd_stake_reward_pool_max( stake_reward_calculation->pool );
+  ulong * partition_idxs = fd_spad_alloc( runtime_spad, alignof(ulong), pool_max*sizeof(ulong) );
+
+  fd_hash_rewards_task_args_t task_args = {
+    .parent_blockhash = parent_blockhash,
+    .num_partitions   = num_partitions,
+    .pool             = stake_reward_calculation->pool,
+    .partition_idxs   = partition_idxs,
+  };
+
+  fd_tpool_exec_all_batch( tpool, 0UL, fd_tpool_worker_cnt( tpool ), hash_rewards_into_partitions_tpool,
+                           NULL, &task_args, NULL, 1UL, 0UL, pool_max );
+
   /* Iterate over all the stake rewards, moving references to them into the appropiate partitions.
       IMPORTANT: after this, we cannot use the original stake rewards dlist anymore. */
   fd_stake_reward_dlist_iter_t next_iter;
@@ -735,24 +807,13 @@ hash_rewards_into_partitions( fd_exec_slot_ctx_t *                        slot_c
       continue;
     }
 
-    /* https://github.com/firedancer-io/solana/blob/dab3da8e7b667d7527565bddbdbecf7ec1fb868e/runtime/src/epoch_rewards_hasher.rs#L43C31-L61 */
-    fd_siphash13_t  _sip[1] = {0};
-    fd_siphash13_t * hasher = fd_siphash13_init( _sip, 0UL, 0UL );
-
-    hasher = fd_siphash13_append( hasher, parent_blockhash->hash, sizeof(fd_hash_t) );
-    fd_siphash13_append( hasher, (const uchar *) stake_reward->stake_pubkey.key, sizeof(fd_pubkey_t) );
-
-    ulong hash64 = fd_siphash13_fini( hasher );
-    /* hash_to_partition */
-    /* FIXME: should be saturating add */
-    ulong partition_index = (ulong)((uint128) num_partitions *
-                                    (uint128) hash64 /
-                                    ((uint128)ULONG_MAX + 1));
-
     /* Move the stake reward to the partition's dlist */
-    fd_stake_reward_dlist_t * partition = &result->partitioned_stake_rewards.partitions[ partition_index ];
+    ulong                     partition_index = partition_idxs[ fd_stake_reward_pool_idx( stake_reward_calculation->pool, stake_reward ) ];
+    fd_stake_reward_dlist_t * partition       = &result->partitioned_stake_rewards.partitions[ partition_index ];
     fd_stake_reward_dlist_ele_push_tail( partition, stake_reward, stake_reward_calculation->pool );
   }
+
+  } FD_SPAD_FRAME_END;
 }
 
 /* Calculate rewards from previous epoch to prepare for partitioned distribution.
@@ -789,6 +850,7 @@ calculate_rewards_for_partitioning( fd_exec_slot_ctx_t *                   slot_
                                 &validator_result->calculate_stake_vote_rewards_result.stake_reward_calculation,
                                 parent_blockhash,
                                 &result->stake_rewards_by_partition,
+                                tpool,
                                 runtime_spad );
 
   result->stake_rewards_by_partition.total_stake_rewards_lamports =
@@ -870,24 +932,18 @@ calculate_rewards_and_distribute_vote_rewards( fd_exec_slot_ctx_t *
   fd_memcpy( &result->point_value, &rewards_calc_result->point_value, FD_POINT_VALUE_FOOTPRINT );
 }
 
-/* Distributes a single partitioned reward to a single stake account */
+/* Distributes a single partitioned reward to a single stake account.
+   stake_acc_rec must already be writable (see
+   distribute_epoch_rewards_in_partition).  Only touches the given
+   account, so it is safe to run concurrently for distinct accounts. */
 static int
-distribute_epoch_reward_to_stake_acc( fd_exec_slot_ctx_t * slot_ctx,
-                                      fd_pubkey_t *        stake_pubkey,
-                                      ulong                reward_lamports,
-                                      ulong                new_credits_observed ) {
-
-  FD_TXN_ACCOUNT_DECL( stake_acc_rec );
-
-  if( FD_UNLIKELY( fd_acc_mgr_modify( slot_ctx->acc_mgr, slot_ctx->funk_txn, stake_pubkey, 0, 0UL, stake_acc_rec ) != FD_ACC_MGR_SUCCESS ) ) {
-    FD_LOG_ERR(( "Unable to modify stake account" ));
-  }
-
-  stake_acc_rec->meta->slot = slot_ctx->slot_bank.slot;
+distribute_epoch_reward_to_stake_acc( fd_txn_account_t * stake_acc_rec,
+                                      ulong              reward_lamports,
+                                      ulong              new_credits_observed ) {
 
   fd_stake_state_v2_t stake_state[1] = {0};
   if( fd_stake_get_state( stake_acc_rec, stake_state ) != 0 ) {
-    FD_LOG_DEBUG(( "failed to read stake state for %s", FD_BASE58_ENC_32_ALLOCA( stake_pubkey ) ));
+    FD_LOG_DEBUG(( "failed to read stake state for %s", FD_BASE58_ENC_32_ALLOCA( stake_acc_rec->pubkey ) ));
     return 1;
   }
 
@@ -939,33 +995,91 @@ set_epoch_reward_status_active( fd_exec_slot_ctx_t *             slot_ctx,
   fd_memcpy( &slot_ctx->epoch_reward_status.inner.Active.partitioned_stake_rewards, partitioned_rewards, FD_PARTITIONED_STAKE_REWARDS_FOOTPRINT );
 }
 
+static void
+distribute_epoch_rewards_in_partition_tpool( void  *tpool,
+                                             ulong t0 FD_PARAM_UNUSED,      ulong t1 FD_PARAM_UNUSED,
+                                             void  *args,
+                                             void  *reduce FD_PARAM_UNUSED, ulong stride FD_PARAM_UNUSED,
+                                             ulong l0 FD_PARAM_UNUSED,      ulong l1 FD_PARAM_UNUSED,
+                                             ulong m0,                      ulong m1,
+                                             ulong n0 FD_PARAM_UNUSED,      ulong n1 FD_PARAM_UNUSED ) {
+  fd_distribute_rewards_task_args_t const * task_args     = (fd_distribute_rewards_task_args_t const *)args;
+  fd_stake_reward_t * const *               stake_rewards = (fd_stake_reward_t * const *)tpool;
+
+  for( ulong i=m0; i<m1; i++ ) {
+    task_args->results[ i ] = distribute_epoch_reward_to_stake_acc( task_args->stake_accs + i,
+                                                                    stake_rewards[ i ]->lamports,
+                                                                    stake_rewards[ i ]->credits_observed );
+  }
+}
+
 /*  Process reward credits for a partition of rewards.
     Store the rewards to AccountsDB, update reward history record and total capitalization
 
+    The stake accounts of the partition are made writable serially
+    (this modifies funk, the caller holds the funk write lock) and the
+    stake states are then updated via the tpool.  A partition holds each
+    stake account at most once, so no two workers touch the same
+    account.  The distributed and burned lamports are summed in
+    partition order.
+
     https://github.com/anza-xyz/agave/blob/cbc8320d35358da14d79ebcada4dfb6756ffac79/runtime/src/bank/partitioned_epoch_rewards/distribution.rs#L88 */
 static void
 distribute_epoch_rewards_in_partition( fd_stake_reward_dlist_t * partition,
                                        fd_stake_reward_t *       pool,
-                                       fd_exec_slot_ctx_t *      slot_ctx ) {
+                                       fd_exec_slot_ctx_t *      slot_ctx,
+                                       fd_tpool_t *              tpool,
+                                       fd_spad_t *               runtime_spad ) {
 
   ulong lamports_distributed = 0UL;
   ulong lamports_burned      = 0UL;
 
+  FD_SPAD_FRAME_BEGIN( runtime_spad ) {
+
+  ulong stake_reward_cnt = 0UL;
+  for( fd_stake_reward_dlist_iter_t iter = fd_stake_reward_dlist_iter_fwd_init( partition, pool );
+        !fd_stake_reward_dlist_iter_done( iter, partition, pool );
+        iter = fd_stake_reward_dlist_iter_fwd_next( iter, partition, pool ) ) {
+    stake_reward_cnt++;
+  }
+
+  fd_stake_reward_t * * stake_rewards = fd_spad_alloc( runtime_spad, alignof(fd_stake_reward_t *), stake_reward_cnt*sizeof(fd_stake_reward_t *) );
+  fd_txn_account_t *    stake_accs    = fd_spad_alloc( runtime_spad, alignof(fd_txn_account_t),    stake_reward_cnt*sizeof(fd_txn_account_t) );
+  int *                 results       = fd_spad_alloc( runtime_spad, alignof(int),                 stake_reward_cnt*sizeof(int) );
+
+  ulong stake_reward_idx = 0UL;
   for( fd_stake_reward_dlist_iter_t iter = fd_stake_reward_dlist_iter_fwd_init( partition, pool );
         !fd_stake_reward_dlist_iter_done( iter, partition, pool );
         iter = fd_stake_reward_dlist_iter_fwd_next( iter, partition, pool ) ) {
     fd_stake_reward_t * stake_reward = fd_stake_reward_dlist_iter_ele( iter, partition, pool );
+    fd_txn_account_t *  stake_acc    = fd_txn_account_init( stake_accs + stake_reward_idx );
 
-    if( distribute_epoch_reward_to_stake_acc( slot_ctx,
-                                              &stake_reward->stake_pubkey,
-                                              stake_reward->lamports,
-                                              stake_reward->credits_observed ) == 0 ) {
-      lamports_distributed += stake_reward->lamports;
+    if( FD_UNLIKELY( fd_acc_mgr_modify( slot_ctx->acc_mgr, slot_ctx->funk_txn, &stake_reward->stake_pubkey, 0, 0UL, stake_acc ) != FD_ACC_MGR_SUCCESS ) ) {
+      FD_LOG_ERR(( "Unable to modify stake account" ));
+    }
+    stake_acc->meta->slot = slot_ctx->slot_bank.slot;
+
+    stake_rewards[ stake_reward_idx++ ] = stake_reward;
+  }
+
+  fd_distribute_rewards_task_args_t task_args = {
+    .stake_accs = stake_accs,
+    .results    = results,
+  };
+
+  fd_tpool_exec_all_batch( tpool, 0UL, fd_tpool_worker_cnt( tpool ), distribute_epoch_rewards_in_partition_tpool,
+                           stake_rewards, &task_args, NULL, 1UL, 0UL, stake_reward_cnt );
+
+  for( ulong i=0UL; i<stake_reward_cnt; i++ ) {
+    if( results[ i ]==0 ) {
+      lamports_distributed += stake_rewards[ i ]->lamports;
     } else {
-      lamports_burned += stake_reward->lamports;
+      lamports_burned += stake_rewards[ i ]->lamports;
     }
   }
 
+  } FD_SPAD_FRAME_END;
+
   /* Update the epoch rewards sysvar with the amount distributed and burnt */
   if( FD_LIKELY( FD_FEATURE_ACTIVE( slot_ctx, enable_partitioned_epoch_reward ) ||
                  FD_FEATURE_ACTIVE( slot_ctx, partitioned_epoch_rewards_superfeature ) ) ) {
@@ -987,7 +1101,6 @@ fd_distribute_partitioned_epoch_rewards( fd_exec_slot_ctx_t * slot_ctx,
                                          ulong                exec_spad_cnt,
                                          fd_spad_t *          runtime_spad ) {
 
-  (void)tpool;
   (void)exec_spads;
   (void)exec_spad_cnt;
 
@@ -1012,9 +1125,14 @@ fd_distribute_partitioned_epoch_rewards( fd_exec_slot_ctx_t * slot_ctx,
 
   if( (height>=distribution_starting_block_height) && (height < distribution_end_exclusive) ) {
     ulong partition_index = height - distribution_starting_block_height;
+    long  distribution_ticks = -fd_tickcount();
     distribute_epoch_rewards_in_partition( &status->partitioned_stake_rewards.partitions[ partition_index ],
                                            status->partitioned_stake_rewards.pool,
-                                           slot_ctx );
+                                           slot_ctx,
+                                           tpool,
+                                           runtime_spad );
+    distribution_ticks += fd_tickcount();
+    slot_ctx->rewards_distribution_ticks = distribution_ticks;
   }
 
   /* If we have finished distributing rewards, set the status to inactive */
@@ -1052,7 +1170,9 @@ fd_update_rewards( fd_exec_slot_ctx_t * slot_ctx,
   for( ulong i = 0UL; i < rewards_result->stake_rewards_by_partition.partitioned_stake_rewards.partitions_len; i++ ) {
     distribute_epoch_rewards_in_partition( &rewards_result->stake_rewards_by_partition.partitioned_stake_rewards.partitions[ i ],
                                            rewards_result->stake_rewards_by_partition.partitioned_stake_rewards.pool,
-                                           slot_ctx );
+                                           slot_ctx,
+                                           tpool,
+                                           runtime_spad );
   }
 }
 
@@ -1210,6 +1330,7 @@ fd_rewards_recalculate_partitioned_rewards( fd_exec_slot_ctx_t * slot_ctx,
                                   &calculate_stake_vote_rewards_result->stake_reward_calculation,
                                   &epoch_rewards->parent_blockhash,
                                   stake_rewards_by_partition,
+                                  tpool,
                                   runtime_spad );
 
     /* Update the epoch reward status with the newly re-calculated partitions. */
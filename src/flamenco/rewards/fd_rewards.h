@@ -18,10 +18,24 @@ struct fd_calculate_points_task_args {
   ulong                           minimum_stake_delegation;
   fd_vote_info_pair_t_mapnode_t * vote_states_root;
   fd_vote_info_pair_t_mapnode_t * vote_states_pool;
-  uint128 *                       total_points; // out field
+  uint128 *                       worker_points; // out field, indexed by worker
 };
 typedef struct fd_calculate_points_task_args fd_calculate_points_task_args_t;
 
+struct fd_hash_rewards_task_args {
+  fd_hash_t const *   parent_blockhash;
+  ulong               num_partitions;
+  fd_stake_reward_t * pool;
+  ulong *             partition_idxs; // out field, indexed by pool element
+};
+typedef struct fd_hash_rewards_task_args fd_hash_rewards_task_args_t;
+
+struct fd_distribute_rewards_task_args {
+  fd_txn_account_t * stake_accs; // writable stake accounts, indexed like the partition's stake rewards
+  int *              results;    // out field, 0 if the reward was distributed
+};
+typedef struct fd_distribute_rewards_task_args fd_distribute_rewards_task_args_t;
+
 struct fd_calculate_stake_vote_rewards_task_args {
   fd_exec_slot_ctx_t *                       slot_ctx;
   fd_stake_history_t const *                 stake_history;
@@ -61,6 +75,11 @@ fd_rewards_recalculate_partitioned_rewards( fd_exec_slot_ctx_t * slot_ctx,
                                             ulong                exec_spad_cnt,
                                             fd_spad_t *          runtime_spad );
 
+/* fd_distribute_partitioned_epoch_rewards distributes the stake rewards
+   of the partition assigned to the current block height, if any.  The
+   stake accounts are updated via the tpool.  The time spent is
+   recorded in slot_ctx->rewards_distribution_ticks. */
+
 void
 fd_distribute_partitioned_epoch_rewards( fd_exec_slot_ctx_t * slot_ctx,
                                          fd_tpool_t *         tpool,
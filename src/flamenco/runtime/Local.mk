@@ -30,12 +30,22 @@ $(call add-objs,fd_txncache,fd_flamenco)
 $(call add-hdrs,fd_cost_tracker.h)
 $(call add-objs,fd_cost_tracker,fd_flamenco)
 
+$(call add-hdrs,fd_exec_dag.h)
+$(call add-objs,fd_exec_dag,fd_flamenco)
+$(call make-unit-test,test_exec_dag,test_exec_dag,fd_flamenco fd_ballet fd_util)
+$(call run-unit-test,test_exec_dag,)
+
+$(call add-hdrs,fd_exec_spec.h)
+$(call add-objs,fd_exec_spec,fd_flamenco)
+$(call make-unit-test,test_exec_spec,test_exec_spec,fd_flamenco fd_ballet fd_util)
+$(call run-unit-test,test_exec_spec,)
+
 $(call add-hdrs, tests/fd_dump_pb.h)
 $(call add-objs, tests/fd_dump_pb,fd_flamenco)
 
 $(call add-hdrs,fd_rent_lists.h)
 
-$(call make-unit-test,test_txncache,test_txncache,fd_flamenco fd_util)
+$(call make-unit-test,test_txncache,test_txncache,fd_flamenco fd_ballet fd_util)
 
 ifdef FD_HAS_ATOMIC
 $(call add-hdrs,fd_runtime.h fd_runtime_init.h fd_runtime_err.h)
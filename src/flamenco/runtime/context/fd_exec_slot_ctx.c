@@ -100,7 +100,7 @@ fd_exec_slot_ctx_delete( void * mem ) {
    accounts in current epoch stakes. */
 
 static int
-recover_clock( fd_exec_slot_ctx_t * slot_ctx, fd_spad_t * runtime_spad ) {
+recover_clock( fd_exec_slot_ctx_t * slot_ctx ) {
 
   fd_epoch_bank_t const * epoch_bank = fd_exec_epoch_ctx_epoch_bank( slot_ctx->epoch_ctx );
   fd_vote_accounts_t const * vote_accounts = &epoch_bank->stakes.vote_accounts;
@@ -114,43 +114,15 @@ recover_clock( fd_exec_slot_ctx_t * slot_ctx, fd_spad_t * runtime_spad ) {
 
    /* Extract vote timestamp of account */
 
-   fd_bincode_decode_ctx_t ctx = {
-    .data    = n->elem.value.data,
-    .dataend = n->elem.value.data + n->elem.value.data_len,
-  };
-
-  ulong total_sz = 0UL;
-  int err = fd_vote_state_versioned_decode_footprint( &ctx, &total_sz );
+  fd_vote_block_timestamp_t last_timestamp;
+  int err = fd_vote_get_last_timestamp( n->elem.value.data, n->elem.value.data_len, &last_timestamp );
   if( FD_UNLIKELY( err ) ) {
     FD_LOG_WARNING(( "vote state decode footprint failed" ));
     return 0;
   }
 
-  uchar * mem = fd_spad_alloc( runtime_spad, fd_vote_state_versioned_align(), total_sz );
-  if( FD_UNLIKELY( !mem ) ) {
-    FD_LOG_ERR(( "Unable to allocate memory for versioned vote state" ));
-  }
-
-  fd_vote_state_versioned_t * vsv = fd_vote_state_versioned_decode( mem, &ctx );
-
-  long timestamp = 0;
-  ulong slot = 0;
-  switch( vsv->discriminant ) {
-    case fd_vote_state_versioned_enum_v0_23_5:
-      timestamp = vsv->inner.v0_23_5.last_timestamp.timestamp;
-      slot = vsv->inner.v0_23_5.last_timestamp.slot;
-      break;
-    case fd_vote_state_versioned_enum_v1_14_11:
-      timestamp = vsv->inner.v1_14_11.last_timestamp.timestamp;
-      slot = vsv->inner.v1_14_11.last_timestamp.slot;
-      break;
-    case fd_vote_state_versioned_enum_current:
-      timestamp = vsv->inner.current.last_timestamp.timestamp;
-      slot = vsv->inner.current.last_timestamp.slot;
-      break;
-    default:
-      __builtin_unreachable();
-  }
+  long  timestamp = last_timestamp.timestamp;
+  ulong slot      = last_timestamp.slot;
 
 
 
@@ -315,7 +287,7 @@ fd_exec_slot_ctx_recover_( fd_exec_slot_ctx_t *   slot_ctx,
   if( !slot_ctx->slot_bank.timestamp_votes.votes_pool ) {
     slot_ctx->slot_bank.timestamp_votes.votes_pool = fd_clock_timestamp_vote_t_map_alloc( fd_spad_virtual( runtime_spad ),15000UL );
   }
-  recover_clock( slot_ctx, runtime_spad );
+  recover_clock( slot_ctx );
 
   /* Pass in the hard forks */
 
@@ -494,83 +466,71 @@ fd_exec_slot_ctx_recover( fd_exec_slot_ctx_t *   slot_ctx,
 }
 
 fd_exec_slot_ctx_t *
-fd_exec_slot_ctx_recover_status_cache( fd_exec_slot_ctx_t *    ctx,
-                                       fd_bank_slot_deltas_t * slot_deltas,
-                                       fd_spad_t *             runtime_spad ) {
+fd_exec_slot_ctx_recover_status_cache_slot( fd_exec_slot_ctx_t * ctx,
+                                            ulong                slot,
+                                            int                  is_root ) {
 
-  fd_txncache_t * status_cache = ctx->status_cache;
-  if( !status_cache ) {
+  if( !ctx->status_cache ) {
     FD_LOG_WARNING(("No status cache in slot ctx"));
     return NULL;
   }
 
-  FD_SPAD_FRAME_BEGIN( runtime_spad ) {
+  /* Roots are registered in the order the slot deltas appear in the
+     snapshot, right before their statuses are inserted.  If the
+     snapshot has more roots than the txncache can hold, the oldest
+     roots end up purged (with their statuses) regardless of order. */
 
-  ulong num_entries = 0;
-  for( ulong i = 0; i < slot_deltas->slot_deltas_len; i++ ) {
-    fd_slot_delta_t * slot_delta = &slot_deltas->slot_deltas[i];
-    for( ulong j = 0; j < slot_delta->slot_delta_vec_len; j++ ) {
-      num_entries += slot_delta->slot_delta_vec[j].value.statuses_len;
-    }
+  if( is_root ) fd_txncache_register_root_slot( ctx->status_cache, slot );
+  return ctx;
+}
+
+#define FD_EXEC_SLOT_CTX_STATUS_CACHE_INSERT_BATCH (1024UL)
+
+fd_exec_slot_ctx_t *
+fd_exec_slot_ctx_recover_status_cache_pair( fd_exec_slot_ctx_t * ctx,
+                                            ulong                slot,
+                                            fd_hash_t const *    blockhash,
+                                            ulong                txn_idx,
+                                            uchar const *        key_slices,
+                                            uchar const *        results,
+                                            ulong                status_cnt ) {
+
+  fd_txncache_t * status_cache = ctx->status_cache;
+  if( !status_cache ) {
+    FD_LOG_WARNING(("No status cache in slot ctx"));
+    return NULL;
   }
-  fd_txncache_insert_t * insert_vals = fd_spad_alloc( runtime_spad, alignof(fd_txncache_insert_t), num_entries * sizeof(fd_txncache_insert_t) );
-
-  /* Dumb sort for 300 slot entries to insert in order. */
-  fd_slot_delta_t ** deltas = fd_spad_alloc( runtime_spad, alignof(fd_slot_delta_t*), slot_deltas->slot_deltas_len * sizeof(fd_slot_delta_t*) );
-
-  long curr = -1;
-  for( ulong i = 0UL; i < slot_deltas->slot_deltas_len; i++ ) {
-    ulong curr_min     = ULONG_MAX;
-    ulong curr_min_idx = ULONG_MAX;
-    for( ulong j = 0; j < slot_deltas->slot_deltas_len; j++ ) {
-      fd_slot_delta_t * slot_delta = &slot_deltas->slot_deltas[j];
-      if( (long)slot_delta->slot <= curr ) continue;
-
-      if( curr_min > slot_delta->slot ) {
-        curr_min = slot_delta->slot;
-        curr_min_idx = j;
-      }
-    }
-    deltas[i] = &slot_deltas->slot_deltas[curr_min_idx];
-    curr = (long)slot_deltas->slot_deltas[curr_min_idx].slot;
+  if( FD_UNLIKELY( txn_idx>32UL-20UL ) ) {
+    FD_LOG_WARNING(( "Invalid status cache txn_idx %lu", txn_idx ));
+    return NULL;
   }
 
-  ulong idx = 0;
-  for( ulong i = 0; i < slot_deltas->slot_deltas_len; i++ ) {
-    fd_slot_delta_t * slot_delta = deltas[i];
-    ulong slot = slot_delta->slot;
-    if( slot_delta->is_root ) {
-      fd_txncache_register_root_slot( ctx->status_cache, slot );
-    }
-    for( ulong j = 0; j < slot_delta->slot_delta_vec_len; j++ ) {
-      fd_status_pair_t * pair = &slot_delta->slot_delta_vec[j];
-      fd_hash_t * blockhash = &pair->hash;
-      uchar * results = fd_spad_alloc( runtime_spad, FD_SPAD_ALIGN, pair->value.statuses_len );
-      for( ulong k = 0; k < pair->value.statuses_len; k++ ) {
-        fd_cache_status_t * status = &pair->value.statuses[k];
-        uchar * result = results + k;
-        *result = (uchar)status->result.discriminant;
-        insert_vals[idx++] = (fd_txncache_insert_t){
-          .blockhash = blockhash->uc,
-          .slot = slot,
-          .txnhash = status->key_slice,
-          .result = result
-        };
-      }
-    }
+  /* The truncation offset of the blockhash is set before its statuses
+     are inserted, so statuses of the same blockhash in later slot
+     deltas are inserted consistently.  Thus, each key slice is placed
+     at that offset within a full size txn hash. */
+
+  fd_hash_t hash = *blockhash;
+  if( FD_UNLIKELY( fd_txncache_set_txnhash_offset( status_cache, slot, hash.uc, txn_idx ) ) ) {
+    FD_LOG_WARNING(( "Failed to set status cache txn_idx for slot %lu", slot ));
+    return NULL;
   }
-  fd_txncache_insert_batch( ctx->status_cache, insert_vals, num_entries );
-
-  for( ulong i = 0; i < slot_deltas->slot_deltas_len; i++ ) {
-    fd_slot_delta_t * slot_delta = deltas[i];
-    ulong slot = slot_delta->slot;
-    for( ulong j = 0; j < slot_delta->slot_delta_vec_len; j++ ) {
-      fd_status_pair_t * pair      = &slot_delta->slot_delta_vec[j];
-      fd_hash_t *        blockhash = &pair->hash;
-      fd_txncache_set_txnhash_offset( ctx->status_cache, slot, blockhash->uc, pair->value.txn_idx );
+
+  fd_txncache_insert_t insert_vals[ FD_EXEC_SLOT_CTX_STATUS_CACHE_INSERT_BATCH ];
+  uchar                txnhashes  [ FD_EXEC_SLOT_CTX_STATUS_CACHE_INSERT_BATCH ][ 32 ];
+  for( ulong i=0UL; i<status_cnt; i+=FD_EXEC_SLOT_CTX_STATUS_CACHE_INSERT_BATCH ) {
+    ulong cnt = fd_ulong_min( status_cnt-i, FD_EXEC_SLOT_CTX_STATUS_CACHE_INSERT_BATCH );
+    for( ulong j=0UL; j<cnt; j++ ) {
+      fd_memset( txnhashes[ j ], 0, 32UL );
+      fd_memcpy( txnhashes[ j ]+txn_idx, key_slices+(i+j)*20UL, 20UL );
+      insert_vals[ j ] = (fd_txncache_insert_t){
+        .blockhash = hash.uc,
+        .slot      = slot,
+        .txnhash   = txnhashes[ j ],
+        .result    = results+i+j
+      };
     }
+    fd_txncache_insert_batch( status_cache, insert_vals, cnt );
   }
-
-  } FD_SPAD_FRAME_END;
   return ctx;
 }
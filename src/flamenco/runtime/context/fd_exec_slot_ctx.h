@@ -33,6 +33,9 @@ struct __attribute__((aligned(8UL))) fd_exec_slot_ctx {
 
   /* TODO figure out what to do with this */
   fd_epoch_reward_status_t    epoch_reward_status;
+  long                        rewards_distribution_ticks; /* Ticks spent distributing partitioned
+                                                           epoch rewards before executing this
+                                                           slot's transactions, 0 if none */
 
   /* TODO remove this stuff */
   ulong                       signature_cnt;
@@ -54,6 +57,10 @@ struct __attribute__((aligned(8UL))) fd_exec_slot_ctx {
                                                      recording, e.g. txn logs.  Analogue
                                                      of Agave's ExecutionRecordingConfig. */
 
+  int                         replay_sched;          /* How txns of a block are scheduled onto
+                                                     exec workers, FD_RUNTIME_REPLAY_SCHED_*
+                                                     (0 is DAG, the default). */
+
   ulong                       root_slot;
   ulong                       snapshot_freq;
   ulong                       incremental_freq;
@@ -92,17 +99,30 @@ fd_exec_slot_ctx_recover( fd_exec_slot_ctx_t *   ctx,
                           fd_solana_manifest_t * manifest,
                           fd_spad_t *            spad );
 
-/* fd_exec_slot_ctx_recover re-initializes the current slot
-   context's status cache from the provided solana slot deltas.
-   Assumes objects in slot deltas were allocated using slot ctx valloc
-   (U.B. otherwise).
-   On return, slot deltas is destroyed.  Returns ctx on success.
-   On failure, logs reason for error and returns NULL. */
+/* fd_exec_slot_ctx_recover_status_cache_{slot,pair} re-populate the
+   current slot context's status cache from the slot deltas of a
+   snapshot, as they are decoded incrementally.  _slot is called for
+   each slot delta, before its status pairs, and registers the slot as
+   a root if is_root.  _pair inserts a batch of status_cnt statuses of
+   a status pair with the given blockhash and txn_idx (the offset of
+   the key slices into the txn hashes).  key_slices points to
+   status_cnt 20 byte key slices and results to status_cnt result
+   discriminants.  Returns ctx on success.  On failure, logs reason for
+   error and returns NULL. */
+
+fd_exec_slot_ctx_t *
+fd_exec_slot_ctx_recover_status_cache_slot( fd_exec_slot_ctx_t * ctx,
+                                            ulong                slot,
+                                            int                  is_root );
 
 fd_exec_slot_ctx_t *
-fd_exec_slot_ctx_recover_status_cache( fd_exec_slot_ctx_t *    ctx,
-                                       fd_bank_slot_deltas_t * slot_deltas,
-                                       fd_spad_t *             runtime_spad );
+fd_exec_slot_ctx_recover_status_cache_pair( fd_exec_slot_ctx_t * ctx,
+                                            ulong                slot,
+                                            fd_hash_t const *    blockhash,
+                                            ulong                txn_idx,
+                                            uchar const *        key_slices,
+                                            uchar const *        results,
+                                            ulong                status_cnt );
 
 FD_PROTOTYPES_END
 
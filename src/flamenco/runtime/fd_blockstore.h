@@ -314,7 +314,7 @@ struct fd_block_info {
 
   ulong ticks_consumed;
   ulong tick_hash_count_accum;
-  fd_hash_t in_poh_hash; /* TODO: might not be best place to hold this */
+  fd_hash_t in_poh_hash; /* hash of the last entry replayed so far (parent block hash before the first batch). TODO: might not be best place to hold this */
 
   /* Block */
 
@@ -0,0 +1,342 @@
+#include "fd_exec_dag.h"
+
+#if FD_HAS_AVX
+#include "../../util/simd/fd_avx.h"
+#endif
+
+static const fd_acct_addr_t fd_exec_dag_null_addr = { 0 };
+
+#define MAP_NAME              fd_exec_dag_acct_map
+#define MAP_T                 fd_exec_dag_acct_t
+#define MAP_KEY_T             fd_acct_addr_t
+#define MAP_KEY_NULL          fd_exec_dag_null_addr
+#if FD_HAS_AVX
+# define MAP_KEY_INVAL(k)     _mm256_testz_si256( wb_ldu( (k).b ), wb_ldu( (k).b ) )
+#else
+# define MAP_KEY_INVAL(k)     MAP_KEY_EQUAL(k, fd_exec_dag_null_addr)
+#endif
+#define MAP_KEY_EQUAL(k0,k1)  (!memcmp((k0).b,(k1).b, FD_TXN_ACCT_ADDR_SZ))
+#define MAP_KEY_EQUAL_IS_SLOW 1
+#define MAP_MEMOIZE           0
+#define MAP_KEY_HASH(key)     ((uint)fd_ulong_hash( fd_ulong_load_8( (key).b ) ))
+#include "../../util/tmpl/fd_map_dynamic.c"
+
+/* Every transaction implicitly references the barrier pseudo account
+   and every reference allocates at most 3 links (an edge from the last
+   writer, a reader list node and an edge from that reader to the next
+   writer), so the link pool never runs out before the reference budget
+   does. */
+
+#define FD_EXEC_DAG_LINK_PER_REF (3UL)
+
+static inline ulong
+fd_exec_dag_private_ref_max( ulong txn_max,
+                             ulong acct_max ) {
+  return txn_max + acct_max;
+}
+
+/* The number of distinct accounts is bounded by the reference budget
+   ref_max rather than acct_max: a dag holding fewer than txn_max txns
+   can spend the unused barrier references of the missing txns on
+   accounts.  The account map is sized for that bound and kept at most
+   half full. */
+
+static inline int
+fd_exec_dag_private_lg_slot_cnt( ulong ref_max ) {
+  return fd_ulong_find_msb( fd_ulong_pow2_up( 2UL*ref_max ) );
+}
+
+FD_FN_CONST ulong
+fd_exec_dag_align( void ) {
+  return FD_EXEC_DAG_ALIGN;
+}
+
+FD_FN_CONST ulong
+fd_exec_dag_footprint( ulong txn_max,
+                       ulong acct_max ) {
+  if( FD_UNLIKELY( !txn_max  || txn_max >(ulong)UINT_MAX/8UL ) ) return 0UL;
+  if( FD_UNLIKELY( !acct_max || acct_max>(ulong)UINT_MAX/8UL ) ) return 0UL;
+  ulong ref_max = fd_exec_dag_private_ref_max( txn_max, acct_max );
+  int   lg_slot = fd_exec_dag_private_lg_slot_cnt( ref_max );
+  ulong l = FD_LAYOUT_INIT;
+  l = FD_LAYOUT_APPEND( l, FD_EXEC_DAG_ALIGN,               sizeof(fd_exec_dag_t)                                            );
+  l = FD_LAYOUT_APPEND( l, alignof(fd_exec_dag_txn_t),      txn_max*sizeof(fd_exec_dag_txn_t)                                );
+  l = FD_LAYOUT_APPEND( l, alignof(fd_exec_dag_link_t),     FD_EXEC_DAG_LINK_PER_REF*ref_max*sizeof(fd_exec_dag_link_t)      );
+  l = FD_LAYOUT_APPEND( l, alignof(uint),                   txn_max*sizeof(uint)                                             );
+  l = FD_LAYOUT_APPEND( l, fd_exec_dag_acct_map_align(),    fd_exec_dag_acct_map_footprint( lg_slot )                        );
+  return FD_LAYOUT_FINI( l, FD_EXEC_DAG_ALIGN );
+}
+
+void *
+fd_exec_dag_new( void * shmem,
+                 ulong  txn_max,
+                 ulong  acct_max ) {
+
+  if( FD_UNLIKELY( !shmem ) ) {
+    FD_LOG_WARNING(( "NULL shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shmem, fd_exec_dag_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_exec_dag_footprint( txn_max, acct_max ) ) ) {
+    FD_LOG_WARNING(( "bad txn_max (%lu) or acct_max (%lu)", txn_max, acct_max ));
+    return NULL;
+  }
+
+  ulong ref_max = fd_exec_dag_private_ref_max( txn_max, acct_max );
+  int   lg_slot = fd_exec_dag_private_lg_slot_cnt( ref_max );
+
+  FD_SCRATCH_ALLOC_INIT( l, shmem );
+  fd_exec_dag_t * dag   = FD_SCRATCH_ALLOC_APPEND( l, FD_EXEC_DAG_ALIGN,            sizeof(fd_exec_dag_t)                                       );
+  void *          txn   = FD_SCRATCH_ALLOC_APPEND( l, alignof(fd_exec_dag_txn_t),   txn_max*sizeof(fd_exec_dag_txn_t)                           );
+  void *          link  = FD_SCRATCH_ALLOC_APPEND( l, alignof(fd_exec_dag_link_t),  FD_EXEC_DAG_LINK_PER_REF*ref_max*sizeof(fd_exec_dag_link_t) );
+  void *          ready = FD_SCRATCH_ALLOC_APPEND( l, alignof(uint),                txn_max*sizeof(uint)                                        );
+  void *          map   = FD_SCRATCH_ALLOC_APPEND( l, fd_exec_dag_acct_map_align(), fd_exec_dag_acct_map_footprint( lg_slot )                   );
+  FD_SCRATCH_ALLOC_FINI( l, FD_EXEC_DAG_ALIGN );
+
+  memset( dag, 0, sizeof(fd_exec_dag_t) );
+
+  dag->txn_max     = txn_max;
+  dag->ref_max     = ref_max;
+  dag->lg_slot_cnt = lg_slot;
+  dag->txn_off     = (ulong)txn   - (ulong)dag;
+  dag->link_off    = (ulong)link  - (ulong)dag;
+  dag->ready_off   = (ulong)ready - (ulong)dag;
+  dag->map_off     = (ulong)fd_exec_dag_acct_map_join( fd_exec_dag_acct_map_new( map, lg_slot ) ) - (ulong)dag;
+
+  fd_exec_dag_reset( dag );
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( dag->magic ) = FD_EXEC_DAG_MAGIC;
+  FD_COMPILER_MFENCE();
+
+  return shmem;
+}
+
+fd_exec_dag_t *
+fd_exec_dag_join( void * shdag ) {
+
+  if( FD_UNLIKELY( !shdag ) ) {
+    FD_LOG_WARNING(( "NULL shdag" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shdag, fd_exec_dag_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shdag" ));
+    return NULL;
+  }
+
+  fd_exec_dag_t * dag = (fd_exec_dag_t *)shdag;
+
+  if( FD_UNLIKELY( dag->magic!=FD_EXEC_DAG_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  return dag;
+}
+
+void *
+fd_exec_dag_leave( fd_exec_dag_t * dag ) {
+
+  if( FD_UNLIKELY( !dag ) ) {
+    FD_LOG_WARNING(( "NULL dag" ));
+    return NULL;
+  }
+
+  return (void *)dag;
+}
+
+void *
+fd_exec_dag_delete( void * shdag ) {
+
+  if( FD_UNLIKELY( !shdag ) ) {
+    FD_LOG_WARNING(( "NULL shdag" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shdag, fd_exec_dag_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shdag" ));
+    return NULL;
+  }
+
+  fd_exec_dag_t * dag = (fd_exec_dag_t *)shdag;
+
+  if( FD_UNLIKELY( dag->magic!=FD_EXEC_DAG_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( dag->magic ) = 0UL;
+  FD_COMPILER_MFENCE();
+
+  return shdag;
+}
+
+static inline fd_exec_dag_txn_t  * fd_exec_dag_private_txn  ( fd_exec_dag_t * dag ) { return (fd_exec_dag_txn_t  *)( (ulong)dag + dag->txn_off   ); }
+static inline fd_exec_dag_link_t * fd_exec_dag_private_link ( fd_exec_dag_t * dag ) { return (fd_exec_dag_link_t *)( (ulong)dag + dag->link_off  ); }
+static inline uint               * fd_exec_dag_private_ready( fd_exec_dag_t * dag ) { return (uint               *)( (ulong)dag + dag->ready_off ); }
+static inline fd_exec_dag_acct_t * fd_exec_dag_private_map  ( fd_exec_dag_t * dag ) { return (fd_exec_dag_acct_t *)( (ulong)dag + dag->map_off   ); }
+
+fd_exec_dag_t *
+fd_exec_dag_reset( fd_exec_dag_t * dag ) {
+  dag->txn_cnt    = 0UL;
+  dag->done_cnt   = 0UL;
+  dag->ref_cnt    = 0UL;
+  dag->link_cnt   = 0UL;
+  dag->depth_max  = 0UL;
+  dag->ready_head = 0UL;
+  dag->ready_tail = 0UL;
+
+  dag->zero->key            = fd_exec_dag_null_addr;
+  dag->zero->writer         = FD_EXEC_DAG_IDX_NULL;
+  dag->zero->reader_head    = FD_EXEC_DAG_IDX_NULL;
+  dag->barrier->key         = fd_exec_dag_null_addr;
+  dag->barrier->writer      = FD_EXEC_DAG_IDX_NULL;
+  dag->barrier->reader_head = FD_EXEC_DAG_IDX_NULL;
+
+  fd_exec_dag_acct_map_clear( fd_exec_dag_private_map( dag ) );
+  return dag;
+}
+
+/* fd_exec_dag_private_edge adds an edge pred->succ unless pred already
+   completed.  Edges from the same predecessor to the transaction being
+   inserted are added back to back, so checking the head of the
+   predecessor's successor list is enough to filter out duplicates. */
+
+static inline void
+fd_exec_dag_private_edge( fd_exec_dag_t * dag,
+                          uint            pred,
+                          uint            succ ) {
+  if( pred==FD_EXEC_DAG_IDX_NULL || pred==succ ) return;
+  fd_exec_dag_txn_t  * txn  = fd_exec_dag_private_txn ( dag );
+  fd_exec_dag_link_t * link = fd_exec_dag_private_link( dag );
+  if( txn[ pred ].done ) return;
+  uint head = txn[ pred ].succ_head;
+  if( head!=FD_EXEC_DAG_IDX_NULL && link[ head ].txn==succ ) return;
+  uint l = (uint)dag->link_cnt++;
+  link[ l ].txn       = succ;
+  link[ l ].next      = head;
+  txn[ pred ].succ_head = l;
+  txn[ succ ].indeg++;
+  txn[ succ ].depth   = fd_uint_max( txn[ succ ].depth, txn[ pred ].depth+1U );
+}
+
+static inline void
+fd_exec_dag_private_read( fd_exec_dag_t *      dag,
+                          fd_exec_dag_acct_t * acct,
+                          uint                 idx ) {
+  fd_exec_dag_private_edge( dag, acct->writer, idx );
+  fd_exec_dag_link_t * link = fd_exec_dag_private_link( dag );
+  uint l = (uint)dag->link_cnt++;
+  link[ l ].txn     = idx;
+  link[ l ].next    = acct->reader_head;
+  acct->reader_head = l;
+}
+
+static inline void
+fd_exec_dag_private_write( fd_exec_dag_t *      dag,
+                           fd_exec_dag_acct_t * acct,
+                           uint                 idx ) {
+  fd_exec_dag_link_t * link = fd_exec_dag_private_link( dag );
+  if( acct->reader_head==FD_EXEC_DAG_IDX_NULL ) {
+    fd_exec_dag_private_edge( dag, acct->writer, idx );
+  } else {
+    /* Every reader since the last writer already depends on it */
+    for( uint l=acct->reader_head; l!=FD_EXEC_DAG_IDX_NULL; l=link[ l ].next ) fd_exec_dag_private_edge( dag, link[ l ].txn, idx );
+  }
+  acct->writer      = idx;
+  acct->reader_head = FD_EXEC_DAG_IDX_NULL;
+}
+
+static inline fd_exec_dag_acct_t *
+fd_exec_dag_private_acct( fd_exec_dag_t *        dag,
+                          fd_acct_addr_t const * addr ) {
+  if( FD_UNLIKELY( fd_exec_dag_acct_map_key_inval( *addr ) ) ) return dag->zero;
+  fd_exec_dag_acct_t * map  = fd_exec_dag_private_map( dag );
+  fd_exec_dag_acct_t * acct = fd_exec_dag_acct_map_query( map, *addr, NULL );
+  if( FD_LIKELY( acct ) ) return acct;
+  acct = fd_exec_dag_acct_map_insert( map, *addr );
+  acct->writer      = FD_EXEC_DAG_IDX_NULL;
+  acct->reader_head = FD_EXEC_DAG_IDX_NULL;
+  return acct;
+}
+
+static inline uint
+fd_exec_dag_private_txn_add( fd_exec_dag_t * dag ) {
+  uint idx = (uint)dag->txn_cnt++;
+  fd_exec_dag_txn_t * txn = fd_exec_dag_private_txn( dag ) + idx;
+  txn->indeg     = 0U;
+  txn->succ_head = FD_EXEC_DAG_IDX_NULL;
+  txn->depth     = 0U;
+  txn->done      = 0;
+  return idx;
+}
+
+static inline void
+fd_exec_dag_private_txn_fini( fd_exec_dag_t * dag,
+                              uint            idx ) {
+  fd_exec_dag_txn_t const * txn = fd_exec_dag_private_txn( dag ) + idx;
+  dag->depth_max = fd_ulong_max( dag->depth_max, (ulong)txn->depth+1UL );
+  if( !txn->indeg ) fd_exec_dag_private_ready( dag )[ dag->ready_tail++ ] = idx;
+}
+
+ulong
+fd_exec_dag_insert( fd_exec_dag_t *        dag,
+                    fd_acct_addr_t const * writable,
+                    ulong                  writable_cnt,
+                    fd_acct_addr_t const * readonly,
+                    ulong                  readonly_cnt ) {
+
+  ulong ref_cnt = writable_cnt + readonly_cnt + 1UL;
+  if( FD_UNLIKELY( dag->txn_cnt>=dag->txn_max ||
+                   writable_cnt>dag->ref_max || readonly_cnt>dag->ref_max ||
+                   ref_cnt>dag->ref_max-dag->ref_cnt ) ) return ULONG_MAX;
+
+  /* Distinct accounts are bounded by the reference budget, so the map
+     never fills up beyond half its slots. */
+
+  dag->ref_cnt += ref_cnt;
+  uint idx = fd_exec_dag_private_txn_add( dag );
+
+  fd_exec_dag_private_read( dag, dag->barrier, idx );
+  for( ulong i=0UL; i<writable_cnt; i++ ) fd_exec_dag_private_write( dag, fd_exec_dag_private_acct( dag, writable + i ), idx );
+  for( ulong i=0UL; i<readonly_cnt; i++ ) fd_exec_dag_private_read ( dag, fd_exec_dag_private_acct( dag, readonly + i ), idx );
+
+  fd_exec_dag_private_txn_fini( dag, idx );
+  return (ulong)idx;
+}
+
+ulong
+fd_exec_dag_insert_barrier( fd_exec_dag_t * dag ) {
+
+  if( FD_UNLIKELY( dag->txn_cnt>=dag->txn_max || dag->ref_cnt>=dag->ref_max ) ) return ULONG_MAX;
+
+  dag->ref_cnt++;
+  uint idx = fd_exec_dag_private_txn_add( dag );
+  fd_exec_dag_private_write( dag, dag->barrier, idx );
+  fd_exec_dag_private_txn_fini( dag, idx );
+  return (ulong)idx;
+}
+
+void
+fd_exec_dag_complete( fd_exec_dag_t * dag,
+                      ulong           idx ) {
+  fd_exec_dag_txn_t  * txn   = fd_exec_dag_private_txn  ( dag );
+  fd_exec_dag_link_t * link  = fd_exec_dag_private_link ( dag );
+  uint *               ready = fd_exec_dag_private_ready( dag );
+
+  txn[ idx ].done = 1;
+  dag->done_cnt++;
+
+  for( uint l=txn[ idx ].succ_head; l!=FD_EXEC_DAG_IDX_NULL; l=link[ l ].next ) {
+    uint succ = link[ l ].txn;
+    if( !--txn[ succ ].indeg ) ready[ dag->ready_tail++ ] = succ;
+  }
+  txn[ idx ].succ_head = FD_EXEC_DAG_IDX_NULL;
+}
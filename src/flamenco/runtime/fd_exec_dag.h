@@ -0,0 +1,199 @@
+#ifndef HEADER_fd_src_flamenco_runtime_fd_exec_dag_h
+#define HEADER_fd_src_flamenco_runtime_fd_exec_dag_h
+
+/* fd_exec_dag is an account conflict scheduler for replaying the
+   transactions of a block in parallel.
+
+   Transactions are inserted in ledger order along with the set of
+   accounts they write and the set of accounts they read.  The dag adds
+   an edge from every earlier transaction that conflicts with the newly
+   inserted one (write-write, write-read and read-write on the same
+   account), such that executing transactions in any topological order of
+   the dag gives the same result as executing them in ledger order.
+   Transactions that only read an account never conflict with each other.
+
+   A transaction whose account set is not known (e.g. its address lookup
+   tables could not be resolved) can be inserted as a barrier.  A barrier
+   conflicts with every transaction inserted before it and after it.
+
+   Typical usage:
+
+     for( each txn in ledger order ) fd_exec_dag_insert( dag, w, w_cnt, r, r_cnt );
+     while( fd_exec_dag_done_cnt( dag )<fd_exec_dag_txn_cnt( dag ) ) {
+       ulong idx = fd_exec_dag_ready_pop( dag );
+       if( idx!=ULONG_MAX ) ... dispatch txn idx to an idle worker ...
+       for( each txn idx that finished executing ) fd_exec_dag_complete( dag, idx );
+     }
+
+   Insertion can also be interleaved with execution (transactions that
+   depend only on already completed transactions are immediately ready).
+
+   The dag is not thread safe; it is intended to be owned by the thread
+   that dispatches work to the exec workers. */
+
+#include "../fd_flamenco_base.h"
+#include "../../ballet/txn/fd_txn.h"
+
+#define FD_EXEC_DAG_ALIGN (128UL)
+
+#define FD_EXEC_DAG_IDX_NULL (UINT_MAX)
+
+/* fd_exec_dag_txn_t is the per transaction state of the dag. */
+
+struct fd_exec_dag_txn {
+  uint indeg;     /* Number of incomplete predecessors */
+  uint succ_head; /* Head of the successor edge list, FD_EXEC_DAG_IDX_NULL if none */
+  uint depth;     /* Length of the longest chain of incomplete predecessors at insert */
+  int  done;      /* Non-zero once completed */
+};
+typedef struct fd_exec_dag_txn fd_exec_dag_txn_t;
+
+/* fd_exec_dag_link_t is a node of a singly linked list of transaction
+   indices.  It is used for both successor edge lists and the per
+   account lists of readers since the last writer. */
+
+struct fd_exec_dag_link {
+  uint txn;
+  uint next;
+};
+typedef struct fd_exec_dag_link fd_exec_dag_link_t;
+
+/* fd_exec_dag_acct_t tracks the conflict state of a single account. */
+
+struct fd_exec_dag_acct {
+  fd_acct_addr_t key;
+  uint           writer;      /* Last txn to write this account, FD_EXEC_DAG_IDX_NULL if none */
+  uint           reader_head; /* Txns that read this account since writer */
+};
+typedef struct fd_exec_dag_acct fd_exec_dag_acct_t;
+
+struct __attribute__((aligned(FD_EXEC_DAG_ALIGN))) fd_exec_dag_private {
+  ulong magic;      /* ==FD_EXEC_DAG_MAGIC */
+  ulong txn_max;
+  ulong ref_max;    /* Max account references (incl. the implicit barrier reference of each txn) */
+  int   lg_slot_cnt;
+
+  ulong txn_cnt;    /* Txns inserted so far */
+  ulong done_cnt;   /* Txns completed so far */
+  ulong ref_cnt;    /* Account references inserted so far */
+  ulong link_cnt;   /* Links allocated so far */
+  ulong depth_max;  /* Longest dependency chain (in txns) so far */
+  ulong ready_head; /* Ready txns are ready[ ready_head, ready_tail ) */
+  ulong ready_tail;
+
+  /* The zero address can't be stored in the account map (it is the
+     map's null key) and barriers are modeled as writes to a pseudo
+     account that every other transaction reads, so both have dedicated
+     entries. */
+
+  fd_exec_dag_acct_t zero[1];
+  fd_exec_dag_acct_t barrier[1];
+
+  ulong txn_off;    /* fd_exec_dag_txn_t  [ txn_max   ] */
+  ulong link_off;   /* fd_exec_dag_link_t [ 3*ref_max ] */
+  ulong ready_off;  /* uint               [ txn_max   ] */
+  ulong map_off;    /* Account map slots (2^lg_slot_cnt) */
+};
+typedef struct fd_exec_dag_private fd_exec_dag_t;
+
+#define FD_EXEC_DAG_MAGIC (0xf17eda2ce7dad000UL) /* firedancer exec dag version 0 */
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_exec_dag_{align,footprint} return the alignment and footprint of
+   a memory region suitable for a dag that can hold up to txn_max
+   transactions referencing up to acct_max accounts in total (i.e. the
+   sum of the writable and readonly counts over all inserted
+   transactions).  footprint returns 0 if txn_max or acct_max are
+   invalid. */
+
+FD_FN_CONST ulong
+fd_exec_dag_align( void );
+
+FD_FN_CONST ulong
+fd_exec_dag_footprint( ulong txn_max,
+                       ulong acct_max );
+
+/* fd_exec_dag_new formats the memory region shmem as an empty dag.
+   Returns shmem on success and NULL on failure (logs details).
+   fd_exec_dag_join joins the caller to the dag.  fd_exec_dag_leave and
+   fd_exec_dag_delete do the usual inverses. */
+
+void *
+fd_exec_dag_new( void * shmem,
+                 ulong  txn_max,
+                 ulong  acct_max );
+
+fd_exec_dag_t *
+fd_exec_dag_join( void * shdag );
+
+void *
+fd_exec_dag_leave( fd_exec_dag_t * dag );
+
+void *
+fd_exec_dag_delete( void * shdag );
+
+/* fd_exec_dag_reset removes all transactions from the dag. */
+
+fd_exec_dag_t *
+fd_exec_dag_reset( fd_exec_dag_t * dag );
+
+/* fd_exec_dag_insert appends a transaction that writes the
+   writable_cnt accounts at writable and reads the readonly_cnt accounts
+   at readonly to the dag.  Accounts may be listed more than once.
+   Returns the index of the transaction in the dag (which is the number
+   of transactions inserted before it) or ULONG_MAX if the dag is out of
+   capacity (the dag is unchanged in that case).  The transaction is
+   immediately ready if all earlier conflicting transactions have
+   already completed. */
+
+ulong
+fd_exec_dag_insert( fd_exec_dag_t *        dag,
+                    fd_acct_addr_t const * writable,
+                    ulong                  writable_cnt,
+                    fd_acct_addr_t const * readonly,
+                    ulong                  readonly_cnt );
+
+/* fd_exec_dag_insert_barrier appends a transaction that conflicts with
+   all other transactions in the dag.  Returns the index of the
+   transaction or ULONG_MAX if the dag is out of capacity. */
+
+ulong
+fd_exec_dag_insert_barrier( fd_exec_dag_t * dag );
+
+/* fd_exec_dag_ready_pop returns the index of the oldest ready
+   transaction that has not been popped yet or ULONG_MAX if there is
+   none.  The caller should execute the transaction and call
+   fd_exec_dag_complete when done. */
+
+static inline ulong
+fd_exec_dag_ready_pop( fd_exec_dag_t * dag ) {
+  if( FD_UNLIKELY( dag->ready_head==dag->ready_tail ) ) return ULONG_MAX;
+  uint const * ready = (uint const *)( (ulong)dag + dag->ready_off );
+  return (ulong)ready[ dag->ready_head++ ];
+}
+
+/* fd_exec_dag_complete marks the popped transaction idx as completed,
+   making any transaction that was only waiting on it ready. */
+
+void
+fd_exec_dag_complete( fd_exec_dag_t * dag,
+                      ulong           idx );
+
+/* Accessors */
+
+FD_FN_PURE static inline ulong fd_exec_dag_txn_cnt  ( fd_exec_dag_t const * dag ) { return dag->txn_cnt;  }
+FD_FN_PURE static inline ulong fd_exec_dag_done_cnt ( fd_exec_dag_t const * dag ) { return dag->done_cnt; }
+FD_FN_PURE static inline ulong fd_exec_dag_ready_cnt( fd_exec_dag_t const * dag ) { return dag->ready_tail - dag->ready_head; }
+
+/* fd_exec_dag_depth returns the number of txns on the longest chain of
+   dependencies inserted so far (completed predecessors excluded).  If
+   all txns were inserted before any completed, the dag can't be
+   executed in fewer than this many rounds no matter how many workers
+   are available, so txn_cnt/depth bounds the useful parallelism. */
+
+FD_FN_PURE static inline ulong fd_exec_dag_depth( fd_exec_dag_t const * dag ) { return dag->depth_max; }
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_flamenco_runtime_fd_exec_dag_h */
@@ -0,0 +1,208 @@
+#include "fd_exec_spec.h"
+
+#if FD_HAS_AVX
+#include "../../util/simd/fd_avx.h"
+#endif
+
+static const fd_acct_addr_t fd_exec_spec_null_addr = { 0 };
+
+#define MAP_NAME              fd_exec_spec_acct_map
+#define MAP_T                 fd_exec_spec_acct_t
+#define MAP_KEY_T             fd_acct_addr_t
+#define MAP_KEY_NULL          fd_exec_spec_null_addr
+#if FD_HAS_AVX
+# define MAP_KEY_INVAL(k)     _mm256_testz_si256( wb_ldu( (k).b ), wb_ldu( (k).b ) )
+#else
+# define MAP_KEY_INVAL(k)     MAP_KEY_EQUAL(k, fd_exec_spec_null_addr)
+#endif
+#define MAP_KEY_EQUAL(k0,k1)  (!memcmp((k0).b,(k1).b, FD_TXN_ACCT_ADDR_SZ))
+#define MAP_KEY_EQUAL_IS_SLOW 1
+#define MAP_MEMOIZE           0
+#define MAP_KEY_HASH(key)     ((uint)fd_ulong_hash( fd_ulong_load_8( (key).b ) ))
+#include "../../util/tmpl/fd_map_dynamic.c"
+
+static inline int
+fd_exec_spec_private_lg_slot_cnt( ulong acct_max ) {
+  /* Keep the account map at most half full */
+  return fd_ulong_find_msb( fd_ulong_pow2_up( 2UL*acct_max ) );
+}
+
+static inline fd_exec_spec_acct_t *
+fd_exec_spec_private_map( fd_exec_spec_t * spec ) {
+  return (fd_exec_spec_acct_t *)( (ulong)spec + spec->map_off );
+}
+
+FD_FN_CONST ulong
+fd_exec_spec_align( void ) {
+  return FD_EXEC_SPEC_ALIGN;
+}
+
+FD_FN_CONST ulong
+fd_exec_spec_footprint( ulong acct_max ) {
+  if( FD_UNLIKELY( !acct_max || acct_max>(ulong)UINT_MAX ) ) return 0UL;
+  ulong l = FD_LAYOUT_INIT;
+  l = FD_LAYOUT_APPEND( l, FD_EXEC_SPEC_ALIGN,           sizeof(fd_exec_spec_t)                                                     );
+  l = FD_LAYOUT_APPEND( l, fd_exec_spec_acct_map_align(), fd_exec_spec_acct_map_footprint( fd_exec_spec_private_lg_slot_cnt( acct_max ) ) );
+  return FD_LAYOUT_FINI( l, FD_EXEC_SPEC_ALIGN );
+}
+
+void *
+fd_exec_spec_new( void * shmem,
+                  ulong  acct_max ) {
+
+  if( FD_UNLIKELY( !shmem ) ) {
+    FD_LOG_WARNING(( "NULL shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shmem, fd_exec_spec_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_exec_spec_footprint( acct_max ) ) ) {
+    FD_LOG_WARNING(( "bad acct_max (%lu)", acct_max ));
+    return NULL;
+  }
+
+  int lg_slot = fd_exec_spec_private_lg_slot_cnt( acct_max );
+
+  FD_SCRATCH_ALLOC_INIT( l, shmem );
+  fd_exec_spec_t * spec = FD_SCRATCH_ALLOC_APPEND( l, FD_EXEC_SPEC_ALIGN,            sizeof(fd_exec_spec_t)                     );
+  void *           map  = FD_SCRATCH_ALLOC_APPEND( l, fd_exec_spec_acct_map_align(), fd_exec_spec_acct_map_footprint( lg_slot ) );
+  FD_SCRATCH_ALLOC_FINI( l, FD_EXEC_SPEC_ALIGN );
+
+  memset( spec, 0, sizeof(fd_exec_spec_t) );
+
+  spec->acct_max    = acct_max;
+  spec->lg_slot_cnt = lg_slot;
+  spec->map_off     = (ulong)fd_exec_spec_acct_map_join( fd_exec_spec_acct_map_new( map, lg_slot ) ) - (ulong)spec;
+
+  fd_exec_spec_reset( spec );
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( spec->magic ) = FD_EXEC_SPEC_MAGIC;
+  FD_COMPILER_MFENCE();
+
+  return shmem;
+}
+
+fd_exec_spec_t *
+fd_exec_spec_join( void * shspec ) {
+
+  if( FD_UNLIKELY( !shspec ) ) {
+    FD_LOG_WARNING(( "NULL shspec" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shspec, fd_exec_spec_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shspec" ));
+    return NULL;
+  }
+
+  fd_exec_spec_t * spec = (fd_exec_spec_t *)shspec;
+
+  if( FD_UNLIKELY( spec->magic!=FD_EXEC_SPEC_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  return spec;
+}
+
+void *
+fd_exec_spec_leave( fd_exec_spec_t * spec ) {
+
+  if( FD_UNLIKELY( !spec ) ) {
+    FD_LOG_WARNING(( "NULL spec" ));
+    return NULL;
+  }
+
+  return (void *)spec;
+}
+
+void *
+fd_exec_spec_delete( void * shspec ) {
+
+  if( FD_UNLIKELY( !shspec ) ) {
+    FD_LOG_WARNING(( "NULL shspec" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shspec, fd_exec_spec_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shspec" ));
+    return NULL;
+  }
+
+  fd_exec_spec_t * spec = (fd_exec_spec_t *)shspec;
+
+  if( FD_UNLIKELY( spec->magic!=FD_EXEC_SPEC_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( spec->magic ) = 0UL;
+  FD_COMPILER_MFENCE();
+
+  return shspec;
+}
+
+fd_exec_spec_t *
+fd_exec_spec_reset( fd_exec_spec_t * spec ) {
+  spec->zero_writer  = ULONG_MAX;
+  spec->overflow_idx = ULONG_MAX;
+  spec->validate_cnt = 0UL;
+  spec->abort_cnt    = 0UL;
+  fd_exec_spec_acct_map_clear( fd_exec_spec_private_map( spec ) );
+  return spec;
+}
+
+int
+fd_exec_spec_validate( fd_exec_spec_t *       spec,
+                       ulong                  start_idx,
+                       fd_acct_addr_t const * read,
+                       ulong                  read_cnt ) {
+  spec->validate_cnt++;
+
+  int valid = spec->overflow_idx==ULONG_MAX || spec->overflow_idx<start_idx;
+
+  fd_exec_spec_acct_t * map = fd_exec_spec_private_map( spec );
+  for( ulong i=0UL; valid && i<read_cnt; i++ ) {
+    ulong writer;
+    if( FD_UNLIKELY( fd_exec_spec_acct_map_key_inval( read[i] ) ) ) {
+      writer = spec->zero_writer;
+    } else {
+      fd_exec_spec_acct_t const * acct = fd_exec_spec_acct_map_query( map, read[i], NULL );
+      writer = acct ? acct->writer : ULONG_MAX;
+    }
+    valid = writer==ULONG_MAX || writer<start_idx;
+  }
+
+  spec->abort_cnt += (ulong)!valid;
+  return valid;
+}
+
+void
+fd_exec_spec_commit( fd_exec_spec_t *       spec,
+                     ulong                  idx,
+                     fd_acct_addr_t const * write,
+                     ulong                  write_cnt ) {
+  fd_exec_spec_acct_t * map = fd_exec_spec_private_map( spec );
+  for( ulong i=0UL; i<write_cnt; i++ ) {
+    if( FD_UNLIKELY( fd_exec_spec_acct_map_key_inval( write[i] ) ) ) {
+      spec->zero_writer = idx;
+      continue;
+    }
+    fd_exec_spec_acct_t * acct = fd_exec_spec_acct_map_query( map, write[i], NULL );
+    if( FD_UNLIKELY( !acct ) ) {
+      if( FD_UNLIKELY( fd_exec_spec_acct_map_key_cnt( map )>=spec->acct_max ) ) {
+        /* Out of space, fail every txn that could have observed this */
+        spec->overflow_idx = idx;
+        continue;
+      }
+      acct = fd_exec_spec_acct_map_insert( map, write[i] );
+    }
+    acct->writer = idx;
+  }
+}
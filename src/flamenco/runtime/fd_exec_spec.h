@@ -0,0 +1,114 @@
+#ifndef HEADER_fd_src_flamenco_runtime_fd_exec_spec_h
+#define HEADER_fd_src_flamenco_runtime_fd_exec_spec_h
+
+/* fd_exec_spec validates optimistically executed transactions.
+
+   In optimistic replay, transactions are executed speculatively in
+   parallel against the committed state (i.e. the effects of the
+   transactions before them in ledger order that were committed at the
+   time they started executing) and are then committed strictly in
+   ledger order.  A transaction that started executing when the first
+   start_idx transactions were committed is valid at commit time if none
+   of the transactions committed since then (i.e. with an index in
+   [start_idx,idx)) wrote an account it read.  Otherwise it has to be
+   re-executed (which is then guaranteed to be valid as all transactions
+   before it are committed).
+
+   fd_exec_spec tracks for each account the index of the last committed
+   transaction that wrote it.  Like fd_exec_dag, it is not thread safe
+   and is intended to be owned by the thread that dispatches work to
+   the exec workers. */
+
+#include "../fd_flamenco_base.h"
+#include "../../ballet/txn/fd_txn.h"
+
+#define FD_EXEC_SPEC_ALIGN (128UL)
+
+/* fd_exec_spec_acct_t is the last committed writer of an account */
+
+struct fd_exec_spec_acct {
+  fd_acct_addr_t key;
+  ulong          writer;
+};
+typedef struct fd_exec_spec_acct fd_exec_spec_acct_t;
+
+struct __attribute__((aligned(FD_EXEC_SPEC_ALIGN))) fd_exec_spec_private {
+  ulong magic;        /* ==FD_EXEC_SPEC_MAGIC */
+  ulong acct_max;
+  int   lg_slot_cnt;
+
+  ulong zero_writer;  /* Last writer of the all zero address (the map's null key), ULONG_MAX if none */
+  ulong overflow_idx; /* Index of the last commit that didn't fit in the map, ULONG_MAX if none */
+
+  ulong validate_cnt; /* Number of fd_exec_spec_validate calls */
+  ulong abort_cnt;    /* Number of those that failed */
+
+  ulong map_off;      /* Account map slots (2^lg_slot_cnt) */
+};
+typedef struct fd_exec_spec_private fd_exec_spec_t;
+
+#define FD_EXEC_SPEC_MAGIC (0xf17eda2ce75bec00UL) /* firedancer exec spec version 0 */
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_exec_spec_{align,footprint} return the alignment and footprint of
+   a memory region suitable for tracking up to acct_max distinct written
+   accounts.  footprint returns 0 if acct_max is invalid.  If more
+   distinct accounts are committed, validation becomes conservative (all
+   transactions that started before the overflowing commit fail
+   validation). */
+
+FD_FN_CONST ulong
+fd_exec_spec_align( void );
+
+FD_FN_CONST ulong
+fd_exec_spec_footprint( ulong acct_max );
+
+/* fd_exec_spec_{new,join,leave,delete} have the usual semantics.  new
+   returns shmem on success and NULL on failure (logs details). */
+
+void *
+fd_exec_spec_new( void * shmem,
+                  ulong  acct_max );
+
+fd_exec_spec_t *
+fd_exec_spec_join( void * shspec );
+
+void *
+fd_exec_spec_leave( fd_exec_spec_t * spec );
+
+void *
+fd_exec_spec_delete( void * shspec );
+
+/* fd_exec_spec_reset forgets all committed writes and zeros the
+   counters. */
+
+fd_exec_spec_t *
+fd_exec_spec_reset( fd_exec_spec_t * spec );
+
+/* fd_exec_spec_validate returns 1 if none of the read_cnt accounts at
+   read were written by a transaction with an index at least start_idx
+   and 0 otherwise. */
+
+int
+fd_exec_spec_validate( fd_exec_spec_t *       spec,
+                       ulong                  start_idx,
+                       fd_acct_addr_t const * read,
+                       ulong                  read_cnt );
+
+/* fd_exec_spec_commit records that transaction idx wrote the write_cnt
+   accounts at write.  Transactions should be committed in increasing
+   index order. */
+
+void
+fd_exec_spec_commit( fd_exec_spec_t *       spec,
+                     ulong                  idx,
+                     fd_acct_addr_t const * write,
+                     ulong                  write_cnt );
+
+FD_FN_PURE static inline ulong fd_exec_spec_validate_cnt( fd_exec_spec_t const * spec ) { return spec->validate_cnt; }
+FD_FN_PURE static inline ulong fd_exec_spec_abort_cnt   ( fd_exec_spec_t const * spec ) { return spec->abort_cnt;    }
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_flamenco_runtime_fd_exec_spec_h */
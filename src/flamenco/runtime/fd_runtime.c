@@ -6,6 +6,8 @@
 
 #include "fd_executor.h"
 #include "fd_cost_tracker.h"
+#include "fd_exec_dag.h"
+#include "fd_exec_spec.h"
 #include "fd_hashes.h"
 #include "fd_txncache.h"
 #include "sysvar/fd_sysvar_cache.h"
@@ -33,6 +35,7 @@
 #include "program/fd_bpf_program_util.h"
 #include "program/fd_bpf_loader_program.h"
 #include "program/fd_compute_budget_program.h"
+#include "program/fd_address_lookup_table_program.h"
 
 #include "sysvar/fd_sysvar_clock.h"
 #include "sysvar/fd_sysvar_fees.h"
@@ -464,40 +467,12 @@ fd_runtime_distribute_rent_to_validators( fd_exec_slot_ctx_t * slot_ctx,
       n;
       n = fd_vote_accounts_pair_t_map_successor( vote_accounts_pool, n ), i++) {
 
-    fd_bincode_decode_ctx_t ctx = {
-      .data    = n->elem.value.data,
-      .dataend = n->elem.value.data + n->elem.value.data_len
-    };
-
-    ulong total_sz = 0UL;
-    int err = fd_vote_state_versioned_decode_footprint( &ctx, &total_sz );
+    fd_pubkey_t node_pubkey;
+    int err = fd_vote_get_node_pubkey( n->elem.value.data, n->elem.value.data_len, &node_pubkey );
     if( FD_UNLIKELY( err ) ) {
       FD_LOG_ERR(( "Failed to decode the vote state" ));
     }
 
-    uchar * mem = fd_spad_alloc( runtime_spad, alignof(fd_vote_state_versioned_t), total_sz );
-    if( FD_UNLIKELY( !mem ) ) {
-      FD_LOG_ERR(( "Unable to allocate memory" ));
-    }
-
-    fd_vote_state_versioned_t * vsv = (fd_vote_state_versioned_t *)mem;
-    fd_vote_state_versioned_decode( vsv, &ctx );
-
-    fd_pubkey_t node_pubkey;
-    switch( vsv->discriminant ) {
-      case fd_vote_state_versioned_enum_v0_23_5:
-        node_pubkey = vsv->inner.v0_23_5.node_pubkey;
-        break;
-      case fd_vote_state_versioned_enum_v1_14_11:
-        node_pubkey = vsv->inner.v1_14_11.node_pubkey;
-        break;
-      case fd_vote_state_versioned_enum_current:
-        node_pubkey = vsv->inner.current.node_pubkey;
-        break;
-      default:
-        __builtin_unreachable();
-    }
-
     validator_stakes[i].pubkey = node_pubkey;
     validator_stakes[i].stake  = n->elem.stake;
 
@@ -1408,10 +1383,19 @@ fd_runtime_block_execute_prepare( fd_exec_slot_ctx_t * slot_ctx,
   }
 
   /* Load sysvars into cache */
+  ulong decode_cnt             = slot_ctx->sysvar_cache->decode_cnt;
+  ulong reuse_cnt              = slot_ctx->sysvar_cache->reuse_cnt;
+  long  sysvar_cache_load_time = -fd_log_wallclock();
   if( FD_UNLIKELY( result = fd_runtime_sysvar_cache_load( slot_ctx ) ) ) {
     /* non-zero error */
     return result;
   }
+  sysvar_cache_load_time += fd_log_wallclock();
+  FD_LOG_INFO(( "loaded sysvar cache - slot: %lu, elapsed: %6.6f ms, decoded: %lu, reused: %lu",
+                slot_ctx->slot_bank.slot,
+                (double)sysvar_cache_load_time * 1e-6,
+                slot_ctx->sysvar_cache->decode_cnt - decode_cnt,
+                slot_ctx->sysvar_cache->reuse_cnt  - reuse_cnt ));
 
   return FD_RUNTIME_EXECUTE_SUCCESS;
 }
@@ -1711,47 +1695,15 @@ fd_runtime_finalize_txn( fd_exec_slot_ctx_t *         slot_ctx,
         /* lock for inserting/modifying vote accounts in slot ctx. */
         fd_funk_start_write( slot_ctx->acc_mgr->funk );
         fd_vote_store_account( slot_ctx, acc_rec );
-        FD_SPAD_FRAME_BEGIN( txn_ctx->spad ) {
-          fd_bincode_decode_ctx_t decode_vsv = {
-            .data    = acc_rec->const_data,
-            .dataend = acc_rec->const_data + acc_rec->const_meta->dlen,
-          };
-
-          ulong total_sz = 0UL;
-          int err = fd_vote_state_versioned_decode_footprint( &decode_vsv, &total_sz );
-          if( FD_UNLIKELY( err ) ) {
-            FD_LOG_WARNING(( "failed to decode vote state versioned" ));
-            continue;
-          }
-
-          uchar * mem = fd_spad_alloc( txn_ctx->spad, 8UL, total_sz );
-          if( FD_UNLIKELY( !mem ) ) {
-            FD_LOG_ERR(( "Unable to allocate memory for vote state versioned" ));
-          }
-
-          fd_vote_state_versioned_decode( mem, &decode_vsv );
-          fd_vote_state_versioned_t * vsv = (fd_vote_state_versioned_t *)mem;
-
-          fd_vote_block_timestamp_t const * ts = NULL;
-          switch( vsv->discriminant ) {
-          case fd_vote_state_versioned_enum_v0_23_5:
-            ts = &vsv->inner.v0_23_5.last_timestamp;
-            break;
-          case fd_vote_state_versioned_enum_v1_14_11:
-            ts = &vsv->inner.v1_14_11.last_timestamp;
-            break;
-          case fd_vote_state_versioned_enum_current:
-            ts = &vsv->inner.current.last_timestamp;
-            break;
-          default:
-            __builtin_unreachable();
-          }
-
+        fd_vote_block_timestamp_t ts[1];
+        if( FD_UNLIKELY( fd_vote_get_last_timestamp( acc_rec->const_data, acc_rec->const_meta->dlen, ts ) ) ) {
+          FD_LOG_WARNING(( "failed to decode vote state versioned" ));
+        } else {
           fd_vote_record_timestamp_vote_with_slot( slot_ctx,
                                                    acc_rec->pubkey,
                                                    ts->timestamp,
                                                    ts->slot );
-        } FD_SPAD_FRAME_END;
+        }
         fd_funk_end_write( slot_ctx->acc_mgr->funk );
       }
 
@@ -1871,6 +1823,66 @@ fd_runtime_prepare_execute_finalize_txn_task( void * tpool,
   fd_runtime_finalize_txn( slot_ctx, capture_ctx, task_info );
 }
 
+/* fd_runtime_txn_account_modified returns 1 if the executed txn
+   changed the account (lamports, owner, executable, rent epoch or data)
+   relative to the committed state it was loaded from and 0 otherwise.
+   Accounts that did not exist before are always considered modified. */
+
+static int
+fd_runtime_txn_account_modified( fd_txn_account_t const * acct ) {
+  fd_account_meta_t const * orig = acct->orig_meta;
+  fd_account_meta_t const * meta = acct->const_meta;
+  if( FD_UNLIKELY( !orig || !meta ) ) return 1;
+  if( orig==meta                    ) return 0;
+  if( meta->dlen!=orig->dlen        ) return 1;
+  if( memcmp( &meta->info, &orig->info, sizeof(fd_solana_account_meta_t) ) ) return 1;
+  return !!memcmp( acct->const_data, acct->orig_data, meta->dlen );
+}
+
+/* fd_runtime_prepare_execute_txn_task is fd_runtime_prepare_execute_finalize_txn_task
+   without the finalize step, which is left to the dispatcher (used for
+   speculative execution where the txn may have to be re-executed). */
+
+static void
+fd_runtime_prepare_execute_txn_task( void * tpool,
+                                     ulong  t0,
+                                     ulong  t1,
+                                     void * args,
+                                     void * reduce,
+                                     ulong  stride FD_PARAM_UNUSED,
+                                     ulong  l0     FD_PARAM_UNUSED,
+                                     ulong  l1     FD_PARAM_UNUSED,
+                                     ulong  m0     FD_PARAM_UNUSED,
+                                     ulong  m1     FD_PARAM_UNUSED,
+                                     ulong  n0     FD_PARAM_UNUSED,
+                                     ulong  n1     FD_PARAM_UNUSED ) {
+
+  fd_exec_slot_ctx_t *         slot_ctx     = (fd_exec_slot_ctx_t *)tpool;
+  fd_capture_ctx_t *           capture_ctx  = (fd_capture_ctx_t *)t0;
+  fd_txn_p_t *                 txn          = (fd_txn_p_t *)t1;
+  fd_execute_txn_task_info_t * task_info    = (fd_execute_txn_task_info_t *)args;
+  fd_spad_t *                  exec_spad    = (fd_spad_t *)reduce;
+
+  fd_runtime_prepare_and_execute_txn( slot_ctx,
+                                      txn,
+                                      task_info,
+                                      exec_spad,
+                                      capture_ctx );
+
+  /* Record what the txn actually modified while the state it was loaded
+     from is still in place: the dispatcher does not finalize a txn that
+     saves an account referenced by a txn still executing. */
+
+  fd_memset( task_info->modified, 0, sizeof(task_info->modified) );
+  if( FD_UNLIKELY( !( txn->flags & FD_TXN_P_FLAGS_EXECUTE_SUCCESS ) || task_info->exec_res ) ) return;
+
+  fd_exec_txn_ctx_t const * txn_ctx = task_info->txn_ctx;
+  for( ulong i=0UL; i<txn_ctx->accounts_cnt; i++ ) {
+    if( !fd_txn_account_is_writable_idx( txn_ctx, (int)i ) ) continue;
+    if( fd_runtime_txn_account_modified( &txn_ctx->accounts[ i ] ) ) task_info->modified[ i>>6 ] |= 1UL<<(i&63UL);
+  }
+}
+
 /* fd_executor_txn_verify and fd_runtime_pre_execute_check are responisble
    for the bulk of the pre-transaction execution checks in the runtime.
    They aim to preserve the ordering present in the Agave client to match
@@ -1904,100 +1916,613 @@ fd_runtime_prepare_execute_finalize_txn_task( void * tpool,
    validates the program accounts in load_transaction_accounts(). This
    is paralled by fd_executor_load_transaction_accounts(). */
 
-int
-fd_runtime_process_txns_in_microblock_stream( fd_exec_slot_ctx_t * slot_ctx,
-                                              fd_capture_ctx_t *   capture_ctx,
-                                              fd_txn_p_t *         txns,
-                                              ulong                txn_cnt,
-                                              fd_tpool_t *         tpool,
-                                              fd_spad_t * *        exec_spads,
-                                              ulong                exec_spad_cnt,
-                                              fd_spad_t *          runtime_spad,
-                                              fd_cost_tracker_t *  cost_tracker_opt ) {
+/* fd_runtime_txn_acct_refs collects the accounts the txn may write
+   into writable and the accounts it may read into readonly for conflict
+   scheduling.  Writability is taken from the txn descriptor before any
+   demotion (e.g. of program ids and reserved accounts), which
+   overestimates the write set.  Address lookup tables are resolved
+   directly against the accounts as of the start of the block (entries
+   appended within a slot are not usable until the next slot) and the
+   lookup table accounts themselves are reported as read so the txn is
+   ordered after any txn in the block that modifies a table it uses.
+
+   Returns 0 on success and -1 if the txn should be scheduled as a
+   barrier: its lookup tables could not be resolved (the txn will fail
+   during execution anyway) or it references a BPF loader directly (such
+   txns can deploy, upgrade or close programs which changes how later
+   txns in the block that invoke those programs behave without them
+   referencing the program data account). */
 
-  int res = 0;
+static int
+fd_runtime_txn_acct_refs( fd_exec_slot_ctx_t const * slot_ctx,
+                          fd_txn_p_t const *         txn_p,
+                          fd_acct_addr_t *           writable,
+                          ulong *                    _writable_cnt,
+                          fd_acct_addr_t *           readonly,
+                          ulong *                    _readonly_cnt ) {
+
+  fd_txn_t const *       txn       = TXN( txn_p );
+  fd_acct_addr_t const * acct_addr = fd_txn_get_acct_addrs( txn, txn_p->payload );
 
+  ulong writable_cnt = 0UL;
+  ulong readonly_cnt = 0UL;
+
+  for( ulong i=0UL; i<txn->acct_addr_cnt; i++ ) {
+    if( fd_txn_is_writable( txn, (int)i ) ) writable[ writable_cnt++ ] = acct_addr[ i ];
+    else                                    readonly[ readonly_cnt++ ] = acct_addr[ i ];
+  }
+
+  if( txn->transaction_version==FD_TXN_V0 ) {
+    fd_txn_acct_addr_lut_t const * addr_luts = fd_txn_get_address_tables_const( txn );
+    for( ulong i=0UL; i<txn->addr_table_lookup_cnt; i++ ) {
+      fd_txn_acct_addr_lut_t const * addr_lut     = &addr_luts[ i ];
+      fd_acct_addr_t const *         addr_lut_acc = (fd_acct_addr_t const *)( txn_p->payload + addr_lut->addr_off );
+
+      FD_TXN_ACCOUNT_DECL( addr_lut_rec );
+      if( FD_UNLIKELY( fd_acc_mgr_view( slot_ctx->acc_mgr, slot_ctx->funk_txn, (fd_pubkey_t const *)addr_lut_acc, addr_lut_rec )!=FD_ACC_MGR_SUCCESS ) ) return -1;
+
+      ulong dlen = addr_lut_rec->const_meta->dlen;
+      if( FD_UNLIKELY( dlen<FD_LOOKUP_TABLE_META_SIZE ) ) return -1;
+      fd_acct_addr_t const * lookup_addrs     = (fd_acct_addr_t const *)( addr_lut_rec->const_data + FD_LOOKUP_TABLE_META_SIZE );
+      ulong                  lookup_addrs_cnt = ( dlen - FD_LOOKUP_TABLE_META_SIZE ) >> 5UL;
+
+      readonly[ readonly_cnt++ ] = *addr_lut_acc;
+
+      uchar const * writable_idx = txn_p->payload + addr_lut->writable_off;
+      for( ulong j=0UL; j<addr_lut->writable_cnt; j++ ) {
+        if( FD_UNLIKELY( writable_idx[ j ]>=lookup_addrs_cnt ) ) return -1;
+        writable[ writable_cnt++ ] = lookup_addrs[ writable_idx[ j ] ];
+      }
+
+      uchar const * readonly_idx = txn_p->payload + addr_lut->readonly_off;
+      for( ulong j=0UL; j<addr_lut->readonly_cnt; j++ ) {
+        if( FD_UNLIKELY( readonly_idx[ j ]>=lookup_addrs_cnt ) ) return -1;
+        readonly[ readonly_cnt++ ] = lookup_addrs[ readonly_idx[ j ] ];
+      }
+    }
+  }
+
+  for( ulong i=0UL; i<writable_cnt+readonly_cnt; i++ ) {
+    fd_pubkey_t const * key = (fd_pubkey_t const *)( i<writable_cnt ? &writable[ i ] : &readonly[ i-writable_cnt ] );
+    if( FD_UNLIKELY( !memcmp( key, fd_solana_bpf_loader_deprecated_program_id.key,   sizeof(fd_pubkey_t) ) ||
+                     !memcmp( key, fd_solana_bpf_loader_program_id.key,              sizeof(fd_pubkey_t) ) ||
+                     !memcmp( key, fd_solana_bpf_loader_upgradeable_program_id.key,  sizeof(fd_pubkey_t) ) ||
+                     !memcmp( key, fd_solana_bpf_loader_v4_program_id.key,           sizeof(fd_pubkey_t) ) ) ) return -1;
+  }
+
+  *_writable_cnt = writable_cnt;
+  *_readonly_cnt = readonly_cnt;
+  return 0;
+}
+
+/* fd_runtime_txn_refs_t holds the predicted account references of a
+   list of txns.  The references of txn i are ref[ off[i], off[i+1] ),
+   the first w_cnt[i] of which are writable.  barrier[i] is set if the
+   references of txn i could not be predicted (see
+   fd_runtime_txn_acct_refs), in which case it has to run alone. */
+
+struct fd_runtime_txn_refs {
+  fd_acct_addr_t * ref;
+  ulong *          off;
+  ulong *          w_cnt;
+  uchar *          barrier;
+};
+typedef struct fd_runtime_txn_refs fd_runtime_txn_refs_t;
+
+/* fd_runtime_sched_stats_t accumulates what the exec scheduler did
+   with a list of txns. */
+
+struct fd_runtime_sched_stats {
+  int   sched;      /* FD_RUNTIME_REPLAY_SCHED_{DAG,OPTIMISTIC} used */
+  ulong busy_ticks; /* Ticks exec workers spent on txns (as observed by the dispatcher) */
+  ulong exec_cnt;   /* Txn executions, including re-executions */
+  ulong abort_cnt;  /* Speculative executions that failed validation */
+};
+typedef struct fd_runtime_sched_stats fd_runtime_sched_stats_t;
+
+/* fd_runtime_txn_refs_prepare resets the flags of txns and predicts
+   their account references into refs.  refs is allocated from
+   runtime_spad. */
+
+static void
+fd_runtime_txn_refs_prepare( fd_runtime_txn_refs_t *    refs,
+                             fd_exec_slot_ctx_t const * slot_ctx,
+                             fd_txn_p_t *               txns,
+                             ulong                      txn_cnt,
+                             fd_spad_t *                runtime_spad ) {
+
+  ulong ref_max = 0UL;
   for( ulong i=0UL; i<txn_cnt; i++ ) {
     txns[i].flags = FD_TXN_P_FLAGS_SANITIZE_SUCCESS;
+    fd_txn_t const * txn = TXN( &txns[i] );
+    ref_max += (ulong)txn->acct_addr_cnt + (ulong)txn->addr_table_adtl_cnt + (ulong)txn->addr_table_lookup_cnt;
+  }
+
+  refs->ref     = fd_spad_alloc( runtime_spad, alignof(fd_acct_addr_t), fd_ulong_max( ref_max, 1UL )*sizeof(fd_acct_addr_t) );
+  refs->off     = fd_spad_alloc( runtime_spad, alignof(ulong),          (txn_cnt+1UL)*sizeof(ulong)                         );
+  refs->w_cnt   = fd_spad_alloc( runtime_spad, alignof(ulong),          txn_cnt*sizeof(ulong)                               );
+  refs->barrier = fd_spad_alloc( runtime_spad, alignof(uchar),          txn_cnt                                             );
+
+  ulong off = 0UL;
+  for( ulong i=0UL; i<txn_cnt; i++ ) {
+    fd_acct_addr_t readonly[ FD_TXN_ACCT_ADDR_MAX + FD_TXN_ADDR_TABLE_LOOKUP_MAX ];
+    ulong          writable_cnt;
+    ulong          readonly_cnt;
+    refs->off[ i ] = off;
+    if( FD_LIKELY( !fd_runtime_txn_acct_refs( slot_ctx, &txns[i], refs->ref+off, &writable_cnt, readonly, &readonly_cnt ) ) ) {
+      fd_memcpy( refs->ref+off+writable_cnt, readonly, readonly_cnt*sizeof(fd_acct_addr_t) );
+      refs->w_cnt  [ i ] = writable_cnt;
+      refs->barrier[ i ] = 0;
+      off += writable_cnt + readonly_cnt;
+    } else {
+      refs->w_cnt  [ i ] = 0UL;
+      refs->barrier[ i ] = 1;
+    }
+  }
+  refs->off[ txn_cnt ] = off;
+}
+
+/* fd_runtime_txn_dag_build returns an account conflict dag over the txns
+   described by refs.  The dag is allocated from runtime_spad. */
+
+static fd_exec_dag_t *
+fd_runtime_txn_dag_build( fd_runtime_txn_refs_t const * refs,
+                          ulong                         txn_cnt,
+                          fd_spad_t *                   runtime_spad ) {
+
+  ulong acct_max = 1UL + refs->off[ txn_cnt ];
+
+  void * dag_mem = fd_spad_alloc( runtime_spad, fd_exec_dag_align(), fd_exec_dag_footprint( txn_cnt, acct_max ) );
+  fd_exec_dag_t * dag = fd_exec_dag_join( fd_exec_dag_new( dag_mem, txn_cnt, acct_max ) );
+  if( FD_UNLIKELY( !dag ) ) {
+    FD_LOG_ERR(( "failed to create exec dag (txn_cnt=%lu, acct_max=%lu)", txn_cnt, acct_max ));
+  }
+
+  for( ulong i=0UL; i<txn_cnt; i++ ) {
+    ulong idx;
+    if( FD_LIKELY( !refs->barrier[ i ] ) ) {
+      fd_acct_addr_t const * ref   = refs->ref + refs->off[ i ];
+      ulong                  w_cnt = refs->w_cnt[ i ];
+      idx = fd_exec_dag_insert( dag, ref, w_cnt, ref+w_cnt, refs->off[ i+1UL ]-refs->off[ i ]-w_cnt );
+    } else {
+      idx = fd_exec_dag_insert_barrier( dag );
+    }
+    if( FD_UNLIKELY( idx!=i ) ) FD_LOG_ERR(( "exec dag out of capacity" )); /* Sized above */
+  }
+
+  return dag;
+}
+
+/* fd_runtime_txn_dispatch starts task for txn on exec worker
+   worker_idx.  The txn ctx is allocated in a new frame of the worker's
+   spad, which the caller pops once it is done with the txn. */
+
+static void
+fd_runtime_txn_dispatch( fd_exec_slot_ctx_t *         slot_ctx,
+                         fd_capture_ctx_t *           capture_ctx,
+                         fd_tpool_t *                 tpool,
+                         ulong                        worker_idx,
+                         fd_spad_t *                  exec_spad,
+                         fd_tpool_task_t              task,
+                         fd_execute_txn_task_info_t * task_info,
+                         fd_txn_p_t *                 txn ) {
+
+  fd_spad_push( exec_spad );
+
+  task_info->spad    = exec_spad;
+  task_info->txn     = txn;
+  task_info->txn_ctx = fd_spad_alloc( exec_spad, FD_EXEC_TXN_CTX_ALIGN, FD_EXEC_TXN_CTX_FOOTPRINT );
+  if( FD_UNLIKELY( !task_info->txn_ctx ) ) {
+    FD_LOG_ERR(( "failed to allocate txn ctx" ));
+  }
+
+  fd_tpool_exec( tpool, worker_idx, task,
+                 slot_ctx, (ulong)capture_ctx, (ulong)txn,
+                 task_info, exec_spad, 0UL,
+                 0UL, 0UL, 0UL, 0UL, 0UL, 0UL );
+}
+
+/* fd_runtime_txn_cost_check verifies cost tracker limits for an executed
+   txn (only for offline replay).  The txn ctx lives in the worker's spad
+   frame so this has to happen before the frame is popped.
+   https://github.com/anza-xyz/agave/blob/v2.2.0/ledger/src/blockstore_processor.rs#L284-L299 */
+
+static int
+fd_runtime_txn_cost_check( fd_exec_slot_ctx_t const *         slot_ctx,
+                           fd_execute_txn_task_info_t const * task_info,
+                           fd_cost_tracker_t *                cost_tracker,
+                           fd_spad_t *                        runtime_spad ) {
+
+  if( !( task_info->txn->flags & FD_TXN_P_FLAGS_EXECUTE_SUCCESS ) ) return 0;
+
+  fd_exec_txn_ctx_t const * txn_ctx          = task_info->txn_ctx;
+  fd_transaction_cost_t     transaction_cost = fd_calculate_cost_for_executed_transaction( task_info->txn_ctx,
+                                                                                           runtime_spad );
+
+  /* https://github.com/anza-xyz/agave/blob/v2.2.0/ledger/src/blockstore_processor.rs#L302-L307 */
+  int res = fd_cost_tracker_try_add( cost_tracker, txn_ctx, &transaction_cost );
+  if( FD_UNLIKELY( res ) ) {
+    FD_LOG_WARNING(( "Block cost limits exceeded for slot %lu", slot_ctx->slot_bank.slot ));
   }
+  return res;
+}
+
+/* fd_runtime_process_txns_dag executes txns by dispatching every txn
+   whose conflicting predecessors (in ledger order) in dag have
+   completed to the next idle exec worker. */
+
+static int
+fd_runtime_process_txns_dag( fd_exec_slot_ctx_t *       slot_ctx,
+                             fd_capture_ctx_t *         capture_ctx,
+                             fd_txn_p_t *               txns,
+                             ulong                      txn_cnt,
+                             fd_exec_dag_t *            dag,
+                             fd_tpool_t *               tpool,
+                             fd_spad_t * *              exec_spads,
+                             ulong                      exec_spad_cnt,
+                             fd_spad_t *                runtime_spad,
+                             fd_cost_tracker_t *        cost_tracker_opt,
+                             fd_runtime_sched_stats_t * stats ) {
+
+  int res = 0;
 
   fd_execute_txn_task_info_t * task_infos = fd_spad_alloc( runtime_spad,
                                                            alignof(fd_execute_txn_task_info_t),
                                                            txn_cnt * sizeof(fd_execute_txn_task_info_t) );
 
-  ulong curr_exec_idx = 0UL;
-  while( curr_exec_idx<txn_cnt ) {
-    ulong exec_idx_start = curr_exec_idx;
+  /* worker_txn[ worker_idx ] is the txn the worker is executing (or
+     ULONG_MAX if idle) and worker_tick[ worker_idx ] is when it was
+     dispatched. */
+
+  ulong * worker_txn  = fd_spad_alloc( runtime_spad, alignof(ulong), exec_spad_cnt*sizeof(ulong) );
+  long *  worker_tick = fd_spad_alloc( runtime_spad, alignof(long),  exec_spad_cnt*sizeof(long)  );
+  for( ulong worker_idx=0UL; worker_idx<exec_spad_cnt; worker_idx++ ) worker_txn[ worker_idx ] = ULONG_MAX;
+  ulong inflight_cnt = 0UL;
+
+  int cost_tracking = cost_tracker_opt!=NULL && FD_FEATURE_ACTIVE( slot_ctx, apply_cost_tracker_during_replay );
+
+  for(;;) {
+    int progress = 0;
+
+    /* Retire txns whose workers went idle */
 
-    // Push a new spad frame for each exec spad
     for( ulong worker_idx=1UL; worker_idx<exec_spad_cnt; worker_idx++ ) {
-      fd_spad_push( exec_spads[ worker_idx ] );
+      ulong idx = worker_txn[ worker_idx ];
+      if( idx==ULONG_MAX || fd_tpool_worker_state( tpool, worker_idx )!=FD_TPOOL_WORKER_STATE_IDLE ) continue;
+      fd_tpool_wait( tpool, worker_idx );
+      stats->busy_ticks += (ulong)( fd_tickcount() - worker_tick[ worker_idx ] );
+
+      if( cost_tracking && !res ) res = fd_runtime_txn_cost_check( slot_ctx, &task_infos[ idx ], cost_tracker_opt, runtime_spad );
+
+      fd_spad_pop( exec_spads[ worker_idx ] );
+      worker_txn[ worker_idx ] = ULONG_MAX;
+      inflight_cnt--;
+      fd_exec_dag_complete( dag, idx );
+      progress = 1;
+    }
+
+    /* If there was a error with cost tracker calculations, stop
+       dispatching and return the error once in-flight txns are done */
+
+    if( FD_UNLIKELY( res ) ) {
+      if( !inflight_cnt ) return res;
+      FD_SPIN_PAUSE();
+      continue;
     }
 
+    if( fd_exec_dag_done_cnt( dag )==txn_cnt ) break;
+
+    /* Dispatch ready txns to idle workers */
+
     for( ulong worker_idx=1UL; worker_idx<exec_spad_cnt; worker_idx++ ) {
-      if( curr_exec_idx>=txn_cnt ) {
-        break;
-      }
-      int state = fd_tpool_worker_state( tpool, worker_idx );
-      if( state!=FD_TPOOL_WORKER_STATE_IDLE ) {
-        continue;
-      }
+      if( worker_txn[ worker_idx ]!=ULONG_MAX ) continue;
+      ulong idx = fd_exec_dag_ready_pop( dag );
+      if( idx==ULONG_MAX ) break;
+
+      worker_txn [ worker_idx ] = idx;
+      worker_tick[ worker_idx ] = fd_tickcount();
+      inflight_cnt++;
+      stats->exec_cnt++;
+
+      fd_runtime_txn_dispatch( slot_ctx, capture_ctx, tpool, worker_idx, exec_spads[ worker_idx ],
+                               fd_runtime_prepare_execute_finalize_txn_task, &task_infos[ idx ], &txns[ idx ] );
+      progress = 1;
+    }
 
-      task_infos[ curr_exec_idx ].spad    = exec_spads[ worker_idx ];
-      task_infos[ curr_exec_idx ].txn     = &txns[ curr_exec_idx ];
-      task_infos[ curr_exec_idx ].txn_ctx = fd_spad_alloc( task_infos[ curr_exec_idx ].spad,
-                                                           FD_EXEC_TXN_CTX_ALIGN,
-                                                           FD_EXEC_TXN_CTX_FOOTPRINT );
-      if( FD_UNLIKELY( !task_infos[ curr_exec_idx ].txn_ctx ) ) {
-        FD_LOG_ERR(( "failed to allocate txn ctx" ));
-      }
+    if( FD_UNLIKELY( !inflight_cnt && !fd_exec_dag_ready_cnt( dag ) ) ) {
+      FD_LOG_ERR(( "exec dag stalled (%lu of %lu txns done)", fd_exec_dag_done_cnt( dag ), txn_cnt ));
+    }
+
+    if( !progress ) FD_SPIN_PAUSE();
+  }
+
+  return 0;
+}
+
+/* fd_runtime_txn_write_set collects the accounts fd_runtime_finalize_txn
+   saves for an executed txn into write and returns their count.  If
+   modified_only is set, accounts the txn saves unchanged (see
+   task_info->modified) are left out.  The fee payer (charged a fee) and
+   the nonce account (advanced) are always modified. */
+
+static ulong
+fd_runtime_txn_write_set( fd_execute_txn_task_info_t const * task_info,
+                          int                                modified_only,
+                          fd_acct_addr_t *                   write ) {
+
+  if( !( task_info->txn->flags & FD_TXN_P_FLAGS_EXECUTE_SUCCESS ) ) return 0UL;
+
+  fd_exec_txn_ctx_t const * txn_ctx   = task_info->txn_ctx;
+  ulong                     write_cnt = 0UL;
+
+  if( FD_UNLIKELY( task_info->exec_res ) ) {
+    fd_memcpy( &write[ write_cnt++ ], &txn_ctx->account_keys[ FD_FEE_PAYER_TXN_IDX ], sizeof(fd_acct_addr_t) );
+    if( txn_ctx->nonce_account_idx_in_txn!=ULONG_MAX ) {
+      fd_memcpy( &write[ write_cnt++ ], &txn_ctx->account_keys[ txn_ctx->nonce_account_idx_in_txn ], sizeof(fd_acct_addr_t) );
+    }
+    return write_cnt;
+  }
+
+  for( ulong i=0UL; i<txn_ctx->accounts_cnt; i++ ) {
+    if( i!=FD_FEE_PAYER_TXN_IDX ) {
+      if( !fd_txn_account_is_writable_idx( txn_ctx, (int)i ) ) continue;
+      if( modified_only && !( task_info->modified[ i>>6 ] & (1UL<<(i&63UL)) ) ) continue;
+    }
+    fd_memcpy( &write[ write_cnt++ ], &txn_ctx->account_keys[ i ], sizeof(fd_acct_addr_t) );
+  }
+  return write_cnt;
+}
 
-      fd_tpool_exec( tpool, worker_idx, fd_runtime_prepare_execute_finalize_txn_task,
-                     slot_ctx, (ulong)capture_ctx, (ulong)task_infos[curr_exec_idx].txn,
-                     &task_infos[ curr_exec_idx ], exec_spads[ worker_idx ], 0UL,
-                     0UL, 0UL, 0UL, 0UL, 0UL, 0UL );
+/* fd_runtime_txn_refs_any returns 1 if any of the write_cnt accounts at
+   write is referenced by txn idx and 0 otherwise. */
 
-      curr_exec_idx++;
+static int
+fd_runtime_txn_refs_any( fd_runtime_txn_refs_t const * refs,
+                         ulong                         idx,
+                         fd_acct_addr_t const *        write,
+                         ulong                         write_cnt ) {
+  for( ulong i=refs->off[ idx ]; i<refs->off[ idx+1UL ]; i++ ) {
+    for( ulong j=0UL; j<write_cnt; j++ ) {
+      if( !memcmp( &refs->ref[ i ], &write[ j ], sizeof(fd_acct_addr_t) ) ) return 1;
     }
+  }
+  return 0;
+}
+
+/* fd_runtime_process_txns_optimistic executes txns speculatively: txns
+   are dispatched in ledger order to idle exec workers without waiting
+   for the txns before them and execute against the state committed at
+   that point.  The dispatcher then validates and finalizes them strictly
+   in ledger order (fd_exec_spec); a txn that referenced an account
+   modified by a txn committed after it was dispatched is re-executed.
+   Writable accounts a txn saves unchanged don't invalidate anything.
+   Barrier txns are executed alone. */
+
+static int
+fd_runtime_process_txns_optimistic( fd_exec_slot_ctx_t *          slot_ctx,
+                                    fd_capture_ctx_t *            capture_ctx,
+                                    fd_txn_p_t *                  txns,
+                                    ulong                         txn_cnt,
+                                    fd_runtime_txn_refs_t const * refs,
+                                    fd_tpool_t *                  tpool,
+                                    fd_spad_t * *                 exec_spads,
+                                    ulong                         exec_spad_cnt,
+                                    fd_spad_t *                   runtime_spad,
+                                    fd_cost_tracker_t *           cost_tracker_opt,
+                                    fd_runtime_sched_stats_t *    stats ) {
+
+  if( FD_UNLIKELY( exec_spad_cnt<2UL ) ) {
+    FD_LOG_ERR(( "no exec workers" ));
+  }
+
+  ulong acct_max = 1UL + refs->off[ txn_cnt ];
+
+  void * spec_mem = fd_spad_alloc( runtime_spad, fd_exec_spec_align(), fd_exec_spec_footprint( acct_max ) );
+  fd_exec_spec_t * spec = fd_exec_spec_join( fd_exec_spec_new( spec_mem, acct_max ) );
+  if( FD_UNLIKELY( !spec ) ) {
+    FD_LOG_ERR(( "failed to create exec spec (acct_max=%lu)", acct_max ));
+  }
+
+  fd_execute_txn_task_info_t * task_infos = fd_spad_alloc( runtime_spad,
+                                                           alignof(fd_execute_txn_task_info_t),
+                                                           txn_cnt * sizeof(fd_execute_txn_task_info_t) );
+
+  /* worker_txn[ worker_idx ] is the txn held by the worker (or
+     ULONG_MAX if none).  A worker holds its txn (and the spad frame of
+     its txn ctx) until the txn is committed.  worker_start is the number
+     of committed txns when the txn was dispatched, worker_tick when it
+     was dispatched and worker_busy whether it is still executing.
+     txn_worker is the inverse of worker_txn. */
+
+  ulong * worker_txn   = fd_spad_alloc( runtime_spad, alignof(ulong), exec_spad_cnt*sizeof(ulong) );
+  ulong * worker_start = fd_spad_alloc( runtime_spad, alignof(ulong), exec_spad_cnt*sizeof(ulong) );
+  long *  worker_tick  = fd_spad_alloc( runtime_spad, alignof(long),  exec_spad_cnt*sizeof(long)  );
+  int *   worker_busy  = fd_spad_alloc( runtime_spad, alignof(int),   exec_spad_cnt*sizeof(int)   );
+  ulong * txn_worker   = fd_spad_alloc( runtime_spad, alignof(ulong), txn_cnt*sizeof(ulong)       );
+  for( ulong worker_idx=0UL; worker_idx<exec_spad_cnt; worker_idx++ ) {
+    worker_txn [ worker_idx ] = ULONG_MAX;
+    worker_busy[ worker_idx ] = 0;
+  }
+
+  int cost_tracking = cost_tracker_opt!=NULL && FD_FEATURE_ACTIVE( slot_ctx, apply_cost_tracker_during_replay );
+  int res           = 0;
+
+  ulong commit_idx = 0UL; /* Txns [0,commit_idx) are committed */
+  ulong next_idx   = 0UL; /* Txns [commit_idx,next_idx) are dispatched */
+
+  while( commit_idx<txn_cnt ) {
+    int progress = 0;
 
-    /* Wait for the workers to finish before we try to dispatch them a new task */
     for( ulong worker_idx=1UL; worker_idx<exec_spad_cnt; worker_idx++ ) {
+      if( !worker_busy[ worker_idx ] || fd_tpool_worker_state( tpool, worker_idx )!=FD_TPOOL_WORKER_STATE_IDLE ) continue;
       fd_tpool_wait( tpool, worker_idx );
+      stats->busy_ticks += (ulong)( fd_tickcount() - worker_tick[ worker_idx ] );
+      worker_busy[ worker_idx ] = 0;
+      progress = 1;
     }
 
-    /* Verify cost tracker limits (only for offline replay)
-       https://github.com/anza-xyz/agave/blob/v2.2.0/ledger/src/blockstore_processor.rs#L284-L299 */
-    if( cost_tracker_opt!=NULL && FD_FEATURE_ACTIVE( slot_ctx, apply_cost_tracker_during_replay ) ) {
-      for( ulong i=exec_idx_start; i<curr_exec_idx; i++ ) {
+    /* Commit executed txns in ledger order */
+
+    while( commit_idx<next_idx ) {
+      ulong worker_idx = txn_worker[ commit_idx ];
+      if( worker_busy[ worker_idx ] ) break;
+
+      fd_execute_txn_task_info_t * task_info = &task_infos[ commit_idx ];
+      fd_acct_addr_t const *       ref       = refs->ref + refs->off[ commit_idx ];
+      ulong                        ref_cnt   = refs->off[ commit_idx+1UL ] - refs->off[ commit_idx ];
+
+      if( !refs->barrier[ commit_idx ] &&
+          !fd_exec_spec_validate( spec, worker_start[ worker_idx ], ref, ref_cnt ) ) {
+        /* Re-execute against the now fully committed state */
+        fd_spad_pop( exec_spads[ worker_idx ] );
+        txns[ commit_idx ].flags  = FD_TXN_P_FLAGS_SANITIZE_SUCCESS;
+        worker_start[ worker_idx ] = commit_idx;
+        worker_tick [ worker_idx ] = fd_tickcount();
+        worker_busy [ worker_idx ] = 1;
+        stats->exec_cnt++;
+        fd_runtime_txn_dispatch( slot_ctx, capture_ctx, tpool, worker_idx, exec_spads[ worker_idx ],
+                                 fd_runtime_prepare_execute_txn_task, task_info, &txns[ commit_idx ] );
+        progress = 1;
+        break;
+      }
 
-        /* Skip any transactions that were not processed */
-        fd_execute_txn_task_info_t const * task_info = &task_infos[ i ];
-        if( FD_UNLIKELY( !( task_info->txn->flags & FD_TXN_P_FLAGS_EXECUTE_SUCCESS ) ) ) continue;
+      /* Finalizing saves all writable accounts to funk in place, even
+         unchanged ones (which may move their records).  Txns still
+         executing that reference any of them must not observe a
+         partial update, so wait for them to finish first.  Only the
+         accounts actually modified invalidate other txns. */
 
-        fd_exec_txn_ctx_t const * txn_ctx          = task_info->txn_ctx;
-        fd_transaction_cost_t     transaction_cost = fd_calculate_cost_for_executed_transaction( task_info->txn_ctx,
-                                                                                                 runtime_spad );
+      fd_acct_addr_t save[ MAX_TX_ACCOUNT_LOCKS ];
+      ulong          save_cnt = fd_runtime_txn_write_set( task_info, 0, save );
 
-        /* https://github.com/anza-xyz/agave/blob/v2.2.0/ledger/src/blockstore_processor.rs#L302-L307 */
-        res = fd_cost_tracker_try_add( cost_tracker_opt, txn_ctx, &transaction_cost );
-        if( FD_UNLIKELY( res ) ) {
-          FD_LOG_WARNING(( "Block cost limits exceeded for slot %lu", slot_ctx->slot_bank.slot ));
+      int wait = 0;
+      for( ulong other_idx=1UL; other_idx<exec_spad_cnt; other_idx++ ) {
+        if( worker_busy[ other_idx ] && fd_runtime_txn_refs_any( refs, worker_txn[ other_idx ], save, save_cnt ) ) {
+          wait = 1;
           break;
         }
       }
+      if( wait ) break;
+
+      fd_acct_addr_t write[ MAX_TX_ACCOUNT_LOCKS ];
+      ulong          write_cnt = fd_runtime_txn_write_set( task_info, 1, write );
+
+      fd_runtime_finalize_txn( slot_ctx, capture_ctx, task_info );
+      fd_exec_spec_commit( spec, commit_idx, write, write_cnt );
+
+      if( cost_tracking ) res = fd_runtime_txn_cost_check( slot_ctx, task_info, cost_tracker_opt, runtime_spad );
+
+      fd_spad_pop( exec_spads[ worker_idx ] );
+      worker_txn[ worker_idx ] = ULONG_MAX;
+      commit_idx++;
+      progress = 1;
+      if( FD_UNLIKELY( res ) ) break;
     }
 
-    // Pop the spad frame
+    /* If there was a error with cost tracker calculations, stop and
+       return the error once in-flight txns are done */
+
+    if( FD_UNLIKELY( res ) ) break;
+
+    /* Dispatch txns in ledger order to free workers.  A barrier txn is
+       only dispatched once all txns before it are committed and nothing
+       is dispatched past it until it is committed. */
+
     for( ulong worker_idx=1UL; worker_idx<exec_spad_cnt; worker_idx++ ) {
-      fd_spad_pop( exec_spads[ worker_idx ] );
+      if( worker_txn[ worker_idx ]!=ULONG_MAX ) continue;
+      if( next_idx==txn_cnt ) break;
+      if( refs->barrier[ next_idx ] && commit_idx!=next_idx ) break;
+      if( next_idx>commit_idx && refs->barrier[ next_idx-1UL ] ) break;
+
+      worker_txn  [ worker_idx ] = next_idx;
+      worker_start[ worker_idx ] = commit_idx;
+      worker_tick [ worker_idx ] = fd_tickcount();
+      worker_busy [ worker_idx ] = 1;
+      txn_worker  [ next_idx   ] = worker_idx;
+      stats->exec_cnt++;
+
+      fd_runtime_txn_dispatch( slot_ctx, capture_ctx, tpool, worker_idx, exec_spads[ worker_idx ],
+                               fd_runtime_prepare_execute_txn_task, &task_infos[ next_idx ], &txns[ next_idx ] );
+      next_idx++;
+      progress = 1;
     }
 
-    /* If there was a error with cost tracker calculations, return the error */
-    if( FD_UNLIKELY( res ) ) return res;
+    if( !progress ) FD_SPIN_PAUSE();
   }
 
-  return 0;
+  for( ulong worker_idx=1UL; worker_idx<exec_spad_cnt; worker_idx++ ) {
+    if( worker_txn[ worker_idx ]==ULONG_MAX ) continue;
+    if( worker_busy[ worker_idx ] ) fd_tpool_wait( tpool, worker_idx );
+    fd_spad_pop( exec_spads[ worker_idx ] );
+  }
+
+  stats->abort_cnt += fd_exec_spec_abort_cnt( spec );
 
+  return res;
+}
+
+/* fd_runtime_process_txns_sched executes txns over the exec workers
+   with the scheduler selected by slot_ctx->replay_sched and accumulates
+   what it did into stats. */
+
+static int
+fd_runtime_process_txns_sched( fd_exec_slot_ctx_t *       slot_ctx,
+                               fd_capture_ctx_t *         capture_ctx,
+                               fd_txn_p_t *               txns,
+                               ulong                      txn_cnt,
+                               fd_tpool_t *               tpool,
+                               fd_spad_t * *              exec_spads,
+                               ulong                      exec_spad_cnt,
+                               fd_spad_t *                runtime_spad,
+                               fd_cost_tracker_t *        cost_tracker_opt,
+                               fd_runtime_sched_stats_t * stats ) {
+
+  if( FD_UNLIKELY( !txn_cnt ) ) return 0;
+
+  fd_runtime_txn_refs_t refs[1];
+  fd_runtime_txn_refs_prepare( refs, slot_ctx, txns, txn_cnt, runtime_spad );
+
+  int             sched = slot_ctx->replay_sched;
+  fd_exec_dag_t * dag   = NULL;
+  if( sched!=FD_RUNTIME_REPLAY_SCHED_OPTIMISTIC ) {
+    dag = fd_runtime_txn_dag_build( refs, txn_cnt, runtime_spad );
+
+    /* The dag can keep txn_cnt/depth workers busy on average.  When that
+       is well below the worker count, speculate instead: the dag has to
+       assume txns modify every account they declare writable while
+       optimistic validation only fails on accounts a committed txn
+       actually modified (e.g. a shared writable account that most txns
+       leave unchanged serializes the dag but not speculation). */
+
+    if( sched==FD_RUNTIME_REPLAY_SCHED_AUTO ) {
+      ulong worker_cnt = fd_ulong_max( exec_spad_cnt, 2UL ) - 1UL;
+      sched = fd_exec_dag_depth( dag )*worker_cnt > 2UL*txn_cnt ? FD_RUNTIME_REPLAY_SCHED_OPTIMISTIC
+                                                                : FD_RUNTIME_REPLAY_SCHED_DAG;
+    }
+  }
+  stats->sched = sched;
+
+  if( sched==FD_RUNTIME_REPLAY_SCHED_OPTIMISTIC ) {
+    return fd_runtime_process_txns_optimistic( slot_ctx, capture_ctx, txns, txn_cnt, refs, tpool, exec_spads, exec_spad_cnt,
+                                               runtime_spad, cost_tracker_opt, stats );
+  }
+  return fd_runtime_process_txns_dag( slot_ctx, capture_ctx, txns, txn_cnt, dag, tpool, exec_spads, exec_spad_cnt,
+                                      runtime_spad, cost_tracker_opt, stats );
+}
+
+int
+fd_runtime_process_txns_in_microblock_stream( fd_exec_slot_ctx_t * slot_ctx,
+                                              fd_capture_ctx_t *   capture_ctx,
+                                              fd_txn_p_t *         txns,
+                                              ulong                txn_cnt,
+                                              fd_tpool_t *         tpool,
+                                              fd_spad_t * *        exec_spads,
+                                              ulong                exec_spad_cnt,
+                                              fd_spad_t *          runtime_spad,
+                                              fd_cost_tracker_t *  cost_tracker_opt ) {
+  fd_runtime_sched_stats_t stats[1] = {0};
+  return fd_runtime_process_txns_sched( slot_ctx, capture_ctx, txns, txn_cnt, tpool, exec_spads, exec_spad_cnt,
+                                        runtime_spad, cost_tracker_opt, stats );
 }
 
 /******************************************************************************/
@@ -2642,6 +3167,7 @@ fd_runtime_process_new_epoch( fd_exec_slot_ctx_t * slot_ctx,
   }
 
   /* Updates stake history sysvar accumulated values. */
+  long stakes_activate_time = -fd_log_wallclock();
   fd_stakes_activate_epoch( slot_ctx,
                             new_rate_activation_epoch,
                             &temp_info,
@@ -2649,6 +3175,7 @@ fd_runtime_process_new_epoch( fd_exec_slot_ctx_t * slot_ctx,
                             exec_spads,
                             exec_spad_cnt,
                             runtime_spad );
+  stakes_activate_time += fd_log_wallclock();
 
   /* Update the stakes epoch value to the new epoch */
   epoch_bank->stakes.epoch = epoch;
@@ -2672,6 +3199,7 @@ fd_runtime_process_new_epoch( fd_exec_slot_ctx_t * slot_ctx,
 
   fd_spad_push( runtime_spad );
 
+  long refresh_vote_accounts_time = -fd_log_wallclock();
   fd_refresh_vote_accounts( slot_ctx,
                             history,
                             new_rate_activation_epoch,
@@ -2680,8 +3208,10 @@ fd_runtime_process_new_epoch( fd_exec_slot_ctx_t * slot_ctx,
                             exec_spads,
                             exec_spad_cnt,
                             runtime_spad );
+  refresh_vote_accounts_time += fd_log_wallclock();
 
   /* Distribute rewards */
+  long rewards_time = -fd_log_wallclock();
   fd_hash_t const * parent_blockhash = slot_ctx->slot_bank.block_hash_queue.last_hash;
   if( FD_FEATURE_ACTIVE( slot_ctx, enable_partitioned_epoch_reward ) ||
       FD_FEATURE_ACTIVE( slot_ctx, partitioned_epoch_rewards_superfeature ) ) {
@@ -2704,6 +3234,7 @@ fd_runtime_process_new_epoch( fd_exec_slot_ctx_t * slot_ctx,
                        exec_spad_cnt,
                        runtime_spad );
   }
+  rewards_time += fd_log_wallclock();
 
   /* Replace stakes at T-2 (slot_ctx->slot_bank.epoch_stakes) by stakes at T-1 (epoch_bank->next_epoch_stakes) */
   fd_update_epoch_stakes( slot_ctx );
@@ -2719,7 +3250,12 @@ fd_runtime_process_new_epoch( fd_exec_slot_ctx_t * slot_ctx,
   FD_LOG_NOTICE(( "fd_process_new_epoch end" ));
 
   long end = fd_log_wallclock();
-  FD_LOG_NOTICE(("fd_process_new_epoch took %ld ns", end - start));
+  FD_LOG_NOTICE(( "fd_process_new_epoch took %ld ns - stake infos: %lu, stakes activation: %6.6f ms, vote accounts refresh: %6.6f ms, rewards calculation: %6.6f ms",
+                  end - start,
+                  temp_info.stake_infos_len,
+                  (double)stakes_activate_time       * 1e-6,
+                  (double)refresh_vote_accounts_time * 1e-6,
+                  (double)rewards_time               * 1e-6 ));
 }
 
 /******************************************************************************/
@@ -2912,7 +3448,9 @@ fd_raw_block_txn_iter_ele( fd_raw_block_txn_iter_t iter, fd_txn_p_t * out_txn )
 /* The below runtime block parsing and block destroying logic is ONLY used in
    offline replay to simulate the block parsing/freeing that would occur in
    the full, live firedancer client. This is done via two APIs:
-   fd_runtime_block_prepare and fd_runtime_block_destroy. */
+   fd_runtime_block_prepare and fd_runtime_block_destroy.  The microblock
+   batch level fd_runtime_microblock_batch_prepare is also used by the
+   replay tile to parse batches as they are deshredded. */
 
 /* Helpers for fd_runtime_block_prepare */
 
@@ -2992,7 +3530,7 @@ fd_runtime_microblock_prepare( void const *           buf,
   return 0;
 }
 
-static int
+int
 fd_runtime_microblock_batch_prepare( void const *                 buf,
                                      ulong                        buf_sz,
                                      fd_spad_t *                  runtime_spad,
@@ -3613,35 +4151,17 @@ fd_runtime_block_verify_info_collect( fd_runtime_block_info_t const *      block
   }
 }
 
-static void
-fd_runtime_poh_verify_wide_task( void * tpool,
-                                 ulong  t0 FD_PARAM_UNUSED,
-                                 ulong  t1 FD_PARAM_UNUSED,
-                                 void * args FD_PARAM_UNUSED,
-                                 void * reduce FD_PARAM_UNUSED,
-                                 ulong  stride FD_PARAM_UNUSED,
-                                 ulong  l0 FD_PARAM_UNUSED,
-                                 ulong  l1 FD_PARAM_UNUSED,
-                                 ulong  m0,
-                                 ulong  m1 FD_PARAM_UNUSED,
-                                 ulong  n0 FD_PARAM_UNUSED,
-                                 ulong  n1 FD_PARAM_UNUSED ) {
-  fd_poh_verification_info_t * poh_info = (fd_poh_verification_info_t *)tpool + m0;
-
-  fd_hash_t out_poh_hash = *poh_info->in_poh_hash;
-  fd_hash_t init_poh_hash_cpy = *poh_info->in_poh_hash;
+/* fd_runtime_poh_verify_entry finishes the PoH verification of an entry
+   whose hash chain was already advanced up to the mixin (if any) into
+   out_poh_hash. */
 
+static void
+fd_runtime_poh_verify_entry( fd_poh_verification_info_t * poh_info,
+                             fd_hash_t *                  out_poh_hash ) {
   fd_microblock_info_t const *microblock_info = poh_info->microblock_info;
-  ulong hash_cnt = microblock_info->microblock.hdr->hash_cnt;
   ulong txn_cnt = microblock_info->microblock.hdr->txn_cnt;
 
-  if( !txn_cnt ) { /* microblock is a tick */
-    fd_poh_append( &out_poh_hash, hash_cnt );
-  } else {
-    if( hash_cnt ) {
-      fd_poh_append(&out_poh_hash, hash_cnt - 1);
-    }
-
+  if( txn_cnt ) {
     ulong                 leaf_cnt = microblock_info->signature_cnt;
     uchar *               commit   = fd_alloca_check( FD_WBMTREE32_ALIGN, fd_wbmtree32_footprint(leaf_cnt));
     fd_wbmtree32_leaf_t * leafs    = fd_alloca_check(alignof(fd_wbmtree32_leaf_t), sizeof(fd_wbmtree32_leaf_t) * leaf_cnt);
@@ -3667,32 +4187,84 @@ fd_runtime_poh_verify_wide_task( void * tpool,
 
     fd_wbmtree32_append( tree, leafs, leaf_cnt, mbuf );
     uchar * root = fd_wbmtree32_fini( tree );
-    fd_poh_mixin( &out_poh_hash, root );
+    fd_poh_mixin( out_poh_hash, root );
   }
 
-  if( FD_UNLIKELY( memcmp(microblock_info->microblock.hdr->hash, out_poh_hash.hash, sizeof(fd_hash_t)) ) ) {
+  if( FD_UNLIKELY( memcmp(microblock_info->microblock.hdr->hash, out_poh_hash->hash, sizeof(fd_hash_t)) ) ) {
     FD_LOG_WARNING(( "poh mismatch (bank: %s, entry: %s. INIT: %s)",
-        FD_BASE58_ENC_32_ALLOCA( out_poh_hash.hash ),
+        FD_BASE58_ENC_32_ALLOCA( out_poh_hash->hash ),
         FD_BASE58_ENC_32_ALLOCA( microblock_info->microblock.hdr->hash ),
-        FD_BASE58_ENC_32_ALLOCA(&init_poh_hash_cpy) ));
+        FD_BASE58_ENC_32_ALLOCA( poh_info->in_poh_hash ) ));
     poh_info->success = -1;
   }
 }
 
+/* FD_RUNTIME_POH_VERIFY_CHAIN_MAX bounds the number of entries whose
+   hash chains a verify task advances together. */
+
+#define FD_RUNTIME_POH_VERIFY_CHAIN_MAX (64UL)
+
+/* fd_runtime_poh_verify_wide_task verifies the entries [m0,m1).  The
+   hash chains of the entries are independent of each other (each starts
+   from the hash of the previous entry), so they are advanced in
+   lockstep with fd_poh_append_batch (which uses the SHA-256 batch API on
+   targets with wide SHA-256 batching). */
+
+static void
+fd_runtime_poh_verify_wide_task( void * tpool,
+                                 ulong  t0 FD_PARAM_UNUSED,
+                                 ulong  t1 FD_PARAM_UNUSED,
+                                 void * args FD_PARAM_UNUSED,
+                                 void * reduce FD_PARAM_UNUSED,
+                                 ulong  stride FD_PARAM_UNUSED,
+                                 ulong  l0 FD_PARAM_UNUSED,
+                                 ulong  l1 FD_PARAM_UNUSED,
+                                 ulong  m0,
+                                 ulong  m1,
+                                 ulong  n0 FD_PARAM_UNUSED,
+                                 ulong  n1 FD_PARAM_UNUSED ) {
+  fd_poh_verification_info_t * poh_infos = (fd_poh_verification_info_t *)tpool;
+
+  fd_hash_t out_poh_hash[ FD_RUNTIME_POH_VERIFY_CHAIN_MAX ];
+  void *    out_poh_ptr [ FD_RUNTIME_POH_VERIFY_CHAIN_MAX ];
+  ulong     hash_cnt    [ FD_RUNTIME_POH_VERIFY_CHAIN_MAX ];
+
+  for( ulong i0=m0; i0<m1; i0+=FD_RUNTIME_POH_VERIFY_CHAIN_MAX ) {
+    ulong chain_cnt = fd_ulong_min( m1-i0, FD_RUNTIME_POH_VERIFY_CHAIN_MAX );
+
+    for( ulong j=0UL; j<chain_cnt; j++ ) {
+      fd_poh_verification_info_t const * poh_info = poh_infos + i0 + j;
+      fd_microblock_hdr_t const *        hdr      = poh_info->microblock_info->microblock.hdr;
+
+      /* A tick is hash_cnt hashes, a microblock with transactions is
+         hash_cnt-1 hashes followed by the mixin of its transactions */
+      out_poh_hash[ j ] = *poh_info->in_poh_hash;
+      out_poh_ptr [ j ] = &out_poh_hash[ j ];
+      hash_cnt    [ j ] = hdr->txn_cnt ? fd_ulong_sat_sub( hdr->hash_cnt, 1UL ) : hdr->hash_cnt;
+    }
+
+    fd_poh_append_batch( out_poh_ptr, hash_cnt, chain_cnt );
+
+    for( ulong j=0UL; j<chain_cnt; j++ ) {
+      fd_runtime_poh_verify_entry( poh_infos + i0 + j, &out_poh_hash[ j ] );
+    }
+  }
+}
+
 static int
 fd_runtime_poh_verify_tpool( fd_poh_verification_info_t * poh_verification_info,
                              ulong                        poh_verification_info_cnt,
                              fd_tpool_t *                 tpool ) {
-  fd_tpool_exec_all_rrobin( tpool,
-                            0,
-                            fd_tpool_worker_cnt( tpool ),
-                            fd_runtime_poh_verify_wide_task,
-                            poh_verification_info,
-                            NULL,
-                            NULL,
-                            1,
-                            0,
-                            poh_verification_info_cnt );
+  fd_tpool_exec_all_batch( tpool,
+                           0,
+                           fd_tpool_worker_cnt( tpool ),
+                           fd_runtime_poh_verify_wide_task,
+                           poh_verification_info,
+                           NULL,
+                           NULL,
+                           1,
+                           0,
+                           poh_verification_info_cnt );
 
   for( ulong i=0UL; i<poh_verification_info_cnt; i++ ) {
     if( poh_verification_info[i].success ) {
@@ -3703,6 +4275,26 @@ fd_runtime_poh_verify_tpool( fd_poh_verification_info_t * poh_verification_info,
   return 0;
 }
 
+int
+fd_runtime_microblock_batch_poh_verify_tpool( fd_microblock_batch_info_t const * microblock_batch_info,
+                                              fd_hash_t const *                  in_poh_hash,
+                                              fd_tpool_t *                       tpool,
+                                              fd_spad_t *                        runtime_spad ) {
+  ulong poh_verification_info_cnt = microblock_batch_info->microblock_cnt;
+  if( FD_UNLIKELY( !poh_verification_info_cnt ) ) return 0;
+
+  FD_SPAD_FRAME_BEGIN( runtime_spad ) {
+
+  fd_poh_verification_info_t * poh_verification_info = fd_spad_alloc( runtime_spad,
+                                                                      alignof(fd_poh_verification_info_t),
+                                                                      poh_verification_info_cnt * sizeof(fd_poh_verification_info_t) );
+  fd_runtime_microblock_batch_verify_info_collect( microblock_batch_info, in_poh_hash, poh_verification_info );
+
+  return fd_runtime_poh_verify_tpool( poh_verification_info, poh_verification_info_cnt, tpool );
+
+  } FD_SPAD_FRAME_END;
+}
+
 static int
 fd_runtime_block_verify_tpool( fd_exec_slot_ctx_t *    slot_ctx,
                                fd_runtime_block_info_t const * block_info,
@@ -3852,30 +4444,38 @@ fd_runtime_block_execute_tpool( fd_exec_slot_ctx_t *    slot_ctx,
     fd_cost_tracker_init( cost_tracker, slot_ctx, runtime_spad );
   }
 
-  /* We want to emulate microblock-by-microblock execution */
-  ulong to_exec_idx = 0UL;
-  for( ulong i=0UL; i<block_info->microblock_batch_cnt; i++ ) {
-    for( ulong j=0UL; j<block_info->microblock_batch_infos[i].microblock_cnt; j++ ) {
-      ulong txn_cnt = block_info->microblock_batch_infos[i].microblock_infos[j].microblock.hdr->txn_cnt;
-      fd_txn_p_t * mblock_txn_ptrs = &txn_ptrs[ to_exec_idx ];
-      ulong        mblock_txn_cnt  = txn_cnt;
-      to_exec_idx += txn_cnt;
-
-      if( !mblock_txn_cnt ) continue;
-
-      res = fd_runtime_process_txns_in_microblock_stream( slot_ctx,
-                                                          capture_ctx,
-                                                          mblock_txn_ptrs,
-                                                          mblock_txn_cnt,
-                                                          tpool,
-                                                          exec_spads,
-                                                          exec_spad_cnt,
-                                                          runtime_spad,
-                                                          cost_tracker );
-      if( FD_UNLIKELY( res!=FD_RUNTIME_EXECUTE_SUCCESS ) ) {
-        return res;
-      }
-    }
+  /* Schedule all txns of the block at once such that txns in later
+     microblocks only wait for the txns they actually conflict with */
+  long  exec_time  = -fd_log_wallclock();
+  long  exec_tick  = -fd_tickcount();
+  fd_runtime_sched_stats_t stats[1] = {0};
+  res = fd_runtime_process_txns_sched( slot_ctx,
+                                       capture_ctx,
+                                       txn_ptrs,
+                                       txn_cnt,
+                                       tpool,
+                                       exec_spads,
+                                       exec_spad_cnt,
+                                       runtime_spad,
+                                       cost_tracker,
+                                       stats );
+  if( FD_UNLIKELY( res!=FD_RUNTIME_EXECUTE_SUCCESS ) ) {
+    return res;
+  }
+  exec_time += fd_log_wallclock();
+  exec_tick += fd_tickcount();
+
+  if( txn_cnt ) {
+    ulong worker_cnt = fd_ulong_max( exec_spad_cnt, 2UL ) - 1UL;
+    FD_LOG_INFO(( "executed txns - slot: %lu, txns: %lu, elapsed: %6.6f ms, tps: %6.6f, worker utilization: %5.1f%% (%lu workers), "
+                  "sched: %s, executions: %lu, aborts: %lu (%4.1f%%)",
+                  slot_ctx->slot_bank.slot, txn_cnt, (double)exec_time * 1e-6,
+                  (double)txn_cnt / ( (double)fd_long_max( exec_time, 1L ) * 1e-9 ),
+                  100. * (double)stats->busy_ticks / ( (double)fd_long_max( exec_tick, 1L ) * (double)worker_cnt ),
+                  worker_cnt,
+                  stats->sched==FD_RUNTIME_REPLAY_SCHED_OPTIMISTIC ? "optimistic" : "dag",
+                  stats->exec_cnt, stats->abort_cnt,
+                  100. * (double)stats->abort_cnt / (double)fd_ulong_max( stats->exec_cnt, 1UL ) ));
   }
 
   long block_finalize_time = -fd_log_wallclock();
@@ -3907,6 +4507,7 @@ fd_runtime_block_pre_execute_process_new_epoch( fd_exec_slot_ctx_t * slot_ctx,
 
   /* Update block height. */
   slot_ctx->slot_bank.block_height += 1UL;
+  slot_ctx->rewards_distribution_ticks = 0L;
 
   if( slot_ctx->slot_bank.slot != 0UL ) {
     ulong             slot_idx;
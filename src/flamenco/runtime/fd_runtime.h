@@ -37,6 +37,22 @@
 #define FD_RUNTIME_TRACE_SAVE   (1)
 #define FD_RUNTIME_TRACE_REPLAY (2)
 
+/* FD_RUNTIME_REPLAY_SCHED_* select how the txns of a block are
+   scheduled onto the exec workers (fd_exec_slot_ctx_t::replay_sched).
+   DAG dispatches a txn once every earlier conflicting txn completed
+   (fd_exec_dag).  OPTIMISTIC executes txns speculatively in ledger
+   order, validates them at commit and re-executes those that read an
+   account modified by a txn committed in the meantime (fd_exec_spec).  AUTO picks OPTIMISTIC for blocks whose conflict dag
+   is too deep to keep the workers busy and DAG otherwise.
+
+   DAG is the zero value and hence the default for any slot ctx that
+   does not set replay_sched explicitly (e.g. the replay tile).
+   OPTIMISTIC and AUTO are opt-in (fd_ledger --replay-sched). */
+
+#define FD_RUNTIME_REPLAY_SCHED_DAG        (0)
+#define FD_RUNTIME_REPLAY_SCHED_AUTO       (1)
+#define FD_RUNTIME_REPLAY_SCHED_OPTIMISTIC (2)
+
 #define FD_RUNTIME_NUM_ROOT_BLOCKS (32UL)
 
 #define FD_FEATURE_ACTIVE_(_slot, _features, _feature_name)               (_slot >= (_features). _feature_name)
@@ -71,6 +87,7 @@ struct fd_execute_txn_task_info {
   fd_exec_txn_ctx_t * txn_ctx;
   fd_txn_p_t *        txn;
   int                 exec_res;
+  ulong               modified[ MAX_TX_ACCOUNT_LOCKS/64UL ]; /* Bit set of accounts modified by a speculative execution */
 };
 typedef struct fd_execute_txn_task_info fd_execute_txn_task_info_t;
 
@@ -391,6 +408,30 @@ fd_runtime_microblock_verify_ticks( fd_exec_slot_ctx_t *        slot_ctx,
 void
 fd_runtime_poh_verify( fd_poh_verifier_t * poh_info );
 
+/* fd_runtime_microblock_batch_prepare parses the microblock batch (an
+   entry batch as deshredded from a data complete shred) of buf_sz bytes
+   at buf into out_microblock_batch_info.  Transactions are parsed into
+   memory allocated from runtime_spad.  Returns 0 on success and -1 if
+   the batch is malformed. */
+
+int
+fd_runtime_microblock_batch_prepare( void const *                 buf,
+                                     ulong                        buf_sz,
+                                     fd_spad_t *                  runtime_spad,
+                                     fd_microblock_batch_info_t * out_microblock_batch_info );
+
+/* fd_runtime_microblock_batch_poh_verify_tpool verifies the PoH hashes
+   of all microblocks in a prepared microblock batch, starting from
+   in_poh_hash (the hash of the last entry before the batch).  The
+   microblocks are verified in parallel on tpool.  Returns 0 on success
+   and -1 if any hash does not match. */
+
+int
+fd_runtime_microblock_batch_poh_verify_tpool( fd_microblock_batch_info_t const * microblock_batch_info,
+                                              fd_hash_t const *                  in_poh_hash,
+                                              fd_tpool_t *                       tpool,
+                                              fd_spad_t *                        runtime_spad );
+
 int
 fd_runtime_block_execute_prepare( fd_exec_slot_ctx_t * slot_ctx,
                                   fd_spad_t *          runtime_spad );
@@ -430,8 +471,14 @@ fd_runtime_process_txns( fd_exec_slot_ctx_t * slot_ctx,
                          fd_spad_t *          runtime_spad );
 
 /* fd_runtime_execute_txns_in_microblock_stream is responsible for end-to-end
-   preparing, executing and finalizng a list of transactions. It assumes that
-   all transactions are conflict-free. */
+   preparing, executing and finalizng a list of transactions. Transactions
+   are scheduled over the exec workers as selected by
+   slot_ctx->replay_sched, so the list may span multiple microblocks:
+   either a transaction is dispatched as soon as every earlier
+   transaction in the list it conflicts with has completed (dag), or
+   transactions are executed speculatively and committed in order,
+   re-executing the ones that observed state a preceding transaction
+   went on to modify (optimistic). */
 
 int
 fd_runtime_process_txns_in_microblock_stream( fd_exec_slot_ctx_t * slot_ctx,
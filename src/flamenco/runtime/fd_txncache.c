@@ -1,6 +1,10 @@
 #include "fd_txncache.h"
 #include "../fd_rwlock.h"
 
+#if FD_HAS_AVX
+#include "../../util/simd/fd_avx.h"
+#endif
+
 #define SORT_NAME        sort_slot_ascend
 #define SORT_KEY_T       ulong
 #define SORT_BEFORE(a,b) (a)<(b)
@@ -16,11 +20,23 @@
 
 #define FD_TXNCACHE_TXNS_PER_PAGE (16384UL)
 
-/* The number of unique entries in the hash lookup table for each
-   blockhash.  A higher value here uses more memory but enables faster
-   lookups. */
+/* The txnhash index of each blockhash is a table of buckets.  A bucket
+   is one cache line holding the 4 byte prefixes of up to 7 txnhashes
+   next to each other, followed by the pool indices of the txns they
+   belong to, so a query compares the prefixes of a whole bucket with
+   one AVX2 compare and only visits the txns whose prefix matched.  Once
+   a bucket is full, further txns go to a chain of overflow nodes of 8
+   prefixes each.  The nodes take two entries from the txnpages of the
+   blockhash, like the txns themselves.
 
-#define FD_TXNCACHE_BLOCKCACHE_MAP_CNT (524288UL)
+   A higher bucket count uses more memory but keeps chains short.  At
+   32768 buckets the table takes as much memory as the 524288 chain
+   heads it replaced, and holds up to 229,376 txns per blockhash
+   without overflow. */
+
+#define FD_TXNCACHE_BLOCKCACHE_BUCKET_CNT (32768UL)
+#define FD_TXNCACHE_BUCKET_LANE_CNT       (7U)
+#define FD_TXNCACHE_NODE_LANE_CNT         (8U)
 
 /* The number of unique entries in the hash lookup table for each
    (slot, blockhash).  This prevents all the entries needing to be in
@@ -28,6 +44,15 @@
 
 #define FD_TXNCACHE_SLOTCACHE_MAP_CNT (1024UL)
 
+/* The number of queries of a batch that are in flight at once.  The
+   lookups for a group of queries are done in stages (resolve the
+   blockhash and prefetch the bucket, compare the prefixes of the bucket
+   and prefetch the first matching transaction, verify the matches and
+   walk any overflow nodes) so the cache misses of the queries in the
+   group overlap instead of being taken one after another. */
+
+#define FD_TXNCACHE_QUERY_PIPELINE (16UL)
+
 /* Value for an empty blockcache `max_slot` or empty slotcache
   `slot` entry. When the entries are set to this value, we can insert
   to the entry, but stop iterating while running queries. */
@@ -44,7 +69,6 @@
 #define FD_TXNCACHE_TEMP_ENTRY (ULONG_MAX-2UL)
 
 struct fd_txncache_private_txn {
-  uint  blockcache_next; /* Pointer to the next element in the blockcache hash chain containing this entry from the pool. */
   uint  slotblockcache_next;  /* Pointer to the next element in the slotcache hash chain containing this entry from the pool. */
 
   ulong slot;            /* Slot that the transaction was executed.  A transaction might be in the cache
@@ -66,6 +90,41 @@ struct fd_txncache_private_txnpage {
 
 typedef struct fd_txncache_private_txnpage fd_txncache_private_txnpage_t;
 
+/* A bucket of the txnhash index of a blockcache.  Lanes are claimed by
+   incrementing cnt, lanes [0,min(cnt,7)) are claimed.  A claimed lane
+   has its prefix written before its txn index is published, idx is
+   UINT_MAX until then.  cnt is the 8th lane of the prefix compare and
+   is always masked off. */
+
+struct __attribute__((aligned(64UL))) fd_txncache_private_bucket {
+  uint prefix[ FD_TXNCACHE_BUCKET_LANE_CNT ]; /* Bytes [8,12) of the truncated txnhash of each lane. */
+  uint cnt;                                   /* Number of claimed lanes, can exceed the lane count. */
+  uint idx[ FD_TXNCACHE_BUCKET_LANE_CNT ];    /* Pool index of the txn of each lane. */
+  uint next;                                  /* Pool index of the first overflow node, UINT_MAX if none and
+                                                 FD_TXNCACHE_NODE_FAILED if it could not be allocated. */
+};
+
+typedef struct fd_txncache_private_bucket fd_txncache_private_bucket_t;
+
+/* An overflow node, same as a bucket but with 8 lanes.  A node takes
+   two consecutive entries of a txnpage. */
+
+struct fd_txncache_private_node {
+  uint prefix[ FD_TXNCACHE_NODE_LANE_CNT ];
+  uint idx[ FD_TXNCACHE_NODE_LANE_CNT ];
+  uint cnt;
+  uint next;
+  uint last; /* Only used in the first node of a chain: a hint to the last node of the chain, so inserts do not walk
+                the chain, UINT_MAX if not known.  Can lag behind the actual last node. */
+};
+
+typedef struct fd_txncache_private_node fd_txncache_private_node_t;
+
+FD_STATIC_ASSERT( sizeof(fd_txncache_private_bucket_t)==64UL, txncache );
+FD_STATIC_ASSERT( sizeof(fd_txncache_private_node_t)<=2UL*sizeof(fd_txncache_private_txn_t), txncache );
+
+#define FD_TXNCACHE_NODE_FAILED (UINT_MAX-1U)
+
 struct fd_txncache_private_blockcache {
   uchar blockhash[ 32 ]; /* The actual blockhash of these transactions. */
   ulong max_slot;        /* The max slot we have seen that contains a transaction referencing this blockhash.
@@ -82,10 +141,9 @@ struct fd_txncache_private_blockcache {
                             insert into the cache ourselves, we do just always use a key_offset of zero, so this is
                             only nonzero when constructed form a peer snapshot. */
 
-  uint  heads[ FD_TXNCACHE_BLOCKCACHE_MAP_CNT ]; /* The hash table for the blockhash.  Each entry is a pointer to the head of a
-                                                    linked list of transactions that reference this blockhash.  As we add
-                                                    transactions to the bucket, the head pointer is updated to the new item, and
-                                                    the new item is pointed to the previous head. */
+  fd_txncache_private_bucket_t buckets[ FD_TXNCACHE_BLOCKCACHE_BUCKET_CNT ]; /* The txnhash index for the blockhash.  A txn goes to the
+                                                                              bucket given by the first 8 bytes of its truncated hash,
+                                                                              and is matched on the next 4 bytes. */
 
   ushort pages_cnt;      /* The number of txnpages currently in use to store the transactions in this blockcache. */
   uint * pages;          /* A list of the txnpages containing the transactions for this blockcache. */
@@ -110,8 +168,13 @@ typedef struct fd_txncache_private_slotcache fd_txncache_private_slotcache_t;
 
 struct __attribute__((aligned(FD_TXNCACHE_ALIGN))) fd_txncache_private {
   fd_rwlock_t lock[ 1 ]; /* The txncache is a concurrent structure and will be accessed by multiple threads
-                            concurrently.  Insertion and querying only take a read lock as they can be done
-                            lockless but all other operations will take a write lock internally. */
+                            concurrently.  Insertion only takes a read lock as it can be done lockless but
+                            all other operations will take a write lock internally.  Queries take no lock
+                            unless they overlap with a purge, see purge_seq. */
+
+  ulong purge_seq;       /* Incremented before and after each purge, so it is odd while a purge is freeing
+                            txnpages.  Queries run without the lock and retry under the lock if purge_seq
+                            was odd or changed while they ran. */
 
   ulong  root_slots_max;
   ulong  live_slots_max;
@@ -229,6 +292,42 @@ fd_txncache_get_probed_entries_const( fd_txncache_t const * tc ) {
   return (ulong *)( (uchar const *)tc + tc->probed_entries_off );
 }
 
+/* fd_txncache_private_{blockhash,txnhash}_eq return 1 if the 32 byte
+   blockhashes (20 byte truncated txnhashes) at a and b are equal and 0
+   otherwise.  These are the inner loop compares of query. */
+
+FD_FN_PURE static inline int
+fd_txncache_private_blockhash_eq( uchar const * a,
+                                  uchar const * b ) {
+# if FD_HAS_AVX
+  return _mm256_movemask_epi8( wb_eq( wb_ldu( a ), wb_ldu( b ) ) )==-1;
+# else
+  return !memcmp( a, b, 32UL );
+# endif
+}
+
+FD_FN_PURE static inline int
+fd_txncache_private_txnhash_eq( uchar const * a,
+                                uchar const * b ) {
+  return (FD_LOAD( ulong, a     )==FD_LOAD( ulong, b     )) &
+         (FD_LOAD( ulong, a+ 8UL)==FD_LOAD( ulong, b+ 8UL)) &
+         (FD_LOAD( uint,  a+16UL)==FD_LOAD( uint,  b+16UL));
+}
+
+/* fd_txncache_max_entries returns the max number of txnpage entries
+   used by txn_cnt txns of one blockhash.  Besides the txns themselves,
+   each overflow node of the txnhash index takes two entries.  A bucket
+   only gets a node once all its lanes (and those of its previous nodes)
+   are claimed, so a bucket with n txns has at most ceil((n-7)/8) =
+   floor(n/8) nodes, and the blockhash has at most floor(txn_cnt/8).
+   This is rounded up so that it is also an upper bound when summed
+   over blockhashes. */
+
+FD_FN_CONST static ulong
+fd_txncache_max_entries( ulong txn_cnt ) {
+  return txn_cnt + 2UL*((txn_cnt+7UL)/8UL);
+}
+
 FD_FN_CONST static ushort
 fd_txncache_max_txnpages_per_blockhash( ulong max_txn_per_slot ) {
   /* The maximum number of transaction pages we might need to store all
@@ -249,9 +348,11 @@ fd_txncache_max_txnpages_per_blockhash( ulong max_txn_per_slot ) {
      Transactions referenced by a particular blockhash.
      Transactions are stored in pages of 16,384, so we might need up
      to 4,800 of these pages to store all the transactions in a
-     slot. */
+     slot, plus a quarter more for the overflow nodes of the txnhash
+     index.  An overflow node needs two consecutive entries, so up to
+     one entry at the end of each page may go unused. */
 
-  ulong result = 1UL+(max_txn_per_slot*150UL-1UL)/FD_TXNCACHE_TXNS_PER_PAGE;
+  ulong result = 1UL+(fd_txncache_max_entries( max_txn_per_slot*150UL )-1UL)/(FD_TXNCACHE_TXNS_PER_PAGE-1UL);
   if( FD_UNLIKELY( result>USHORT_MAX ) ) return 0;
   return (ushort)result;
 }
@@ -273,9 +374,11 @@ fd_txncache_max_txnpages( ulong max_live_slots,
 
        (max_live_slots*max_txn_per_slot)/FD_TXNCACHE_TXNS_PER_PAGE
 
-     pages, and the other blockhashes need 1 page each. */
+     pages, and the other blockhashes need 1 page each.  As above, the
+     txnhash index takes some entries as well, and up to one entry per
+     page may go unused. */
 
-  ulong result = max_live_slots-1UL+max_live_slots*(1UL+(max_txn_per_slot-1UL)/FD_TXNCACHE_TXNS_PER_PAGE);
+  ulong result = max_live_slots-1UL+max_live_slots*(1UL+(fd_txncache_max_entries( max_txn_per_slot )-1UL)/(FD_TXNCACHE_TXNS_PER_PAGE-1UL));
   if( FD_UNLIKELY( result>UINT_MAX ) ) return 0;
   return (uint)result;
 }
@@ -369,6 +472,7 @@ fd_txncache_new( void * shmem,
   txncache->constipated_slots_off = (ulong)_constipated_slots - (ulong)txncache;
 
   tc->lock->value           = 0;
+  tc->purge_seq             = 0UL;
   tc->root_slots_cnt        = 0UL;
   tc->constipated_slots_cnt = 0UL;
 
@@ -512,6 +616,12 @@ fd_txncache_purge_slot( fd_txncache_t * tc,
   ulong sum_distance = 0;
   ulong empty_entry_cnt = 0;
   ulong tombstone_entry_cnt = 0;
+
+  /* Make lockless queries that overlap with the purge retry under the
+     lock (see fd_txncache_query_batch). */
+  FD_VOLATILE( tc->purge_seq ) = tc->purge_seq+1UL;
+  FD_COMPILER_MFENCE();
+
   fd_txncache_private_blockcache_t * blockcache = fd_txncache_get_blockcache( tc );
   for( ulong i=0UL; i<tc->live_slots_max; i++ ) {
     if( FD_LIKELY( blockcache[ i ].max_slot==FD_TXNCACHE_EMPTY_ENTRY || blockcache[ i ].max_slot==FD_TXNCACHE_TOMBSTONE_ENTRY || (blockcache[ i ].max_slot)>slot ) ) {
@@ -543,6 +653,9 @@ fd_txncache_purge_slot( fd_txncache_t * tc,
     if( FD_LIKELY( slotcache[ i ].slot==FD_TXNCACHE_EMPTY_ENTRY || slotcache[ i ].slot==FD_TXNCACHE_TOMBSTONE_ENTRY || slotcache[ i ].slot>slot ) ) continue;
     fd_txncache_remove_slotcache_idx( tc, i );
   }
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( tc->purge_seq ) = tc->purge_seq+1UL;
 }
 
 /* fd_txncache_register_root_slot_private is a helper function that
@@ -648,8 +761,10 @@ fd_txncache_find_blockhash( fd_txncache_t const *               tc,
   ulong * probed_entries = fd_txncache_get_probed_entries_const( tc );
   ulong first_tombstone = ULONG_MAX;
 
+  ulong live_slots_mask = tc->live_slots_max-1UL; /* live_slots_max is a power of 2 */
+
   for( ulong i=0UL; i<tc->live_slots_max; i++ ) {
-    ulong blockcache_idx = (hash+i)%tc->live_slots_max;
+    ulong blockcache_idx = (hash+i) & live_slots_mask;
     fd_txncache_private_blockcache_t * blockcache = &tc_blockcache[ blockcache_idx ];
 
     if( FD_UNLIKELY( blockcache->max_slot==FD_TXNCACHE_EMPTY_ENTRY ) ) {
@@ -671,13 +786,13 @@ fd_txncache_find_blockhash( fd_txncache_t const *               tc,
     }
     FD_COMPILER_MFENCE(); /* Prevent reordering of the blockhash read to before the atomic lock
                              (highest_slot) has been fully released by the writer. */
-    if( FD_LIKELY( !memcmp( blockcache->blockhash, blockhash, 32UL ) ) ) {
+    if( FD_LIKELY( fd_txncache_private_blockhash_eq( blockcache->blockhash, blockhash ) ) ) {
       *out_blockcache = blockcache;
       if( is_insert ) {
         /* Undo the probed entry changes since we found the blockhash. */
-        for( ulong j=hash%tc->live_slots_max; j!=fd_ulong_min(first_tombstone, blockcache_idx); ) {
+        for( ulong j=hash & live_slots_mask; j!=fd_ulong_min(first_tombstone, blockcache_idx); ) {
           probed_entries[ j ]--;
-          j = (j+1)%tc->live_slots_max;
+          j = (j+1) & live_slots_mask;
         }
       }
       return FD_TXNCACHE_FIND_FOUND;
@@ -765,7 +880,8 @@ fd_txncache_ensure_blockcache( fd_txncache_t *                     tc,
     if( FD_LIKELY( FD_ATOMIC_CAS( &(*out_blockcache)->max_slot, FD_TXNCACHE_EMPTY_ENTRY, FD_TXNCACHE_TEMP_ENTRY ) ||
         FD_ATOMIC_CAS( &(*out_blockcache)->max_slot, FD_TXNCACHE_TOMBSTONE_ENTRY, FD_TXNCACHE_TEMP_ENTRY ) ) ) {
       memcpy( (*out_blockcache)->blockhash, blockhash, 32UL );
-      memset( (*out_blockcache)->heads, 0xFF, FD_TXNCACHE_BLOCKCACHE_MAP_CNT*sizeof(uint) );
+      memset( (*out_blockcache)->buckets, 0xFF, sizeof((*out_blockcache)->buckets) );
+      for( ulong i=0UL; i<FD_TXNCACHE_BLOCKCACHE_BUCKET_CNT; i++ ) (*out_blockcache)->buckets[ i ].cnt = 0U;
       (*out_blockcache)->pages_cnt      = 0;
       (*out_blockcache)->txnhash_offset = 0UL;
       memset( (*out_blockcache)->pages, 0xFF, tc->txnpages_per_blockhash_max*sizeof(uint) );
@@ -865,69 +981,203 @@ fd_txncache_ensure_txnpage( fd_txncache_t *                    tc,
   }
 }
 
-static int
-fd_txncache_insert_txn( fd_txncache_t *                        tc,
-                        fd_txncache_private_blockcache_t *     blockcache,
-                        fd_txncache_private_slotblockcache_t * slotblockcache,
-                        fd_txncache_private_txnpage_t *        txnpage,
-                        fd_txncache_insert_t const *           txn ) {
+/* fd_txncache_private_{txn,node} return the txn (overflow node) at
+   pool index idx. */
+
+FD_FN_PURE static inline fd_txncache_private_txn_t *
+fd_txncache_private_txn( fd_txncache_private_txnpage_t * txnpages,
+                         uint                            idx ) {
+  return txnpages[ idx/FD_TXNCACHE_TXNS_PER_PAGE ].txns[ idx%FD_TXNCACHE_TXNS_PER_PAGE ];
+}
+
+FD_FN_PURE static inline fd_txncache_private_node_t *
+fd_txncache_private_node( fd_txncache_private_txnpage_t * txnpages,
+                          uint                            idx ) {
+  return (fd_txncache_private_node_t *)fd_txncache_private_txn( txnpages, idx );
+}
+
+/* fd_txncache_private_node_prefetch prefetches an overflow node, which
+   can straddle two cache lines. */
+
+static inline void
+fd_txncache_private_node_prefetch( fd_txncache_private_node_t const * node ) {
+  __builtin_prefetch( node );
+  __builtin_prefetch( (uchar const *)node + sizeof(fd_txncache_private_node_t) - 1UL );
+}
+
+/* fd_txncache_alloc_entries reserves entry_cnt (1 or 2) consecutive
+   entries from the txnpages of blockcache, and returns the pool index
+   of the first one, or UINT_MAX if the blockcache is out of pages.  If
+   the current page has fewer than entry_cnt entries left, they are
+   given up and the next page is used. */
+
+static uint
+fd_txncache_alloc_entries( fd_txncache_t *                    tc,
+                           fd_txncache_private_blockcache_t * blockcache,
+                           ushort                             entry_cnt ) {
   fd_txncache_private_txnpage_t * txnpages = fd_txncache_get_txnpages( tc );
-  ulong txnpage_idx = (ulong)(txnpage - txnpages);
 
   for(;;) {
+    fd_txncache_private_txnpage_t * txnpage = fd_txncache_ensure_txnpage( tc, blockcache );
+    if( FD_UNLIKELY( !txnpage ) ) return UINT_MAX;
+
     ushort txnpage_free = txnpage->free;
-    if( FD_UNLIKELY( !txnpage_free ) ) return 0;
-    if( FD_UNLIKELY( FD_ATOMIC_CAS( &txnpage->free, txnpage_free, txnpage_free-1UL )!=txnpage_free ) ) continue;
-
-    ulong txn_idx = FD_TXNCACHE_TXNS_PER_PAGE-txnpage_free;
-    ulong txnhash_offset = blockcache->txnhash_offset;
-    ulong txnhash = FD_LOAD( ulong, txn->txnhash+txnhash_offset );
-    memcpy( txnpage->txns[ txn_idx ]->txnhash, txn->txnhash+txnhash_offset, 20UL );
-    txnpage->txns[ txn_idx ]->result = *txn->result;
-    txnpage->txns[ txn_idx ]->slot   = txn->slot;
-    FD_COMPILER_MFENCE();
+    if( FD_UNLIKELY( !txnpage_free ) ) continue;
+    if( FD_UNLIKELY( txnpage_free<entry_cnt ) ) {
+      FD_ATOMIC_CAS( &txnpage->free, txnpage_free, 0 );
+      continue;
+    }
+    if( FD_UNLIKELY( FD_ATOMIC_CAS( &txnpage->free, txnpage_free, txnpage_free-entry_cnt )!=txnpage_free ) ) continue;
 
-    for(;;) {
-      ulong txn_bucket = txnhash%FD_TXNCACHE_BLOCKCACHE_MAP_CNT;
-      uint head = blockcache->heads[ txn_bucket ];
-      txnpage->txns[ txn_idx ]->blockcache_next = head;
+    ulong txnpage_idx = (ulong)(txnpage - txnpages);
+    return (uint)(FD_TXNCACHE_TXNS_PER_PAGE*txnpage_idx + FD_TXNCACHE_TXNS_PER_PAGE-txnpage_free);
+  }
+}
+
+/* fd_txncache_index_insert adds the txn at pool index txn_idx, with the
+   (truncated) txnhash, to the txnhash index of blockcache.  The lane is
+   claimed with an atomic increment of the cnt of the bucket or node, and
+   the prefix is written before the txn index is published, so a
+   concurrent query either skips the lane or sees a complete entry.  The
+   inserter claiming the first lane past the end of a full bucket (or
+   node) allocates the next overflow node, other inserters wait for it
+   to be linked.  Inserters skip ahead to the last node of a chain as
+   hinted by its first node.  Returns 1 on success and 0 if the node
+   could not be allocated. */
+
+static int
+fd_txncache_index_insert( fd_txncache_t *                    tc,
+                          fd_txncache_private_blockcache_t * blockcache,
+                          uchar const *                      txnhash,
+                          uint                               txn_idx ) {
+  fd_txncache_private_txnpage_t * txnpages = fd_txncache_get_txnpages( tc );
+  fd_txncache_private_bucket_t *  bucket   = &blockcache->buckets[ FD_LOAD( ulong, txnhash ) & (FD_TXNCACHE_BLOCKCACHE_BUCKET_CNT-1UL) ];
+  uint                            prefix   = FD_LOAD( uint, txnhash+8UL );
+
+  fd_txncache_private_node_t * first = NULL;
+
+  uint * lane_prefix = bucket->prefix;
+  uint * lane_idx    = bucket->idx;
+  uint * cnt         = &bucket->cnt;
+  uint * next        = &bucket->next;
+  uint   lane_cnt    = FD_TXNCACHE_BUCKET_LANE_CNT;
+  for(;;) {
+    uint lane = FD_VOLATILE_CONST( *cnt );
+    if( FD_LIKELY( lane<=lane_cnt ) ) lane = FD_ATOMIC_FETCH_AND_ADD( cnt, 1U );
+    if( FD_LIKELY( lane<lane_cnt ) ) {
+      lane_prefix[ lane ] = prefix;
       FD_COMPILER_MFENCE();
-      if( FD_LIKELY( FD_ATOMIC_CAS( &blockcache->heads[ txn_bucket ], head, (uint)(FD_TXNCACHE_TXNS_PER_PAGE*txnpage_idx+txn_idx) )==head ) ) break;
-      FD_SPIN_PAUSE();
+      FD_VOLATILE( lane_idx[ lane ] ) = txn_idx;
+      return 1;
     }
 
-    for(;;) {
-      ulong txn_bucket = txnhash%FD_TXNCACHE_SLOTCACHE_MAP_CNT;
-      uint head = slotblockcache->heads[ txn_bucket ];
-      txnpage->txns[ txn_idx ]->slotblockcache_next = head;
+    uint node_idx;
+    if( lane==lane_cnt ) {
+      node_idx = fd_txncache_alloc_entries( tc, blockcache, 2 );
+      if( FD_LIKELY( node_idx!=UINT_MAX ) ) {
+        fd_txncache_private_node_t * node = fd_txncache_private_node( txnpages, node_idx );
+        memset( node, 0xFF, sizeof(fd_txncache_private_node_t) );
+        node->cnt = 0U;
+      } else {
+        node_idx = FD_TXNCACHE_NODE_FAILED;
+      }
       FD_COMPILER_MFENCE();
-      if( FD_LIKELY( FD_ATOMIC_CAS( &slotblockcache->heads[ txn_bucket ], head, (uint)(FD_TXNCACHE_TXNS_PER_PAGE*txnpage_idx+txn_idx) )==head ) ) break;
-      FD_SPIN_PAUSE();
+      FD_VOLATILE( *next ) = node_idx;
+      if( FD_LIKELY( first && node_idx!=FD_TXNCACHE_NODE_FAILED ) ) FD_VOLATILE( first->last ) = node_idx;
+    } else {
+      node_idx = FD_VOLATILE_CONST( *next );
+      while( FD_UNLIKELY( node_idx==UINT_MAX ) ) {
+        FD_SPIN_PAUSE();
+        node_idx = FD_VOLATILE_CONST( *next );
+      }
     }
+    if( FD_UNLIKELY( node_idx==FD_TXNCACHE_NODE_FAILED ) ) return 0;
 
-    for(;;) {
-      ulong max_slot = blockcache->max_slot;
-
-      if( FD_UNLIKELY( txn->slot<=max_slot && max_slot != ULONG_MAX-3UL) ) break;
-      if( FD_LIKELY( FD_ATOMIC_CAS( &blockcache->max_slot, max_slot, txn->slot )==max_slot ) ) break;
-      FD_SPIN_PAUSE();
+    fd_txncache_private_node_t * node = fd_txncache_private_node( txnpages, node_idx );
+    if( FD_UNLIKELY( !first ) ) {
+      first = node;
+      uint last = FD_VOLATILE_CONST( first->last );
+      if( FD_LIKELY( last<FD_TXNCACHE_NODE_FAILED ) ) node = fd_txncache_private_node( txnpages, last );
     }
-    return 1;
+    lane_prefix = node->prefix;
+    lane_idx    = node->idx;
+    cnt         = &node->cnt;
+    next        = &node->next;
+    lane_cnt    = FD_TXNCACHE_NODE_LANE_CNT;
   }
 }
 
+static int
+fd_txncache_insert_txn( fd_txncache_t *                        tc,
+                        fd_txncache_private_blockcache_t *     blockcache,
+                        fd_txncache_private_slotblockcache_t * slotblockcache,
+                        fd_txncache_insert_t const *           txn ) {
+  fd_txncache_private_txnpage_t * txnpages = fd_txncache_get_txnpages( tc );
+
+  uint txn_idx = fd_txncache_alloc_entries( tc, blockcache, 1 );
+  if( FD_UNLIKELY( txn_idx==UINT_MAX ) ) return 0;
+
+  ulong txnhash_offset = blockcache->txnhash_offset;
+  ulong txnhash = FD_LOAD( ulong, txn->txnhash+txnhash_offset );
+  fd_txncache_private_txn_t * entry = fd_txncache_private_txn( txnpages, txn_idx );
+  memcpy( entry->txnhash, txn->txnhash+txnhash_offset, 20UL );
+  entry->result = *txn->result;
+  entry->slot   = txn->slot;
+  FD_COMPILER_MFENCE();
+
+  if( FD_UNLIKELY( !fd_txncache_index_insert( tc, blockcache, txn->txnhash+txnhash_offset, txn_idx ) ) ) return 0;
+
+  for(;;) {
+    ulong txn_bucket = txnhash%FD_TXNCACHE_SLOTCACHE_MAP_CNT;
+    uint head = slotblockcache->heads[ txn_bucket ];
+    entry->slotblockcache_next = head;
+    FD_COMPILER_MFENCE();
+    if( FD_LIKELY( FD_ATOMIC_CAS( &slotblockcache->heads[ txn_bucket ], head, txn_idx )==head ) ) break;
+    FD_SPIN_PAUSE();
+  }
+
+  for(;;) {
+    ulong max_slot = blockcache->max_slot;
+
+    if( FD_UNLIKELY( txn->slot<=max_slot && max_slot != ULONG_MAX-3UL) ) break;
+    if( FD_LIKELY( FD_ATOMIC_CAS( &blockcache->max_slot, max_slot, txn->slot )==max_slot ) ) break;
+    FD_SPIN_PAUSE();
+  }
+  return 1;
+}
+
 int
 fd_txncache_insert_batch( fd_txncache_t *              tc,
                           fd_txncache_insert_t const * txns,
                           ulong                        txns_cnt ) {
   fd_rwlock_read( tc->lock );
 
+  /* Inserts are processed in groups, resolving the blockcaches and
+     prefetching the buckets of a group before inserting, so that the
+     bucket and first overflow node misses of the group overlap. */
+
+  fd_txncache_private_txnpage_t *    txnpages    = fd_txncache_get_txnpages( tc );
+  fd_txncache_private_blockcache_t * group       [ FD_TXNCACHE_QUERY_PIPELINE ];
+  fd_txncache_private_bucket_t *     group_bucket[ FD_TXNCACHE_QUERY_PIPELINE ];
   for( ulong i=0UL; i<txns_cnt; i++ ) {
-    fd_txncache_private_blockcache_t * blockcache;
-    if( FD_UNLIKELY( !fd_txncache_ensure_blockcache( tc, txns[ i ].blockhash, &blockcache ) ) ) {
-      FD_LOG_WARNING(( "no blockcache found" ));
-      goto unlock_fail;
+    ulong j = i % FD_TXNCACHE_QUERY_PIPELINE;
+    if( FD_UNLIKELY( !j ) ) {
+      ulong group_cnt = fd_ulong_min( txns_cnt-i, FD_TXNCACHE_QUERY_PIPELINE );
+      for( ulong k=0UL; k<group_cnt; k++ ) {
+        if( FD_UNLIKELY( !fd_txncache_ensure_blockcache( tc, txns[ i+k ].blockhash, &group[ k ] ) ) ) {
+          FD_LOG_WARNING(( "no blockcache found" ));
+          goto unlock_fail;
+        }
+        uchar const * txnhash = txns[ i+k ].txnhash + group[ k ]->txnhash_offset;
+        group_bucket[ k ] = &group[ k ]->buckets[ FD_LOAD( ulong, txnhash ) & (FD_TXNCACHE_BLOCKCACHE_BUCKET_CNT-1UL) ];
+        __builtin_prefetch( group_bucket[ k ] );
+      }
+      for( ulong k=0UL; k<group_cnt; k++ ) {
+        uint next = FD_VOLATILE_CONST( group_bucket[ k ]->next );
+        if( FD_UNLIKELY( next<FD_TXNCACHE_NODE_FAILED ) ) fd_txncache_private_node_prefetch( fd_txncache_private_node( txnpages, next ) );
+      }
     }
+    fd_txncache_private_blockcache_t * blockcache = group[ j ];
 
     fd_txncache_private_slotcache_t * slotcache;
     if( FD_UNLIKELY( !fd_txncache_ensure_slotcache( tc, txns[ i ].slot, &slotcache ) ) ) {
@@ -941,16 +1191,9 @@ fd_txncache_insert_batch( fd_txncache_t *              tc,
       goto unlock_fail;
     }
 
-    for(;;) {
-      fd_txncache_private_txnpage_t * txnpage = fd_txncache_ensure_txnpage( tc, blockcache );
-      if( FD_UNLIKELY( !txnpage ) ) {
-        goto unlock_fail;
-        FD_LOG_WARNING(( "no txnpage found" ));
-      }
-
-      int success = fd_txncache_insert_txn( tc, blockcache, slotblockcache, txnpage, &txns[ i ] );
-      if( FD_LIKELY( success ) ) break;
-      FD_SPIN_PAUSE();
+    if( FD_UNLIKELY( !fd_txncache_insert_txn( tc, blockcache, slotblockcache, &txns[ i ] ) ) ) {
+      FD_LOG_WARNING(( "no txnpage found" ));
+      goto unlock_fail;
     }
   }
 
@@ -962,6 +1205,182 @@ unlock_fail:
   return 0;
 }
 
+/* fd_txncache_private_{bucket,node}_match return a bit mask of the
+   claimed lanes of a bucket (overflow node) whose prefix equals
+   prefix.  The 8th lane of the bucket compare is its cnt. */
+
+static inline uint
+fd_txncache_private_bucket_match( fd_txncache_private_bucket_t const * bucket,
+                                  uint                                 prefix ) {
+  uint claimed = fd_uint_min( FD_VOLATILE_CONST( bucket->cnt ), FD_TXNCACHE_BUCKET_LANE_CNT );
+  FD_COMPILER_MFENCE();
+# if FD_HAS_AVX
+  uint mask = (uint)wc_pack( wu_eq( wu_ld( bucket->prefix ), wu_bcast( prefix ) ) );
+# else
+  uint mask = 0U;
+  for( uint i=0U; i<FD_TXNCACHE_BUCKET_LANE_CNT; i++ ) mask |= (uint)(bucket->prefix[ i ]==prefix)<<i;
+# endif
+  return mask & ((1U<<claimed)-1U);
+}
+
+static inline uint
+fd_txncache_private_node_match( fd_txncache_private_node_t const * node,
+                                uint                               prefix ) {
+  uint claimed = fd_uint_min( FD_VOLATILE_CONST( node->cnt ), FD_TXNCACHE_NODE_LANE_CNT );
+  FD_COMPILER_MFENCE();
+# if FD_HAS_AVX
+  uint mask = (uint)wc_pack( wu_eq( wu_ldu( node->prefix ), wu_bcast( prefix ) ) );
+# else
+  uint mask = 0U;
+  for( uint i=0U; i<FD_TXNCACHE_NODE_LANE_CNT; i++ ) mask |= (uint)(node->prefix[ i ]==prefix)<<i;
+# endif
+  return mask & ((1U<<claimed)-1U);
+}
+
+/* fd_txncache_private_match_txns checks the lanes in mask of lane_idx
+   (the txn indices of a bucket or overflow node).  Returns 1 if one of
+   them is txnhash and passes query_func, 0 if none does, and -1 if a
+   txn index is out of bounds (which can only be observed when a purge
+   runs concurrently). */
+
+static inline int
+fd_txncache_private_match_txns( fd_txncache_private_txnpage_t * txnpages,
+                                uint const *                    lane_idx,
+                                uint                            mask,
+                                uchar const *                   txnhash,
+                                ulong                           txn_idx_max,
+                                void *                          query_func_ctx,
+                                int ( * query_func )( ulong slot, void * ctx ) ) {
+  for( ; mask; mask=fd_uint_pop_lsb( mask ) ) {
+    uint idx = FD_VOLATILE_CONST( lane_idx[ fd_uint_find_lsb( mask ) ] );
+    if( FD_UNLIKELY( idx==UINT_MAX ) ) continue; /* lane claimed but not published yet */
+    if( FD_UNLIKELY( idx>=txn_idx_max ) ) return -1;
+    fd_txncache_private_txn_t * txn = fd_txncache_private_txn( txnpages, idx );
+    if( FD_LIKELY( fd_txncache_private_txnhash_eq( txnhash, txn->txnhash ) ) ) {
+      if( FD_LIKELY( !query_func || query_func( txn->slot, query_func_ctx ) ) ) return 1;
+    }
+  }
+  return 0;
+}
+
+/* fd_txncache_private_memo_t remembers the blockcache of the last
+   blockhash resolved by a query batch.  Transactions in a batch
+   typically reference a handful of recent blockhashes, so the
+   blockcache map is only probed when the blockhash changes.  The memo
+   is valid as long as purge_seq is unchanged. */
+
+struct fd_txncache_private_memo {
+  uchar const *                      blockhash;
+  fd_txncache_private_blockcache_t * blockcache;
+  ulong                              purge_seq;
+};
+
+typedef struct fd_txncache_private_memo fd_txncache_private_memo_t;
+
+/* fd_txncache_query_group runs the cnt (at most
+   FD_TXNCACHE_QUERY_PIPELINE) queries at query and writes their results
+   to out.  This does not take the lock.  Returns 1 on success and 0 if
+   it observed an inconsistent index, in which case out is garbage.  If
+   purge_seq was even and did not change while this ran, it succeeded
+   and the results are correct. */
+
+static int
+fd_txncache_query_group( fd_txncache_t *              tc,
+                         fd_txncache_query_t const *  query,
+                         ulong                        cnt,
+                         fd_txncache_private_memo_t * memo,
+                         void *                       query_func_ctx,
+                         int ( * query_func )( ulong slot, void * ctx ),
+                         int *                        out ) {
+  fd_txncache_private_txnpage_t * txnpages    = fd_txncache_get_txnpages( tc );
+  ulong                           txn_idx_max = (ulong)tc->txnpages_max*FD_TXNCACHE_TXNS_PER_PAGE;
+  ulong                           hop_max     = (ulong)tc->txnpages_per_blockhash_max*FD_TXNCACHE_TXNS_PER_PAGE/2UL;
+
+  fd_txncache_private_blockcache_t * blockcache[ FD_TXNCACHE_QUERY_PIPELINE ];
+  fd_txncache_private_bucket_t *     bucket    [ FD_TXNCACHE_QUERY_PIPELINE ];
+  uint                               prefix    [ FD_TXNCACHE_QUERY_PIPELINE ];
+  uint                               mask      [ FD_TXNCACHE_QUERY_PIPELINE ];
+
+  /* Stage 1: resolve the blockcache of each query and prefetch the
+     bucket it hashes to. */
+
+  for( ulong j=0UL; j<cnt; j++ ) {
+    uchar const * blockhash = query[ j ].blockhash;
+    if( FD_UNLIKELY( !memo->blockhash || (blockhash!=memo->blockhash && !fd_txncache_private_blockhash_eq( blockhash, memo->blockhash )) ) ) {
+      fd_txncache_private_blockcache_t * found;
+      memo->blockhash  = blockhash;
+      memo->blockcache = fd_txncache_find_blockhash( tc, blockhash, 0, &found )==FD_TXNCACHE_FIND_FOUND ? found : NULL;
+    }
+
+    blockcache[ j ] = memo->blockcache;
+    if( FD_UNLIKELY( !memo->blockcache ) ) continue;
+
+    uchar const * txnhash = query[ j ].txnhash + memo->blockcache->txnhash_offset;
+    bucket[ j ] = &memo->blockcache->buckets[ FD_LOAD( ulong, txnhash ) & (FD_TXNCACHE_BLOCKCACHE_BUCKET_CNT-1UL) ];
+    prefix[ j ] = FD_LOAD( uint, txnhash+8UL );
+    __builtin_prefetch( bucket[ j ] );
+  }
+
+  /* Stage 2: compare the prefixes of each bucket, and prefetch the
+     first matching txn and the first overflow node. */
+
+  for( ulong j=0UL; j<cnt; j++ ) {
+    mask[ j ] = 0U;
+    if( FD_UNLIKELY( !blockcache[ j ] ) ) continue;
+
+    mask[ j ] = fd_txncache_private_bucket_match( bucket[ j ], prefix[ j ] );
+    if( FD_LIKELY( mask[ j ] ) ) {
+      uint idx = FD_VOLATILE_CONST( bucket[ j ]->idx[ fd_uint_find_lsb( mask[ j ] ) ] );
+      if( FD_LIKELY( idx<txn_idx_max ) ) __builtin_prefetch( fd_txncache_private_txn( txnpages, idx ) );
+    }
+    uint next = FD_VOLATILE_CONST( bucket[ j ]->next );
+    if( FD_UNLIKELY( next<txn_idx_max ) ) fd_txncache_private_node_prefetch( fd_txncache_private_node( txnpages, next ) );
+  }
+
+  /* Stage 3: verify the matches of the buckets. */
+
+  uint next[ FD_TXNCACHE_QUERY_PIPELINE ];
+  for( ulong j=0UL; j<cnt; j++ ) {
+    out [ j ] = 0;
+    next[ j ] = UINT_MAX;
+    if( FD_UNLIKELY( !blockcache[ j ] ) ) continue;
+
+    uchar const * txnhash = query[ j ].txnhash + blockcache[ j ]->txnhash_offset;
+    int found = fd_txncache_private_match_txns( txnpages, bucket[ j ]->idx, mask[ j ], txnhash, txn_idx_max, query_func_ctx, query_func );
+    if( FD_UNLIKELY( found<0 ) ) return 0;
+    out [ j ] = found;
+    next[ j ] = found ? UINT_MAX : FD_VOLATILE_CONST( bucket[ j ]->next );
+  }
+
+  /* Stage 4: walk the overflow nodes of the queries that did not match
+     yet in lockstep, one node of each query per round, so the misses
+     of the queries overlap here as well. */
+
+  for( ulong hop=0UL; ; hop++ ) {
+    int active = 0;
+    for( ulong j=0UL; j<cnt; j++ ) {
+      if( FD_LIKELY( next[ j ]>=FD_TXNCACHE_NODE_FAILED ) ) continue;
+      if( FD_UNLIKELY( next[ j ]>=txn_idx_max || hop>=hop_max ) ) return 0;
+      active = 1;
+
+      fd_txncache_private_node_t * node = fd_txncache_private_node( txnpages, next[ j ] );
+      next[ j ] = FD_VOLATILE_CONST( node->next );
+      if( FD_LIKELY( next[ j ]<txn_idx_max ) ) fd_txncache_private_node_prefetch( fd_txncache_private_node( txnpages, next[ j ] ) );
+
+      uchar const * txnhash   = query[ j ].txnhash + blockcache[ j ]->txnhash_offset;
+      uint          node_mask = fd_txncache_private_node_match( node, prefix[ j ] );
+      int found = fd_txncache_private_match_txns( txnpages, node->idx, node_mask, txnhash, txn_idx_max, query_func_ctx, query_func );
+      if( FD_UNLIKELY( found<0 ) ) return 0;
+      if( found ) {
+        out [ j ] = 1;
+        next[ j ] = UINT_MAX;
+      }
+    }
+    if( !active ) break;
+  }
+  return 1;
+}
+
 void
 fd_txncache_query_batch( fd_txncache_t *             tc,
                          fd_txncache_query_t const * queries,
@@ -969,33 +1388,35 @@ fd_txncache_query_batch( fd_txncache_t *             tc,
                          void *                      query_func_ctx,
                          int ( * query_func )( ulong slot, void * ctx ),
                          int *                       out_results ) {
-  fd_rwlock_read( tc->lock );
-  fd_txncache_private_txnpage_t * txnpages = fd_txncache_get_txnpages( tc );
-  for( ulong i=0UL; i<queries_cnt; i++ ) {
-    out_results[ i ] = 0;
 
-    fd_txncache_query_t const * query = &queries[ i ];
-    fd_txncache_private_blockcache_t * blockcache;
-    int result = fd_txncache_find_blockhash( tc, query->blockhash, 0, &blockcache );
+  /* Queries run without the lock.  Inserts never move or free entries,
+     only a purge (under the write lock) does, so a group of queries
+     that did not overlap with a purge saw a consistent index.  If it
+     did, the group is redone under the read lock.  Memory freed by a
+     purge stays mapped, and garbage indices are bounds checked, so the
+     lockless attempt is safe even then. */
 
-    if( FD_UNLIKELY( result!=FD_TXNCACHE_FIND_FOUND ) ) {
-      continue;
-    }
+  fd_txncache_private_memo_t memo = { .blockhash = NULL, .blockcache = NULL, .purge_seq = ULONG_MAX };
 
-    ulong txnhash_offset = blockcache->txnhash_offset;
-    ulong head_hash = FD_LOAD( ulong, query->txnhash+txnhash_offset ) % FD_TXNCACHE_BLOCKCACHE_MAP_CNT;
-    for( uint head=blockcache->heads[ head_hash ]; head!=UINT_MAX; head=txnpages[ head/FD_TXNCACHE_TXNS_PER_PAGE ].txns[ head%FD_TXNCACHE_TXNS_PER_PAGE ]->blockcache_next ) {
-      fd_txncache_private_txn_t * txn = txnpages[ head/FD_TXNCACHE_TXNS_PER_PAGE ].txns[ head%FD_TXNCACHE_TXNS_PER_PAGE ];
-      if( FD_LIKELY( !memcmp( query->txnhash+txnhash_offset, txn->txnhash, 20UL ) ) ) {
-        if( FD_LIKELY( !query_func || query_func( txn->slot, query_func_ctx ) ) ) {
-          out_results[ i ] = 1;
-          break;
-        }
-      }
+  for( ulong i0=0UL; i0<queries_cnt; i0+=FD_TXNCACHE_QUERY_PIPELINE ) {
+    fd_txncache_query_t const * query = queries     + i0;
+    int *                       out   = out_results + i0;
+    ulong                       cnt   = fd_ulong_min( queries_cnt-i0, FD_TXNCACHE_QUERY_PIPELINE );
+
+    ulong purge_seq = FD_VOLATILE_CONST( tc->purge_seq );
+    FD_COMPILER_MFENCE();
+    if( FD_LIKELY( !(purge_seq&1UL) ) ) {
+      if( FD_UNLIKELY( memo.purge_seq!=purge_seq ) ) memo = (fd_txncache_private_memo_t){ .blockhash = NULL, .blockcache = NULL, .purge_seq = purge_seq };
+      int ok = fd_txncache_query_group( tc, query, cnt, &memo, query_func_ctx, query_func, out );
+      FD_COMPILER_MFENCE();
+      if( FD_LIKELY( ok && FD_VOLATILE_CONST( tc->purge_seq )==purge_seq ) ) continue;
     }
-  }
 
-  fd_rwlock_unread( tc->lock );
+    fd_rwlock_read( tc->lock );
+    memo = (fd_txncache_private_memo_t){ .blockhash = NULL, .blockcache = NULL, .purge_seq = tc->purge_seq };
+    fd_txncache_query_group( tc, query, cnt, &memo, query_func_ctx, query_func, out );
+    fd_rwlock_unread( tc->lock );
+  }
 }
 
 int
@@ -1161,6 +1582,220 @@ fd_txncache_get_entries( fd_txncache_t *         tc,
 
 }
 
+/* FD_TXNCACHE_WRITE_SLOT_DELTAS_CHUNK is the max number of statuses
+   fd_txncache_write_slot_deltas visits per hold of the lock. */
+
+#define FD_TXNCACHE_WRITE_SLOT_DELTAS_CHUNK (4096UL)
+
+/* fd_txncache_private_writer_t is the state of
+   fd_txncache_write_slot_deltas.  Encoded items are appended to buf.
+   The read lock is held while walking the status cache, and released
+   whenever buf is handed to write, or after visiting a chunk of
+   statuses.  purge_seq and root_slots_cnt detect changes to the rooted
+   slots while the lock was not held. */
+
+struct fd_txncache_private_writer {
+  fd_txncache_t * tc;
+  int             locked;
+  ulong           purge_seq;
+  ulong           root_slots_cnt;
+  ulong           visit_cnt;
+
+  uchar *         buf;
+  ulong           buf_sz;
+  ulong           buf_used;
+  void *          ctx;
+  int          ( * write )( uchar const * data, ulong data_sz, void * ctx );
+};
+
+typedef struct fd_txncache_private_writer fd_txncache_private_writer_t;
+
+static void
+fd_txncache_private_writer_lock( fd_txncache_private_writer_t * w ) {
+  fd_rwlock_read( w->tc->lock );
+  w->locked    = 1;
+  w->visit_cnt = 0UL;
+}
+
+static void
+fd_txncache_private_writer_unlock( fd_txncache_private_writer_t * w ) {
+  fd_rwlock_unread( w->tc->lock );
+  w->locked = 0;
+}
+
+static int
+fd_txncache_private_writer_flush( fd_txncache_private_writer_t * w ) {
+  if( FD_UNLIKELY( !w->buf_used ) ) return 0;
+  int err = w->write( w->buf, w->buf_used, w->ctx );
+  w->buf_used = 0UL;
+  return err;
+}
+
+/* fd_txncache_private_writer_yield releases the lock, writes out what
+   is buffered, and takes the lock again.  Fails with -1 if the rooted
+   slots changed in the meantime, as pointers into the status cache held
+   by the caller may then no longer be valid. */
+
+static int
+fd_txncache_private_writer_yield( fd_txncache_private_writer_t * w ) {
+  fd_txncache_private_writer_unlock( w );
+  int err = fd_txncache_private_writer_flush( w );
+  if( FD_UNLIKELY( err ) ) return err;
+
+  fd_txncache_private_writer_lock( w );
+  if( FD_UNLIKELY( w->tc->purge_seq!=w->purge_seq || w->tc->root_slots_cnt!=w->root_slots_cnt ) ) {
+    FD_LOG_WARNING(( "rooted slots changed while writing slot deltas" ));
+    return -1;
+  }
+  return 0;
+}
+
+/* fd_txncache_private_writer_visit is called for every status visited,
+   and yields the lock after every chunk of statuses. */
+
+static inline int
+fd_txncache_private_writer_visit( fd_txncache_private_writer_t * w ) {
+  if( FD_LIKELY( ++w->visit_cnt<FD_TXNCACHE_WRITE_SLOT_DELTAS_CHUNK ) ) return 0;
+  return fd_txncache_private_writer_yield( w );
+}
+
+/* fd_txncache_private_writer_prepare ensures there are at least sz
+   bytes of space in the buffer, yielding to write it out if not, and
+   returns an encode ctx covering the free space.  The caller commits
+   what was encoded with fd_txncache_private_writer_publish. */
+
+static int
+fd_txncache_private_writer_prepare( fd_txncache_private_writer_t * w,
+                                    ulong                          sz,
+                                    fd_bincode_encode_ctx_t *      encode ) {
+  if( FD_UNLIKELY( w->buf_sz-w->buf_used<sz ) ) {
+    int err = fd_txncache_private_writer_yield( w );
+    if( FD_UNLIKELY( err ) ) return err;
+  }
+  encode->data    = w->buf + w->buf_used;
+  encode->dataend = w->buf + w->buf_sz;
+  return 0;
+}
+
+static void
+fd_txncache_private_writer_publish( fd_txncache_private_writer_t * w,
+                                    fd_bincode_encode_ctx_t const * encode ) {
+  w->buf_used = (ulong)((uchar *)encode->data - w->buf);
+}
+
+int
+fd_txncache_write_slot_deltas( fd_txncache_t * tc,
+                               uchar *         buf,
+                               ulong           buf_sz,
+                               void *          ctx,
+                               int ( * write )( uchar const * data, ulong data_sz, void * ctx ) ) {
+  if( FD_UNLIKELY( !buf || buf_sz<FD_TXNCACHE_WRITE_SLOT_DELTAS_BUF_MIN ) ) {
+    FD_LOG_WARNING(( "bad buf" ));
+    return -1;
+  }
+  if( FD_UNLIKELY( !write ) ) {
+    FD_LOG_WARNING(( "NULL write" ));
+    return -1;
+  }
+
+  fd_txncache_private_writer_t w[1] = {{ .tc = tc, .buf = buf, .buf_sz = buf_sz, .ctx = ctx, .write = write }};
+  fd_txncache_private_writer_lock( w );
+  w->purge_seq      = tc->purge_seq;
+  w->root_slots_cnt = tc->root_slots_cnt;
+
+  fd_txncache_private_txnpage_t * txnpages   = fd_txncache_get_txnpages( tc );
+  ulong                         * root_slots = fd_txncache_get_root_slots( tc );
+
+  /* This produces exactly the bincode encoding of the
+     fd_bank_slot_deltas_t given by fd_txncache_get_entries.  The
+     number of status pairs of a slot, and of statuses of a pair, are
+     counted right before they are encoded. */
+
+  fd_bincode_encode_ctx_t encode[1];
+  int                     err;
+
+# define ENCODE( sz, expr ) do {                                              \
+    err = fd_txncache_private_writer_prepare( w, (sz), encode );              \
+    if( FD_UNLIKELY( err ) ) goto fail;                                       \
+    if( FD_UNLIKELY( (expr) ) ) { err = -1; goto fail; }                      \
+    fd_txncache_private_writer_publish( w, encode );                          \
+  } while(0)
+
+  ulong slot_cnt = w->root_slots_cnt;
+  ENCODE( 8UL, fd_bincode_uint64_encode( slot_cnt, encode ) );
+
+  for( ulong i=0UL; i<slot_cnt; i++ ) {
+    ulong slot = root_slots[ i ];
+
+    fd_txncache_private_slotcache_t * slotcache;
+    if( FD_UNLIKELY( FD_TXNCACHE_FIND_FOUND!=fd_txncache_find_slot( tc, slot, 0, &slotcache ) ) ) slotcache = NULL;
+
+    ulong pair_cnt = 0UL;
+    for( ulong j=0UL; slotcache && j<FD_TXNCACHE_DEFAULT_MAX_ROOTED_SLOTS; j++ ) {
+      pair_cnt += slotcache->blockcache[ j ].txnhash_offset<ULONG_MAX-1UL;
+    }
+
+    ENCODE( 17UL, fd_bincode_uint64_encode( slot,     encode ) ||
+                  fd_bincode_bool_encode  ( 1,        encode ) ||
+                  fd_bincode_uint64_encode( pair_cnt, encode ) );
+
+    for( ulong j=0UL; slotcache && j<FD_TXNCACHE_DEFAULT_MAX_ROOTED_SLOTS; j++ ) {
+      fd_txncache_private_slotblockcache_t * slotblockcache = &slotcache->blockcache[ j ];
+      if( FD_UNLIKELY( slotblockcache->txnhash_offset>=ULONG_MAX-1UL ) ) continue;
+
+      ulong status_cnt = 0UL;
+      for( ulong k=0UL; k<FD_TXNCACHE_SLOTCACHE_MAP_CNT; k++ ) {
+        for( uint head=slotblockcache->heads[ k ]; head!=UINT_MAX; head=fd_txncache_private_txn( txnpages, head )->slotblockcache_next ) {
+          status_cnt++;
+          err = fd_txncache_private_writer_visit( w );
+          if( FD_UNLIKELY( err ) ) goto fail;
+        }
+      }
+
+      ENCODE( 48UL, fd_bincode_bytes_encode ( slotblockcache->blockhash, 32UL, encode ) ||
+                    fd_bincode_uint64_encode( slotblockcache->txnhash_offset, encode ) ||
+                    fd_bincode_uint64_encode( status_cnt,                     encode ) );
+
+      /* Statuses are not expected to be inserted into rooted slots, but
+         if they were, fail rather than encode more or fewer statuses
+         than declared above. */
+
+      ulong written_cnt = 0UL;
+      for( ulong k=0UL; k<FD_TXNCACHE_SLOTCACHE_MAP_CNT; k++ ) {
+        for( uint head=slotblockcache->heads[ k ]; head!=UINT_MAX; head=fd_txncache_private_txn( txnpages, head )->slotblockcache_next ) {
+          if( FD_UNLIKELY( written_cnt++==status_cnt ) ) goto fail_changed;
+
+          fd_txncache_private_txn_t const * txn = fd_txncache_private_txn( txnpages, head );
+          fd_cache_status_t cache_status[1];
+          fd_memset( cache_status, 0, sizeof(fd_cache_status_t) );
+          fd_memcpy( cache_status->key_slice, txn->txnhash, 20UL );
+          cache_status->result.discriminant = txn->result;
+          ENCODE( fd_cache_status_size( cache_status ), fd_cache_status_encode( cache_status, encode ) );
+
+          err = fd_txncache_private_writer_visit( w );
+          if( FD_UNLIKELY( err ) ) goto fail;
+        }
+      }
+      if( FD_UNLIKELY( written_cnt!=status_cnt ) ) goto fail_changed;
+    }
+  }
+
+# undef ENCODE
+
+  fd_txncache_private_writer_unlock( w );
+  err = fd_txncache_private_writer_flush( w );
+  if( FD_UNLIKELY( err ) ) goto fail;
+  return 0;
+
+fail_changed:
+  FD_LOG_WARNING(( "statuses inserted into a rooted slot while writing slot deltas" ));
+  err = -1;
+fail:
+  if( FD_LIKELY( w->locked ) ) fd_txncache_private_writer_unlock( w );
+  FD_LOG_WARNING(( "failed to write slot deltas (%d)", err ));
+  return err;
+}
+
 int
 fd_txncache_get_is_constipated( fd_txncache_t * tc ) {
   fd_rwlock_read( tc->lock );
@@ -23,8 +23,10 @@
 
    Both of these operations are concurrent and lockless, assuming there
    are no other (non-insert/query) operations occuring on the txn cache.
-   Most other operations lock the entire structure and will prevent both
-   insertion and query from proceeding.
+   Most other operations lock the entire structure and will prevent
+   insertion from proceeding.  Queries do not take the lock at all, and
+   only fall back to waiting on it when they overlap with a purge of old
+   transactions.
 
    The txn cache is both CPU and memory sensitive.  A transaction result
    is 1 byte, and the stored transaction hashes are 20 bytes, so
@@ -43,8 +45,13 @@
          hash_map<blockhash, hash_map<txnhash, vec<(slot, status)>>>
 
        The top level hash_map is a probed hash map, and the txnhash map
-       is a chained hash map, where the items come from a pool of pages
-       of transactions.  We use pages of transactions to support fast
+       is a bucketized hash map: each bucket is a cache line holding the
+       4 byte prefixes of up to 7 txnhashes contiguously, next to the
+       indices of their transactions, and continues in a chain of
+       overflow nodes once full.  A query compares all prefixes of a
+       bucket at once and only reads the transactions that matched.
+       The transactions (and the overflow nodes) come from a pool of
+       pages of transactions.  We use pages of transactions to support fast
        removal of a blockhash from the top level map, we need to return
        at most 4,800 pages back to the pool rather than 78,643,200
        individual transactions.
@@ -56,8 +63,8 @@
        amortizes to zero.  Creating a blockhash happens once per
        blockhash, so also amortizes to zero, the only operation we care
        about is then the simple insert case with an unfull transaction
-       page into an existing blockhash.  This can be done with two
-       compare-and-swaps,
+       page into an existing blockhash.  This can be done with a
+       compare-and-swap and a fetch-and-add,
 
          // 1. Find the blockhash in the probed hash map.
 
@@ -71,8 +78,10 @@
          // 3. Write the transaction into the page and the map
 
             page.txns[ idx ] = txn;
-            page.txns[ idx ].next = by_blockhash.txns[ txnhash ].idx;
-            by_blockhash.txns[ txnhash ].head.compare_and_swap( current, idx );
+            let bucket = by_blockhash.buckets[ txnhash ];
+            let lane = bucket.cnt.fetch_add( 1 );
+            bucket.prefix[ lane ] = txnhash.prefix;
+            bucket.idx[ lane ] = idx;
 
        Removal of a blockhash from this structure is simple because it
        does not need to be concurrent (the caller will only remove
@@ -139,7 +148,7 @@
 
 #define FD_TXNCACHE_ALIGN (128UL)
 
-#define FD_TXNCACHE_MAGIC (0xF17EDA2CE5CAC4E0) /* FIREDANCE SCACHE V0 */
+#define FD_TXNCACHE_MAGIC (0xF17EDA2CE5CAC4E1) /* FIREDANCE SCACHE V1 */
 
 /* The duration of history to keep around in the txn cache before aging
    it out.  This must be at least 150, otherwise we could forget about
@@ -399,8 +408,17 @@ fd_txncache_insert_batch( fd_txncache_t *              tc,
    filled with 0 or 1 if the transaction is not present or present
    respectively.
 
+   Queries within a batch are pipelined (the memory accesses of several
+   queries are issued before any of them is waited on) and consecutive
+   queries against the same blockhash only look the blockhash up once,
+   so callers with many transactions to check should prefer passing
+   them in a single call over calling this once per transaction.
+
    This is a cheap, high performance, concurrent operation and can occur
-   at the same time as queries and arbitrary other insertions. */
+   at the same time as queries and arbitrary other insertions.  It does
+   not take the lock, except to redo a group of queries that overlapped
+   with a purge (see fd_txncache_register_root_slot).  query_func may
+   thus also be called with stale slots, whose results are discarded. */
 
 void
 fd_txncache_query_batch( fd_txncache_t *             tc,
@@ -435,6 +453,42 @@ fd_txncache_get_entries( fd_txncache_t *         tc,
                          fd_bank_slot_deltas_t * bank_slot_deltas,
                          fd_spad_t *             spad );
 
+/* fd_txncache_write_slot_deltas streams the rooted state of the status
+   cache in the bincode encoding of fd_bank_slot_deltas_t (the format of
+   the status cache file of Agave-compatible snapshots).  The output is
+   the same as encoding the result of fd_txncache_get_entries, but the
+   decoded slot deltas and the full encoding are never materialized in
+   memory.
+
+   The status cache is walked one chunk at a time under the read lock,
+   encoding into buf.  The lock is released whenever buf is full and
+   handed to write (e.g. file I/O), and after every few thousand
+   statuses, so writing never holds up operations that take the write
+   lock, such as registering roots, for long.  The memory used does not
+   depend on the number of statuses.
+
+   buf is a caller provided staging buffer of buf_sz bytes (at least
+   FD_TXNCACHE_WRITE_SLOT_DELTAS_BUF_MIN, larger values mean fewer and
+   larger calls to write).  The encoding is passed to write in order in
+   chunks of at most buf_sz bytes, with the ctx provided.  write should
+   return 0 on success and non-zero on failure.  Returns 0 on success.
+   On failure, returns the non-zero value returned by write, or -1 for
+   bad arguments or if the rooted slots changed while the lock was
+   released (logs details), and the output is incomplete.
+
+   Like fd_txncache_snapshot, this assumes there are no concurrent
+   inserts into the root slots, and that no roots are registered
+   meanwhile (i.e. the status cache is constipated). */
+
+#define FD_TXNCACHE_WRITE_SLOT_DELTAS_BUF_MIN (256UL)
+
+int
+fd_txncache_write_slot_deltas( fd_txncache_t * tc,
+                               uchar *         buf,
+                               ulong           buf_sz,
+                               void *          ctx,
+                               int ( * write )( uchar const * data, ulong data_sz, void * ctx ) );
+
 /* fd_txncache_{is,set}_constipated is used to set and determine if the 
    status cache is currently in a constipated state. */
 
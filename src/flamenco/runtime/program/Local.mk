@@ -41,6 +41,8 @@ $(call add-objs,fd_system_program fd_system_program_nonce,fd_flamenco)
 
 $(call add-hdrs,fd_vote_program.h)
 $(call add-objs,fd_vote_program,fd_flamenco)
+$(call make-unit-test,test_vote_program,test_vote_program,fd_flamenco fd_funk fd_ballet fd_util)
+$(call run-unit-test,test_vote_program)
 
 $(call add-hdrs,fd_zk_elgamal_proof_program.h)
 $(call add-objs,fd_zk_elgamal_proof_program,fd_flamenco)
@@ -3174,6 +3174,28 @@ fd_stake_get_state( fd_txn_account_t const * self,
   return get_state( self, out );
 }
 
+int
+fd_stake_get_stake( fd_txn_account_t const * self,
+                    fd_stake_t *             out ) {
+  fd_stake_state_v2_view_t view[1];
+  if( FD_UNLIKELY( fd_stake_state_v2_view( view, self->const_data, self->const_meta->dlen ) ||
+                   fd_stake_state_v2_view_discriminant( view )!=fd_stake_state_v2_enum_stake ) ) {
+    return FD_EXECUTOR_INSTR_ERR_INVALID_ACC_DATA;
+  }
+
+  fd_stake_state_v2_stake_view_t state      = fd_stake_state_v2_view_stake( view );
+  fd_stake_view_t                stake      = fd_stake_state_v2_stake_view_stake( &state );
+  fd_delegation_view_t           delegation = fd_stake_view_delegation( &stake );
+
+  out->delegation.voter_pubkey         = *fd_delegation_view_voter_pubkey( &delegation );
+  out->delegation.stake                = fd_delegation_view_stake( &delegation );
+  out->delegation.activation_epoch     = fd_delegation_view_activation_epoch( &delegation );
+  out->delegation.deactivation_epoch   = fd_delegation_view_deactivation_epoch( &delegation );
+  out->delegation.warmup_cooldown_rate = fd_delegation_view_warmup_cooldown_rate( &delegation );
+  out->credits_observed                = fd_stake_view_credits_observed( &stake );
+  return 0;
+}
+
 fd_stake_history_entry_t
 fd_stake_activating_and_deactivating( fd_delegation_t const *    self,
                                       ulong                      target_epoch,
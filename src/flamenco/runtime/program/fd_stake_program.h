@@ -37,6 +37,17 @@ int
 fd_stake_get_state( fd_txn_account_t const * self,
                     fd_stake_state_v2_t *    out );
 
+/* fd_stake_get_stake reads the stake of a stake account in the
+   StakeStateV2::Stake state in place, without decoding the rest of the
+   stake state.  Returns 0 on success and
+   FD_EXECUTOR_INSTR_ERR_INVALID_ACC_DATA if the account data is not a
+   valid stake state or the account is not delegated (out is not
+   modified). */
+
+int
+fd_stake_get_stake( fd_txn_account_t const * self,
+                    fd_stake_t *             out );
+
 fd_stake_history_entry_t
 fd_stake_activating_and_deactivating( fd_delegation_t const *    self,
                                       ulong                      target_epoch,
@@ -1846,6 +1846,59 @@ verify_and_get_vote_state( fd_borrowed_account_t *       vote_account,
   return FD_EXECUTOR_INSTR_SUCCESS;
 }
 
+/* verify_and_get_vote_state_fast is verify_and_get_vote_state for the
+   vote processing instructions.  If the vote account is eligible for
+   the fast path (see fd_vote_fast_state_t), the vote state is loaded in
+   place and *is_fast is set to 1.  Otherwise, it falls back to
+   verify_and_get_vote_state into fast->state.  Either way, the vote
+   state to process is fast->state and it should be written back with
+   set_vote_account_state_fast.
+
+   The fast path is only taken when it is indistinguishable from the
+   general path: the account would not be resized or downgraded by
+   set_vote_account_state and the single authorized voter is for an
+   epoch no later than the current one.  In that case,
+   get_and_update_authorized_voter returns that voter and leaves it as
+   the single authorized voter for the current epoch. */
+
+static int
+verify_and_get_vote_state_fast( fd_borrowed_account_t *       vote_account,
+                                fd_sol_sysvar_clock_t const * clock,
+                                fd_pubkey_t const *           signers[FD_TXN_SIG_MAX],
+                                fd_vote_fast_state_t *        fast /* out */,
+                                int *                         is_fast /* out */,
+                                fd_exec_instr_ctx_t const *   ctx ) {
+  fd_txn_account_t const * acct = vote_account->acct;
+  *is_fast = FD_FEATURE_ACTIVE( ctx->slot_ctx, vote_state_add_vote_latency ) &&
+             acct->const_meta->dlen>=size_of_versioned( 1 ) &&
+             fd_vote_fast_state_load( fast, acct->const_data, acct->const_meta->dlen, ctx->txn_ctx->spad ) &&
+             fast->voter_epoch<=clock->epoch;
+  if( FD_UNLIKELY( !*is_fast ) ) {
+    return verify_and_get_vote_state( vote_account, clock, signers, &fast->state, ctx );
+  }
+
+  fast->voter_epoch = clock->epoch;
+  return verify_authorized_signer( &fast->voter, signers );
+}
+
+__attribute__((warn_unused_result)) static int
+set_vote_account_state_fast( fd_borrowed_account_t *     vote_account,
+                             fd_vote_fast_state_t *      fast,
+                             int                         is_fast,
+                             fd_exec_instr_ctx_t const * ctx ) {
+  if( FD_UNLIKELY( !is_fast ) ) return set_vote_account_state( vote_account, &fast->state, ctx );
+
+  /* https://github.com/anza-xyz/agave/blob/v2.1.14/sdk/src/transaction_context.rs#L974 */
+  uchar * data = NULL;
+  ulong   dlen = 0UL;
+  int err = fd_borrowed_account_get_data_mut( vote_account, &data, &dlen );
+  if( FD_UNLIKELY( err ) ) return err;
+
+  // https://github.com/anza-xyz/agave/blob/v2.0.1/sdk/src/transaction_context.rs#L978
+  if( FD_UNLIKELY( fd_vote_fast_state_store( fast, data, dlen ) ) ) return FD_EXECUTOR_INSTR_ERR_ACC_DATA_TOO_SMALL;
+  return FD_EXECUTOR_INSTR_SUCCESS;
+}
+
 // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L1104
 static int
 process_vote_with_account( fd_borrowed_account_t *       vote_account,
@@ -1855,18 +1908,20 @@ process_vote_with_account( fd_borrowed_account_t *       vote_account,
                            fd_pubkey_t const *           signers[static FD_TXN_SIG_MAX],
                            fd_exec_instr_ctx_t const *   ctx ) {
 
-  int             rc;
-  fd_vote_state_t vote_state;
+  int                  rc;
+  fd_vote_fast_state_t fast[1];
+  int                  is_fast;
   // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L1112
-  rc = verify_and_get_vote_state( vote_account, clock, signers, &vote_state, ctx );
+  rc = verify_and_get_vote_state_fast( vote_account, clock, signers, fast, &is_fast, ctx );
   if( FD_UNLIKELY( rc ) ) return rc;
+  fd_vote_state_t * vote_state = &fast->state;
 
   // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L1114
   int   timely_vote_credits = FD_FEATURE_ACTIVE( ctx->slot_ctx, timely_vote_credits );
   int   deprecate_unused_legacy_vote_plumbing = FD_FEATURE_ACTIVE( ctx->slot_ctx, deprecate_unused_legacy_vote_plumbing );
 
   // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L1117
-  rc = process_vote( &vote_state, vote, slot_hashes, clock->epoch, clock->slot, timely_vote_credits, deprecate_unused_legacy_vote_plumbing, ctx );
+  rc = process_vote( vote_state, vote, slot_hashes, clock->epoch, clock->slot, timely_vote_credits, deprecate_unused_legacy_vote_plumbing, ctx );
   if( FD_UNLIKELY( rc ) ) return rc;
 
   // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L1126
@@ -1889,12 +1944,12 @@ process_vote_with_account( fd_borrowed_account_t *       vote_account,
       return FD_EXECUTOR_INSTR_ERR_CUSTOM_ERR;
     }
     // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L1131
-    rc = process_timestamp( &vote_state, *max, *vote->timestamp, ctx );
+    rc = process_timestamp( vote_state, *max, *vote->timestamp, ctx );
     if( FD_UNLIKELY( rc ) ) return rc;
   }
 
   // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L1133
-  return set_vote_account_state( vote_account, &vote_state, ctx );
+  return set_vote_account_state_fast( vote_account, fast, is_fast, ctx );
 }
 
 // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L1156
@@ -1988,21 +2043,22 @@ process_vote_state_update( fd_borrowed_account_t *       vote_account,
     }
   }
 
-  fd_vote_state_t vote_state;
+  fd_vote_fast_state_t fast[1];
+  int                  is_fast;
   // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L1144
-  rc = verify_and_get_vote_state( vote_account, clock, signers, &vote_state, ctx );
+  rc = verify_and_get_vote_state_fast( vote_account, clock, signers, fast, &is_fast, ctx );
   if( FD_UNLIKELY( rc ) ) return rc;
 
 
   // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L1145
   rc = do_process_vote_state_update(
-      &vote_state, slot_hashes, clock->epoch, clock->slot, vote_state_update, ctx );
+      &fast->state, slot_hashes, clock->epoch, clock->slot, vote_state_update, ctx );
   if( FD_UNLIKELY( rc ) ) {
     return rc;
   }
 
   // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L1153
-  rc = set_vote_account_state( vote_account, &vote_state, ctx );
+  rc = set_vote_account_state_fast( vote_account, fast, is_fast, ctx );
 
   return rc;
 }
@@ -2076,20 +2132,21 @@ process_tower_sync( fd_borrowed_account_t *       vote_account,
   }
 
   // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L1194
-  fd_vote_state_t vote_state;
+  fd_vote_fast_state_t fast[1];
+  int                  is_fast;
   do {
-    int err = verify_and_get_vote_state( vote_account, clock, signers, &vote_state, ctx );
+    int err = verify_and_get_vote_state_fast( vote_account, clock, signers, fast, &is_fast, ctx );
     if( FD_UNLIKELY( err ) ) return err;
   } while(0);
 
   // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L1195
   do {
-    int err = do_process_tower_sync( &vote_state, slot_hashes, clock->epoch, clock->slot, tower_sync, ctx );
+    int err = do_process_tower_sync( &fast->state, slot_hashes, clock->epoch, clock->slot, tower_sync, ctx );
     if( FD_UNLIKELY( err ) ) return err;
   } while(0);
 
   // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L1203
-  return set_vote_account_state( vote_account, &vote_state, ctx );
+  return set_vote_account_state_fast( vote_account, fast, is_fast, ctx );
 }
 
 /**********************************************************************/
@@ -2864,6 +2921,191 @@ fd_vote_convert_to_current( fd_vote_state_versioned_t * self,
   convert_to_current( self, spad );
 }
 
+int
+fd_vote_get_node_pubkey( uchar const * data,
+                         ulong         data_sz,
+                         fd_pubkey_t * node_pubkey ) {
+  fd_vote_state_versioned_view_t view[1];
+  int err = fd_vote_state_versioned_view( view, data, data_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+
+  switch( fd_vote_state_versioned_view_discriminant( view ) ) {
+  case fd_vote_state_versioned_enum_v0_23_5: {
+    fd_vote_state_0_23_5_view_t vs = fd_vote_state_versioned_view_v0_23_5( view );
+    *node_pubkey = *fd_vote_state_0_23_5_view_node_pubkey( &vs );
+    break;
+  }
+  case fd_vote_state_versioned_enum_v1_14_11: {
+    fd_vote_state_1_14_11_view_t vs = fd_vote_state_versioned_view_v1_14_11( view );
+    *node_pubkey = *fd_vote_state_1_14_11_view_node_pubkey( &vs );
+    break;
+  }
+  case fd_vote_state_versioned_enum_current: {
+    fd_vote_state_view_t vs = fd_vote_state_versioned_view_current( view );
+    *node_pubkey = *fd_vote_state_view_node_pubkey( &vs );
+    break;
+  }
+  default:
+    __builtin_unreachable();
+  }
+  return FD_BINCODE_SUCCESS;
+}
+
+int
+fd_vote_get_last_timestamp( uchar const *               data,
+                            ulong                       data_sz,
+                            fd_vote_block_timestamp_t * last_timestamp ) {
+  fd_vote_state_versioned_view_t view[1];
+  int err = fd_vote_state_versioned_view( view, data, data_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+
+  fd_vote_block_timestamp_view_t ts;
+  switch( fd_vote_state_versioned_view_discriminant( view ) ) {
+  case fd_vote_state_versioned_enum_v0_23_5: {
+    fd_vote_state_0_23_5_view_t vs = fd_vote_state_versioned_view_v0_23_5( view );
+    ts = fd_vote_state_0_23_5_view_last_timestamp( &vs );
+    break;
+  }
+  case fd_vote_state_versioned_enum_v1_14_11: {
+    fd_vote_state_1_14_11_view_t vs = fd_vote_state_versioned_view_v1_14_11( view );
+    ts = fd_vote_state_1_14_11_view_last_timestamp( &vs );
+    break;
+  }
+  case fd_vote_state_versioned_enum_current: {
+    fd_vote_state_view_t vs = fd_vote_state_versioned_view_current( view );
+    ts = fd_vote_state_view_last_timestamp( &vs );
+    break;
+  }
+  default:
+    __builtin_unreachable();
+  }
+  last_timestamp->slot      = fd_vote_block_timestamp_view_slot     ( &ts );
+  last_timestamp->timestamp = fd_vote_block_timestamp_view_timestamp( &ts );
+  return FD_BINCODE_SUCCESS;
+}
+
+/* vote_fast_voters_off returns the offset of the encoded authorized
+   voters in a versioned vote state: discriminant, node pubkey,
+   authorized withdrawer, commission, votes and root slot come first. */
+
+static inline ulong
+vote_fast_voters_off( fd_vote_state_t const * state ) {
+  ulong votes_cnt = state->votes ? deq_fd_landed_vote_t_cnt( state->votes ) : 0UL;
+  return 4UL + 32UL + 32UL + 1UL + 8UL + votes_cnt*13UL + 1UL + fd_ulong_if( state->has_root_slot, 8UL, 0UL );
+}
+
+int
+fd_vote_fast_state_load( fd_vote_fast_state_t * fast,
+                         uchar const *          data,
+                         ulong                  data_sz,
+                         fd_spad_t *            spad ) {
+  /* Validate the whole vote state up front so the rest can be read
+     unchecked and so the general path is taken for anything it would
+     reject. */
+  fd_vote_state_versioned_view_t view[1];
+  if( FD_UNLIKELY( fd_vote_state_versioned_view( view, data, data_sz ) ) ) return 0;
+  if( FD_UNLIKELY( fd_vote_state_versioned_view_discriminant( view )!=fd_vote_state_versioned_enum_current ) ) return 0;
+
+  fd_vote_state_t * state = &fast->state;
+  uchar const *     p     = data+4UL;
+
+  fd_memcpy( &state->node_pubkey,           p,       sizeof(fd_pubkey_t) );
+  fd_memcpy( &state->authorized_withdrawer, p+32UL, sizeof(fd_pubkey_t) );
+  state->commission = p[64];
+  p += 65UL;
+
+  /* Same deque capacities as fd_vote_state_decode */
+  ulong votes_len = FD_LOAD( ulong, p ); p += 8UL;
+  state->votes = deq_fd_landed_vote_t_alloc( fd_spad_virtual( spad ), fd_ulong_max( votes_len, 32UL ) );
+  for( ulong i=0UL; i<votes_len; i++ ) {
+    fd_landed_vote_t * vote = deq_fd_landed_vote_t_push_tail_nocopy( state->votes );
+    vote->latency                    = p[0];
+    vote->lockout.slot               = FD_LOAD( ulong, p+1UL );
+    vote->lockout.confirmation_count = FD_LOAD( uint,  p+9UL );
+    p += 13UL;
+  }
+
+  state->has_root_slot = *p++;
+  state->root_slot     = 0UL;
+  if( state->has_root_slot ) { state->root_slot = FD_LOAD( ulong, p ); p += 8UL; }
+
+  fast->voters_off = (ulong)p - (ulong)data;
+  if( FD_UNLIKELY( FD_LOAD( ulong, p )!=1UL ) ) return 0;
+  fast->voter_epoch = FD_LOAD( ulong, p+8UL );
+  fd_memcpy( &fast->voter, p+16UL, sizeof(fd_pubkey_t) );
+  fast->voters_sz = 8UL + fd_vote_authorized_voter_size( NULL ) + fd_vote_prior_voters_size( NULL );
+  p += fast->voters_sz;
+
+  state->authorized_voters.pool  = NULL;
+  state->authorized_voters.treap = NULL;
+
+  ulong epoch_credits_len = FD_LOAD( ulong, p ); p += 8UL;
+  state->epoch_credits = deq_fd_vote_epoch_credits_t_alloc( fd_spad_virtual( spad ), fd_ulong_max( epoch_credits_len, 64UL ) );
+  for( ulong i=0UL; i<epoch_credits_len; i++ ) {
+    fd_vote_epoch_credits_t * credits = deq_fd_vote_epoch_credits_t_push_tail_nocopy( state->epoch_credits );
+    credits->epoch        = FD_LOAD( ulong, p       );
+    credits->credits      = FD_LOAD( ulong, p+ 8UL );
+    credits->prev_credits = FD_LOAD( ulong, p+16UL );
+    p += 24UL;
+  }
+
+  state->last_timestamp.slot      = FD_LOAD( ulong, p     );
+  state->last_timestamp.timestamp = FD_LOAD( long,  p+8UL );
+  return 1;
+}
+
+ulong
+fd_vote_fast_state_size( fd_vote_fast_state_t const * fast ) {
+  fd_vote_state_t const * state = &fast->state;
+  ulong epoch_credits_cnt = state->epoch_credits ? deq_fd_vote_epoch_credits_t_cnt( state->epoch_credits ) : 0UL;
+  return vote_fast_voters_off( state ) + fast->voters_sz + 8UL + epoch_credits_cnt*24UL + 16UL;
+}
+
+int
+fd_vote_fast_state_store( fd_vote_fast_state_t const * fast,
+                          uchar *                      data,
+                          ulong                        data_sz ) {
+  fd_vote_state_t const * state = &fast->state;
+  if( FD_UNLIKELY( fd_vote_fast_state_size( fast )>data_sz ) ) return FD_BINCODE_ERR_OVERFLOW;
+
+  /* Move the encoded authorized voter and prior voters first: the new
+     votes and epoch credits may overlap where they used to be.  The
+     discriminant, node pubkey, authorized withdrawer and commission
+     never change and are left as is. */
+  ulong voters_off = vote_fast_voters_off( state );
+  memmove( data+voters_off, data+fast->voters_off, fast->voters_sz );
+  FD_STORE( ulong, data+voters_off+8UL, fast->voter_epoch );
+
+  /* Everything fits (size checked above) */
+  uchar * p = data+4UL+32UL+32UL+1UL;
+  ulong votes_cnt = state->votes ? deq_fd_landed_vote_t_cnt( state->votes ) : 0UL;
+  FD_STORE( ulong, p, votes_cnt ); p += 8UL;
+  for( ulong i=0UL; i<votes_cnt; i++ ) {
+    fd_landed_vote_t const * vote = deq_fd_landed_vote_t_peek_index_const( state->votes, i );
+    p[0] = vote->latency;
+    FD_STORE( ulong, p+1UL, vote->lockout.slot               );
+    FD_STORE( uint,  p+9UL, vote->lockout.confirmation_count );
+    p += 13UL;
+  }
+  *p++ = (uchar)!!state->has_root_slot;
+  if( state->has_root_slot ) { FD_STORE( ulong, p, state->root_slot ); p += 8UL; }
+
+  p = data+voters_off+fast->voters_sz;
+  ulong epoch_credits_cnt = state->epoch_credits ? deq_fd_vote_epoch_credits_t_cnt( state->epoch_credits ) : 0UL;
+  FD_STORE( ulong, p, epoch_credits_cnt ); p += 8UL;
+  for( ulong i=0UL; i<epoch_credits_cnt; i++ ) {
+    fd_vote_epoch_credits_t const * credits = deq_fd_vote_epoch_credits_t_peek_index_const( state->epoch_credits, i );
+    FD_STORE( ulong, p,       credits->epoch        );
+    FD_STORE( ulong, p+ 8UL, credits->credits      );
+    FD_STORE( ulong, p+16UL, credits->prev_credits );
+    p += 24UL;
+  }
+  FD_STORE( ulong, p,     state->last_timestamp.slot      );
+  FD_STORE( long,  p+8UL, state->last_timestamp.timestamp );
+
+  return FD_BINCODE_SUCCESS;
+}
+
 static void
 remove_vote_account( fd_exec_slot_ctx_t * slot_ctx, fd_txn_account_t * vote_account ) {
   fd_epoch_bank_t * epoch_bank = fd_exec_epoch_ctx_epoch_bank( slot_ctx->epoch_ctx );
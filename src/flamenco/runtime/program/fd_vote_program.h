@@ -64,6 +64,76 @@ void
 fd_vote_convert_to_current( fd_vote_state_versioned_t * self,
                             fd_spad_t *                 spad );
 
+/* fd_vote_get_node_pubkey and fd_vote_get_last_timestamp read the node
+   pubkey and the last timestamp of the vote state (of any version)
+   encoded in the data_sz bytes at data in place, without decoding or
+   allocating the rest of the vote state.  Return FD_BINCODE_SUCCESS on
+   success and a FD_BINCODE_ERR code if data is not a valid vote state
+   (out is not modified). */
+
+int
+fd_vote_get_node_pubkey( uchar const * data,
+                         ulong         data_sz,
+                         fd_pubkey_t * node_pubkey /* out */ );
+
+int
+fd_vote_get_last_timestamp( uchar const *               data,
+                            ulong                       data_sz,
+                            fd_vote_block_timestamp_t * last_timestamp /* out */ );
+
+/* fd_vote_fast_state_t is the vote state as seen by the vote replay
+   fast path.  Almost every vote program instruction executed in replay
+   is a TowerSync or (Compact)UpdateVoteState against a current version
+   vote account with a single authorized voter.  Processing those only
+   reads and writes the votes, root slot, epoch credits and last
+   timestamp, so only these are decoded.  The authorized voter and the
+   prior voters are left encoded in the account data and are moved as
+   raw bytes on write back (the authorized voter epoch is patched in
+   place) instead of being decoded into a treap and re-encoded.
+
+   state.authorized_voters and state.prior_voters are not populated. */
+
+struct fd_vote_fast_state {
+  fd_vote_state_t state;
+  fd_pubkey_t     voter;       /* The single authorized voter */
+  ulong           voter_epoch; /* Epoch of the authorized voter */
+  ulong           voters_off;  /* Offset of the encoded authorized voters in the account data */
+  ulong           voters_sz;   /* Encoded size of the authorized voters and the prior voters */
+};
+
+typedef struct fd_vote_fast_state fd_vote_fast_state_t;
+
+/* fd_vote_fast_state_load loads the vote state encoded in the data_sz
+   bytes at data into fast.  The votes and epoch credits deques are
+   allocated from spad.  Returns 1 on success and 0 if data is not a
+   valid current version vote state with exactly one authorized voter
+   (the caller should use the general path). */
+
+int
+fd_vote_fast_state_load( fd_vote_fast_state_t * fast,
+                         uchar const *          data,
+                         ulong                  data_sz,
+                         fd_spad_t *            spad );
+
+/* fd_vote_fast_state_size returns the encoded size of the versioned
+   vote state held in fast. */
+
+ulong
+fd_vote_fast_state_size( fd_vote_fast_state_t const * fast );
+
+/* fd_vote_fast_state_store encodes fast in place into the data_sz bytes
+   at data, which must still hold the vote state fast was loaded from.
+   The result is identical to encoding the equivalent fully decoded
+   fd_vote_state_versioned_t.  Bytes past fd_vote_fast_state_size are
+   not modified.  Returns FD_BINCODE_SUCCESS on success and
+   FD_BINCODE_ERR_OVERFLOW if data_sz is too small (data is not
+   modified). */
+
+int
+fd_vote_fast_state_store( fd_vote_fast_state_t const * fast,
+                          uchar *                      data,
+                          ulong                        data_sz );
+
 void
 fd_vote_record_timestamp_vote_with_slot( fd_exec_slot_ctx_t * slot_ctx,
                                          fd_pubkey_t const *  vote_acc,
@@ -0,0 +1,299 @@
+#include "fd_vote_program.h"
+
+/* Tests that the vote replay fast path loads and stores vote states
+   exactly like a full decode and encode of the versioned vote state,
+   and benchmarks both on a mainnet shaped vote account. */
+
+#define ACCT_SZ (FD_VOTE_STATE_V3_SZ+64UL)
+
+static uchar acct_fast[ ACCT_SZ ];
+static uchar acct_full[ ACCT_SZ ];
+static uchar dec_buf  [ 1UL<<16 ] __attribute__((aligned(128UL)));
+static uchar spad_mem [ FD_SPAD_FOOTPRINT( 1UL<<20 ) ] __attribute__((aligned(FD_SPAD_ALIGN)));
+
+/* Minimal bincode writer */
+
+static uchar * w_u8 ( uchar * p, uchar v ) { *p = v;                return p+1UL; }
+static uchar * w_u32( uchar * p, uint  v ) { FD_STORE( uint,  p, v ); return p+4UL; }
+static uchar * w_u64( uchar * p, ulong v ) { FD_STORE( ulong, p, v ); return p+8UL; }
+
+static uchar *
+w_rand( uchar *    p,
+        fd_rng_t * rng,
+        ulong      sz ) {
+  for( ulong i=0UL; i<sz; i++ ) p[i] = fd_rng_uchar( rng );
+  return p+sz;
+}
+
+/* encode_vote_state fills acct with random bytes and writes a random
+   current version vote state with voter_cnt authorized voters (vote_cnt
+   and credit_cnt of ULONG_MAX pick random counts).  Returns the encoded
+   size. */
+
+static ulong
+encode_vote_state( uchar *    acct,
+                   fd_rng_t * rng,
+                   ulong      voter_cnt,
+                   ulong      vote_cnt,
+                   ulong      credit_cnt ) {
+  if( vote_cnt  ==ULONG_MAX ) vote_cnt   = fd_rng_ulong_roll( rng, 32UL );
+  if( credit_cnt==ULONG_MAX ) credit_cnt = fd_rng_ulong_roll( rng, 65UL );
+
+  w_rand( acct, rng, ACCT_SZ );
+  uchar * p = acct;
+  p = w_u32 ( p, fd_vote_state_versioned_enum_current );
+  p = w_rand( p, rng, 32UL );                       /* node_pubkey */
+  p = w_rand( p, rng, 32UL );                       /* authorized_withdrawer */
+  p = w_u8  ( p, fd_rng_uchar( rng ) );             /* commission */
+  p = w_u64 ( p, vote_cnt );
+  for( ulong i=0UL; i<vote_cnt; i++ ) {
+    p = w_u8 ( p, fd_rng_uchar( rng ) );
+    p = w_u64( p, fd_rng_ulong( rng ) );
+    p = w_u32( p, fd_rng_uint( rng ) );
+  }
+  int has_root = fd_rng_int_roll( rng, 2 );
+  p = w_u8( p, (uchar)has_root );                   /* root_slot */
+  if( has_root ) p = w_u64( p, fd_rng_ulong( rng ) );
+  p = w_u64( p, voter_cnt );                        /* authorized_voters */
+  for( ulong i=0UL; i<voter_cnt; i++ ) { p = w_u64( p, 2UL*i+fd_rng_ulong_roll( rng, 2UL ) ); p = w_rand( p, rng, 32UL ); }
+  p = w_rand( p, rng, 1544UL );                     /* prior_voters */
+  p = w_u8  ( p, (uchar)fd_rng_uint_roll( rng, 2U ) );
+  p = w_u64 ( p, credit_cnt );                      /* epoch_credits */
+  p = w_rand( p, rng, 24UL*credit_cnt );
+  p = w_rand( p, rng, 16UL );                       /* last_timestamp */
+  return (ulong)( p-acct );
+}
+
+static fd_vote_state_t *
+decode_full( uchar const * acct,
+             ulong         acct_sz ) {
+  fd_bincode_decode_ctx_t ctx = { .data = acct, .dataend = acct+acct_sz };
+  ulong total_sz = 0UL;
+  FD_TEST( !fd_vote_state_versioned_decode_footprint( &ctx, &total_sz ) );
+  FD_TEST( total_sz<=sizeof(dec_buf) );
+  fd_vote_state_versioned_t * vsv = fd_vote_state_versioned_decode( dec_buf, &ctx );
+  FD_TEST( vsv->discriminant==fd_vote_state_versioned_enum_current );
+  return &vsv->inner.current;
+}
+
+static void
+encode_full( fd_vote_state_t const * state,
+             uchar *                 acct,
+             ulong                   acct_sz ) {
+  fd_vote_state_versioned_t vsv = { .discriminant = fd_vote_state_versioned_enum_current,
+                                    .inner        = { .current = *state } };
+  fd_bincode_encode_ctx_t ctx = { .data = acct, .dataend = acct+acct_sz };
+  FD_TEST( !fd_vote_state_versioned_encode( &vsv, &ctx ) );
+}
+
+static void
+check_same( fd_vote_state_t const * a,
+            fd_vote_state_t const * b ) {
+  FD_TEST( !memcmp( &a->node_pubkey,           &b->node_pubkey,           sizeof(fd_pubkey_t) ) );
+  FD_TEST( !memcmp( &a->authorized_withdrawer, &b->authorized_withdrawer, sizeof(fd_pubkey_t) ) );
+  FD_TEST( a->commission==b->commission );
+  FD_TEST( deq_fd_landed_vote_t_cnt( a->votes )==deq_fd_landed_vote_t_cnt( b->votes ) );
+  FD_TEST( deq_fd_landed_vote_t_max( a->votes )==deq_fd_landed_vote_t_max( b->votes ) );
+  for( ulong i=0UL; i<deq_fd_landed_vote_t_cnt( a->votes ); i++ ) {
+    fd_landed_vote_t const * va = deq_fd_landed_vote_t_peek_index_const( a->votes, i );
+    fd_landed_vote_t const * vb = deq_fd_landed_vote_t_peek_index_const( b->votes, i );
+    FD_TEST( va->latency==vb->latency );
+    FD_TEST( va->lockout.slot==vb->lockout.slot );
+    FD_TEST( va->lockout.confirmation_count==vb->lockout.confirmation_count );
+  }
+  FD_TEST( a->has_root_slot==b->has_root_slot );
+  if( a->has_root_slot ) FD_TEST( a->root_slot==b->root_slot );
+  FD_TEST( deq_fd_vote_epoch_credits_t_cnt( a->epoch_credits )==deq_fd_vote_epoch_credits_t_cnt( b->epoch_credits ) );
+  FD_TEST( deq_fd_vote_epoch_credits_t_max( a->epoch_credits )==deq_fd_vote_epoch_credits_t_max( b->epoch_credits ) );
+  for( ulong i=0UL; i<deq_fd_vote_epoch_credits_t_cnt( a->epoch_credits ); i++ ) {
+    fd_vote_epoch_credits_t const * ca = deq_fd_vote_epoch_credits_t_peek_index_const( a->epoch_credits, i );
+    fd_vote_epoch_credits_t const * cb = deq_fd_vote_epoch_credits_t_peek_index_const( b->epoch_credits, i );
+    FD_TEST( ca->epoch==cb->epoch && ca->credits==cb->credits && ca->prev_credits==cb->prev_credits );
+  }
+  FD_TEST( a->last_timestamp.slot==b->last_timestamp.slot );
+  FD_TEST( a->last_timestamp.timestamp==b->last_timestamp.timestamp );
+}
+
+/* mutate makes the kind of changes vote processing makes to a vote
+   state.  Called with identically seeded rngs, it makes the same
+   changes. */
+
+static void
+mutate( fd_vote_state_t * state,
+        fd_rng_t *        rng ) {
+  ulong pop_cnt = fd_rng_ulong_roll( rng, deq_fd_landed_vote_t_cnt( state->votes )+1UL );
+  for( ulong i=0UL; i<pop_cnt; i++ ) deq_fd_landed_vote_t_pop_head( state->votes );
+  ulong push_cnt = fd_rng_ulong_roll( rng, 32UL-deq_fd_landed_vote_t_cnt( state->votes ) );
+  for( ulong i=0UL; i<push_cnt; i++ ) {
+    fd_landed_vote_t * v = deq_fd_landed_vote_t_push_tail_nocopy( state->votes );
+    v->latency                    = fd_rng_uchar( rng );
+    v->lockout.slot               = fd_rng_ulong( rng );
+    v->lockout.confirmation_count = fd_rng_uint( rng );
+  }
+
+  state->has_root_slot = (uchar)fd_rng_uint_roll( rng, 2U );
+  state->root_slot     = state->has_root_slot ? fd_rng_ulong( rng ) : ULONG_MAX;
+
+  ulong credit_cnt = deq_fd_vote_epoch_credits_t_cnt( state->epoch_credits );
+  if( credit_cnt<64UL && fd_rng_uint_roll( rng, 2U ) ) {
+    deq_fd_vote_epoch_credits_t_push_tail( state->epoch_credits, (fd_vote_epoch_credits_t){
+        .epoch = fd_rng_ulong( rng ), .credits = fd_rng_ulong( rng ), .prev_credits = fd_rng_ulong( rng ) } );
+  } else if( credit_cnt && fd_rng_uint_roll( rng, 2U ) ) {
+    deq_fd_vote_epoch_credits_t_pop_head( state->epoch_credits );
+  }
+  if( !deq_fd_vote_epoch_credits_t_empty( state->epoch_credits ) ) {
+    deq_fd_vote_epoch_credits_t_peek_tail( state->epoch_credits )->credits += fd_rng_ulong_roll( rng, 16UL );
+  }
+
+  state->last_timestamp.slot      = fd_rng_ulong( rng );
+  state->last_timestamp.timestamp = (long)fd_rng_ulong( rng );
+}
+
+static void
+test_fast_state( fd_rng_t *  rng,
+                 fd_spad_t * spad,
+                 ulong       iter_max ) {
+  for( ulong iter=0UL; iter<iter_max; iter++ ) {
+    ulong sz = encode_vote_state( acct_fast, rng, 1UL, ULONG_MAX, ULONG_MAX );
+    fd_memcpy( acct_full, acct_fast, ACCT_SZ );
+
+    FD_SPAD_FRAME_BEGIN( spad ) {
+      fd_vote_fast_state_t fast[1];
+      FD_TEST( fd_vote_fast_state_load( fast, acct_fast, ACCT_SZ, spad )==1 );
+      FD_TEST( fd_vote_fast_state_size( fast )==sz );
+      FD_TEST( fast->voter_epoch==FD_LOAD( ulong, acct_fast+fast->voters_off+8UL ) );
+      FD_TEST( !memcmp( &fast->voter, acct_fast+fast->voters_off+16UL, sizeof(fd_pubkey_t) ) );
+
+      fd_vote_state_t * full = decode_full( acct_full, ACCT_SZ );
+      check_same( &fast->state, full );
+
+      /* Unmodified state is stored back unchanged */
+
+      FD_TEST( !fd_vote_fast_state_store( fast, acct_fast, ACCT_SZ ) );
+      FD_TEST( !memcmp( acct_fast, acct_full, ACCT_SZ ) );
+
+      /* Apply the same changes to both and compare encodings, including
+         the stale bytes past the end of the vote state */
+
+      ulong seed = fd_rng_ulong( rng );
+      fd_rng_t _r0[1]; fd_rng_t * r0 = fd_rng_join( fd_rng_new( _r0, (uint)seed, seed ) );
+      fd_rng_t _r1[1]; fd_rng_t * r1 = fd_rng_join( fd_rng_new( _r1, (uint)seed, seed ) );
+      mutate( &fast->state, r0 );
+      mutate( full,         r1 );
+      fd_rng_delete( fd_rng_leave( r0 ) );
+      fd_rng_delete( fd_rng_leave( r1 ) );
+
+      ulong epoch = fast->voter_epoch + fd_rng_ulong_roll( rng, 3UL );
+      fast->voter_epoch = epoch;
+      fd_vote_authorized_voters_treap_fwd_iter_t it =
+          fd_vote_authorized_voters_treap_fwd_iter_init( full->authorized_voters.treap, full->authorized_voters.pool );
+      fd_vote_authorized_voters_treap_fwd_iter_ele( it, full->authorized_voters.pool )->epoch = epoch;
+
+      ulong new_sz = fd_vote_fast_state_size( fast );
+      FD_TEST( fd_vote_fast_state_store( fast, acct_fast, new_sz-1UL )==FD_BINCODE_ERR_OVERFLOW );
+      FD_TEST( !fd_vote_fast_state_store( fast, acct_fast, new_sz ) );
+      encode_full( full, acct_full, ACCT_SZ );
+      FD_TEST( !memcmp( acct_fast, acct_full, ACCT_SZ ) );
+    } FD_SPAD_FRAME_END;
+  }
+
+  /* Vote states the fast path does not handle */
+
+  FD_SPAD_FRAME_BEGIN( spad ) {
+    fd_vote_fast_state_t fast[1];
+
+    ulong sz = encode_vote_state( acct_fast, rng, 2UL, ULONG_MAX, ULONG_MAX );
+    FD_TEST( !fd_vote_fast_state_load( fast, acct_fast, sz, spad ) ); /* multiple authorized voters */
+    sz = encode_vote_state( acct_fast, rng, 0UL, ULONG_MAX, ULONG_MAX );
+    FD_TEST( !fd_vote_fast_state_load( fast, acct_fast, sz, spad ) ); /* uninitialized */
+
+    sz = encode_vote_state( acct_fast, rng, 1UL, ULONG_MAX, ULONG_MAX );
+    FD_TEST( fd_vote_fast_state_load( fast, acct_fast, sz, spad ) );
+    FD_TEST( !fd_vote_fast_state_load( fast, acct_fast, sz-1UL, spad ) ); /* truncated */
+    FD_STORE( uint, acct_fast, fd_vote_state_versioned_enum_v1_14_11 );
+    FD_TEST( !fd_vote_fast_state_load( fast, acct_fast, sz, spad ) ); /* old version */
+  } FD_SPAD_FRAME_END;
+}
+
+/* bench_vote replays a vote against a vote account with full vote
+   history: the oldest vote is popped, a new one is pushed and the
+   credits of the current epoch are incremented. */
+
+static void
+bench_apply_vote( fd_vote_state_t * state,
+                  ulong             slot ) {
+  deq_fd_landed_vote_t_pop_head( state->votes );
+  deq_fd_landed_vote_t_push_tail( state->votes, (fd_landed_vote_t){ .latency = 1, .lockout = { .slot = slot, .confirmation_count = 1U } } );
+  state->root_slot = slot-32UL;
+  deq_fd_vote_epoch_credits_t_peek_tail( state->epoch_credits )->credits += 16UL;
+}
+
+static void
+bench_vote( fd_rng_t *  rng,
+            fd_spad_t * spad,
+            ulong       bench_cnt ) {
+  encode_vote_state( acct_fast, rng, 1UL, 31UL, 64UL );
+  fd_memcpy( acct_full, acct_fast, ACCT_SZ );
+
+  /* warm up */
+  for( ulong rem=bench_cnt/10UL; rem; rem-- ) {
+    FD_SPAD_FRAME_BEGIN( spad ) {
+      fd_vote_fast_state_t fast[1];
+      FD_TEST( fd_vote_fast_state_load( fast, acct_fast, ACCT_SZ, spad ) );
+      FD_TEST( !fd_vote_fast_state_store( fast, acct_fast, ACCT_SZ ) );
+    } FD_SPAD_FRAME_END;
+  }
+
+  long dt = -fd_log_wallclock();
+  for( ulong rem=bench_cnt; rem; rem-- ) {
+    FD_SPAD_FRAME_BEGIN( spad ) {
+      fd_bincode_decode_ctx_t ctx = { .data = acct_full, .dataend = acct_full+ACCT_SZ };
+      ulong total_sz = 0UL;
+      FD_TEST( !fd_vote_state_versioned_decode_footprint( &ctx, &total_sz ) );
+      fd_vote_state_versioned_t * vsv = fd_vote_state_versioned_decode( fd_spad_alloc( spad, fd_vote_state_versioned_align(), total_sz ), &ctx );
+      bench_apply_vote( &vsv->inner.current, rem );
+      fd_bincode_encode_ctx_t enc = { .data = acct_full, .dataend = acct_full+ACCT_SZ };
+      FD_TEST( fd_vote_state_versioned_size( vsv )<=ACCT_SZ );
+      FD_TEST( !fd_vote_state_versioned_encode( vsv, &enc ) );
+    } FD_SPAD_FRAME_END;
+  }
+  dt += fd_log_wallclock();
+  FD_LOG_NOTICE(( "full decode/encode: %6.1f ns/vote (%.3e votes/s)", (double)dt/(double)bench_cnt, 1e9*(double)bench_cnt/(double)dt ));
+
+  dt = -fd_log_wallclock();
+  for( ulong rem=bench_cnt; rem; rem-- ) {
+    FD_SPAD_FRAME_BEGIN( spad ) {
+      fd_vote_fast_state_t fast[1];
+      FD_TEST( fd_vote_fast_state_load( fast, acct_fast, ACCT_SZ, spad ) );
+      bench_apply_vote( &fast->state, rem );
+      FD_TEST( !fd_vote_fast_state_store( fast, acct_fast, ACCT_SZ ) );
+    } FD_SPAD_FRAME_END;
+  }
+  dt += fd_log_wallclock();
+  FD_LOG_NOTICE(( "fast load/store:    %6.1f ns/vote (%.3e votes/s)", (double)dt/(double)bench_cnt, 1e9*(double)bench_cnt/(double)dt ));
+
+  FD_TEST( !memcmp( acct_fast, acct_full, ACCT_SZ ) );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  ulong iter_max  = fd_env_strip_cmdline_ulong( &argc, &argv, "--iter-max",  NULL, 1000UL  );
+  ulong bench_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--bench-cnt", NULL, 10000UL );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+  fd_spad_t * spad = fd_spad_join( fd_spad_new( spad_mem, 1UL<<20 ) );
+  FD_TEST( spad );
+
+  test_fast_state( rng, spad, iter_max );
+  bench_vote( rng, spad, bench_cnt );
+
+  fd_spad_delete( fd_spad_leave( spad ) );
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
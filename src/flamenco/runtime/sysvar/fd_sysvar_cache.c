@@ -82,7 +82,12 @@ fd_sysvar_cache_delete( fd_sysvar_cache_t * cache ) {
 FD_SYSVAR_CACHE_ITER(X)
 #undef X
 
-/* Restore sysvars */
+/* Restore sysvars
+
+   If the account still holds the image the cached value was parsed
+   from, the value is kept as is, unless it has heap parts (these were
+   allocated from the runtime spad frame of an earlier block and have
+   to be parsed again). */
 
 # define X( type, name )                                                  \
 void                                                                      \
@@ -94,7 +99,10 @@ fd_sysvar_cache_restore_##name(                                           \
     fd_pubkey_t const * pubkey = &fd_sysvar_##name##_id;                  \
     FD_TXN_ACCOUNT_DECL( account );                                       \
     int view_err = fd_acc_mgr_view( acc_mgr, funk_txn, pubkey, account ); \
-    if( view_err==FD_ACC_MGR_ERR_UNKNOWN_ACCOUNT ) break;                 \
+    if( view_err==FD_ACC_MGR_ERR_UNKNOWN_ACCOUNT ) {                      \
+      cache->img_sz_##name = 0UL;                                         \
+      break;                                                              \
+    }                                                                     \
                                                                           \
     if( view_err!=FD_ACC_MGR_SUCCESS ) {                                  \
       char pubkey_cstr[ FD_BASE58_ENCODED_32_SZ ];                        \
@@ -103,13 +111,28 @@ fd_sysvar_cache_restore_##name(                                           \
                   view_err, fd_acc_mgr_strerror( view_err ) ));           \
     }                                                                     \
                                                                           \
-    if( account->const_meta->info.lamports == 0UL ) break;                \
+    if( account->const_meta->info.lamports == 0UL ) {                     \
+      cache->img_sz_##name = 0UL;                                         \
+      break;                                                              \
+    }                                                                     \
+                                                                          \
+    uchar const * data    = account->const_data;                          \
+    ulong         data_sz = account->const_meta->dlen;                    \
+                                                                          \
+    /* Keep the cached value if the account is unchanged */               \
+    if( cache->has_##name && cache->inl_##name &&                         \
+        cache->img_sz_##name==data_sz &&                                  \
+        0==memcmp( cache->img_##name, data, data_sz ) ) {                 \
+      cache->reuse_cnt++;                                                 \
+      break;                                                              \
+    }                                                                     \
+    cache->img_sz_##name = 0UL;                                           \
                                                                           \
     /* Decode new value                                                   \
       type##_decode() does not do heap allocations on failure */          \
     fd_bincode_decode_ctx_t decode = {                                    \
-      .data    = account->const_data,                                     \
-      .dataend = account->const_data + account->const_meta->dlen          \
+      .data    = data,                                                    \
+      .dataend = data + data_sz                                           \
     };                                                                    \
     ulong total_sz    = 0UL;                                              \
     int   err         = type##_decode_footprint( &decode, &total_sz );    \
@@ -118,14 +141,26 @@ fd_sysvar_cache_restore_##name(                                           \
       break;                                                              \
     }                                                                     \
                                                                           \
-    type##_t * mem = fd_spad_alloc( cache->runtime_spad,                  \
-                                    type##_align(),                       \
-                                    total_sz );                           \
-    if( FD_UNLIKELY( !mem ) ) {                                           \
-      FD_LOG_ERR(( "memory allocation failed" ));                         \
+    cache->inl_##name = (total_sz==sizeof(type##_t));                     \
+    if( cache->inl_##name ) {                                             \
+      /* No heap parts, decode in place */                                \
+      type##_decode( cache->val_##name, &decode );                        \
+    } else {                                                              \
+      type##_t * mem = fd_spad_alloc( cache->runtime_spad,                \
+                                      type##_align(),                     \
+                                      total_sz );                         \
+      if( FD_UNLIKELY( !mem ) ) {                                         \
+        FD_LOG_ERR(( "memory allocation failed" ));                       \
+      }                                                                   \
+      type##_decode( mem, &decode );                                      \
+      fd_memcpy( cache->val_##name, mem, sizeof(type##_t) );              \
+    }                                                                     \
+    cache->decode_cnt++;                                                  \
+                                                                          \
+    if( FD_LIKELY( data_sz<=sizeof(cache->img_##name) ) ) {               \
+      fd_memcpy( cache->img_##name, data, data_sz );                      \
+      cache->img_sz_##name = data_sz;                                     \
     }                                                                     \
-    type##_decode( mem, &decode );                                        \
-    fd_memcpy( cache->val_##name, mem, sizeof(type##_t) );                \
   } while(0);                                                             \
 }
   FD_SYSVAR_CACHE_ITER(X)
@@ -141,6 +176,21 @@ fd_sysvar_cache_restore_##name( cache, acc_mgr, funk_txn );
 # undef X
 }
 
+uchar const *
+fd_sysvar_cache_data( fd_sysvar_cache_t const * cache,
+                      fd_pubkey_t const *       address,
+                      ulong *                   sz ) {
+# define X( type, name )                                                     \
+  if( 0==memcmp( address, &fd_sysvar_##name##_id, sizeof(fd_pubkey_t) ) ) { \
+    if( !cache->img_sz_##name ) return NULL;                                 \
+    *sz = cache->img_sz_##name;                                              \
+    return cache->img_##name;                                                \
+  }
+  FD_SYSVAR_CACHE_ITER(X)
+# undef X
+  return NULL;
+}
+
 # define X( type, name )                                               \
   type##_t const *                                                     \
   fd_sysvar_from_instr_acct_##name( fd_exec_instr_ctx_t const * ctx,   \
@@ -27,6 +27,20 @@
    accounts DB.  Currently, the write back happens at arbitrary stages
    in the slot boundary logic and is different for every sysvar.
 
+   ### Serialized images
+
+   Alongside the parsed value, the cache keeps a copy of the serialized
+   account data each sysvar was parsed from (if it fits the image
+   capacity of that sysvar).  Sysvar reads that want raw account bytes
+   (e.g. the sol_get_sysvar syscall) are served straight from the image
+   instead of going through the accounts DB.
+
+   Most sysvars do not change from one block to the next.  All forks
+   share one cache which is restored from the accounts DB at the start
+   of every block, and restoring a sysvar whose account content still
+   matches the image (and whose parsed value does not spill onto the
+   heap) leaves the parsed value as is instead of parsing it again.
+
    ### Memory Management
 
    fd_sysvar_cache_t is contained by a continuous memory region and
@@ -46,6 +60,21 @@
   X( fd_stake_history,                stake_history       ) \
   X( fd_sol_sysvar_last_restart_slot, last_restart_slot   )
 
+/* FD_SYSVAR_CACHE_IMG_MAX_{...} give the capacity of the serialized
+   image of each sysvar.  These match the account data size of the
+   respective sysvar on mainnet.  Accounts larger than that are still
+   parsed but have no image. */
+
+#define FD_SYSVAR_CACHE_IMG_MAX_clock               (    40UL)
+#define FD_SYSVAR_CACHE_IMG_MAX_epoch_schedule      (    33UL)
+#define FD_SYSVAR_CACHE_IMG_MAX_epoch_rewards       (    81UL)
+#define FD_SYSVAR_CACHE_IMG_MAX_fees                (     8UL)
+#define FD_SYSVAR_CACHE_IMG_MAX_rent                (    17UL)
+#define FD_SYSVAR_CACHE_IMG_MAX_slot_hashes         ( 20488UL)
+#define FD_SYSVAR_CACHE_IMG_MAX_recent_block_hashes (  6008UL)
+#define FD_SYSVAR_CACHE_IMG_MAX_stake_history       ( 16392UL)
+#define FD_SYSVAR_CACHE_IMG_MAX_last_restart_slot   (     8UL)
+
 /* The memory of fd_sysvar_cache_t fits as much sysvar information into
    the struct as possible.  Unfortunately some parts of the sysvar
    spill out onto the heap due to how the type generator works.
@@ -53,7 +82,12 @@
    The has_{...} bits specify whether a sysvar logically exists.
    The val_{...} structs contain the top-level struct of each sysvar.
    If has_{...}==0 then any heap pointers in val_{...} are NULL,
-   allowing for safe idempotent calls to fd_sol_sysvar_{...}_destroy() */
+   allowing for safe idempotent calls to fd_sol_sysvar_{...}_destroy()
+   The img_{...} buffers hold the img_sz_{...} bytes of account data the
+   val_{...} structs were parsed from.  img_sz_{...}==0 if there is no
+   image (the sysvar does not exist or did not fit).  The inl_{...} bits
+   specify whether val_{...} is fully contained in the struct (i.e. has
+   no heap parts). */
 
 struct __attribute__((aligned(16UL))) fd_sysvar_cache_private {
   ulong       magic;  /* ==FD_SYSVAR_CACHE_MAGIC */
@@ -65,11 +99,27 @@ struct __attribute__((aligned(16UL))) fd_sysvar_cache_private {
   FD_SYSVAR_CACHE_ITER(X)
 # undef X
 
+  /* Declare the img_{...} images */
+# define X( _type, name ) \
+  ulong img_sz_##name;    \
+  uchar img_##name[ FD_SYSVAR_CACHE_IMG_MAX_##name ];
+  FD_SYSVAR_CACHE_ITER(X)
+# undef X
+
   /* Declare the has_{...} bits */
 # define X( _type, name ) \
   ulong has_##name : 1;
   FD_SYSVAR_CACHE_ITER(X)
 # undef X
+
+  /* Declare the inl_{...} bits */
+# define X( _type, name ) \
+  ulong inl_##name : 1;
+  FD_SYSVAR_CACHE_ITER(X)
+# undef X
+
+  ulong decode_cnt; /* Number of sysvars parsed by restore */
+  ulong reuse_cnt;  /* Number of sysvars restore found unchanged */
 };
 
 struct fd_sysvar_cache_private;
@@ -138,6 +188,19 @@ FD_FN_PURE fd_recent_block_hashes_t          const * fd_sysvar_cache_recent_bloc
 FD_FN_PURE fd_stake_history_t                const * fd_sysvar_cache_stake_history      ( fd_sysvar_cache_t const * cache );
 FD_FN_PURE fd_sol_sysvar_last_restart_slot_t const * fd_sysvar_cache_last_restart_slot  ( fd_sysvar_cache_t const * cache );
 
+/* fd_sysvar_cache_data returns a pointer to the serialized image of
+   the sysvar with the given address and stores its size in *sz.  The
+   image is identical to the account data the sysvar was last restored
+   from.  The returned pointer is valid until the next restore of that
+   sysvar.  Returns NULL (*sz is not modified) if the address is not a
+   cached sysvar or if the sysvar has no image, in which case the caller
+   should read the account from the accounts DB. */
+
+uchar const *
+fd_sysvar_cache_data( fd_sysvar_cache_t const * cache,
+                      fd_pubkey_t const *       address,
+                      ulong *                   sz );
+
 /* fd_sysvar_from_instr_acct_{...} pretends to read a sysvar from an
    instruction account.  Checks that a given instruction account has
    an address matching the sysvar.  Returns the sysvar from the sysvar
@@ -7,6 +7,7 @@
 #include "../fd_system_ids.h"
 #include "../context/fd_exec_epoch_ctx.h"
 #include "../context/fd_exec_slot_ctx.h"
+#include "../program/fd_vote_program.h"
 #include "../../fd_flamenco_base.h"
 
 /* https://github.com/solana-labs/solana/blob/8f2c8b8388a495d2728909e30460aa40dcc5d733/runtime/src/stake_weighted_timestamp.rs#L14 */
@@ -226,41 +227,15 @@ fd_calculate_stake_weighted_timestamp( fd_exec_slot_ctx_t * slot_ctx,
       ulong vote_slot = 0;
       if( vote_acc_node == NULL ) {
 
-        fd_bincode_decode_ctx_t ctx = {
-          .data    = n->elem.value.data,
-          .dataend = n->elem.value.data + n->elem.value.data_len,
-        };
-
-        ulong total_sz = 0UL;
-        int   err      = fd_vote_state_versioned_decode_footprint( &ctx, &total_sz );
+        fd_vote_block_timestamp_t last_timestamp;
+        int err = fd_vote_get_last_timestamp( n->elem.value.data, n->elem.value.data_len, &last_timestamp );
         if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) {
           FD_LOG_WARNING(( "Vote state versioned decode footprint failed" ));
           continue;
         }
 
-        uchar * mem = fd_spad_alloc( runtime_spad, fd_vote_state_versioned_align(), total_sz );
-        if( FD_UNLIKELY( !mem ) ) {
-          FD_LOG_ERR(( "Unable to allocate memory for vote state versioned" ));
-        }
-
-        fd_vote_state_versioned_t * vsv = fd_vote_state_versioned_decode( mem, &ctx );
-
-        switch( vsv->discriminant ) {
-          case fd_vote_state_versioned_enum_v0_23_5:
-            vote_timestamp = (ulong)vsv->inner.v0_23_5.last_timestamp.timestamp;
-            vote_slot = vsv->inner.v0_23_5.last_timestamp.slot;
-            break;
-          case fd_vote_state_versioned_enum_v1_14_11:
-            vote_timestamp = (ulong)vsv->inner.v1_14_11.last_timestamp.timestamp;
-            vote_slot = vsv->inner.v1_14_11.last_timestamp.slot;
-            break;
-          case fd_vote_state_versioned_enum_current:
-            vote_timestamp = (ulong)vsv->inner.current.last_timestamp.timestamp;
-            vote_slot = vsv->inner.current.last_timestamp.slot;
-            break;
-          default:
-            __builtin_unreachable();
-        }
+        vote_timestamp = (ulong)last_timestamp.timestamp;
+        vote_slot      = last_timestamp.slot;
 
       } else {
         vote_timestamp = (ulong)vote_acc_node->elem.timestamp;
@@ -0,0 +1,138 @@
+#include "fd_sysvar_cache.h"
+#include "../fd_system_ids.h"
+
+/* set_account writes an account with the given lamports and data into
+   funk_txn. */
+
+static void
+set_account( fd_acc_mgr_t *      acc_mgr,
+             fd_funk_txn_t *     funk_txn,
+             fd_pubkey_t const * pubkey,
+             ulong               lamports,
+             uchar const *       data,
+             ulong               data_sz ) {
+  fd_funk_rec_t *     rec  = NULL;
+  fd_account_meta_t * meta = fd_acc_mgr_modify_raw( acc_mgr, funk_txn, pubkey, 1, data_sz, NULL, &rec, NULL );
+  FD_TEST( meta );
+  meta->dlen          = data_sz;
+  meta->info.lamports = lamports;
+  fd_memcpy( (uchar *)meta + meta->hlen, data, data_sz );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  char const * _page_sz = fd_env_strip_cmdline_cstr  ( &argc, &argv, "--page-sz",  NULL,        "normal" );
+  ulong        page_cnt = fd_env_strip_cmdline_ulong ( &argc, &argv, "--page-cnt", NULL,         32768UL );
+  ulong        near_cpu = fd_env_strip_cmdline_ulong ( &argc, &argv, "--near-cpu", NULL, fd_log_cpu_id() );
+
+  fd_wksp_t * wksp = fd_wksp_new_anonymous( fd_cstr_to_shmem_page_sz( _page_sz ), page_cnt, near_cpu, "wksp", 0UL );
+  FD_TEST( wksp );
+
+  ulong const static_tag = 1UL;
+  ulong const funk_tag   = 42UL;
+  fd_funk_t * funk = fd_funk_join( fd_funk_new( fd_wksp_alloc_laddr( wksp, fd_funk_align(), fd_funk_footprint(), funk_tag ), funk_tag, 1234UL, 16UL, 64UL ) );
+  FD_TEST( funk );
+  fd_funk_start_write( funk );
+
+  fd_acc_mgr_t * acc_mgr = fd_acc_mgr_new( fd_wksp_alloc_laddr( wksp, FD_ACC_MGR_ALIGN, FD_ACC_MGR_FOOTPRINT, static_tag ), funk );
+  FD_TEST( acc_mgr );
+
+  ulong       spad_sz = 1048576UL;
+  fd_spad_t * spad    = fd_spad_join( fd_spad_new( fd_wksp_alloc_laddr( wksp, FD_SPAD_ALIGN, FD_SPAD_FOOTPRINT( spad_sz ), static_tag ), spad_sz ) );
+  FD_TEST( spad );
+  fd_spad_push( spad );
+
+  fd_sysvar_cache_t * cache = fd_sysvar_cache_new( fd_spad_alloc( spad, fd_sysvar_cache_align(), fd_sysvar_cache_footprint() ), spad );
+  FD_TEST( cache );
+
+  fd_funk_txn_xid_t xid[1] = {{ .ul = { 1UL, 1UL } }};
+  fd_funk_txn_t *   txn    = fd_funk_txn_prepare( funk, NULL, xid, 0 );
+  FD_TEST( txn );
+
+  /* Missing sysvars have no value and no image */
+
+  ulong sz = 0UL;
+  fd_sysvar_cache_restore( cache, acc_mgr, txn );
+  FD_TEST( !fd_sysvar_cache_clock( cache ) );
+  FD_TEST( !fd_sysvar_cache_data( cache, &fd_sysvar_clock_id, &sz ) );
+  FD_TEST( !fd_sysvar_cache_data( cache, &fd_solana_system_program_id, &sz ) );
+  FD_TEST( cache->decode_cnt==0UL );
+
+  /* Restoring a sysvar parses it and keeps an image of the account */
+
+  fd_sol_sysvar_clock_t clock = { .slot = 10UL, .epoch_start_timestamp = 1L, .epoch = 2UL, .leader_schedule_epoch = 3UL, .unix_timestamp = 4L };
+  uchar clock_data[ FD_SYSVAR_CACHE_IMG_MAX_clock ];
+  fd_bincode_encode_ctx_t encode = { .data = clock_data, .dataend = clock_data + sizeof(clock_data) };
+  FD_TEST( fd_sol_sysvar_clock_encode( &clock, &encode )==FD_BINCODE_SUCCESS );
+  FD_TEST( encode.data==clock_data + sizeof(clock_data) );
+  set_account( acc_mgr, txn, &fd_sysvar_clock_id, 1UL, clock_data, sizeof(clock_data) );
+
+  fd_sysvar_cache_restore_clock( cache, acc_mgr, txn );
+  FD_TEST( fd_sysvar_cache_clock( cache ) );
+  FD_TEST( fd_sysvar_cache_clock( cache )->slot==10UL );
+  FD_TEST( fd_sysvar_cache_clock( cache )->unix_timestamp==4L );
+  FD_TEST( cache->decode_cnt==1UL && cache->reuse_cnt==0UL );
+
+  uchar const * img = fd_sysvar_cache_data( cache, &fd_sysvar_clock_id, &sz );
+  FD_TEST( img );
+  FD_TEST( sz==sizeof(clock_data) );
+  FD_TEST( 0==memcmp( img, clock_data, sz ) );
+
+  /* Restoring an unchanged sysvar keeps the parsed value */
+
+  fd_sysvar_cache_restore_clock( cache, acc_mgr, txn );
+  FD_TEST( fd_sysvar_cache_clock( cache )->slot==10UL );
+  FD_TEST( cache->decode_cnt==1UL && cache->reuse_cnt==1UL );
+
+  /* Restoring a changed sysvar parses it again */
+
+  clock.slot = 11UL;
+  encode = (fd_bincode_encode_ctx_t){ .data = clock_data, .dataend = clock_data + sizeof(clock_data) };
+  FD_TEST( fd_sol_sysvar_clock_encode( &clock, &encode )==FD_BINCODE_SUCCESS );
+  set_account( acc_mgr, txn, &fd_sysvar_clock_id, 1UL, clock_data, sizeof(clock_data) );
+
+  fd_sysvar_cache_restore_clock( cache, acc_mgr, txn );
+  FD_TEST( fd_sysvar_cache_clock( cache )->slot==11UL );
+  FD_TEST( cache->decode_cnt==2UL && cache->reuse_cnt==1UL );
+  img = fd_sysvar_cache_data( cache, &fd_sysvar_clock_id, &sz );
+  FD_TEST( img && sz==sizeof(clock_data) && 0==memcmp( img, clock_data, sz ) );
+
+  /* Sysvars with heap parts are parsed on every restore */
+
+  uchar slot_hashes_data[ 8UL+2UL*40UL ] = {0};
+  FD_STORE( ulong, slot_hashes_data,       2UL );
+  FD_STORE( ulong, slot_hashes_data+ 8UL, 11UL );
+  FD_STORE( ulong, slot_hashes_data+48UL, 10UL );
+  slot_hashes_data[ 16UL ] = 0xaa;
+  set_account( acc_mgr, txn, &fd_sysvar_slot_hashes_id, 1UL, slot_hashes_data, sizeof(slot_hashes_data) );
+
+  for( ulong i=1UL; i<=2UL; i++ ) {
+    fd_sysvar_cache_restore_slot_hashes( cache, acc_mgr, txn );
+    fd_slot_hashes_t const * slot_hashes = fd_sysvar_cache_slot_hashes( cache );
+    FD_TEST( slot_hashes );
+    FD_TEST( deq_fd_slot_hash_t_cnt( slot_hashes->hashes )==2UL );
+    FD_TEST( deq_fd_slot_hash_t_peek_head_const( slot_hashes->hashes )->slot==11UL );
+    FD_TEST( deq_fd_slot_hash_t_peek_head_const( slot_hashes->hashes )->hash.uc[0]==0xaa );
+    FD_TEST( cache->decode_cnt==2UL+i && cache->reuse_cnt==1UL );
+  }
+  img = fd_sysvar_cache_data( cache, &fd_sysvar_slot_hashes_id, &sz );
+  FD_TEST( img && sz==sizeof(slot_hashes_data) && 0==memcmp( img, slot_hashes_data, sz ) );
+
+  /* Deleted sysvars lose their image */
+
+  set_account( acc_mgr, txn, &fd_sysvar_clock_id, 0UL, clock_data, sizeof(clock_data) );
+  fd_sysvar_cache_restore_clock( cache, acc_mgr, txn );
+  FD_TEST( !fd_sysvar_cache_data( cache, &fd_sysvar_clock_id, &sz ) );
+
+  FD_TEST( fd_sysvar_cache_delete( cache )==cache );
+  fd_spad_pop( spad );
+
+  fd_funk_end_write( funk );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
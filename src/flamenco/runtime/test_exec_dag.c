@@ -0,0 +1,249 @@
+#include "fd_exec_dag.h"
+
+#define TXN_MAX  (512UL)
+#define ACCT_MAX (4096UL)
+#define REF_MAX  (8UL)
+
+static uchar dag_mem[ 1UL<<22 ] __attribute__((aligned(FD_EXEC_DAG_ALIGN)));
+
+/* Reference model of the transactions inserted in the dag */
+
+struct test_txn {
+  int            barrier;
+  ulong          w_cnt;
+  ulong          r_cnt;
+  fd_acct_addr_t w[ REF_MAX ];
+  fd_acct_addr_t r[ REF_MAX ];
+  int            popped;
+  int            done;
+};
+typedef struct test_txn test_txn_t;
+
+static test_txn_t txns[ TXN_MAX ];
+
+static fd_acct_addr_t *
+addr_set( fd_acct_addr_t * addr,
+          ulong            k ) {
+  memset( addr, 0, sizeof(fd_acct_addr_t) );
+  /* k==0 is the all zero address.  k goes into the leading bytes, which
+     are the ones the account map hashes. */
+  FD_STORE( ulong, addr->b, k );
+  return addr;
+}
+
+static int
+refs( test_txn_t const *     txn,
+      fd_acct_addr_t const * addr,
+      int                    write ) {
+  for( ulong i=0UL; i<txn->w_cnt; i++ ) if( !memcmp( txn->w+i, addr, sizeof(fd_acct_addr_t) ) ) return 1;
+  if( write ) return 0;
+  for( ulong i=0UL; i<txn->r_cnt; i++ ) if( !memcmp( txn->r+i, addr, sizeof(fd_acct_addr_t) ) ) return 1;
+  return 0;
+}
+
+static int
+conflicts( test_txn_t const * a,
+           test_txn_t const * b ) {
+  if( a->barrier || b->barrier ) return 1;
+  for( ulong i=0UL; i<a->w_cnt; i++ ) if( refs( b, a->w+i, 0 ) ) return 1;
+  for( ulong i=0UL; i<a->r_cnt; i++ ) if( refs( b, a->r+i, 1 ) ) return 1;
+  return 0;
+}
+
+/* pop pops a ready txn and checks that every earlier conflicting txn
+   has completed and that no ready txn was missed. */
+
+static ulong
+pop( fd_exec_dag_t * dag,
+     ulong           txn_cnt ) {
+  ulong idx = fd_exec_dag_ready_pop( dag );
+  if( idx==ULONG_MAX ) {
+    /* Nothing ready means every unpopped txn has an incomplete
+       earlier conflicting txn */
+    for( ulong j=0UL; j<txn_cnt; j++ ) {
+      if( txns[j].popped ) continue;
+      int blocked = 0;
+      for( ulong i=0UL; i<j; i++ ) blocked |= (!txns[i].done) & conflicts( txns+i, txns+j );
+      FD_TEST( blocked );
+    }
+    return ULONG_MAX;
+  }
+  FD_TEST( idx<txn_cnt );
+  FD_TEST( !txns[idx].popped );
+  for( ulong i=0UL; i<idx; i++ ) if( conflicts( txns+i, txns+idx ) ) FD_TEST( txns[i].done );
+  txns[idx].popped = 1;
+  return idx;
+}
+
+static void
+complete( fd_exec_dag_t * dag,
+          ulong           idx ) {
+  txns[idx].done = 1;
+  fd_exec_dag_complete( dag, idx );
+}
+
+static ulong
+insert_rand( fd_exec_dag_t * dag,
+             fd_rng_t *      rng,
+             ulong           acct_cnt ) {
+  ulong        idx = fd_exec_dag_txn_cnt( dag );
+  test_txn_t * txn = txns + idx;
+  memset( txn, 0, sizeof(test_txn_t) );
+  txn->barrier = !fd_rng_uint_roll( rng, 64U );
+  if( txn->barrier ) {
+    FD_TEST( fd_exec_dag_insert_barrier( dag )==idx );
+    return idx;
+  }
+  txn->w_cnt = fd_rng_ulong_roll( rng, REF_MAX+1UL );
+  txn->r_cnt = fd_rng_ulong_roll( rng, REF_MAX+1UL );
+  for( ulong i=0UL; i<txn->w_cnt; i++ ) addr_set( txn->w+i, fd_rng_ulong_roll( rng, acct_cnt ) );
+  for( ulong i=0UL; i<txn->r_cnt; i++ ) addr_set( txn->r+i, fd_rng_ulong_roll( rng, acct_cnt ) );
+  FD_TEST( fd_exec_dag_insert( dag, txn->w, txn->w_cnt, txn->r, txn->r_cnt )==idx );
+  return idx;
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  ulong iter_max = fd_env_strip_cmdline_ulong( &argc, &argv, "--iter-max", NULL, 64UL );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  /* Bad args */
+
+  FD_TEST( fd_exec_dag_align()==FD_EXEC_DAG_ALIGN );
+  FD_TEST( !fd_exec_dag_footprint( 0UL,      ACCT_MAX ) );
+  FD_TEST( !fd_exec_dag_footprint( TXN_MAX,  0UL      ) );
+  FD_TEST( !fd_exec_dag_footprint( ULONG_MAX, ACCT_MAX ) );
+  ulong footprint = fd_exec_dag_footprint( TXN_MAX, ACCT_MAX );
+  FD_TEST( footprint && footprint<=sizeof(dag_mem) );
+
+  FD_TEST( !fd_exec_dag_new( NULL,        TXN_MAX, ACCT_MAX ) );
+  FD_TEST( !fd_exec_dag_new( dag_mem+1UL, TXN_MAX, ACCT_MAX ) );
+  FD_TEST( !fd_exec_dag_new( dag_mem,     0UL,     ACCT_MAX ) );
+  FD_TEST( !fd_exec_dag_join( NULL        ) );
+  FD_TEST( !fd_exec_dag_join( dag_mem+1UL ) );
+  FD_TEST( !fd_exec_dag_join( dag_mem     ) ); /* not formatted */
+
+  fd_exec_dag_t * dag = fd_exec_dag_join( fd_exec_dag_new( dag_mem, TXN_MAX, ACCT_MAX ) );
+  FD_TEST( dag );
+
+  /* Basic dependencies */
+
+  fd_acct_addr_t a[1]; addr_set( a, 1UL );
+  fd_acct_addr_t b[1]; addr_set( b, 2UL );
+  fd_acct_addr_t z[1]; addr_set( z, 0UL );
+
+  FD_TEST( fd_exec_dag_insert( dag, a,    1UL, b,    1UL )==0UL ); /* w a, r b */
+  FD_TEST( fd_exec_dag_insert( dag, NULL, 0UL, b,    1UL )==1UL ); /* r b: independent of 0 */
+  FD_TEST( fd_exec_dag_insert( dag, NULL, 0UL, a,    1UL )==2UL ); /* r a: after 0 */
+  FD_TEST( fd_exec_dag_insert( dag, b,    1UL, NULL, 0UL )==3UL ); /* w b: after 0 and 1 */
+  FD_TEST( fd_exec_dag_insert( dag, z,    1UL, z,    1UL )==4UL ); /* w/r zero: independent */
+  FD_TEST( fd_exec_dag_insert( dag, z,    1UL, NULL, 0UL )==5UL ); /* w zero: after 4 */
+  FD_TEST( fd_exec_dag_txn_cnt  ( dag )==6UL );
+  FD_TEST( fd_exec_dag_ready_cnt( dag )==3UL );
+  FD_TEST( fd_exec_dag_depth    ( dag )==2UL );
+
+  FD_TEST( fd_exec_dag_ready_pop( dag )==0UL );
+  FD_TEST( fd_exec_dag_ready_pop( dag )==1UL );
+  FD_TEST( fd_exec_dag_ready_pop( dag )==4UL );
+  FD_TEST( fd_exec_dag_ready_pop( dag )==ULONG_MAX );
+  fd_exec_dag_complete( dag, 1UL ); FD_TEST( fd_exec_dag_ready_pop( dag )==ULONG_MAX );
+  fd_exec_dag_complete( dag, 0UL ); FD_TEST( fd_exec_dag_ready_cnt( dag )==2UL );
+  ulong p0 = fd_exec_dag_ready_pop( dag );
+  ulong p1 = fd_exec_dag_ready_pop( dag );
+  FD_TEST( fd_ulong_min( p0, p1 )==2UL && fd_ulong_max( p0, p1 )==3UL );
+  fd_exec_dag_complete( dag, 4UL ); FD_TEST( fd_exec_dag_ready_pop( dag )==5UL );
+
+  /* A txn whose conflicts already completed is immediately ready and a
+     barrier waits for everything before it */
+
+  FD_TEST( fd_exec_dag_insert( dag, a, 1UL, NULL, 0UL )==6UL );  /* w a: after 2 (incomplete) */
+  FD_TEST( fd_exec_dag_insert_barrier( dag )==7UL );
+  FD_TEST( fd_exec_dag_insert( dag, NULL, 0UL, NULL, 0UL )==8UL ); /* after barrier */
+  FD_TEST( fd_exec_dag_ready_pop( dag )==ULONG_MAX );
+  fd_exec_dag_complete( dag, 2UL ); FD_TEST( fd_exec_dag_ready_pop( dag )==6UL );
+  fd_exec_dag_complete( dag, 3UL );
+  fd_exec_dag_complete( dag, 5UL );
+  fd_exec_dag_complete( dag, 6UL ); FD_TEST( fd_exec_dag_ready_pop( dag )==7UL );
+  fd_exec_dag_complete( dag, 7UL ); FD_TEST( fd_exec_dag_ready_pop( dag )==8UL );
+  fd_exec_dag_complete( dag, 8UL );
+  FD_TEST( fd_exec_dag_done_cnt( dag )==fd_exec_dag_txn_cnt( dag ) );
+
+  /* Capacity */
+
+  fd_exec_dag_reset( dag );
+  FD_TEST( !fd_exec_dag_txn_cnt( dag ) && !fd_exec_dag_ready_cnt( dag ) );
+  FD_TEST( !fd_exec_dag_depth( dag ) );
+  for( ulong i=0UL; i<TXN_MAX; i++ ) FD_TEST( fd_exec_dag_insert( dag, a, 1UL, NULL, 0UL )==i );
+  FD_TEST( fd_exec_dag_depth( dag )==TXN_MAX );
+  FD_TEST( fd_exec_dag_insert( dag, a, 1UL, NULL, 0UL )==ULONG_MAX );
+  FD_TEST( fd_exec_dag_insert_barrier( dag )==ULONG_MAX );
+  FD_TEST( fd_exec_dag_ready_cnt( dag )==1UL );
+  for( ulong i=0UL; i<TXN_MAX; i++ ) {
+    FD_TEST( fd_exec_dag_ready_pop( dag )==i );
+    FD_TEST( fd_exec_dag_ready_pop( dag )==ULONG_MAX );
+    fd_exec_dag_complete( dag, i );
+  }
+
+  fd_exec_dag_reset( dag );
+  fd_acct_addr_t many[ REF_MAX ];
+  for( ulong i=0UL; i<REF_MAX; i++ ) addr_set( many+i, i );
+  ulong ins = 0UL;
+  while( fd_exec_dag_insert( dag, many, REF_MAX, many, REF_MAX )!=ULONG_MAX ) ins++;
+  FD_TEST( ins==(TXN_MAX+ACCT_MAX)/(2UL*REF_MAX+1UL) ); /* each txn also references the barrier pseudo account */
+  FD_TEST( fd_exec_dag_txn_cnt( dag )==ins );
+
+  /* Randomized schedules against a brute force reference */
+
+  for( ulong iter=0UL; iter<iter_max; iter++ ) {
+    fd_exec_dag_reset( dag );
+    ulong acct_cnt = 1UL + fd_rng_ulong_roll( rng, 64UL );
+    ulong txn_cnt  = 1UL + fd_rng_ulong_roll( rng, ACCT_MAX/(2UL*REF_MAX) );
+    ulong pre_cnt  = fd_rng_ulong_roll( rng, txn_cnt+1UL ); /* Txns inserted before execution starts */
+
+    for( ulong i=0UL; i<pre_cnt; i++ ) insert_rand( dag, rng, acct_cnt );
+
+    ulong inflight[ 8 ]; ulong inflight_cnt = 0UL;
+    while( fd_exec_dag_done_cnt( dag )<txn_cnt ) {
+      ulong cnt = fd_exec_dag_txn_cnt( dag );
+      if( cnt<txn_cnt && !fd_rng_uint_roll( rng, 4U ) ) { insert_rand( dag, rng, acct_cnt ); continue; }
+      if( inflight_cnt<8UL ) {
+        ulong idx = pop( dag, cnt );
+        if( idx!=ULONG_MAX ) { inflight[ inflight_cnt++ ] = idx; continue; }
+      }
+      if( !inflight_cnt ) { FD_TEST( cnt<txn_cnt ); insert_rand( dag, rng, acct_cnt ); continue; }
+      ulong j = fd_rng_ulong_roll( rng, inflight_cnt );
+      complete( dag, inflight[ j ] );
+      inflight[ j ] = inflight[ --inflight_cnt ];
+    }
+    FD_TEST( !inflight_cnt );
+    FD_TEST( !fd_exec_dag_ready_cnt( dag ) );
+  }
+
+  FD_TEST( fd_exec_dag_delete( fd_exec_dag_leave( dag ) )==dag_mem );
+  FD_TEST( !fd_exec_dag_join( dag_mem ) );
+
+  /* A dag holding fewer txns than txn_max can reference more distinct
+     accounts than acct_max */
+
+  dag = fd_exec_dag_join( fd_exec_dag_new( dag_mem, TXN_MAX, REF_MAX ) );
+  FD_TEST( dag );
+  static fd_acct_addr_t wide[ TXN_MAX+REF_MAX ];
+  for( ulong i=0UL; i<TXN_MAX+REF_MAX; i++ ) addr_set( wide+i, 1UL+i );
+  FD_TEST( fd_exec_dag_insert( dag, wide, TXN_MAX+REF_MAX, NULL, 0UL )==ULONG_MAX );
+  FD_TEST( fd_exec_dag_insert( dag, wide, TXN_MAX+REF_MAX-1UL, NULL, 0UL )==0UL );
+  FD_TEST( fd_exec_dag_insert_barrier( dag )==ULONG_MAX );
+  FD_TEST( fd_exec_dag_ready_pop( dag )==0UL );
+  fd_exec_dag_complete( dag, 0UL );
+  FD_TEST( fd_exec_dag_done_cnt( dag )==1UL );
+  FD_TEST( fd_exec_dag_delete( fd_exec_dag_leave( dag ) )==dag_mem );
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
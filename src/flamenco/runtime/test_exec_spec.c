@@ -0,0 +1,192 @@
+#include "fd_exec_spec.h"
+
+#define TXN_MAX    (512UL)
+#define ACCT_MAX   (4096UL)
+#define KEY_MAX    (64UL)
+#define REF_MAX    (8UL)
+#define WORKER_MAX (8UL)
+
+static uchar spec_mem[ 1UL<<20 ] __attribute__((aligned(FD_EXEC_SPEC_ALIGN)));
+
+/* Model of a txn: it reads r (and w) and writes a function of what it
+   read to every account in w */
+
+struct test_txn {
+  ulong w_cnt;
+  ulong r_cnt;
+  ulong w[ REF_MAX ];
+  ulong r[ 2UL*REF_MAX ]; /* r includes w */
+  ulong out;              /* Value written by the last execution */
+  ulong start_idx;        /* Commit frontier at the last execution */
+};
+typedef struct test_txn test_txn_t;
+
+static test_txn_t txns[ TXN_MAX ];
+
+static fd_acct_addr_t *
+addr_set( fd_acct_addr_t * addr,
+          ulong            k ) {
+  memset( addr, 0, sizeof(fd_acct_addr_t) );
+  /* k==0 is the all zero address.  k goes into the leading bytes, which
+     are the ones the account map hashes. */
+  FD_STORE( ulong, addr->b, k );
+  return addr;
+}
+
+static void
+exec( test_txn_t *  txn,
+      ulong const * state,
+      ulong         start_idx ) {
+  ulong h = 0UL;
+  for( ulong i=0UL; i<txn->r_cnt; i++ ) h = fd_ulong_hash( h ^ state[ txn->r[i] ] );
+  txn->out       = h;
+  txn->start_idx = start_idx;
+}
+
+static void
+apply( test_txn_t const * txn,
+       ulong *            state ) {
+  for( ulong i=0UL; i<txn->w_cnt; i++ ) state[ txn->w[i] ] = txn->out;
+}
+
+static int
+validate( fd_exec_spec_t *   spec,
+          test_txn_t const * txn ) {
+  fd_acct_addr_t r[ 2UL*REF_MAX ];
+  for( ulong i=0UL; i<txn->r_cnt; i++ ) addr_set( r+i, txn->r[i] );
+  return fd_exec_spec_validate( spec, txn->start_idx, r, txn->r_cnt );
+}
+
+static void
+commit( fd_exec_spec_t *   spec,
+        ulong              idx,
+        test_txn_t const * txn ) {
+  fd_acct_addr_t w[ REF_MAX ];
+  for( ulong i=0UL; i<txn->w_cnt; i++ ) addr_set( w+i, txn->w[i] );
+  fd_exec_spec_commit( spec, idx, w, txn->w_cnt );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  ulong iter_max = fd_env_strip_cmdline_ulong( &argc, &argv, "--iter-max", NULL, 256UL );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  /* Bad args */
+
+  FD_TEST( fd_exec_spec_align()==FD_EXEC_SPEC_ALIGN );
+  FD_TEST( !fd_exec_spec_footprint( 0UL ) );
+  FD_TEST( !fd_exec_spec_footprint( ULONG_MAX ) );
+  FD_TEST( fd_exec_spec_footprint( ACCT_MAX )<=sizeof(spec_mem) );
+
+  FD_TEST( !fd_exec_spec_new( NULL,         ACCT_MAX ) );
+  FD_TEST( !fd_exec_spec_new( spec_mem+1UL, ACCT_MAX ) );
+  FD_TEST( !fd_exec_spec_new( spec_mem,     0UL      ) );
+  FD_TEST( !fd_exec_spec_join( NULL ) );
+  FD_TEST( !fd_exec_spec_join( spec_mem+1UL ) );
+  FD_TEST( !fd_exec_spec_join( spec_mem ) ); /* not formatted */
+
+  fd_exec_spec_t * spec = fd_exec_spec_join( fd_exec_spec_new( spec_mem, ACCT_MAX ) );
+  FD_TEST( spec );
+
+  /* Basic validation */
+
+  fd_acct_addr_t a[1]; addr_set( a, 1UL );
+  fd_acct_addr_t b[1]; addr_set( b, 2UL );
+  fd_acct_addr_t z[1]; addr_set( z, 0UL );
+
+  FD_TEST( fd_exec_spec_validate( spec, 0UL, a, 1UL ) );
+  fd_exec_spec_commit( spec, 0UL, a, 1UL );
+  FD_TEST(  fd_exec_spec_validate( spec, 1UL, a, 1UL ) ); /* started after 0 committed */
+  FD_TEST( !fd_exec_spec_validate( spec, 0UL, a, 1UL ) ); /* started before */
+  FD_TEST(  fd_exec_spec_validate( spec, 0UL, b, 1UL ) ); /* didn't read a */
+  fd_exec_spec_commit( spec, 1UL, z, 1UL );
+  FD_TEST( !fd_exec_spec_validate( spec, 1UL, z, 1UL ) );
+  FD_TEST(  fd_exec_spec_validate( spec, 2UL, z, 1UL ) );
+  FD_TEST( fd_exec_spec_validate_cnt( spec )==6UL );
+  FD_TEST( fd_exec_spec_abort_cnt   ( spec )==2UL );
+
+  fd_exec_spec_reset( spec );
+  FD_TEST( !fd_exec_spec_validate_cnt( spec ) && !fd_exec_spec_abort_cnt( spec ) );
+  FD_TEST( fd_exec_spec_validate( spec, 0UL, a, 1UL ) );
+  FD_TEST( fd_exec_spec_validate( spec, 0UL, z, 1UL ) );
+
+  /* Overflow makes validation conservative */
+
+  fd_exec_spec_t * tiny = fd_exec_spec_join( fd_exec_spec_new( spec_mem, 2UL ) );
+  FD_TEST( tiny );
+  fd_exec_spec_commit( tiny, 0UL, a, 1UL );
+  fd_exec_spec_commit( tiny, 1UL, b, 1UL );
+  fd_acct_addr_t c[1]; addr_set( c, 3UL );
+  fd_exec_spec_commit( tiny, 2UL, c, 1UL ); /* doesn't fit */
+  FD_TEST( !fd_exec_spec_validate( tiny, 2UL, z, 1UL ) );
+  FD_TEST(  fd_exec_spec_validate( tiny, 3UL, c, 1UL ) );
+  FD_TEST( fd_exec_spec_delete( fd_exec_spec_leave( tiny ) )==spec_mem );
+  spec = fd_exec_spec_join( fd_exec_spec_new( spec_mem, ACCT_MAX ) );
+  FD_TEST( spec );
+
+  /* Randomized optimistic execution against serial execution */
+
+  static ulong serial_state[ KEY_MAX ];
+  static ulong spec_state  [ KEY_MAX ];
+
+  ulong abort_tot = 0UL;
+  for( ulong iter=0UL; iter<iter_max; iter++ ) {
+    ulong key_cnt    = 1UL + fd_rng_ulong_roll( rng, KEY_MAX );
+    ulong txn_cnt    = 1UL + fd_rng_ulong_roll( rng, TXN_MAX );
+    ulong worker_cnt = 1UL + fd_rng_ulong_roll( rng, WORKER_MAX );
+
+    for( ulong k=0UL; k<key_cnt; k++ ) serial_state[k] = spec_state[k] = fd_rng_ulong( rng );
+
+    for( ulong i=0UL; i<txn_cnt; i++ ) {
+      test_txn_t * txn = txns + i;
+      txn->w_cnt = fd_rng_ulong_roll( rng, REF_MAX+1UL );
+      txn->r_cnt = 0UL;
+      for( ulong j=0UL; j<txn->w_cnt; j++ ) txn->r[ txn->r_cnt++ ] = txn->w[j] = fd_rng_ulong_roll( rng, key_cnt );
+      ulong r_cnt = fd_rng_ulong_roll( rng, REF_MAX+1UL );
+      for( ulong j=0UL; j<r_cnt; j++ ) txn->r[ txn->r_cnt++ ] = fd_rng_ulong_roll( rng, key_cnt );
+    }
+
+    for( ulong i=0UL; i<txn_cnt; i++ ) { exec( txns+i, serial_state, i ); apply( txns+i, serial_state ); }
+
+    /* Up to worker_cnt txns in [commit_idx,next_idx) execute against
+       the committed state at the time they were dispatched.  Completion
+       order is random but commits are in order. */
+
+    fd_exec_spec_reset( spec );
+    ulong commit_idx = 0UL;
+    ulong next_idx   = 0UL;
+    while( commit_idx<txn_cnt ) {
+      if( next_idx<txn_cnt && next_idx-commit_idx<worker_cnt && fd_rng_uint_roll( rng, 2U ) ) {
+        exec( txns+next_idx, spec_state, commit_idx );
+        next_idx++;
+        continue;
+      }
+      if( next_idx==commit_idx ) continue;
+      test_txn_t * txn = txns + commit_idx;
+      if( !validate( spec, txn ) ) {
+        exec( txn, spec_state, commit_idx ); /* Re-execute */
+        FD_TEST( validate( spec, txn ) );
+      }
+      apply( txn, spec_state );
+      commit( spec, commit_idx, txn );
+      commit_idx++;
+    }
+
+    for( ulong k=0UL; k<key_cnt; k++ ) FD_TEST( spec_state[k]==serial_state[k] );
+    abort_tot += fd_exec_spec_abort_cnt( spec );
+  }
+  FD_LOG_NOTICE(( "aborts over %lu iterations: %lu", iter_max, abort_tot ));
+
+  FD_TEST( fd_exec_spec_delete( fd_exec_spec_leave( spec ) )==spec_mem );
+  FD_TEST( !fd_exec_spec_join( spec_mem ) );
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -54,6 +54,33 @@ insert( ulong _blockhash,
     FD_LOG_ERR(( "fd_txncache_insert_batch() failed %lu %lu %lu", _blockhash, _txnhash, slot ));
 }
 
+/* fill inserts txns with txnhashes _txnhash, _txnhash+1, ... into
+   _blockhash until the blockhash is full, and returns the number of
+   txns inserted. */
+
+static ulong
+fill( ulong _blockhash,
+      ulong _txnhash,
+      ulong slot ) {
+  uchar blockhash[ 32 ] = {0};
+  uchar txnhash[ 32 ] = {0};
+  uchar result[ 1 ] = {0};
+  FD_STORE( ulong, blockhash, _blockhash );
+
+  fd_txncache_insert_t insert = {
+    .blockhash = blockhash,
+    .txnhash   = txnhash,
+    .slot      = slot,
+    .result    = result,
+  };
+  ulong cnt = 0UL;
+  for(;;) {
+    FD_STORE( ulong, txnhash, _txnhash+cnt );
+    if( !fd_txncache_insert_batch( (fd_txncache_t*)txncache_scratch, &insert, 1 ) ) return cnt;
+    cnt++;
+  }
+}
+
 static void
 no_insert( ulong _blockhash,
            ulong _txnhash,
@@ -436,12 +463,69 @@ test_full_blockhash( void ) {
     }
   }
 
+  /* The overflow nodes of the txnhash index are sized for the worst
+     case, so a few more txns may fit */
+  FD_TEST( fill( 0UL, 150UL*524288UL, 0UL )<=150UL*524288UL/4UL );
   no_insert( 0UL, 0UL, 0UL );
   no_insert( 0UL, 524288UL, 0UL );
   insert( 1UL, 0UL, 0UL );
   insert( 2UL, 0UL, 0UL );
 }
 
+/* test_bucket_overflow inserts txns that all go to the same bucket of
+   the txnhash index, half of them with the same prefix, such that the
+   bucket overflows into a chain of nodes, and queries them in one
+   batch along with txns that are not present. */
+
+#define OVERFLOW_TXN_CNT (200UL)
+
+void
+test_bucket_overflow( void ) {
+  FD_LOG_NOTICE(( "TEST BUCKET OVERFLOW" ));
+
+  init_all( FD_TXNCACHE_DEFAULT_MAX_ROOTED_SLOTS,
+            TXNCACHE_LIVE_SLOTS,
+            FD_TXNCACHE_DEFAULT_MAX_TRANSACTIONS_PER_SLOT );
+
+  static uchar        blockhash[ 32 ];
+  static uchar        txnhash  [ 2UL*OVERFLOW_TXN_CNT ][ 32 ];
+  uchar               result   [ 1 ] = {0};
+  fd_txncache_query_t query    [ 2UL*OVERFLOW_TXN_CNT ];
+  int                 results  [ 2UL*OVERFLOW_TXN_CNT ];
+
+  /* Same bucket (bytes [0,8) equal modulo the bucket count), prefix
+     (bytes [8,12)) unique for even i and shared for odd i, and the
+     txns with i>=OVERFLOW_TXN_CNT are never inserted */
+  for( ulong i=0UL; i<2UL*OVERFLOW_TXN_CNT; i++ ) {
+    FD_STORE( ulong, txnhash[ i ],       7UL + (i<<20) );
+    FD_STORE( uint,  txnhash[ i ]+8UL,   (i&1UL) ? 42U : (uint)i );
+    FD_STORE( ulong, txnhash[ i ]+12UL,  i );
+    query[ i ].blockhash = blockhash;
+    query[ i ].txnhash   = txnhash[ i ];
+  }
+
+  for( ulong i=0UL; i<OVERFLOW_TXN_CNT; i++ ) {
+    fd_txncache_insert_t insert = {
+      .blockhash = blockhash,
+      .txnhash   = txnhash[ i ],
+      .slot      = i,
+      .result    = result,
+    };
+    FD_TEST( fd_txncache_insert_batch( (fd_txncache_t*)txncache_scratch, &insert, 1UL ) );
+  }
+
+  fd_txncache_query_batch( (fd_txncache_t*)txncache_scratch, query, 2UL*OVERFLOW_TXN_CNT, NULL, NULL, results );
+  for( ulong i=0UL; i<2UL*OVERFLOW_TXN_CNT; i++ ) FD_TEST( results[ i ]==(i<OVERFLOW_TXN_CNT) );
+
+  for( ulong i=0UL; i<OVERFLOW_TXN_CNT; i++ ) {
+    ulong slot = i;
+    fd_txncache_query_batch( (fd_txncache_t*)txncache_scratch, query+i, 1UL, &slot, query_fn, results );
+    FD_TEST( results[ 0 ] );
+    slot = i+1UL;
+    fd_txncache_query_batch( (fd_txncache_t*)txncache_scratch, query+i, 1UL, &slot, query_fn, results );
+    FD_TEST( !results[ 0 ] );
+  }
+}
 
 void
 test_insert_forks( void ) {
@@ -565,6 +649,9 @@ test_full_blockhash_concurrent( void ) {
     FD_TEST( !pthread_join( threads2[i], NULL ) );
   }
 
+  /* The overflow nodes of the txnhash index are sized for the worst
+     case, so a few more txns may fit */
+  FD_TEST( fill( 0UL, 150UL*524288UL, 0UL )<=150UL*524288UL/4UL );
   no_insert( 0UL, 0UL, 0UL );
   no_insert( 0UL, 524288UL, 0UL );
   insert( 1UL, 0UL, 0UL );
@@ -630,11 +717,204 @@ test_cache_full( void ) {
   }
 }
 
+#define SLOT_DELTAS_SPAD_MAX (1UL<<24)
+
+static uchar spad_mem[ FD_SPAD_FOOTPRINT( SLOT_DELTAS_SPAD_MAX ) ] __attribute__((aligned(FD_SPAD_ALIGN)));
+
+static fd_txncache_t * write_slot_deltas_root_tc;
+
+static int
+write_slot_deltas_fn( uchar const * data,
+                      ulong         data_sz,
+                      void *        ctx ) {
+  fd_bincode_encode_ctx_t * out = (fd_bincode_encode_ctx_t *)ctx;
+  FD_TEST( data_sz && data_sz<=FD_TXNCACHE_WRITE_SLOT_DELTAS_BUF_MIN );
+  if( FD_UNLIKELY( (ulong)((uchar *)out->dataend-(uchar *)out->data)<data_sz ) ) return -1;
+  memcpy( out->data, data, data_sz );
+  out->data = (uchar *)out->data + data_sz;
+
+  /* Registers a root while the lock is released, if requested */
+  if( write_slot_deltas_root_tc ) {
+    fd_txncache_register_root_slot( write_slot_deltas_root_tc, 8UL );
+    write_slot_deltas_root_tc = NULL;
+  }
+  return 0;
+}
+
+void
+test_write_slot_deltas( void ) {
+  FD_LOG_NOTICE(( "TEST WRITE SLOT DELTAS" ));
+
+  fd_txncache_t * tc = init_all( FD_TXNCACHE_DEFAULT_MAX_ROOTED_SLOTS,
+                                 TXNCACHE_LIVE_SLOTS,
+                                 FD_TXNCACHE_DEFAULT_MAX_TRANSACTIONS_PER_SLOT );
+
+  /* More rooted statuses than are visited per hold of the lock */
+
+  for( ulong slot=0UL; slot<12UL; slot++ ) {
+    for( ulong i=0UL; i<256UL*slot; i++ ) {
+      uchar blockhash[ 32 ] = {0};
+      uchar txnhash[ 32 ]   = {0};
+      uchar result[ 1 ]     = { (uchar)(i&1UL) };
+      FD_STORE( ulong, blockhash, i%3UL );
+      FD_STORE( ulong, txnhash,   fd_ulong_hash( slot<<32 | i ) );
+      fd_txncache_insert_t insert = { .blockhash = blockhash, .txnhash = txnhash, .slot = slot, .result = result };
+      FD_TEST( fd_txncache_insert_batch( tc, &insert, 1UL ) );
+    }
+  }
+  for( ulong slot=0UL; slot<8UL; slot++ ) fd_txncache_register_root_slot( tc, slot );
+
+  fd_spad_t * spad = fd_spad_join( fd_spad_new( spad_mem, SLOT_DELTAS_SPAD_MAX ) );
+  FD_TEST( spad );
+
+  FD_SPAD_FRAME_BEGIN( spad ) {
+
+    /* Reference encoding */
+
+    fd_bank_slot_deltas_t slot_deltas[1] = {0};
+    FD_TEST( !fd_txncache_get_entries( tc, slot_deltas, spad ) );
+    ulong   ref_sz = fd_bank_slot_deltas_size( slot_deltas );
+    uchar * ref    = fd_spad_alloc( spad, 8UL, ref_sz );
+    fd_bincode_encode_ctx_t encode = { .data = ref, .dataend = ref+ref_sz };
+    FD_TEST( !fd_bank_slot_deltas_encode( slot_deltas, &encode ) );
+
+    /* Streamed encoding through the smallest staging buffer */
+
+    uchar buf[ FD_TXNCACHE_WRITE_SLOT_DELTAS_BUF_MIN ];
+    uchar * out = fd_spad_alloc( spad, 8UL, ref_sz );
+    fd_bincode_encode_ctx_t stream = { .data = out, .dataend = out+ref_sz };
+    FD_TEST( !fd_txncache_write_slot_deltas( tc, buf, sizeof(buf), &stream, write_slot_deltas_fn ) );
+    FD_TEST( (ulong)((uchar *)stream.data-out)==ref_sz );
+    FD_TEST( !memcmp( out, ref, ref_sz ) );
+
+    /* Bad args and write failures */
+
+    stream.data = out;
+    FD_TEST( fd_txncache_write_slot_deltas( tc, NULL, sizeof(buf),     &stream, write_slot_deltas_fn )==-1 );
+    FD_TEST( fd_txncache_write_slot_deltas( tc, buf,  sizeof(buf)-1UL, &stream, write_slot_deltas_fn )==-1 );
+    FD_TEST( fd_txncache_write_slot_deltas( tc, buf,  sizeof(buf),     &stream, NULL                 )==-1 );
+    stream.dataend = out+ref_sz-1UL;
+    FD_TEST( fd_txncache_write_slot_deltas( tc, buf,  sizeof(buf),     &stream, write_slot_deltas_fn )==-1 );
+
+    /* Roots registered while the lock is released are detected */
+
+    stream.data    = out;
+    stream.dataend = out+ref_sz;
+    write_slot_deltas_root_tc = tc;
+    FD_TEST( fd_txncache_write_slot_deltas( tc, buf,  sizeof(buf),     &stream, write_slot_deltas_fn )==-1 );
+    FD_TEST( !write_slot_deltas_root_tc );
+
+  } FD_SPAD_FRAME_END;
+
+  fd_spad_delete( fd_spad_leave( spad ) );
+}
+
+/* test_bench_insert_query inserts txns in batches from the calling
+   thread while other threads concurrently run batched queries for txns
+   that are known to have been inserted, and reports the rate of
+   each.  Only runs when --bench is given. */
+
+#define BENCH_BLOCKHASH_CNT (4UL)
+#define BENCH_BATCH_CNT     (64UL)
+#define BENCH_INSERT_CNT    (1UL<<22)
+#define BENCH_QUERY_THREADS (2UL)
+
+static volatile ulong bench_inserted;
+static volatile int   bench_done;
+
+static void
+bench_hashes( ulong   i,
+              uchar * blockhash,
+              uchar * txnhash ) {
+  memset( blockhash, 0, 32UL ); FD_STORE( ulong, blockhash, i % BENCH_BLOCKHASH_CNT );
+  memset( txnhash,   0, 32UL ); FD_STORE( ulong, txnhash,   fd_ulong_hash( i ) ); FD_STORE( ulong, txnhash+8UL, fd_ulong_hash( ~i ) );
+}
+
+void *
+bench_query_fn( void * arg ) {
+  ulong * _query_cnt = (ulong *)arg;
+  fd_rng_t rng[1];
+  FD_TEST( fd_rng_join( fd_rng_new( rng, (uint)(ulong)_query_cnt, 0UL ) ) );
+
+  uchar               blockhash[ BENCH_BATCH_CNT ][ 32 ];
+  uchar               txnhash  [ BENCH_BATCH_CNT ][ 32 ];
+  fd_txncache_query_t query    [ BENCH_BATCH_CNT ];
+  int                 results  [ BENCH_BATCH_CNT ];
+
+  ulong query_cnt = 0UL;
+  while( !bench_done ) {
+    ulong inserted = bench_inserted;
+    if( FD_UNLIKELY( !inserted ) ) { FD_SPIN_PAUSE(); continue; }
+    for( ulong j=0UL; j<BENCH_BATCH_CNT; j++ ) {
+      bench_hashes( fd_rng_ulong_roll( rng, inserted ), blockhash[ j ], txnhash[ j ] );
+      query[ j ].blockhash = blockhash[ j ];
+      query[ j ].txnhash   = txnhash  [ j ];
+    }
+    fd_txncache_query_batch( (fd_txncache_t*)txncache_scratch, query, BENCH_BATCH_CNT, NULL, NULL, results );
+    for( ulong j=0UL; j<BENCH_BATCH_CNT; j++ ) FD_TEST( results[ j ] );
+    query_cnt += BENCH_BATCH_CNT;
+  }
+
+  *_query_cnt = query_cnt;
+  return NULL;
+}
+
+void
+test_bench_insert_query( void ) {
+  FD_LOG_NOTICE(( "TEST BENCH INSERT QUERY" ));
+
+  init_all( FD_TXNCACHE_DEFAULT_MAX_ROOTED_SLOTS,
+            TXNCACHE_LIVE_SLOTS,
+            FD_TXNCACHE_DEFAULT_MAX_TRANSACTIONS_PER_SLOT );
+
+  bench_inserted = 0UL;
+  bench_done     = 0;
+
+  pthread_t threads  [ BENCH_QUERY_THREADS ];
+  ulong     query_cnt[ BENCH_QUERY_THREADS ];
+  for( ulong i=0UL; i<BENCH_QUERY_THREADS; i++ ) {
+    FD_TEST( !pthread_create( threads+i, NULL, bench_query_fn, query_cnt+i ) );
+  }
+
+  uchar                blockhash[ BENCH_BATCH_CNT ][ 32 ];
+  uchar                txnhash  [ BENCH_BATCH_CNT ][ 32 ];
+  uchar                result   [ 1 ] = {0};
+  fd_txncache_insert_t insert   [ BENCH_BATCH_CNT ];
+
+  long dt = -fd_log_wallclock();
+  for( ulong i0=0UL; i0<BENCH_INSERT_CNT; i0+=BENCH_BATCH_CNT ) {
+    for( ulong j=0UL; j<BENCH_BATCH_CNT; j++ ) {
+      bench_hashes( i0+j, blockhash[ j ], txnhash[ j ] );
+      insert[ j ].blockhash = blockhash[ j ];
+      insert[ j ].txnhash   = txnhash  [ j ];
+      insert[ j ].slot      = (i0+j) / FD_TXNCACHE_DEFAULT_MAX_TRANSACTIONS_PER_SLOT;
+      insert[ j ].result    = result;
+    }
+    FD_TEST( fd_txncache_insert_batch( (fd_txncache_t*)txncache_scratch, insert, BENCH_BATCH_CNT ) );
+    FD_COMPILER_MFENCE();
+    bench_inserted = i0+BENCH_BATCH_CNT;
+  }
+  dt += fd_log_wallclock();
+
+  bench_done = 1;
+  ulong query_tot = 0UL;
+  for( ulong i=0UL; i<BENCH_QUERY_THREADS; i++ ) {
+    FD_TEST( !pthread_join( threads[i], NULL ) );
+    query_tot += query_cnt[ i ];
+  }
+
+  FD_LOG_NOTICE(( "%lu inserts at %.3f M/s with %lu concurrent query threads at %.3f M/s",
+                  BENCH_INSERT_CNT, 1e3*(double)BENCH_INSERT_CNT/(double)dt,
+                  BENCH_QUERY_THREADS, 1e3*(double)query_tot/(double)dt ));
+}
+
 int
 main( int     argc,
       char ** argv ) {
   fd_boot( &argc, &argv );
 
+  int bench = fd_env_strip_cmdline_contains( &argc, &argv, "--bench" );
+
   ulong max_footprint = fd_txncache_footprint( FD_TXNCACHE_DEFAULT_MAX_ROOTED_SLOTS,
                                                TXNCACHE_LIVE_SLOTS,
                                                FD_TXNCACHE_DEFAULT_MAX_TRANSACTIONS_PER_SLOT,
@@ -651,12 +931,15 @@ main( int     argc,
   test_register_root_slot();
   test_register_root_slot_random();
   test_full_blockhash();
+  test_bucket_overflow();
   test_insert_forks();
   test_purge_gap();
   test_many_blockhashes();
   test_full_blockhash_concurrent();
   test_many_blockhashes_concurrent();
   test_cache_full();
+  test_write_slot_deltas();
+  if( bench ) test_bench_insert_query();
 
   FD_LOG_NOTICE(( "pass" ));
   fd_halt();
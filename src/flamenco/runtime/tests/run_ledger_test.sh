@@ -25,6 +25,7 @@ THREAD_MEM_BOUND="--thread-mem-bound 0"
 CLUSTER_VERSION=""
 DUMP_DIR=${DUMP_DIR:="./dump"}
 ONE_OFFS=""
+REPLAY_SCHED=""
 
 while [[ $# -gt 0 ]]; do
   case $1 in
@@ -91,6 +92,11 @@ while [[ $# -gt 0 ]]; do
         shift
         shift
         ;;
+    --replay-sched)
+        REPLAY_SCHED="--replay-sched $2"
+        shift
+        shift
+        ;;
     -*|--*)
        echo "unknown option $1"
        exit 1
@@ -160,6 +166,7 @@ set -x
     $SNAPSHOT \
     $ONE_OFFS \
     $THREAD_MEM_BOUND \
+    $REPLAY_SCHED \
     --allocator wksp \
     $TILE_CPUS >& $LOG
 
@@ -69,10 +69,13 @@ restore_manifest( void *                 ctx,
 }
 
 static int
-restore_status_cache( void *                  ctx,
-                      fd_bank_slot_deltas_t * slot_deltas,
-                      fd_spad_t *             spad ) {
-  return (!!fd_exec_slot_ctx_recover_status_cache( ctx, slot_deltas, spad ) ? 0 : EINVAL);
+restore_status_cache( void *                                     ctx,
+                      fd_snapshot_restore_status_batch_t const * batch ) {
+  if( !batch->blockhash ) {
+    return (!!fd_exec_slot_ctx_recover_status_cache_slot( ctx, batch->slot, batch->is_root ) ? 0 : EINVAL);
+  }
+  return (!!fd_exec_slot_ctx_recover_status_cache_pair( ctx, batch->slot, batch->blockhash, batch->txn_idx,
+                                                        batch->key_slice[ 0 ], batch->result, batch->status_cnt ) ? 0 : EINVAL);
 }
 
 ulong
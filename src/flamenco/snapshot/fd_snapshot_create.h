@@ -18,6 +18,7 @@
 #define FD_SNAPSHOT_VERSION               ("1.2.0")
 #define FD_SNAPSHOT_VERSION_LEN           (5UL)
 #define FD_SNAPSHOT_STATUS_CACHE_FILE     ("snapshots/status_cache")
+#define FD_SNAPSHOT_STATUS_CACHE_BUF_SZ   (1UL<<20) /* Staging buffer for streaming out the status cache */
 
 #define FD_SNAPSHOT_TMP_ARCHIVE           (".tmp.tar")
 #define FD_SNAPSHOT_TMP_INCR_ARCHIVE      (".tmp_inc.tar")
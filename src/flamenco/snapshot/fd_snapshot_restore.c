@@ -316,57 +316,6 @@ fd_snapshot_restore_manifest( fd_snapshot_restore_t * restore ) {
   return err;
 }
 
-/* fd_snapshot_restore_status_cache imports a status cache manifest into the
-   given slot context. Destroys the existing status cache. */
-
-static int
-fd_snapshot_restore_status_cache( fd_snapshot_restore_t * restore ) {
-
-  if( FD_UNLIKELY( !restore->cb_status_cache ) ) {
-    fd_snapshot_restore_discard_buf( restore );
-
-    restore->status_cache_done = 1;
-    return 0;
-  }
-  /* Decode the status cache slot deltas and populate txn cache
-     in slot ctx. */
-
-  fd_bincode_decode_ctx_t decode = {
-    .data    = restore->buf,
-    .dataend = restore->buf + restore->buf_sz,
-  };
-
-  ulong total_sz   = 0UL;
-  int   decode_err = fd_bank_slot_deltas_decode_footprint( &decode, &total_sz );
-  if( FD_UNLIKELY( decode_err!=FD_BINCODE_SUCCESS ) ) {
-    /* TODO: The types generator does not yet handle OOM correctly.
-             OOM failures won't always end up here, but could also
-             result in a NULL pointer dereference. */
-    FD_LOG_WARNING(( "fd_solana_manifest_decode failed (%d)", decode_err ));
-    return EINVAL;
-  }
-
-  uchar * mem = fd_spad_alloc( restore->spad, fd_bank_slot_deltas_align(), total_sz );
-  if( FD_UNLIKELY( !mem ) ) {
-    FD_LOG_ERR(( "Unable to allocate memory for bank slot deltas" ));
-  }
-
-  fd_bank_slot_deltas_t * slot_deltas = fd_bank_slot_deltas_decode( mem, &decode );
-
-  /* Move over objects and recover state. */
-  /* TODO: we ignore the error from status cache restore for now since having the status cache is optional.
-           Add status cache to all cases */
-  restore->cb_status_cache( restore->cb_status_cache_ctx, slot_deltas, restore->spad );
-
-  /* Discard buffer to reclaim heap space (which could be used by
-     fd_funk accounts instead) */
-
-  fd_snapshot_restore_discard_buf( restore );
-
-  restore->status_cache_done = 1;
-  return 0;
-}
-
 /* fd_snapshot_restore_accv_prepare prepares for consumption of an
    account vec file. */
 
@@ -463,15 +412,27 @@ fd_snapshot_restore_status_cache_prepare( fd_snapshot_restore_t * restore,
     return 0;
   }
 
-  /* We don't support streaming manifest deserialization yet.  Thus,
-     buffer the whole manifest in one place. */
-  if( FD_UNLIKELY( !fd_snapshot_restore_prepare_buf( restore, sz ) ) ) {
+  if( FD_UNLIKELY( !restore->cb_status_cache ) ) {
+    restore->status_cache_done = 1;
+    restore->state             = STATE_IGNORE;
+    return 0;
+  }
+
+  /* The status cache is decoded as it streams in, so only a partially
+     received item is ever buffered. */
+  if( FD_UNLIKELY( !fd_snapshot_restore_prepare_buf( restore, FD_SNAPSHOT_RESTORE_STATUS_CACHE_BUF_SZ ) ) ) {
     restore->failed = 1;
     return ENOMEM;
   }
 
-  restore->state  = STATE_READ_STATUS_CACHE;
-  restore->buf_sz = sz;
+  restore->state               = STATE_READ_STATUS_CACHE;
+  restore->buf_sz              = FD_SNAPSHOT_RESTORE_STATUS_CACHE_BUF_SZ;
+  restore->sc_sz               = sz;
+  restore->sc_state            = SC_STATE_SLOT_CNT;
+  restore->sc_slot_rem         = 0UL;
+  restore->sc_pair_rem         = 0UL;
+  restore->sc_status_rem       = 0UL;
+  restore->sc_batch.status_cnt = 0UL;
 
   return 0;
 }
@@ -630,23 +591,151 @@ fd_snapshot_read_manifest_chunk( fd_snapshot_restore_t * restore,
   return end;
 }
 
-/* fd_snapshot_read_status_cache_chunk reads partial status cache content. */
+/* fd_snapshot_status_cache_emit hands the current status batch to the
+   consumer and starts a new batch. */
+
+static void
+fd_snapshot_status_cache_emit( fd_snapshot_restore_t * restore ) {
+  /* TODO: we ignore the error from status cache restore for now since having the status cache is optional.
+           Add status cache to all cases */
+  restore->cb_status_cache( restore->cb_status_cache_ctx, &restore->sc_batch );
+  restore->sc_batch.status_cnt = 0UL;
+}
+
+/* fd_snapshot_status_cache_next returns the next item expected by the
+   status cache decoder. */
+
+FD_FN_PURE static inline uchar
+fd_snapshot_status_cache_next( fd_snapshot_restore_t const * restore ) {
+  if( restore->sc_status_rem ) return SC_STATE_STATUS;
+  if( restore->sc_pair_rem   ) return SC_STATE_PAIR;
+  if( restore->sc_slot_rem   ) return SC_STATE_SLOT;
+  return SC_STATE_DONE;
+}
+
+/* fd_snapshot_status_cache_decode decodes the complete items staged in
+   the buffer (in the bincode encoding of fd_bank_slot_deltas_t), and
+   moves a trailing partial item to the front of the buffer.  Returns 0
+   on success and EINVAL if the status cache is malformed. */
+
+static int
+fd_snapshot_status_cache_decode( fd_snapshot_restore_t * restore ) {
+
+  fd_snapshot_restore_status_batch_t * batch = &restore->sc_batch;
+
+  uchar const * cur = restore->buf;
+  uchar const * end = restore->buf + restore->buf_ctr;
+  while( restore->sc_state!=SC_STATE_DONE ) {
+    fd_bincode_decode_ctx_t decode = { .data = cur, .dataend = end };
+    int err;
+
+    switch( restore->sc_state ) {
+    case SC_STATE_SLOT_CNT: {
+      ulong slot_cnt;
+      err = fd_bincode_uint64_decode( &slot_cnt, &decode );
+      if( FD_UNLIKELY( err ) ) break;
+      restore->sc_slot_rem = slot_cnt;
+      break;
+    }
+    case SC_STATE_SLOT: {
+      ulong slot;
+      uchar is_root;
+      ulong pair_cnt;
+      err = fd_bincode_uint64_decode( &slot, &decode );
+      if( FD_LIKELY( !err ) ) err = fd_bincode_bool_decode  ( &is_root,  &decode );
+      if( FD_LIKELY( !err ) ) err = fd_bincode_uint64_decode( &pair_cnt, &decode );
+      if( FD_UNLIKELY( err ) ) break;
+      batch->slot      = slot;
+      batch->is_root   = is_root;
+      batch->blockhash = NULL;
+      batch->txn_idx   = 0UL;
+      fd_snapshot_status_cache_emit( restore );
+      restore->sc_slot_rem--;
+      restore->sc_pair_rem = pair_cnt;
+      break;
+    }
+    case SC_STATE_PAIR: {
+      fd_hash_t blockhash;
+      ulong     txn_idx;
+      ulong     status_cnt;
+      err = fd_bincode_bytes_decode( blockhash.uc, sizeof(fd_hash_t), &decode );
+      if( FD_LIKELY( !err ) ) err = fd_bincode_uint64_decode( &txn_idx,    &decode );
+      if( FD_LIKELY( !err ) ) err = fd_bincode_uint64_decode( &status_cnt, &decode );
+      if( FD_UNLIKELY( err ) ) break;
+      restore->sc_blockhash = blockhash;
+      batch->blockhash      = &restore->sc_blockhash;
+      batch->txn_idx        = txn_idx;
+      restore->sc_pair_rem--;
+      restore->sc_status_rem = status_cnt;
+      if( !status_cnt ) fd_snapshot_status_cache_emit( restore );
+      break;
+    }
+    case SC_STATE_STATUS: {
+      /* Only the key slice and the result discriminant are used, the
+         rest of the status is validated and skipped. */
+      ulong total_sz = 0UL;
+      err = fd_cache_status_decode_footprint_inner( &decode, &total_sz );
+      if( FD_UNLIKELY( err ) ) break;
+      ulong idx = batch->status_cnt++;
+      fd_memcpy( batch->key_slice[ idx ], cur, 20UL );
+      batch->result[ idx ] = (uchar)FD_LOAD( uint, cur+20UL );
+      restore->sc_status_rem--;
+      if( batch->status_cnt==FD_SNAPSHOT_RESTORE_STATUS_BATCH_MAX || !restore->sc_status_rem ) {
+        fd_snapshot_status_cache_emit( restore );
+      }
+      break;
+    }
+    default:
+      __builtin_unreachable();
+    }
+
+    if( (err==FD_BINCODE_ERR_UNDERFLOW) | (err==FD_BINCODE_ERR_OVERFLOW) ) break; /* partial item */
+    if( FD_UNLIKELY( err ) ) {
+      FD_LOG_WARNING(( "invalid status cache (%d)", err ));
+      return EINVAL;
+    }
+    cur               = decode.data;
+    restore->sc_state = fd_snapshot_status_cache_next( restore );
+  }
+
+  ulong rem = (ulong)( end-cur );
+  memmove( restore->buf, cur, rem );
+  restore->buf_ctr = rem;
+  return 0;
+}
+
+/* fd_snapshot_read_status_cache_chunk reads partial status cache
+   content and decodes it. */
 
 static uchar const *
 fd_snapshot_read_status_cache_chunk( fd_snapshot_restore_t * restore,
                                      uchar const *           buf,
                                      ulong                   bufsz ) {
-  uchar const * end = fd_snapshot_read_buffered( restore, buf, bufsz );
-  if( fd_snapshot_read_is_complete( restore ) ) {
-    int err = fd_snapshot_restore_status_cache( restore );
-    if( FD_UNLIKELY( err ) ) {
-      FD_LOG_WARNING(( "fd_snapshot_restore_status_cache failed" ));
-      restore->failed = 1;
-      return NULL;
-    }
-    restore->state = STATE_IGNORE;
+  ulong sz = fd_ulong_min( fd_ulong_min( bufsz, restore->sc_sz ), restore->buf_sz-restore->buf_ctr );
+  fd_memcpy( restore->buf + restore->buf_ctr, buf, sz );
+  restore->buf_ctr += sz;
+  restore->sc_sz   -= sz;
+
+  if( FD_UNLIKELY( 0!=fd_snapshot_status_cache_decode( restore ) ) ) {
+    restore->failed = 1;
+    return NULL;
   }
-  return end;
+
+  if( restore->sc_state==SC_STATE_DONE ) {
+    /* Ignore any trailing data */
+    fd_snapshot_restore_discard_buf( restore );
+    restore->status_cache_done = 1;
+    restore->state             = STATE_IGNORE;
+  } else if( FD_UNLIKELY( !restore->sc_sz ) ) {
+    FD_LOG_WARNING(( "status cache truncated" ));
+    restore->failed = 1;
+    return NULL;
+  } else if( FD_UNLIKELY( restore->buf_ctr==restore->buf_sz ) ) {
+    FD_LOG_WARNING(( "status cache item exceeds %lu bytes", restore->buf_sz ));
+    restore->failed = 1;
+    return NULL;
+  }
+  return buf+sz;
 }
 
 /* fd_snapshot_restore_chunk1 consumes at least one byte from the given
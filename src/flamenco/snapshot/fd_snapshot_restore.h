@@ -54,18 +54,40 @@ typedef int
                                           fd_solana_manifest_t * manifest,
                                           fd_spad_t *            spad );
 
-/* fd_snapshot_restore_cb_status_cache_fn_t is a callback that provides the
-   user of snapshot restore with the deserialized slot deltas.  The caller
-   may copy data from the deltas. Any leftover fields will be freed on return.
+/* fd_snapshot_restore_status_batch_t is a part of the status cache
+   (the bank slot deltas), decoded incrementally as the status cache
+   file streams in.  Parts are delivered in file order.  Each slot delta
+   is first announced by a batch with blockhash==NULL and status_cnt==0.
+   Then, each of its status pairs is delivered in one or more batches of
+   up to FD_SNAPSHOT_RESTORE_STATUS_BATCH_MAX statuses, all with the
+   blockhash and txn_idx of the pair (a pair without statuses is
+   delivered as one batch with status_cnt==0).  key_slice and result
+   hold the truncated txn hash and the result discriminant of each
+   status. */
+
+#define FD_SNAPSHOT_RESTORE_STATUS_BATCH_MAX (1024UL)
+
+struct fd_snapshot_restore_status_batch {
+  ulong             slot;
+  int               is_root;
+  fd_hash_t const * blockhash;
+  ulong             txn_idx;
+  ulong             status_cnt;
+  uchar             key_slice[ FD_SNAPSHOT_RESTORE_STATUS_BATCH_MAX ][ 20 ];
+  uchar             result   [ FD_SNAPSHOT_RESTORE_STATUS_BATCH_MAX ];
+};
+
+typedef struct fd_snapshot_restore_status_batch fd_snapshot_restore_status_batch_t;
+
+/* fd_snapshot_restore_cb_status_cache_fn_t is a callback that provides
+   the user of snapshot restore with the status cache, one batch at a
+   time.  The batch is only valid for the duration of the call.
 
    ctx is the pointer provided to fd_snapshot_restore_set_cb_status_cache.
-   Returns 0 on success.  Non-zero return value implies failure.  The
-   return value gets forwarded to the original caller of the restore
-   API. */
+   Returns 0 on success.  Non-zero return value implies failure. */
 typedef int
-(* fd_snapshot_restore_cb_status_cache_fn_t)( void *                  ctx,
-                                              fd_bank_slot_deltas_t * slot_deltas,
-                                              fd_spad_t *             spad );
+(* fd_snapshot_restore_cb_status_cache_fn_t)( void *                                     ctx,
+                                              fd_snapshot_restore_status_batch_t const * batch );
 
 FD_PROTOTYPES_BEGIN
 
@@ -94,7 +116,8 @@ fd_snapshot_restore_footprint( void );
    The status cache is also restored using the provided callback if
    a valid callback method is provided. It is valid to provide a NULL
    callback for testing purposes as of now, and the status_cache_ctx
-   can also be NULL.
+   can also be NULL.  The status cache is decoded as it streams in and
+   is never buffered as a whole.
 
    Accounts are restored into the given account manager and funk
    transaction.  (Note that the restore process will leave behind
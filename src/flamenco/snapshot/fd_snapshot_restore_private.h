@@ -105,6 +105,17 @@ struct fd_snapshot_restore {
 
   fd_snapshot_restore_cb_status_cache_fn_t cb_status_cache;
   void *                                   cb_status_cache_ctx;
+
+  /* Status cache decoder.  The status cache file is decoded as it
+     streams in.  Partially received items are staged in buf. */
+
+  ulong     sc_sz;          /* status cache bytes not yet received */
+  uchar     sc_state;       /* SC_STATE_{...} */
+  ulong     sc_slot_rem;    /* slot deltas left to decode */
+  ulong     sc_pair_rem;    /* status pairs left in current slot delta */
+  ulong     sc_status_rem;  /* statuses left in current status pair */
+  fd_hash_t sc_blockhash;   /* blockhash of current status pair */
+  fd_snapshot_restore_status_batch_t sc_batch;
 };
 
 /* STATE_{...} are the state IDs that control file processing in the
@@ -114,7 +125,19 @@ struct fd_snapshot_restore {
 #define STATE_READ_MANIFEST     ((uchar)1)  /* reading manifest (buffered) */
 #define STATE_READ_ACCOUNT_HDR  ((uchar)2)  /* reading account hdr (buffered) */
 #define STATE_READ_ACCOUNT_DATA ((uchar)3)  /* reading account data (direct copy into funk) */
-#define STATE_READ_STATUS_CACHE ((uchar)4)  /* reading status cache (buffered)*/
+#define STATE_READ_STATUS_CACHE ((uchar)4)  /* reading status cache (streaming) */
 #define STATE_DONE              ((uchar)5)  /* expect no more data */
 
+/* SC_STATE_{...} are the items expected next by the status cache
+   decoder.  FD_SNAPSHOT_RESTORE_STATUS_CACHE_BUF_SZ is the size of the
+   staging buffer, which bounds the size of a single item. */
+
+#define SC_STATE_SLOT_CNT ((uchar)0)  /* expect slot delta count */
+#define SC_STATE_SLOT     ((uchar)1)  /* expect slot delta header */
+#define SC_STATE_PAIR     ((uchar)2)  /* expect status pair header */
+#define SC_STATE_STATUS   ((uchar)3)  /* expect status */
+#define SC_STATE_DONE     ((uchar)4)  /* expect no more items */
+
+#define FD_SNAPSHOT_RESTORE_STATUS_CACHE_BUF_SZ (65536UL)
+
 #endif /* HEADER_fd_src_flamenco_snapshot_fd_snapshot_restore_private_h */
@@ -17,9 +17,14 @@ _set_accv_sz( fd_snapshot_restore_t * restore,
 
 static int                     _cb_retcode    = 0;
 static fd_solana_manifest_t  * _cb_v_manifest = NULL;
-static fd_bank_slot_deltas_t * _cb_v_cache    = NULL;
 static void *                  _cb_v_ctx      = NULL;
 
+/* Status cache batches seen by cb_status_cache */
+
+static ulong _cb_v_slot_cnt   = 0UL;
+static ulong _cb_v_batch_cnt  = 0UL;
+static ulong _cb_v_status_cnt = 0UL;
+
 int
 cb_manifest( void *                 ctx,
              fd_solana_manifest_t * manifest,
@@ -31,12 +36,25 @@ cb_manifest( void *                 ctx,
 }
 
 int
-cb_status_cache( void *                  ctx,
-                 fd_bank_slot_deltas_t * cache,
-                 fd_spad_t *             spad ) {
-  (void)spad;
-  _cb_v_cache = cache;
-  _cb_v_ctx   = ctx;
+cb_status_cache( void *                                     ctx,
+                 fd_snapshot_restore_status_batch_t const * batch ) {
+  _cb_v_ctx = ctx;
+  if( !batch->blockhash ) {
+    FD_TEST( !batch->status_cnt );
+    FD_TEST( batch->slot==10UL+_cb_v_slot_cnt );
+    FD_TEST( batch->is_root==(int)(_cb_v_slot_cnt&1UL) );
+    _cb_v_slot_cnt++;
+    return _cb_retcode;
+  }
+  FD_TEST( batch->status_cnt<=FD_SNAPSHOT_RESTORE_STATUS_BATCH_MAX );
+  FD_TEST( batch->blockhash->uc[ 0 ]==1 );
+  FD_TEST( batch->txn_idx==2UL );
+  for( ulong i=0UL; i<batch->status_cnt; i++ ) {
+    FD_TEST( FD_LOAD( ulong, batch->key_slice[ i ] )==_cb_v_status_cnt );
+    FD_TEST( batch->result[ i ]==(_cb_v_status_cnt&1UL) );
+    _cb_v_status_cnt++;
+  }
+  _cb_v_batch_cnt++;
   return _cb_retcode;
 }
 
@@ -155,15 +173,30 @@ main( int     argc,
     fd_spad_pop( _spad );
   } while(0);
 
-  /* Test status cache with size exceeding buffer size (out of memory) */
+  /* Status cache larger than the spad is streamed, not buffered */
 
   do {
     fd_spad_push( _spad );
     fd_snapshot_restore_t * restore = fd_snapshot_restore_new( restore_mem, acc_mgr, NULL, _spad, NULL, cb_manifest, cb_status_cache );
     FD_TEST( restore );
     fd_tar_meta_t meta = { .name = "snapshots/status_cache", .typeflag = FD_TAR_TYPE_REGULAR };
-    FD_TEST( ENOMEM==fd_snapshot_restore_file( restore, &meta, ULONG_MAX ) );
-    FD_TEST( restore->failed == 1 );
+    FD_TEST( 0==fd_snapshot_restore_file( restore, &meta, ULONG_MAX ) );
+    FD_TEST( restore->failed == 0 );
+    FD_TEST( restore->buf_cap == FD_SNAPSHOT_RESTORE_STATUS_CACHE_BUF_SZ );
+    fd_snapshot_restore_delete( restore );
+    fd_spad_pop( _spad );
+  } while(0);
+
+  /* Reject truncated status cache */
+
+  do {
+    fd_spad_push( _spad );
+    fd_snapshot_restore_t * restore = fd_snapshot_restore_new( restore_mem, acc_mgr, NULL, _spad, NULL, cb_manifest, cb_status_cache );
+    FD_TEST( restore );
+    fd_tar_meta_t meta = { .name = "snapshots/status_cache", .typeflag = FD_TAR_TYPE_REGULAR };
+    uchar data[ 12 ] = { 1 };
+    FD_TEST( 0==fd_snapshot_restore_file( restore, &meta, sizeof(data) ) );
+    FD_TEST( EINVAL==fd_snapshot_restore_chunk( restore, data, sizeof(data) ) );
     fd_snapshot_restore_delete( restore );
     fd_spad_pop( _spad );
   } while(0);
@@ -214,28 +247,37 @@ main( int     argc,
     fd_spad_pop( _spad );
   } while(0);
 
-  /* Test basic status cache */
+  /* Test status cache, fed in one go and byte by byte */
 
-  do {
+# define SC_SLOT_CNT   (3UL)
+# define SC_STATUS_CNT (2500UL)  /* per slot, more than a batch */
+  for( ulong step=0UL; step<2UL; step++ ) {
     fd_spad_push( _spad );
-    /* Create basic slot delta */
+    /* Create slot deltas with one status pair per slot */
     fd_bank_slot_deltas_t cache[1];
-    cache->slot_deltas_len = 1;
-    cache->slot_deltas = fd_spad_alloc( _spad, fd_slot_delta_align(), fd_slot_delta_footprint() );
-    cache->slot_deltas->is_root = 0;
-    cache->slot_deltas->slot = 10;
-    cache->slot_deltas->slot_delta_vec_len = 1;
-    cache->slot_deltas->slot_delta_vec = fd_spad_alloc( _spad, fd_status_pair_align(), fd_status_pair_footprint() );
-
-    fd_status_pair_t * pair = cache->slot_deltas->slot_delta_vec;
-    fd_memset( pair->hash.uc, 1UL, sizeof(fd_hash_t) );
-    pair->value.txn_idx = 2;
-    pair->value.statuses_len = 1;
-    pair->value.statuses = fd_spad_alloc( _spad, fd_cache_status_align(), fd_cache_status_footprint() );
-
-    fd_cache_status_t * status = pair->value.statuses;
-    status->result.discriminant = 0;
-    fd_memset(status->key_slice, 2, 20);
+    cache->slot_deltas_len = SC_SLOT_CNT;
+    cache->slot_deltas = fd_spad_alloc( _spad, fd_slot_delta_align(), SC_SLOT_CNT*fd_slot_delta_footprint() );
+    ulong status_idx = 0UL;
+    for( ulong i=0UL; i<SC_SLOT_CNT; i++ ) {
+      fd_slot_delta_t * slot_delta = &cache->slot_deltas[ i ];
+      slot_delta->is_root = (uchar)(i&1UL);
+      slot_delta->slot = 10UL+i;
+      slot_delta->slot_delta_vec_len = 1;
+      slot_delta->slot_delta_vec = fd_spad_alloc( _spad, fd_status_pair_align(), fd_status_pair_footprint() );
+
+      fd_status_pair_t * pair = slot_delta->slot_delta_vec;
+      fd_memset( pair->hash.uc, 1UL, sizeof(fd_hash_t) );
+      pair->value.txn_idx = 2;
+      pair->value.statuses_len = SC_STATUS_CNT;
+      pair->value.statuses = fd_spad_alloc( _spad, fd_cache_status_align(), SC_STATUS_CNT*fd_cache_status_footprint() );
+      for( ulong j=0UL; j<SC_STATUS_CNT; j++ ) {
+        fd_cache_status_t * status = &pair->value.statuses[ j ];
+        fd_memset( status, 0, sizeof(fd_cache_status_t) );
+        FD_STORE( ulong, status->key_slice, status_idx );
+        status->result.discriminant = (uint)(status_idx&1UL);
+        status_idx++;
+      }
+    }
 
     ulong sz = fd_bank_slot_deltas_size( cache );
 
@@ -251,18 +293,28 @@ main( int     argc,
     FD_TEST( restore->status_cache_done == 0) ;
 
     fd_tar_meta_t meta = { .name = "snapshots/status_cache", .typeflag = FD_TAR_TYPE_REGULAR };
-    _cb_v_ctx      = NULL;
-    _cb_v_cache = NULL;
+    _cb_v_ctx        = NULL;
+    _cb_v_slot_cnt   = 0UL;
+    _cb_v_batch_cnt  = 0UL;
+    _cb_v_status_cnt = 0UL;
     _cb_retcode = 0;
     FD_TEST( 0==fd_snapshot_restore_file( restore, &meta, data_sz ) );
-    FD_TEST( 0==fd_snapshot_restore_chunk( restore, data, data_sz ) );
-    FD_TEST( _cb_v_ctx      == _dummy_ctx  );
-    FD_TEST( _cb_v_cache    != NULL        );
+    if( !step ) {
+      FD_TEST( 0==fd_snapshot_restore_chunk( restore, data, data_sz ) );
+    } else {
+      for( ulong i=0UL; i<data_sz; i++ ) FD_TEST( 0==fd_snapshot_restore_chunk( restore, data+i, 1UL ) );
+    }
+    FD_TEST( _cb_v_ctx        == _dummy_ctx                 );
+    FD_TEST( _cb_v_slot_cnt   == SC_SLOT_CNT                );
+    FD_TEST( _cb_v_batch_cnt  == SC_SLOT_CNT*3UL            );
+    FD_TEST( _cb_v_status_cnt == SC_SLOT_CNT*SC_STATUS_CNT  );
     FD_TEST( restore->status_cache_done == 1   );
 
     fd_snapshot_restore_delete( restore );
     fd_spad_pop( _spad );
-  } while(0);
+  }
+# undef SC_SLOT_CNT
+# undef SC_STATUS_CNT
 
   /* Ignore trailing data after manifest */
 
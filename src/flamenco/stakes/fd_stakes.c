@@ -3,6 +3,7 @@
 #include "../runtime/context/fd_exec_epoch_ctx.h"
 #include "../runtime/context/fd_exec_slot_ctx.h"
 #include "../runtime/program/fd_stake_program.h"
+#include "../runtime/program/fd_vote_program.h"
 #include "../runtime/sysvar/fd_sysvar_stake_history.h"
 
 /* fd_stakes_accum_by_node converts Stakes (unordered list of (vote acc,
@@ -11,8 +12,7 @@
 
 static fd_stake_weight_t_mapnode_t *
 fd_stakes_accum_by_node( fd_vote_accounts_t const *    in,
-                         fd_stake_weight_t_mapnode_t * out_pool,
-                         fd_spad_t *                   runtime_spad ) {
+                         fd_stake_weight_t_mapnode_t * out_pool ) {
 
   /* Stakes::staked_nodes(&self: Stakes) -> HashMap<Pubkey, u64> */
 
@@ -33,39 +33,12 @@ fd_stakes_accum_by_node( fd_vote_accounts_t const *    in,
     /* ... filter(|(stake, _)| *stake != 0u64) */
     if( n->elem.stake == 0UL ) continue;
 
-    fd_bincode_decode_ctx_t ctx = {
-      .data    = n->elem.value.data,
-      .dataend = n->elem.value.data + n->elem.value.data_len,
-    };
-
-    ulong total_sz = 0UL;
-    int   err      = fd_vote_state_versioned_decode_footprint( &ctx, &total_sz );
+    fd_pubkey_t node_pubkey;
+    int err = fd_vote_get_node_pubkey( n->elem.value.data, n->elem.value.data_len, &node_pubkey );
     if( FD_UNLIKELY( err ) ) {
       FD_LOG_ERR(( "Failed to decode vote account %s (%d)", FD_BASE58_ENC_32_ALLOCA( n->elem.key.key ), err ));
     }
 
-    uchar * mem = fd_spad_alloc( runtime_spad, fd_vote_state_versioned_align(), total_sz );
-    if( FD_UNLIKELY( !mem ) ) {
-      FD_LOG_ERR(( "Failed to allocate memory for vote account %s", FD_BASE58_ENC_32_ALLOCA( n->elem.key.key ) ));
-    }
-
-    fd_vote_state_versioned_t * vsv = fd_vote_state_versioned_decode( mem, &ctx );
-
-    fd_pubkey_t node_pubkey;
-    switch( vsv->discriminant ) {
-      case fd_vote_state_versioned_enum_v0_23_5:
-        node_pubkey = vsv->inner.v0_23_5.node_pubkey;
-        break;
-      case fd_vote_state_versioned_enum_v1_14_11:
-        node_pubkey = vsv->inner.v1_14_11.node_pubkey;
-        break;
-      case fd_vote_state_versioned_enum_current:
-        node_pubkey = vsv->inner.current.node_pubkey;
-        break;
-      default:
-        __builtin_unreachable();
-    }
-
 
     /* Extract node pubkey */
 
@@ -162,7 +135,7 @@ fd_stake_weights_by_node( fd_vote_accounts_t const * accs,
 
   /* Accumulate stakes to rb tree */
 
-  fd_stake_weight_t_mapnode_t const * root = fd_stakes_accum_by_node( accs, pool, runtime_spad );
+  fd_stake_weight_t_mapnode_t const * root = fd_stakes_accum_by_node( accs, pool );
 
   /* Export to sorted list */
 
@@ -436,15 +409,16 @@ accumulate_stake_cache_delegations_tpool( void  *tpool,
   fd_exec_slot_ctx_t const *              slot_ctx                  = task_args->slot_ctx;
   fd_stake_history_t const *              history                   = task_args->stake_history;
   ulong *                                 new_rate_activation_epoch = task_args->new_rate_activation_epoch;
-  fd_stake_history_entry_t *              accumulator               = task_args->accumulator;
+  fd_stake_history_entry_t *              accumulator               = task_args->accumulators + worker_idx;
   fd_spad_t *                             spad                      = task_args->spads[worker_idx];
   fd_delegation_pair_t_mapnode_t *        delegations_pool          = task_args->stake_delegations_pool;
-  fd_epoch_info_t *                       temp_info                 = task_args->temp_info;
+  fd_epoch_info_pair_t *                  stake_infos               = task_args->temp_info->stake_infos + task_args->temp_info->stake_infos_len + task_args->idx_starts[worker_idx];
   ulong                                   epoch                     = task_args->epoch;
 
   ulong effective    = 0UL;
   ulong activating   = 0UL;
   ulong deactivating = 0UL;
+  ulong stake_cnt    = 0UL;
 
   FD_SPAD_FRAME_BEGIN( spad ) {
     for( fd_delegation_pair_t_mapnode_t * n =  delegations_roots[worker_idx];
@@ -457,25 +431,21 @@ accumulate_stake_cache_delegations_tpool( void  *tpool,
         continue;
       }
 
-      fd_stake_state_v2_t stake_state;
-      rc = fd_stake_get_state( acc, &stake_state );
+      fd_stake_t stake;
+      rc = fd_stake_get_stake( acc, &stake );
       if( FD_UNLIKELY( rc != 0 ) ) {
         continue;
       }
 
-      if( FD_UNLIKELY( !fd_stake_state_v2_is_stake( &stake_state ) ) ) {
-        continue;
-      }
-
-      if( FD_UNLIKELY( stake_state.inner.stake.stake.delegation.stake == 0 ) ) {
+      if( FD_UNLIKELY( stake.delegation.stake == 0 ) ) {
         continue;
       }
 
-      fd_delegation_t * delegation = &stake_state.inner.stake.stake.delegation;
+      fd_delegation_t * delegation = &stake.delegation;
 
-      ulong delegation_idx = FD_ATOMIC_FETCH_AND_ADD( &temp_info->stake_infos_len, 1UL );
-      fd_memcpy( &temp_info->stake_infos[delegation_idx].stake, &stake_state.inner.stake.stake, sizeof(fd_stake_t) );
-      fd_memcpy( &temp_info->stake_infos[delegation_idx].account, &n->elem.account, sizeof(fd_pubkey_t) );
+      fd_memcpy( &stake_infos[stake_cnt].stake, &stake, sizeof(fd_stake_t) );
+      fd_memcpy( &stake_infos[stake_cnt].account, &n->elem.account, sizeof(fd_pubkey_t) );
+      stake_cnt++;
 
       fd_stake_history_entry_t new_entry = fd_stake_activating_and_deactivating( delegation, epoch, history, new_rate_activation_epoch );
       effective    += new_entry.effective;
@@ -483,9 +453,10 @@ accumulate_stake_cache_delegations_tpool( void  *tpool,
       deactivating += new_entry.deactivating;
     }
 
-    FD_ATOMIC_FETCH_AND_ADD( &accumulator->effective,    effective );
-    FD_ATOMIC_FETCH_AND_ADD( &accumulator->activating,   activating );
-    FD_ATOMIC_FETCH_AND_ADD( &accumulator->deactivating, deactivating );
+    accumulator->effective    = effective;
+    accumulator->activating   = activating;
+    accumulator->deactivating = deactivating;
+    task_args->idx_cnts[worker_idx] = stake_cnt;
 
   } FD_SPAD_FRAME_END;
 }
@@ -517,7 +488,9 @@ fd_accumulate_stake_infos( fd_exec_slot_ctx_t const * slot_ctx,
   fd_delegation_pair_t_mapnode_t ** batch_delegation_roots = fd_spad_alloc( runtime_spad, alignof(fd_delegation_pair_t_mapnode_t *),
                                                                                       ( worker_cnt + 1 )*sizeof(fd_delegation_pair_t_mapnode_t *) );
 
-  ulong * idx_starts = fd_spad_alloc( runtime_spad, alignof(ulong), worker_cnt * sizeof(ulong) );
+  ulong *                    idx_starts   = fd_spad_alloc( runtime_spad, alignof(ulong), worker_cnt * sizeof(ulong) );
+  ulong *                    idx_cnts     = fd_spad_alloc( runtime_spad, alignof(ulong), worker_cnt * sizeof(ulong) );
+  fd_stake_history_entry_t * accumulators = fd_spad_alloc( runtime_spad, alignof(fd_stake_history_entry_t), worker_cnt * sizeof(fd_stake_history_entry_t) );
 
   // Determine the logical index partitioning of the delegations pool so we know where to start iterating from
   for( ulong i=0UL; i<worker_cnt; i++ ) {
@@ -541,7 +514,9 @@ fd_accumulate_stake_infos( fd_exec_slot_ctx_t const * slot_ctx,
     .slot_ctx                  = slot_ctx,
     .stake_history             = history,
     .new_rate_activation_epoch = new_rate_activation_epoch,
-    .accumulator               = accumulator,
+    .accumulators              = accumulators,
+    .idx_starts                = idx_starts,
+    .idx_cnts                  = idx_cnts,
     .temp_info                 = temp_info,
     .spads                     = exec_spads,
     .stake_delegations_pool    = stakes->stake_delegations_pool,
@@ -549,6 +524,21 @@ fd_accumulate_stake_infos( fd_exec_slot_ctx_t const * slot_ctx,
   };
 
   fd_tpool_exec_all_batch( tpool, 0UL, worker_cnt, accumulate_stake_cache_delegations_tpool, batch_delegation_roots, &task_args, NULL, 1UL, 0UL, stake_delegations_pool_sz );
+
+  /* Reduce in worker order.  Worker i wrote idx_cnts[i]<=idx_starts[i+1]-idx_starts[i]
+     stake infos starting at stake_infos_len+idx_starts[i], so the slices can be
+     compacted in place. */
+  ulong stake_infos_off = temp_info->stake_infos_len;
+  for( ulong i=0UL; i<worker_cnt; i++ ) {
+    fd_epoch_info_pair_t * slice = temp_info->stake_infos + stake_infos_off + idx_starts[i];
+    if( FD_LIKELY( slice!=temp_info->stake_infos + temp_info->stake_infos_len ) ) {
+      memmove( temp_info->stake_infos + temp_info->stake_infos_len, slice, idx_cnts[i]*sizeof(fd_epoch_info_pair_t) );
+    }
+    temp_info->stake_infos_len += idx_cnts[i];
+    accumulator->effective     += accumulators[i].effective;
+    accumulator->activating    += accumulators[i].activating;
+    accumulator->deactivating  += accumulators[i].deactivating;
+  }
   temp_info->stake_infos_new_keys_start_idx = temp_info->stake_infos_len;
 
   /* The number of account keys aggregated across the epoch is usually small, so there aren't much performance gains from tpooling here. */
@@ -561,22 +551,18 @@ fd_accumulate_stake_infos( fd_exec_slot_ctx_t const * slot_ctx,
       continue;
     }
 
-    fd_stake_state_v2_t stake_state;
-    rc = fd_stake_get_state( acc, &stake_state );
+    fd_stake_t stake;
+    rc = fd_stake_get_stake( acc, &stake );
     if( FD_UNLIKELY( rc != 0) ) {
       continue;
     }
 
-    if( FD_UNLIKELY( !fd_stake_state_v2_is_stake( &stake_state ) ) ) {
-      continue;
-    }
-
-    if( FD_UNLIKELY( stake_state.inner.stake.stake.delegation.stake==0UL ) ) {
+    if( FD_UNLIKELY( stake.delegation.stake==0UL ) ) {
       continue;
     }
 
-    fd_delegation_t * delegation = &stake_state.inner.stake.stake.delegation;
-    fd_memcpy(&temp_info->stake_infos[temp_info->stake_infos_len  ].stake.delegation, &stake_state.inner.stake.stake, sizeof(fd_stake_t));
+    fd_delegation_t * delegation = &stake.delegation;
+    fd_memcpy(&temp_info->stake_infos[temp_info->stake_infos_len  ].stake.delegation, &stake, sizeof(fd_stake_t));
     fd_memcpy(&temp_info->stake_infos[temp_info->stake_infos_len++].account, &n->elem.key, sizeof(fd_pubkey_t));
     fd_stake_history_entry_t new_entry = fd_stake_activating_and_deactivating( delegation, stakes->epoch, history, new_rate_activation_epoch );
     accumulator->effective    += new_entry.effective;
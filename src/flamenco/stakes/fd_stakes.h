@@ -34,11 +34,20 @@ struct fd_compute_stake_delegations {
 };
 typedef struct fd_compute_stake_delegations fd_compute_stake_delegations_t;
 
+/* Each worker of the stake info accumulation writes its stake infos
+   into its own slice of temp_info->stake_infos (starting at
+   idx_starts[worker_idx]) and its totals into accumulators[worker_idx].
+   The slices are compacted and the totals are summed in worker order
+   afterwards, such that the resulting stake infos order (and thus the
+   stake reward partitions) does not depend on thread scheduling. */
+
 struct fd_accumulate_delegations_task_args {
    fd_exec_slot_ctx_t const *         slot_ctx;
    fd_stake_history_t const *         stake_history;
    ulong *                            new_rate_activation_epoch;
-   fd_stake_history_entry_t *         accumulator;
+   fd_stake_history_entry_t *         accumulators; /* indexed by worker */
+   ulong const *                      idx_starts;   /* indexed by worker */
+   ulong *                            idx_cnts;     /* indexed by worker */
    fd_epoch_info_t *                  temp_info;
    fd_spad_t * *                      spads;
    fd_delegation_pair_t_mapnode_t *   stake_delegations_pool;
@@ -5,10 +5,12 @@ $(call make-unit-test,test_types_meta,test_types_meta,fd_flamenco fd_ballet fd_u
 $(call make-unit-test,test_types_yaml,test_types_yaml,fd_flamenco fd_ballet fd_util)
 $(call make-unit-test,test_types_fixtures,test_types_fixtures,fd_flamenco fd_ballet fd_util)
 $(call make-unit-test,test_cast,test_cast,fd_flamenco fd_ballet fd_util)
+$(call make-unit-test,test_types_view,test_types_view,fd_flamenco fd_ballet fd_util)
 $(call run-unit-test,test_types_meta)
 $(call run-unit-test,test_types_yaml)
 $(call run-unit-test,test_types_fixtures)
 $(call run-unit-test,test_cast)
+$(call run-unit-test,test_types_view)
 ifdef FD_HAS_HOSTED
 $(call make-fuzz-test,fuzz_types_decode,fuzz_types_decode,fd_flamenco fd_ballet fd_util)
 endif
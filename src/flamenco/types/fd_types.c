@@ -254,11 +254,7 @@ void fd_fee_calculator_walk( void * w, fd_fee_calculator_t const * self, fd_type
   fun( w, &self->lamports_per_signature, "lamports_per_signature", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_fee_calculator", level-- );
 }
-ulong fd_fee_calculator_size( fd_fee_calculator_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_fee_calculator_size( fd_fee_calculator_t const * self ) { (void)self; return 8UL; }
 
 int fd_hash_age_encode( fd_hash_age_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -279,6 +275,13 @@ int fd_hash_age_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_s
   return err;
 }
 int fd_hash_age_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 24UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_hash_age_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_fee_calculator_decode_footprint_inner( ctx, total_sz );
@@ -289,6 +292,14 @@ int fd_hash_age_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * t
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_hash_age_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_hash_age_t);
+  void const * start_data = ctx->data;
+  int err = fd_hash_age_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_hash_age_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_hash_age_t * self = (fd_hash_age_t *)mem;
   fd_hash_age_new( self );
@@ -321,13 +332,7 @@ void fd_hash_age_walk( void * w, fd_hash_age_t const * self, fd_types_walk_fn_t
   fun( w, &self->timestamp, "timestamp", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_hash_age", level-- );
 }
-ulong fd_hash_age_size( fd_hash_age_t const * self ) {
-  ulong size = 0;
-  size += fd_fee_calculator_size( &self->fee_calculator );
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_hash_age_size( fd_hash_age_t const * self ) { (void)self; return 24UL; }
 
 int fd_hash_hash_age_pair_encode( fd_hash_hash_age_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -346,6 +351,13 @@ int fd_hash_hash_age_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_hash_hash_age_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 56UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_hash_hash_age_pair_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_hash_decode_footprint_inner( ctx, total_sz );
@@ -354,6 +366,14 @@ int fd_hash_hash_age_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_hash_hash_age_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_hash_hash_age_pair_t);
+  void const * start_data = ctx->data;
+  int err = fd_hash_hash_age_pair_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_hash_hash_age_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_hash_hash_age_pair_t * self = (fd_hash_hash_age_pair_t *)mem;
   fd_hash_hash_age_pair_new( self );
@@ -386,12 +406,7 @@ void fd_hash_hash_age_pair_walk( void * w, fd_hash_hash_age_pair_t const * self,
   fd_hash_age_walk( w, &self->val, fun, "val", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_hash_hash_age_pair", level-- );
 }
-ulong fd_hash_hash_age_pair_size( fd_hash_hash_age_pair_t const * self ) {
-  ulong size = 0;
-  size += fd_hash_size( &self->key );
-  size += fd_hash_age_size( &self->val );
-  return size;
-}
+ulong fd_hash_hash_age_pair_size( fd_hash_hash_age_pair_t const * self ) { (void)self; return 56UL; }
 
 int fd_block_hash_vec_encode( fd_block_hash_vec_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -721,6 +736,13 @@ int fd_fee_rate_governor_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_fee_rate_governor_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 33UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_fee_rate_governor_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -735,6 +757,14 @@ int fd_fee_rate_governor_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_fee_rate_governor_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_fee_rate_governor_t);
+  void const * start_data = ctx->data;
+  int err = fd_fee_rate_governor_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_fee_rate_governor_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_fee_rate_governor_t * self = (fd_fee_rate_governor_t *)mem;
   fd_fee_rate_governor_new( self );
@@ -769,15 +799,7 @@ void fd_fee_rate_governor_walk( void * w, fd_fee_rate_governor_t const * self, f
   fun( w, &self->burn_percent, "burn_percent", FD_FLAMENCO_TYPE_UCHAR, "uchar", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_fee_rate_governor", level-- );
 }
-ulong fd_fee_rate_governor_size( fd_fee_rate_governor_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += sizeof(char);
-  return size;
-}
+ulong fd_fee_rate_governor_size( fd_fee_rate_governor_t const * self ) { (void)self; return 33UL; }
 
 int fd_slot_pair_encode( fd_slot_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -796,6 +818,13 @@ int fd_slot_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_
   return err;
 }
 int fd_slot_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 16UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_slot_pair_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -804,6 +833,14 @@ int fd_slot_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong *
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_slot_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_slot_pair_t);
+  void const * start_data = ctx->data;
+  int err = fd_slot_pair_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_slot_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_slot_pair_t * self = (fd_slot_pair_t *)mem;
   fd_slot_pair_new( self );
@@ -832,12 +869,7 @@ void fd_slot_pair_walk( void * w, fd_slot_pair_t const * self, fd_types_walk_fn_
   fun( w, &self->val, "val", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_slot_pair", level-- );
 }
-ulong fd_slot_pair_size( fd_slot_pair_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_slot_pair_size( fd_slot_pair_t const * self ) { (void)self; return 16UL; }
 
 int fd_hard_forks_encode( fd_hard_forks_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -955,6 +987,13 @@ int fd_inflation_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_
   return err;
 }
 int fd_inflation_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 48UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_inflation_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_double_decode_footprint( ctx );
@@ -971,6 +1010,14 @@ int fd_inflation_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong *
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_inflation_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_inflation_t);
+  void const * start_data = ctx->data;
+  int err = fd_inflation_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_inflation_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_inflation_t * self = (fd_inflation_t *)mem;
   fd_inflation_new( self );
@@ -1007,16 +1054,7 @@ void fd_inflation_walk( void * w, fd_inflation_t const * self, fd_types_walk_fn_
   fun( w, &self->unused, "unused", FD_FLAMENCO_TYPE_DOUBLE, "double", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_inflation", level-- );
 }
-ulong fd_inflation_size( fd_inflation_t const * self ) {
-  ulong size = 0;
-  size += sizeof(double);
-  size += sizeof(double);
-  size += sizeof(double);
-  size += sizeof(double);
-  size += sizeof(double);
-  size += sizeof(double);
-  return size;
-}
+ulong fd_inflation_size( fd_inflation_t const * self ) { (void)self; return 48UL; }
 
 int fd_rent_encode( fd_rent_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -1037,6 +1075,13 @@ int fd_rent_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz )
   return err;
 }
 int fd_rent_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 17UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_rent_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -1047,6 +1092,14 @@ int fd_rent_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_rent_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_rent_t);
+  void const * start_data = ctx->data;
+  int err = fd_rent_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_rent_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_rent_t * self = (fd_rent_t *)mem;
   fd_rent_new( self );
@@ -1077,13 +1130,7 @@ void fd_rent_walk( void * w, fd_rent_t const * self, fd_types_walk_fn_t fun, con
   fun( w, &self->burn_percent, "burn_percent", FD_FLAMENCO_TYPE_UCHAR, "uchar", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_rent", level-- );
 }
-ulong fd_rent_size( fd_rent_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += sizeof(double);
-  size += sizeof(char);
-  return size;
-}
+ulong fd_rent_size( fd_rent_t const * self ) { (void)self; return 17UL; }
 
 int fd_epoch_schedule_encode( fd_epoch_schedule_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -1108,6 +1155,17 @@ int fd_epoch_schedule_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * t
   return err;
 }
 int fd_epoch_schedule_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 16UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bool_decode_footprint( ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 16UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_epoch_schedule_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -1122,6 +1180,14 @@ int fd_epoch_schedule_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulo
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_epoch_schedule_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_epoch_schedule_t);
+  void const * start_data = ctx->data;
+  int err = fd_epoch_schedule_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_epoch_schedule_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_epoch_schedule_t * self = (fd_epoch_schedule_t *)mem;
   fd_epoch_schedule_new( self );
@@ -1156,15 +1222,7 @@ void fd_epoch_schedule_walk( void * w, fd_epoch_schedule_t const * self, fd_type
   fun( w, &self->first_normal_slot, "first_normal_slot", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_epoch_schedule", level-- );
 }
-ulong fd_epoch_schedule_size( fd_epoch_schedule_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += sizeof(char);
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_epoch_schedule_size( fd_epoch_schedule_t const * self ) { (void)self; return 33UL; }
 
 int fd_rent_collector_encode( fd_rent_collector_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -1187,6 +1245,17 @@ int fd_rent_collector_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * t
   return err;
 }
 int fd_rent_collector_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 25UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_rent_collector_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -1199,6 +1268,14 @@ int fd_rent_collector_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulo
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_rent_collector_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_rent_collector_t);
+  void const * start_data = ctx->data;
+  int err = fd_rent_collector_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_rent_collector_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_rent_collector_t * self = (fd_rent_collector_t *)mem;
   fd_rent_collector_new( self );
@@ -1235,14 +1312,7 @@ void fd_rent_collector_walk( void * w, fd_rent_collector_t const * self, fd_type
   fd_rent_walk( w, &self->rent, fun, "rent", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_rent_collector", level-- );
 }
-ulong fd_rent_collector_size( fd_rent_collector_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += fd_epoch_schedule_size( &self->epoch_schedule );
-  size += sizeof(double);
-  size += fd_rent_size( &self->rent );
-  return size;
-}
+ulong fd_rent_collector_size( fd_rent_collector_t const * self ) { (void)self; return 66UL; }
 
 int fd_stake_history_entry_encode( fd_stake_history_entry_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -1265,6 +1335,13 @@ int fd_stake_history_entry_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulon
   return err;
 }
 int fd_stake_history_entry_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_stake_history_entry_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -1277,6 +1354,14 @@ int fd_stake_history_entry_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_stake_history_entry_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_stake_history_entry_t);
+  void const * start_data = ctx->data;
+  int err = fd_stake_history_entry_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_stake_history_entry_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_stake_history_entry_t * self = (fd_stake_history_entry_t *)mem;
   fd_stake_history_entry_new( self );
@@ -1309,14 +1394,7 @@ void fd_stake_history_entry_walk( void * w, fd_stake_history_entry_t const * sel
   fun( w, &self->deactivating, "deactivating", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_stake_history_entry", level-- );
 }
-ulong fd_stake_history_entry_size( fd_stake_history_entry_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_stake_history_entry_size( fd_stake_history_entry_t const * self ) { (void)self; return 32UL; }
 
 int fd_stake_history_encode( fd_stake_history_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -1428,6 +1506,27 @@ int fd_solana_account_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * t
   return err;
 }
 int fd_solana_account_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  ulong data_len;
+  err = fd_bincode_uint64_decode( &data_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( data_len ) {
+    *total_sz += 8UL + data_len;
+    err = fd_bincode_bytes_decode_footprint( data_len, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  }
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bool_decode_footprint( ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  return 0;
+}
+static int fd_solana_account_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -1448,6 +1547,14 @@ int fd_solana_account_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulo
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_solana_account_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_solana_account_t);
+  void const * start_data = ctx->data;
+  int err = fd_solana_account_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_solana_account_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_solana_account_t * self = (fd_solana_account_t *)mem;
   fd_solana_account_new( self );
@@ -1525,6 +1632,15 @@ int fd_vote_accounts_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_vote_accounts_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 40UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_solana_account_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_vote_accounts_pair_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -1535,6 +1651,14 @@ int fd_vote_accounts_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_vote_accounts_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_accounts_pair_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_accounts_pair_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_vote_accounts_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_accounts_pair_t * self = (fd_vote_accounts_pair_t *)mem;
   fd_vote_accounts_pair_new( self );
@@ -1596,6 +1720,15 @@ int fd_vote_accounts_pair_serializable_decode_footprint( fd_bincode_decode_ctx_t
   return err;
 }
 int fd_vote_accounts_pair_serializable_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 40UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_solana_account_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_vote_accounts_pair_serializable_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -1606,6 +1739,14 @@ int fd_vote_accounts_pair_serializable_decode_footprint_inner( fd_bincode_decode
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_vote_accounts_pair_serializable_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_accounts_pair_serializable_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_accounts_pair_serializable_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_vote_accounts_pair_serializable_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_accounts_pair_serializable_t * self = (fd_vote_accounts_pair_serializable_t *)mem;
   fd_vote_accounts_pair_serializable_new( self );
@@ -1857,6 +1998,13 @@ int fd_account_keys_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_account_keys_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 33UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_account_keys_pair_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -1865,6 +2013,14 @@ int fd_account_keys_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_account_keys_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_account_keys_pair_t);
+  void const * start_data = ctx->data;
+  int err = fd_account_keys_pair_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_account_keys_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_account_keys_pair_t * self = (fd_account_keys_pair_t *)mem;
   fd_account_keys_pair_new( self );
@@ -1895,12 +2051,7 @@ void fd_account_keys_pair_walk( void * w, fd_account_keys_pair_t const * self, f
   fun( w, &self->exists, "exists", FD_FLAMENCO_TYPE_UCHAR, "uchar", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_account_keys_pair", level-- );
 }
-ulong fd_account_keys_pair_size( fd_account_keys_pair_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->key );
-  size += sizeof(char);
-  return size;
-}
+ulong fd_account_keys_pair_size( fd_account_keys_pair_t const * self ) { (void)self; return 33UL; }
 
 int fd_account_keys_encode( fd_account_keys_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -2015,6 +2166,13 @@ int fd_stake_weight_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * tot
   return err;
 }
 int fd_stake_weight_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 40UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_stake_weight_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -2023,6 +2181,14 @@ int fd_stake_weight_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_stake_weight_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_stake_weight_t);
+  void const * start_data = ctx->data;
+  int err = fd_stake_weight_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_stake_weight_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_stake_weight_t * self = (fd_stake_weight_t *)mem;
   fd_stake_weight_new( self );
@@ -2053,12 +2219,7 @@ void fd_stake_weight_walk( void * w, fd_stake_weight_t const * self, fd_types_wa
   fun( w, &self->stake, "stake", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_stake_weight", level-- );
 }
-ulong fd_stake_weight_size( fd_stake_weight_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->key );
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_stake_weight_size( fd_stake_weight_t const * self ) { (void)self; return 40UL; }
 
 int fd_stake_weights_encode( fd_stake_weights_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -2181,11 +2342,18 @@ int fd_delegation_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total
 int fd_delegation_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
-  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
+  err = fd_bincode_bytes_decode_footprint( 64UL, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_bincode_uint64_decode_footprint( ctx );
-  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_bincode_uint64_decode_footprint( ctx );
+  return 0;
+}
+static int fd_delegation_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  err = fd_bincode_uint64_decode_footprint( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   err = fd_bincode_uint64_decode_footprint( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -2193,6 +2361,14 @@ int fd_delegation_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong *
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_delegation_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_delegation_t);
+  void const * start_data = ctx->data;
+  int err = fd_delegation_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_delegation_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_delegation_t * self = (fd_delegation_t *)mem;
   fd_delegation_new( self );
@@ -2209,6 +2385,16 @@ void fd_delegation_decode_inner( void * struct_mem, void * * alloc_mem, fd_binco
   fd_bincode_uint64_decode_unsafe( &self->deactivation_epoch, ctx );
   fd_bincode_double_decode_unsafe( &self->warmup_cooldown_rate, ctx );
 }
+int fd_delegation_view( fd_delegation_view_t * view, uchar const * data, ulong data_sz ) {
+  fd_bincode_decode_ctx_t ctx = { .data = data, .dataend = data + data_sz };
+  ulong total_sz = 0UL;
+  int err = fd_delegation_decode_footprint_inner( &ctx, &total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  if( FD_UNLIKELY( ctx.data>ctx.dataend ) ) return FD_BINCODE_ERR_OVERFLOW;
+  view->data    = data;
+  view->data_sz = (ulong)ctx.data - (ulong)data;
+  return FD_BINCODE_SUCCESS;
+}
 void fd_delegation_new(fd_delegation_t * self) {
   fd_memset( self, 0, sizeof(fd_delegation_t) );
   fd_pubkey_new( &self->voter_pubkey );
@@ -2229,15 +2415,7 @@ void fd_delegation_walk( void * w, fd_delegation_t const * self, fd_types_walk_f
   fun( w, &self->warmup_cooldown_rate, "warmup_cooldown_rate", FD_FLAMENCO_TYPE_DOUBLE, "double", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_delegation", level-- );
 }
-ulong fd_delegation_size( fd_delegation_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->voter_pubkey );
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += sizeof(double);
-  return size;
-}
+ulong fd_delegation_size( fd_delegation_t const * self ) { (void)self; return 64UL; }
 
 int fd_delegation_pair_encode( fd_delegation_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -2256,6 +2434,13 @@ int fd_delegation_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong *
   return err;
 }
 int fd_delegation_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 96UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_delegation_pair_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -2264,6 +2449,14 @@ int fd_delegation_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ul
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_delegation_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_delegation_pair_t);
+  void const * start_data = ctx->data;
+  int err = fd_delegation_pair_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_delegation_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_delegation_pair_t * self = (fd_delegation_pair_t *)mem;
   fd_delegation_pair_new( self );
@@ -2296,12 +2489,7 @@ void fd_delegation_pair_walk( void * w, fd_delegation_pair_t const * self, fd_ty
   fd_delegation_walk( w, &self->delegation, fun, "delegation", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_delegation_pair", level-- );
 }
-ulong fd_delegation_pair_size( fd_delegation_pair_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->account );
-  size += fd_delegation_size( &self->delegation );
-  return size;
-}
+ulong fd_delegation_pair_size( fd_delegation_pair_t const * self ) { (void)self; return 96UL; }
 
 int fd_stake_encode( fd_stake_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -2320,6 +2508,13 @@ int fd_stake_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz )
   return err;
 }
 int fd_stake_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 72UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_stake_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_delegation_decode_footprint_inner( ctx, total_sz );
@@ -2328,6 +2523,14 @@ int fd_stake_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * tota
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_stake_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_stake_t);
+  void const * start_data = ctx->data;
+  int err = fd_stake_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_stake_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_stake_t * self = (fd_stake_t *)mem;
   fd_stake_new( self );
@@ -2341,6 +2544,16 @@ void fd_stake_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_de
   fd_delegation_decode_inner( &self->delegation, alloc_mem, ctx );
   fd_bincode_uint64_decode_unsafe( &self->credits_observed, ctx );
 }
+int fd_stake_view( fd_stake_view_t * view, uchar const * data, ulong data_sz ) {
+  fd_bincode_decode_ctx_t ctx = { .data = data, .dataend = data + data_sz };
+  ulong total_sz = 0UL;
+  int err = fd_stake_decode_footprint_inner( &ctx, &total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  if( FD_UNLIKELY( ctx.data>ctx.dataend ) ) return FD_BINCODE_ERR_OVERFLOW;
+  view->data    = data;
+  view->data_sz = (ulong)ctx.data - (ulong)data;
+  return FD_BINCODE_SUCCESS;
+}
 void fd_stake_new(fd_stake_t * self) {
   fd_memset( self, 0, sizeof(fd_stake_t) );
   fd_delegation_new( &self->delegation );
@@ -2358,12 +2571,7 @@ void fd_stake_walk( void * w, fd_stake_t const * self, fd_types_walk_fn_t fun, c
   fun( w, &self->credits_observed, "credits_observed", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_stake", level-- );
 }
-ulong fd_stake_size( fd_stake_t const * self ) {
-  ulong size = 0;
-  size += fd_delegation_size( &self->delegation );
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_stake_size( fd_stake_t const * self ) { (void)self; return 72UL; }
 
 int fd_stake_pair_encode( fd_stake_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -2382,6 +2590,13 @@ int fd_stake_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total
   return err;
 }
 int fd_stake_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 104UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_stake_pair_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -2390,6 +2605,14 @@ int fd_stake_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong *
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_stake_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_stake_pair_t);
+  void const * start_data = ctx->data;
+  int err = fd_stake_pair_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_stake_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_stake_pair_t * self = (fd_stake_pair_t *)mem;
   fd_stake_pair_new( self );
@@ -2422,12 +2645,7 @@ void fd_stake_pair_walk( void * w, fd_stake_pair_t const * self, fd_types_walk_f
   fd_stake_walk( w, &self->stake, fun, "stake", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_stake_pair", level-- );
 }
-ulong fd_stake_pair_size( fd_stake_pair_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->account );
-  size += fd_stake_size( &self->stake );
-  return size;
-}
+ulong fd_stake_pair_size( fd_stake_pair_t const * self ) { (void)self; return 104UL; }
 
 int fd_stakes_encode( fd_stakes_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -2463,6 +2681,26 @@ int fd_stakes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz
   return err;
 }
 int fd_stakes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_vote_accounts_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong stake_delegations_len = 0UL;
+  err = fd_bincode_uint64_decode( &stake_delegations_len, ctx );
+  ulong stake_delegations_cnt = stake_delegations_len;
+  *total_sz += fd_delegation_pair_t_map_align() + fd_delegation_pair_t_map_footprint( stake_delegations_cnt );
+  if( FD_UNLIKELY( err ) ) return err;
+  for( ulong i=0; i < stake_delegations_len; i++ ) {
+    err = fd_delegation_pair_decode_footprint_inner( ctx, total_sz );
+    if( FD_UNLIKELY( err ) ) return err;
+  }
+  err = fd_bincode_bytes_decode_footprint( 16UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_stake_history_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_stakes_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_vote_accounts_decode_footprint_inner( ctx, total_sz );
@@ -2484,6 +2722,14 @@ int fd_stakes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * tot
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_stakes_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_stakes_t);
+  void const * start_data = ctx->data;
+  int err = fd_stakes_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_stakes_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_stakes_t * self = (fd_stakes_t *)mem;
   fd_stakes_new( self );
@@ -2591,6 +2837,26 @@ int fd_stakes_serializable_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulon
   return err;
 }
 int fd_stakes_serializable_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_vote_accounts_serializable_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong stake_delegations_len = 0UL;
+  err = fd_bincode_uint64_decode( &stake_delegations_len, ctx );
+  ulong stake_delegations_cnt = stake_delegations_len;
+  *total_sz += fd_delegation_pair_t_map_align() + fd_delegation_pair_t_map_footprint( stake_delegations_cnt );
+  if( FD_UNLIKELY( err ) ) return err;
+  for( ulong i=0; i < stake_delegations_len; i++ ) {
+    err = fd_delegation_pair_decode_footprint_inner( ctx, total_sz );
+    if( FD_UNLIKELY( err ) ) return err;
+  }
+  err = fd_bincode_bytes_decode_footprint( 16UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_stake_history_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_stakes_serializable_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_vote_accounts_serializable_decode_footprint_inner( ctx, total_sz );
@@ -2612,6 +2878,14 @@ int fd_stakes_serializable_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_stakes_serializable_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_stakes_serializable_t);
+  void const * start_data = ctx->data;
+  int err = fd_stakes_serializable_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_stakes_serializable_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_stakes_serializable_t * self = (fd_stakes_serializable_t *)mem;
   fd_stakes_serializable_new( self );
@@ -2719,6 +2993,26 @@ int fd_stakes_stake_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * tot
   return err;
 }
 int fd_stakes_stake_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_vote_accounts_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong stake_delegations_len = 0UL;
+  err = fd_bincode_uint64_decode( &stake_delegations_len, ctx );
+  ulong stake_delegations_cnt = stake_delegations_len;
+  *total_sz += fd_stake_pair_t_map_align() + fd_stake_pair_t_map_footprint( stake_delegations_cnt );
+  if( FD_UNLIKELY( err ) ) return err;
+  for( ulong i=0; i < stake_delegations_len; i++ ) {
+    err = fd_stake_pair_decode_footprint_inner( ctx, total_sz );
+    if( FD_UNLIKELY( err ) ) return err;
+  }
+  err = fd_bincode_bytes_decode_footprint( 16UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_stake_history_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_stakes_stake_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_vote_accounts_decode_footprint_inner( ctx, total_sz );
@@ -2740,6 +3034,14 @@ int fd_stakes_stake_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_stakes_stake_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_stakes_stake_t);
+  void const * start_data = ctx->data;
+  int err = fd_stakes_stake_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_stakes_stake_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_stakes_stake_t * self = (fd_stakes_stake_t *)mem;
   fd_stakes_stake_new( self );
@@ -2836,6 +3138,13 @@ int fd_bank_incremental_snapshot_persistence_decode_footprint( fd_bincode_decode
   return err;
 }
 int fd_bank_incremental_snapshot_persistence_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 88UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_bank_incremental_snapshot_persistence_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -2850,6 +3159,14 @@ int fd_bank_incremental_snapshot_persistence_decode_footprint_inner( fd_bincode_
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_bank_incremental_snapshot_persistence_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_bank_incremental_snapshot_persistence_t);
+  void const * start_data = ctx->data;
+  int err = fd_bank_incremental_snapshot_persistence_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_bank_incremental_snapshot_persistence_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_bank_incremental_snapshot_persistence_t * self = (fd_bank_incremental_snapshot_persistence_t *)mem;
   fd_bank_incremental_snapshot_persistence_new( self );
@@ -2888,15 +3205,7 @@ void fd_bank_incremental_snapshot_persistence_walk( void * w, fd_bank_incrementa
   fun( w, &self->incremental_capitalization, "incremental_capitalization", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_bank_incremental_snapshot_persistence", level-- );
 }
-ulong fd_bank_incremental_snapshot_persistence_size( fd_bank_incremental_snapshot_persistence_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += fd_hash_size( &self->full_hash );
-  size += sizeof(ulong);
-  size += fd_hash_size( &self->incremental_hash );
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_bank_incremental_snapshot_persistence_size( fd_bank_incremental_snapshot_persistence_t const * self ) { (void)self; return 88UL; }
 
 int fd_node_vote_accounts_encode( fd_node_vote_accounts_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -3013,6 +3322,15 @@ int fd_pubkey_node_vote_accounts_pair_decode_footprint( fd_bincode_decode_ctx_t
   return err;
 }
 int fd_pubkey_node_vote_accounts_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_node_vote_accounts_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_pubkey_node_vote_accounts_pair_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -3021,6 +3339,14 @@ int fd_pubkey_node_vote_accounts_pair_decode_footprint_inner( fd_bincode_decode_
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_pubkey_node_vote_accounts_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_pubkey_node_vote_accounts_pair_t);
+  void const * start_data = ctx->data;
+  int err = fd_pubkey_node_vote_accounts_pair_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_pubkey_node_vote_accounts_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_node_vote_accounts_pair_t * self = (fd_pubkey_node_vote_accounts_pair_t *)mem;
   fd_pubkey_node_vote_accounts_pair_new( self );
@@ -3077,6 +3403,13 @@ int fd_pubkey_pubkey_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_pubkey_pubkey_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 64UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_pubkey_pubkey_pair_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -3085,6 +3418,14 @@ int fd_pubkey_pubkey_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_pubkey_pubkey_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_pubkey_pubkey_pair_t);
+  void const * start_data = ctx->data;
+  int err = fd_pubkey_pubkey_pair_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_pubkey_pubkey_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_pubkey_pair_t * self = (fd_pubkey_pubkey_pair_t *)mem;
   fd_pubkey_pubkey_pair_new( self );
@@ -3117,12 +3458,7 @@ void fd_pubkey_pubkey_pair_walk( void * w, fd_pubkey_pubkey_pair_t const * self,
   fd_pubkey_walk( w, &self->value, fun, "value", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_pubkey_pubkey_pair", level-- );
 }
-ulong fd_pubkey_pubkey_pair_size( fd_pubkey_pubkey_pair_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->key );
-  size += fd_pubkey_size( &self->value );
-  return size;
-}
+ulong fd_pubkey_pubkey_pair_size( fd_pubkey_pubkey_pair_t const * self ) { (void)self; return 64UL; }
 
 int fd_epoch_stakes_encode( fd_epoch_stakes_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -3355,6 +3691,13 @@ int fd_pubkey_u64_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong *
   return err;
 }
 int fd_pubkey_u64_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 40UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_pubkey_u64_pair_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -3363,6 +3706,14 @@ int fd_pubkey_u64_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ul
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_pubkey_u64_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_pubkey_u64_pair_t);
+  void const * start_data = ctx->data;
+  int err = fd_pubkey_u64_pair_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_pubkey_u64_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_u64_pair_t * self = (fd_pubkey_u64_pair_t *)mem;
   fd_pubkey_u64_pair_new( self );
@@ -3393,12 +3744,7 @@ void fd_pubkey_u64_pair_walk( void * w, fd_pubkey_u64_pair_t const * self, fd_ty
   fun( w, &self->_1, "_1", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_pubkey_u64_pair", level-- );
 }
-ulong fd_pubkey_u64_pair_size( fd_pubkey_u64_pair_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->_0 );
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_pubkey_u64_pair_size( fd_pubkey_u64_pair_t const * self ) { (void)self; return 40UL; }
 
 int fd_unused_accounts_encode( fd_unused_accounts_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -3691,24 +4037,12 @@ int fd_deserializable_versioned_bank_decode_footprint_inner( fd_bincode_decode_c
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
-  err = fd_hash_decode_footprint_inner( ctx, total_sz );
-  if( FD_UNLIKELY( err ) ) return err;
-  err = fd_hash_decode_footprint_inner( ctx, total_sz );
+  err = fd_bincode_bytes_decode_footprint( 72UL, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_bincode_uint64_decode_footprint( ctx );
-  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   err = fd_hard_forks_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_bincode_uint64_decode_footprint( ctx );
-  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_bincode_uint64_decode_footprint( ctx );
-  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_bincode_uint64_decode_footprint( ctx );
-  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_bincode_uint64_decode_footprint( ctx );
-  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_bincode_uint64_decode_footprint( ctx );
-  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 40UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
   {
     uchar o;
     err = fd_bincode_bool_decode( &o, ctx );
@@ -3719,37 +4053,13 @@ int fd_deserializable_versioned_bank_decode_footprint_inner( fd_bincode_decode_c
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
-  err = fd_bincode_uint64_decode_footprint( ctx );
-  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_bincode_uint128_decode_footprint( ctx );
+  err = fd_bincode_bytes_decode_footprint( 161UL, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_bincode_uint64_decode_footprint( ctx );
-  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_bincode_double_decode_footprint( ctx );
-  if( FD_UNLIKELY( err ) ) return err;
-  err = fd_bincode_uint64_decode_footprint( ctx );
-  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_bincode_uint64_decode_footprint( ctx );
-  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_bincode_uint64_decode_footprint( ctx );
-  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_bincode_uint64_decode_footprint( ctx );
-  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
-  if( FD_UNLIKELY( err ) ) return err;
-  err = fd_bincode_uint64_decode_footprint( ctx );
-  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_fee_calculator_decode_footprint_inner( ctx, total_sz );
-  if( FD_UNLIKELY( err ) ) return err;
-  err = fd_fee_rate_governor_decode_footprint_inner( ctx, total_sz );
-  if( FD_UNLIKELY( err ) ) return err;
-  err = fd_bincode_uint64_decode_footprint( ctx );
-  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   err = fd_rent_collector_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_inflation_decode_footprint_inner( ctx, total_sz );
+  err = fd_bincode_bytes_decode_footprint( 48UL, ctx );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_stakes_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
@@ -3769,15 +4079,116 @@ int fd_deserializable_versioned_bank_decode_footprint_inner( fd_bincode_decode_c
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
-void * fd_deserializable_versioned_bank_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
-  fd_deserializable_versioned_bank_t * self = (fd_deserializable_versioned_bank_t *)mem;
-  fd_deserializable_versioned_bank_new( self );
-  void * alloc_region = (uchar *)mem + sizeof(fd_deserializable_versioned_bank_t);
-  void * * alloc_mem = &alloc_region;
-  fd_deserializable_versioned_bank_decode_inner( mem, alloc_mem, ctx );
-  return self;
-}
-void fd_deserializable_versioned_bank_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx ) {
+static int fd_deserializable_versioned_bank_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_block_hash_vec_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong ancestors_len;
+  err = fd_bincode_uint64_decode( &ancestors_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( ancestors_len ) {
+    *total_sz += FD_SLOT_PAIR_ALIGN + FD_SLOT_PAIR_FOOTPRINT*ancestors_len;
+    for( ulong i=0; i < ancestors_len; i++ ) {
+      err = fd_slot_pair_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  err = fd_hard_forks_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  {
+    uchar o;
+    err = fd_bincode_bool_decode( &o, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    if( o ) {
+    *total_sz += 8UL + sizeof(ulong);
+      err = fd_bincode_uint64_decode_footprint( ctx );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  err = fd_bincode_uint128_decode_footprint( ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  err = fd_bincode_double_decode_footprint( ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  err = fd_fee_calculator_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_fee_rate_governor_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  err = fd_rent_collector_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_inflation_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_stakes_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_unused_accounts_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong epoch_stakes_len;
+  err = fd_bincode_uint64_decode( &epoch_stakes_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( epoch_stakes_len ) {
+    *total_sz += FD_EPOCH_EPOCH_STAKES_PAIR_ALIGN + FD_EPOCH_EPOCH_STAKES_PAIR_FOOTPRINT*epoch_stakes_len;
+    for( ulong i=0; i < epoch_stakes_len; i++ ) {
+      err = fd_epoch_epoch_stakes_pair_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_bincode_bool_decode_footprint( ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+int fd_deserializable_versioned_bank_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_deserializable_versioned_bank_t);
+  void const * start_data = ctx->data;
+  int err = fd_deserializable_versioned_bank_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
+void * fd_deserializable_versioned_bank_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_deserializable_versioned_bank_t * self = (fd_deserializable_versioned_bank_t *)mem;
+  fd_deserializable_versioned_bank_new( self );
+  void * alloc_region = (uchar *)mem + sizeof(fd_deserializable_versioned_bank_t);
+  void * * alloc_mem = &alloc_region;
+  fd_deserializable_versioned_bank_decode_inner( mem, alloc_mem, ctx );
+  return self;
+}
+void fd_deserializable_versioned_bank_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_deserializable_versioned_bank_t * self = (fd_deserializable_versioned_bank_t *)struct_mem;
   fd_block_hash_vec_decode_inner( &self->blockhash_queue, alloc_mem, ctx );
   fd_bincode_uint64_decode_unsafe( &self->ancestors_len, ctx );
@@ -4083,6 +4494,63 @@ int fd_serializable_versioned_bank_decode_footprint( fd_bincode_decode_ctx_t * c
   return err;
 }
 int fd_serializable_versioned_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_block_hash_vec_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong ancestors_len;
+  err = fd_bincode_uint64_decode( &ancestors_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( ancestors_len ) {
+    *total_sz += FD_SLOT_PAIR_ALIGN + FD_SLOT_PAIR_FOOTPRINT*ancestors_len;
+    for( ulong i=0; i < ancestors_len; i++ ) {
+      err = fd_slot_pair_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_bincode_bytes_decode_footprint( 72UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_hard_forks_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 40UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  {
+    uchar o;
+    err = fd_bincode_bool_decode( &o, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    if( o ) {
+    *total_sz += 8UL + sizeof(ulong);
+      err = fd_bincode_uint64_decode_footprint( ctx );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_bincode_bytes_decode_footprint( 161UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_rent_collector_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 48UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_stakes_serializable_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_unused_accounts_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong epoch_stakes_len;
+  err = fd_bincode_uint64_decode( &epoch_stakes_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( epoch_stakes_len ) {
+    *total_sz += FD_EPOCH_EPOCH_STAKES_PAIR_ALIGN + FD_EPOCH_EPOCH_STAKES_PAIR_FOOTPRINT*epoch_stakes_len;
+    for( ulong i=0; i < epoch_stakes_len; i++ ) {
+      err = fd_epoch_epoch_stakes_pair_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_bincode_bool_decode_footprint( ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_serializable_versioned_bank_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_block_hash_vec_decode_footprint_inner( ctx, total_sz );
@@ -4175,6 +4643,14 @@ int fd_serializable_versioned_bank_decode_footprint_inner( fd_bincode_decode_ctx
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_serializable_versioned_bank_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_serializable_versioned_bank_t);
+  void const * start_data = ctx->data;
+  int err = fd_serializable_versioned_bank_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_serializable_versioned_bank_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_serializable_versioned_bank_t * self = (fd_serializable_versioned_bank_t *)mem;
   fd_serializable_versioned_bank_new( self );
@@ -4416,6 +4892,13 @@ int fd_bank_hash_stats_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong *
   return err;
 }
 int fd_bank_hash_stats_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 40UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_bank_hash_stats_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -4430,6 +4913,14 @@ int fd_bank_hash_stats_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ul
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_bank_hash_stats_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_bank_hash_stats_t);
+  void const * start_data = ctx->data;
+  int err = fd_bank_hash_stats_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_bank_hash_stats_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_bank_hash_stats_t * self = (fd_bank_hash_stats_t *)mem;
   fd_bank_hash_stats_new( self );
@@ -4464,15 +4955,7 @@ void fd_bank_hash_stats_walk( void * w, fd_bank_hash_stats_t const * self, fd_ty
   fun( w, &self->num_executable_accounts, "num_executable_accounts", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_bank_hash_stats", level-- );
 }
-ulong fd_bank_hash_stats_size( fd_bank_hash_stats_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_bank_hash_stats_size( fd_bank_hash_stats_t const * self ) { (void)self; return 40UL; }
 
 int fd_bank_hash_info_encode( fd_bank_hash_info_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -4493,6 +4976,13 @@ int fd_bank_hash_info_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * t
   return err;
 }
 int fd_bank_hash_info_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 104UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_bank_hash_info_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_hash_decode_footprint_inner( ctx, total_sz );
@@ -4503,6 +4993,14 @@ int fd_bank_hash_info_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulo
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_bank_hash_info_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_bank_hash_info_t);
+  void const * start_data = ctx->data;
+  int err = fd_bank_hash_info_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_bank_hash_info_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_bank_hash_info_t * self = (fd_bank_hash_info_t *)mem;
   fd_bank_hash_info_new( self );
@@ -4539,13 +5037,7 @@ void fd_bank_hash_info_walk( void * w, fd_bank_hash_info_t const * self, fd_type
   fd_bank_hash_stats_walk( w, &self->stats, fun, "stats", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_bank_hash_info", level-- );
 }
-ulong fd_bank_hash_info_size( fd_bank_hash_info_t const * self ) {
-  ulong size = 0;
-  size += fd_hash_size( &self->accounts_delta_hash );
-  size += fd_hash_size( &self->accounts_hash );
-  size += fd_bank_hash_stats_size( &self->stats );
-  return size;
-}
+ulong fd_bank_hash_info_size( fd_bank_hash_info_t const * self ) { (void)self; return 104UL; }
 
 int fd_slot_map_pair_encode( fd_slot_map_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -4564,6 +5056,13 @@ int fd_slot_map_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * to
   return err;
 }
 int fd_slot_map_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 40UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_slot_map_pair_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -4572,6 +5071,14 @@ int fd_slot_map_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulon
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_slot_map_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_slot_map_pair_t);
+  void const * start_data = ctx->data;
+  int err = fd_slot_map_pair_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_slot_map_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_slot_map_pair_t * self = (fd_slot_map_pair_t *)mem;
   fd_slot_map_pair_new( self );
@@ -4602,12 +5109,7 @@ void fd_slot_map_pair_walk( void * w, fd_slot_map_pair_t const * self, fd_types_
   fd_hash_walk( w, &self->hash, fun, "hash", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_slot_map_pair", level-- );
 }
-ulong fd_slot_map_pair_size( fd_slot_map_pair_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += fd_hash_size( &self->hash );
-  return size;
-}
+ulong fd_slot_map_pair_size( fd_slot_map_pair_t const * self ) { (void)self; return 40UL; }
 
 int fd_snapshot_acc_vec_encode( fd_snapshot_acc_vec_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -4626,6 +5128,13 @@ int fd_snapshot_acc_vec_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong *
   return err;
 }
 int fd_snapshot_acc_vec_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 16UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_snapshot_acc_vec_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -4634,6 +5143,14 @@ int fd_snapshot_acc_vec_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, u
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_snapshot_acc_vec_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_snapshot_acc_vec_t);
+  void const * start_data = ctx->data;
+  int err = fd_snapshot_acc_vec_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_snapshot_acc_vec_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_snapshot_acc_vec_t * self = (fd_snapshot_acc_vec_t *)mem;
   fd_snapshot_acc_vec_new( self );
@@ -4662,12 +5179,7 @@ void fd_snapshot_acc_vec_walk( void * w, fd_snapshot_acc_vec_t const * self, fd_
   fun( w, &self->file_sz, "file_sz", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_snapshot_acc_vec", level-- );
 }
-ulong fd_snapshot_acc_vec_size( fd_snapshot_acc_vec_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_snapshot_acc_vec_size( fd_snapshot_acc_vec_t const * self ) { (void)self; return 16UL; }
 
 int fd_snapshot_slot_acc_vecs_encode( fd_snapshot_slot_acc_vecs_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -4960,6 +5472,43 @@ int fd_solana_accounts_db_fields_decode_footprint( fd_bincode_decode_ctx_t * ctx
   return err;
 }
 int fd_solana_accounts_db_fields_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  ulong storages_len;
+  err = fd_bincode_uint64_decode( &storages_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( storages_len ) {
+    *total_sz += FD_SNAPSHOT_SLOT_ACC_VECS_ALIGN + FD_SNAPSHOT_SLOT_ACC_VECS_FOOTPRINT*storages_len;
+    for( ulong i=0; i < storages_len; i++ ) {
+      err = fd_snapshot_slot_acc_vecs_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_bincode_bytes_decode_footprint( 120UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong historical_roots_len;
+  err = fd_bincode_uint64_decode( &historical_roots_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( historical_roots_len ) {
+    *total_sz += 8UL + sizeof(ulong)*historical_roots_len;
+    for( ulong i=0; i < historical_roots_len; i++ ) {
+      err = fd_bincode_uint64_decode_footprint( ctx );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  ulong historical_roots_with_hash_len;
+  err = fd_bincode_uint64_decode( &historical_roots_with_hash_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( historical_roots_with_hash_len ) {
+    *total_sz += FD_SLOT_MAP_PAIR_ALIGN + FD_SLOT_MAP_PAIR_FOOTPRINT*historical_roots_with_hash_len;
+    for( ulong i=0; i < historical_roots_with_hash_len; i++ ) {
+      err = fd_slot_map_pair_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  return 0;
+}
+static int fd_solana_accounts_db_fields_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   ulong storages_len;
@@ -5000,6 +5549,14 @@ int fd_solana_accounts_db_fields_decode_footprint_inner( fd_bincode_decode_ctx_t
   }
   return 0;
 }
+int fd_solana_accounts_db_fields_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_solana_accounts_db_fields_t);
+  void const * start_data = ctx->data;
+  int err = fd_solana_accounts_db_fields_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_solana_accounts_db_fields_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_solana_accounts_db_fields_t * self = (fd_solana_accounts_db_fields_t *)mem;
   fd_solana_accounts_db_fields_new( self );
@@ -5476,6 +6033,15 @@ int fd_reward_info_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * tota
   return err;
 }
 int fd_reward_info_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_reward_type_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 24UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_reward_info_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_reward_type_decode_footprint_inner( ctx, total_sz );
@@ -5488,6 +6054,14 @@ int fd_reward_info_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_reward_info_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_reward_info_t);
+  void const * start_data = ctx->data;
+  int err = fd_reward_info_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_reward_info_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_reward_info_t * self = (fd_reward_info_t *)mem;
   fd_reward_info_new( self );
@@ -5522,14 +6096,7 @@ void fd_reward_info_walk( void * w, fd_reward_info_t const * self, fd_types_walk
   fun( w, &self->commission, "commission", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_reward_info", level-- );
 }
-ulong fd_reward_info_size( fd_reward_info_t const * self ) {
-  ulong size = 0;
-  size += fd_reward_type_size( &self->reward_type );
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_reward_info_size( fd_reward_info_t const * self ) { (void)self; return 28UL; }
 
 int fd_slot_lthash_encode( fd_slot_lthash_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -5578,11 +6145,7 @@ void fd_slot_lthash_walk( void * w, fd_slot_lthash_t const * self, fd_types_walk
   fun( w, self->lthash, "lthash", FD_FLAMENCO_TYPE_HASH16384, "uchar[2048]", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_slot_lthash", level-- );
 }
-ulong fd_slot_lthash_size( fd_slot_lthash_t const * self ) {
-  ulong size = 0;
-  size += sizeof(char) * 2048;
-  return size;
-}
+ulong fd_slot_lthash_size( fd_slot_lthash_t const * self ) { (void)self; return 2048UL; }
 
 int fd_solana_manifest_encode( fd_solana_manifest_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -6072,6 +6635,13 @@ int fd_rust_duration_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * to
   return err;
 }
 int fd_rust_duration_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 12UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_rust_duration_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -6080,6 +6650,14 @@ int fd_rust_duration_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulon
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_rust_duration_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_rust_duration_t);
+  void const * start_data = ctx->data;
+  int err = fd_rust_duration_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_rust_duration_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_rust_duration_t * self = (fd_rust_duration_t *)mem;
   fd_rust_duration_new( self );
@@ -6108,12 +6686,7 @@ void fd_rust_duration_walk( void * w, fd_rust_duration_t const * self, fd_types_
   fun( w, &self->nanoseconds, "nanoseconds", FD_FLAMENCO_TYPE_UINT, "uint", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_rust_duration", level-- );
 }
-ulong fd_rust_duration_size( fd_rust_duration_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += sizeof(uint);
-  return size;
-}
+ulong fd_rust_duration_size( fd_rust_duration_t const * self ) { (void)self; return 12UL; }
 
 int fd_poh_config_encode( fd_poh_config_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -6145,6 +6718,32 @@ int fd_poh_config_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total
   return err;
 }
 int fd_poh_config_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 12UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  {
+    uchar o;
+    err = fd_bincode_bool_decode( &o, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    if( o ) {
+    *total_sz += 8UL + sizeof(ulong);
+      err = fd_bincode_uint64_decode_footprint( ctx );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  {
+    uchar o;
+    err = fd_bincode_bool_decode( &o, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    if( o ) {
+      err = fd_bincode_uint64_decode_footprint( ctx );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  return 0;
+}
+static int fd_poh_config_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_rust_duration_decode_footprint_inner( ctx, total_sz );
@@ -6170,6 +6769,14 @@ int fd_poh_config_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong *
   }
   return 0;
 }
+int fd_poh_config_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_poh_config_t);
+  void const * start_data = ctx->data;
+  int err = fd_poh_config_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_poh_config_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_poh_config_t * self = (fd_poh_config_t *)mem;
   fd_poh_config_new( self );
@@ -6269,6 +6876,23 @@ int fd_string_pubkey_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_string_pubkey_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  ulong string_len;
+  err = fd_bincode_uint64_decode( &string_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  *total_sz += string_len;
+  if( string_len ) {
+    err = fd_bincode_bytes_decode_footprint( string_len, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    err = !fd_utf8_verify( (char const *) ctx->data - string_len, string_len );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  }
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_string_pubkey_pair_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   ulong string_len;
@@ -6285,6 +6909,14 @@ int fd_string_pubkey_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_string_pubkey_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_string_pubkey_pair_t);
+  void const * start_data = ctx->data;
+  int err = fd_string_pubkey_pair_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_string_pubkey_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_string_pubkey_pair_t * self = (fd_string_pubkey_pair_t *)mem;
   fd_string_pubkey_pair_new( self );
@@ -6351,6 +6983,15 @@ int fd_pubkey_account_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulon
   return err;
 }
 int fd_pubkey_account_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_solana_account_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_pubkey_account_pair_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -6359,6 +7000,14 @@ int fd_pubkey_account_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_pubkey_account_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_pubkey_account_pair_t);
+  void const * start_data = ctx->data;
+  int err = fd_pubkey_account_pair_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_pubkey_account_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_account_pair_t * self = (fd_pubkey_account_pair_t *)mem;
   fd_pubkey_account_pair_new( self );
@@ -6455,6 +7104,53 @@ int fd_genesis_solana_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * t
   return err;
 }
 int fd_genesis_solana_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  ulong accounts_len;
+  err = fd_bincode_uint64_decode( &accounts_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( accounts_len ) {
+    *total_sz += FD_PUBKEY_ACCOUNT_PAIR_ALIGN + FD_PUBKEY_ACCOUNT_PAIR_FOOTPRINT*accounts_len;
+    for( ulong i=0; i < accounts_len; i++ ) {
+      err = fd_pubkey_account_pair_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  ulong native_instruction_processors_len;
+  err = fd_bincode_uint64_decode( &native_instruction_processors_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( native_instruction_processors_len ) {
+    *total_sz += FD_STRING_PUBKEY_PAIR_ALIGN + FD_STRING_PUBKEY_PAIR_FOOTPRINT*native_instruction_processors_len;
+    for( ulong i=0; i < native_instruction_processors_len; i++ ) {
+      err = fd_string_pubkey_pair_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  ulong rewards_pools_len;
+  err = fd_bincode_uint64_decode( &rewards_pools_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( rewards_pools_len ) {
+    *total_sz += FD_PUBKEY_ACCOUNT_PAIR_ALIGN + FD_PUBKEY_ACCOUNT_PAIR_FOOTPRINT*rewards_pools_len;
+    for( ulong i=0; i < rewards_pools_len; i++ ) {
+      err = fd_pubkey_account_pair_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_bincode_bytes_decode_footprint( 16UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_poh_config_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 106UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_uint32_decode_footprint( ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_genesis_solana_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -6509,6 +7205,14 @@ int fd_genesis_solana_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulo
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_genesis_solana_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_genesis_solana_t);
+  void const * start_data = ctx->data;
+  int err = fd_genesis_solana_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_genesis_solana_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_genesis_solana_t * self = (fd_genesis_solana_t *)mem;
   fd_genesis_solana_new( self );
@@ -6682,6 +7386,13 @@ int fd_sol_sysvar_clock_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong *
   return err;
 }
 int fd_sol_sysvar_clock_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 40UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_sol_sysvar_clock_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -6696,6 +7407,14 @@ int fd_sol_sysvar_clock_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, u
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_sol_sysvar_clock_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_sol_sysvar_clock_t);
+  void const * start_data = ctx->data;
+  int err = fd_sol_sysvar_clock_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_sol_sysvar_clock_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_sol_sysvar_clock_t * self = (fd_sol_sysvar_clock_t *)mem;
   fd_sol_sysvar_clock_new( self );
@@ -6730,15 +7449,7 @@ void fd_sol_sysvar_clock_walk( void * w, fd_sol_sysvar_clock_t const * self, fd_
   fun( w, &self->unix_timestamp, "unix_timestamp", FD_FLAMENCO_TYPE_SLONG, "long", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_sol_sysvar_clock", level-- );
 }
-ulong fd_sol_sysvar_clock_size( fd_sol_sysvar_clock_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += sizeof(long);
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += sizeof(long);
-  return size;
-}
+ulong fd_sol_sysvar_clock_size( fd_sol_sysvar_clock_t const * self ) { (void)self; return 40UL; }
 
 int fd_sol_sysvar_last_restart_slot_encode( fd_sol_sysvar_last_restart_slot_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -6787,11 +7498,7 @@ void fd_sol_sysvar_last_restart_slot_walk( void * w, fd_sol_sysvar_last_restart_
   fun( w, &self->slot, "slot", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_sol_sysvar_last_restart_slot", level-- );
 }
-ulong fd_sol_sysvar_last_restart_slot_size( fd_sol_sysvar_last_restart_slot_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_sol_sysvar_last_restart_slot_size( fd_sol_sysvar_last_restart_slot_t const * self ) { (void)self; return 8UL; }
 
 int fd_vote_lockout_encode( fd_vote_lockout_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -6810,6 +7517,13 @@ int fd_vote_lockout_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * tot
   return err;
 }
 int fd_vote_lockout_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 12UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_vote_lockout_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -6818,6 +7532,14 @@ int fd_vote_lockout_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_vote_lockout_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_lockout_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_lockout_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_vote_lockout_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_lockout_t * self = (fd_vote_lockout_t *)mem;
   fd_vote_lockout_new( self );
@@ -6846,12 +7568,7 @@ void fd_vote_lockout_walk( void * w, fd_vote_lockout_t const * self, fd_types_wa
   fun( w, &self->confirmation_count, "confirmation_count", FD_FLAMENCO_TYPE_UINT, "uint", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_vote_lockout", level-- );
 }
-ulong fd_vote_lockout_size( fd_vote_lockout_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += sizeof(uint);
-  return size;
-}
+ulong fd_vote_lockout_size( fd_vote_lockout_t const * self ) { (void)self; return 12UL; }
 
 int fd_lockout_offset_encode( fd_lockout_offset_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -6930,6 +7647,13 @@ int fd_vote_authorized_voter_decode_footprint( fd_bincode_decode_ctx_t * ctx, ul
   return err;
 }
 int fd_vote_authorized_voter_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 40UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_vote_authorized_voter_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -6938,6 +7662,14 @@ int fd_vote_authorized_voter_decode_footprint_inner( fd_bincode_decode_ctx_t * c
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_vote_authorized_voter_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_authorized_voter_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_authorized_voter_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_vote_authorized_voter_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_authorized_voter_t * self = (fd_vote_authorized_voter_t *)mem;
   fd_vote_authorized_voter_new( self );
@@ -6968,12 +7700,7 @@ void fd_vote_authorized_voter_walk( void * w, fd_vote_authorized_voter_t const *
   fd_pubkey_walk( w, &self->pubkey, fun, "pubkey", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_vote_authorized_voter", level-- );
 }
-ulong fd_vote_authorized_voter_size( fd_vote_authorized_voter_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += fd_pubkey_size( &self->pubkey );
-  return size;
-}
+ulong fd_vote_authorized_voter_size( fd_vote_authorized_voter_t const * self ) { (void)self; return 40UL; }
 
 int fd_vote_prior_voter_encode( fd_vote_prior_voter_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -6994,6 +7721,13 @@ int fd_vote_prior_voter_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong *
   return err;
 }
 int fd_vote_prior_voter_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 48UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_vote_prior_voter_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -7004,6 +7738,14 @@ int fd_vote_prior_voter_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, u
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_vote_prior_voter_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_prior_voter_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_prior_voter_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_vote_prior_voter_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_prior_voter_t * self = (fd_vote_prior_voter_t *)mem;
   fd_vote_prior_voter_new( self );
@@ -7036,13 +7778,7 @@ void fd_vote_prior_voter_walk( void * w, fd_vote_prior_voter_t const * self, fd_
   fun( w, &self->epoch_end, "epoch_end", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_vote_prior_voter", level-- );
 }
-ulong fd_vote_prior_voter_size( fd_vote_prior_voter_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->pubkey );
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_vote_prior_voter_size( fd_vote_prior_voter_t const * self ) { (void)self; return 48UL; }
 
 int fd_vote_prior_voter_0_23_5_encode( fd_vote_prior_voter_0_23_5_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -7065,6 +7801,13 @@ int fd_vote_prior_voter_0_23_5_decode_footprint( fd_bincode_decode_ctx_t * ctx,
   return err;
 }
 int fd_vote_prior_voter_0_23_5_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 56UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_vote_prior_voter_0_23_5_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -7077,6 +7820,14 @@ int fd_vote_prior_voter_0_23_5_decode_footprint_inner( fd_bincode_decode_ctx_t *
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_vote_prior_voter_0_23_5_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_prior_voter_0_23_5_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_prior_voter_0_23_5_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_vote_prior_voter_0_23_5_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_prior_voter_0_23_5_t * self = (fd_vote_prior_voter_0_23_5_t *)mem;
   fd_vote_prior_voter_0_23_5_new( self );
@@ -7111,14 +7862,7 @@ void fd_vote_prior_voter_0_23_5_walk( void * w, fd_vote_prior_voter_0_23_5_t con
   fun( w, &self->slot, "slot", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_vote_prior_voter_0_23_5", level-- );
 }
-ulong fd_vote_prior_voter_0_23_5_size( fd_vote_prior_voter_0_23_5_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->pubkey );
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_vote_prior_voter_0_23_5_size( fd_vote_prior_voter_0_23_5_t const * self ) { (void)self; return 56UL; }
 
 int fd_vote_epoch_credits_encode( fd_vote_epoch_credits_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -7139,6 +7883,13 @@ int fd_vote_epoch_credits_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_vote_epoch_credits_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 24UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_vote_epoch_credits_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -7149,6 +7900,14 @@ int fd_vote_epoch_credits_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_vote_epoch_credits_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_epoch_credits_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_epoch_credits_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_vote_epoch_credits_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_epoch_credits_t * self = (fd_vote_epoch_credits_t *)mem;
   fd_vote_epoch_credits_new( self );
@@ -7179,13 +7938,7 @@ void fd_vote_epoch_credits_walk( void * w, fd_vote_epoch_credits_t const * self,
   fun( w, &self->prev_credits, "prev_credits", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_vote_epoch_credits", level-- );
 }
-ulong fd_vote_epoch_credits_size( fd_vote_epoch_credits_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_vote_epoch_credits_size( fd_vote_epoch_credits_t const * self ) { (void)self; return 24UL; }
 
 int fd_vote_block_timestamp_encode( fd_vote_block_timestamp_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -7204,6 +7957,13 @@ int fd_vote_block_timestamp_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulo
   return err;
 }
 int fd_vote_block_timestamp_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 16UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_vote_block_timestamp_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -7212,6 +7972,14 @@ int fd_vote_block_timestamp_decode_footprint_inner( fd_bincode_decode_ctx_t * ct
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_vote_block_timestamp_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_block_timestamp_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_block_timestamp_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_vote_block_timestamp_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_block_timestamp_t * self = (fd_vote_block_timestamp_t *)mem;
   fd_vote_block_timestamp_new( self );
@@ -7225,6 +7993,16 @@ void fd_vote_block_timestamp_decode_inner( void * struct_mem, void * * alloc_mem
   fd_bincode_uint64_decode_unsafe( &self->slot, ctx );
   fd_bincode_uint64_decode_unsafe( (ulong *) &self->timestamp, ctx );
 }
+int fd_vote_block_timestamp_view( fd_vote_block_timestamp_view_t * view, uchar const * data, ulong data_sz ) {
+  fd_bincode_decode_ctx_t ctx = { .data = data, .dataend = data + data_sz };
+  ulong total_sz = 0UL;
+  int err = fd_vote_block_timestamp_decode_footprint_inner( &ctx, &total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  if( FD_UNLIKELY( ctx.data>ctx.dataend ) ) return FD_BINCODE_ERR_OVERFLOW;
+  view->data    = data;
+  view->data_sz = (ulong)ctx.data - (ulong)data;
+  return FD_BINCODE_SUCCESS;
+}
 void fd_vote_block_timestamp_new(fd_vote_block_timestamp_t * self) {
   fd_memset( self, 0, sizeof(fd_vote_block_timestamp_t) );
 }
@@ -7240,12 +8018,7 @@ void fd_vote_block_timestamp_walk( void * w, fd_vote_block_timestamp_t const * s
   fun( w, &self->timestamp, "timestamp", FD_FLAMENCO_TYPE_SLONG, "long", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_vote_block_timestamp", level-- );
 }
-ulong fd_vote_block_timestamp_size( fd_vote_block_timestamp_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += sizeof(long);
-  return size;
-}
+ulong fd_vote_block_timestamp_size( fd_vote_block_timestamp_t const * self ) { (void)self; return 16UL; }
 
 int fd_vote_prior_voters_encode( fd_vote_prior_voters_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -7268,6 +8041,15 @@ int fd_vote_prior_voters_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_vote_prior_voters_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 1544UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bool_decode_footprint( ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_vote_prior_voters_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   for( ulong i=0; i<32; i++ ) {
@@ -7280,6 +8062,14 @@ int fd_vote_prior_voters_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_vote_prior_voters_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_prior_voters_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_prior_voters_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_vote_prior_voters_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_prior_voters_t * self = (fd_vote_prior_voters_t *)mem;
   fd_vote_prior_voters_new( self );
@@ -7319,14 +8109,7 @@ void fd_vote_prior_voters_walk( void * w, fd_vote_prior_voters_t const * self, f
   fun( w, &self->is_empty, "is_empty", FD_FLAMENCO_TYPE_BOOL, "bool", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_vote_prior_voters", level-- );
 }
-ulong fd_vote_prior_voters_size( fd_vote_prior_voters_t const * self ) {
-  ulong size = 0;
-  for( ulong i=0; i<32; i++ )
-    size += fd_vote_prior_voter_size( self->buf + i );
-  size += sizeof(ulong);
-  size += sizeof(char);
-  return size;
-}
+ulong fd_vote_prior_voters_size( fd_vote_prior_voters_t const * self ) { (void)self; return 1545UL; }
 
 int fd_vote_prior_voters_0_23_5_encode( fd_vote_prior_voters_0_23_5_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -7347,6 +8130,13 @@ int fd_vote_prior_voters_0_23_5_decode_footprint( fd_bincode_decode_ctx_t * ctx,
   return err;
 }
 int fd_vote_prior_voters_0_23_5_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 1800UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_vote_prior_voters_0_23_5_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   for( ulong i=0; i<32; i++ ) {
@@ -7357,6 +8147,14 @@ int fd_vote_prior_voters_0_23_5_decode_footprint_inner( fd_bincode_decode_ctx_t
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_vote_prior_voters_0_23_5_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_prior_voters_0_23_5_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_prior_voters_0_23_5_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_vote_prior_voters_0_23_5_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_prior_voters_0_23_5_t * self = (fd_vote_prior_voters_0_23_5_t *)mem;
   fd_vote_prior_voters_0_23_5_new( self );
@@ -7394,13 +8192,7 @@ void fd_vote_prior_voters_0_23_5_walk( void * w, fd_vote_prior_voters_0_23_5_t c
   fun( w, &self->idx, "idx", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_vote_prior_voters_0_23_5", level-- );
 }
-ulong fd_vote_prior_voters_0_23_5_size( fd_vote_prior_voters_0_23_5_t const * self ) {
-  ulong size = 0;
-  for( ulong i=0; i<32; i++ )
-    size += fd_vote_prior_voter_0_23_5_size( self->buf + i );
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_vote_prior_voters_0_23_5_size( fd_vote_prior_voters_0_23_5_t const * self ) { (void)self; return 1800UL; }
 
 int fd_landed_vote_encode( fd_landed_vote_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -7419,6 +8211,13 @@ int fd_landed_vote_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * tota
   return err;
 }
 int fd_landed_vote_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 13UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_landed_vote_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint8_decode_footprint( ctx );
@@ -7427,6 +8226,14 @@ int fd_landed_vote_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_landed_vote_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_landed_vote_t);
+  void const * start_data = ctx->data;
+  int err = fd_landed_vote_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_landed_vote_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_landed_vote_t * self = (fd_landed_vote_t *)mem;
   fd_landed_vote_new( self );
@@ -7457,12 +8264,7 @@ void fd_landed_vote_walk( void * w, fd_landed_vote_t const * self, fd_types_walk
   fd_vote_lockout_walk( w, &self->lockout, fun, "lockout", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_landed_vote", level-- );
 }
-ulong fd_landed_vote_size( fd_landed_vote_t const * self ) {
-  ulong size = 0;
-  size += sizeof(char);
-  size += fd_vote_lockout_size( &self->lockout );
-  return size;
-}
+ulong fd_landed_vote_size( fd_landed_vote_t const * self ) { (void)self; return 13UL; }
 
 int fd_vote_state_0_23_5_encode( fd_vote_state_0_23_5_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -7525,6 +8327,42 @@ int fd_vote_state_0_23_5_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_vote_state_0_23_5_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 1905UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong votes_len;
+  err = fd_bincode_uint64_decode( &votes_len, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong votes_max = fd_ulong_max( votes_len, 32 );
+  *total_sz += deq_fd_vote_lockout_t_align() + deq_fd_vote_lockout_t_footprint( votes_max );
+  ulong votes_sz;
+  if( FD_UNLIKELY( __builtin_umull_overflow( votes_len, 12, &votes_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
+  err = fd_bincode_bytes_decode_footprint( votes_sz, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  {
+    uchar o;
+    err = fd_bincode_bool_decode( &o, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    if( o ) {
+      err = fd_bincode_uint64_decode_footprint( ctx );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  ulong epoch_credits_len;
+  err = fd_bincode_uint64_decode( &epoch_credits_len, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong epoch_credits_max = fd_ulong_max( epoch_credits_len, 64 );
+  *total_sz += deq_fd_vote_epoch_credits_t_align() + deq_fd_vote_epoch_credits_t_footprint( epoch_credits_max );
+  ulong epoch_credits_sz;
+  if( FD_UNLIKELY( __builtin_umull_overflow( epoch_credits_len, 24, &epoch_credits_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
+  err = fd_bincode_bytes_decode_footprint( epoch_credits_sz, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 16UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_vote_state_0_23_5_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -7570,6 +8408,14 @@ int fd_vote_state_0_23_5_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_vote_state_0_23_5_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_state_0_23_5_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_state_0_23_5_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_vote_state_0_23_5_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_state_0_23_5_t * self = (fd_vote_state_0_23_5_t *)mem;
   fd_vote_state_0_23_5_new( self );
@@ -7614,6 +8460,16 @@ void fd_vote_state_0_23_5_decode_inner( void * struct_mem, void * * alloc_mem, f
   }
   fd_vote_block_timestamp_decode_inner( &self->last_timestamp, alloc_mem, ctx );
 }
+int fd_vote_state_0_23_5_view( fd_vote_state_0_23_5_view_t * view, uchar const * data, ulong data_sz ) {
+  fd_bincode_decode_ctx_t ctx = { .data = data, .dataend = data + data_sz };
+  ulong total_sz = 0UL;
+  int err = fd_vote_state_0_23_5_decode_footprint_inner( &ctx, &total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  if( FD_UNLIKELY( ctx.data>ctx.dataend ) ) return FD_BINCODE_ERR_OVERFLOW;
+  view->data    = data;
+  view->data_sz = (ulong)ctx.data - (ulong)data;
+  return FD_BINCODE_SUCCESS;
+}
 void fd_vote_state_0_23_5_new(fd_vote_state_0_23_5_t * self) {
   fd_memset( self, 0, sizeof(fd_vote_state_0_23_5_t) );
   fd_pubkey_new( &self->node_pubkey );
@@ -7901,6 +8757,46 @@ int fd_vote_state_1_14_11_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_vote_state_1_14_11_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 65UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong votes_len;
+  err = fd_bincode_uint64_decode( &votes_len, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong votes_max = fd_ulong_max( votes_len, 32 );
+  *total_sz += deq_fd_vote_lockout_t_align() + deq_fd_vote_lockout_t_footprint( votes_max );
+  ulong votes_sz;
+  if( FD_UNLIKELY( __builtin_umull_overflow( votes_len, 12, &votes_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
+  err = fd_bincode_bytes_decode_footprint( votes_sz, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  {
+    uchar o;
+    err = fd_bincode_bool_decode( &o, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    if( o ) {
+      err = fd_bincode_uint64_decode_footprint( ctx );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_vote_authorized_voters_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_vote_prior_voters_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong epoch_credits_len;
+  err = fd_bincode_uint64_decode( &epoch_credits_len, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong epoch_credits_max = fd_ulong_max( epoch_credits_len, 64 );
+  *total_sz += deq_fd_vote_epoch_credits_t_align() + deq_fd_vote_epoch_credits_t_footprint( epoch_credits_max );
+  ulong epoch_credits_sz;
+  if( FD_UNLIKELY( __builtin_umull_overflow( epoch_credits_len, 24, &epoch_credits_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
+  err = fd_bincode_bytes_decode_footprint( epoch_credits_sz, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 16UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_vote_state_1_14_11_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -7944,6 +8840,14 @@ int fd_vote_state_1_14_11_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_vote_state_1_14_11_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_state_1_14_11_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_state_1_14_11_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_vote_state_1_14_11_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_state_1_14_11_t * self = (fd_vote_state_1_14_11_t *)mem;
   fd_vote_state_1_14_11_new( self );
@@ -7987,6 +8891,16 @@ void fd_vote_state_1_14_11_decode_inner( void * struct_mem, void * * alloc_mem,
   }
   fd_vote_block_timestamp_decode_inner( &self->last_timestamp, alloc_mem, ctx );
 }
+int fd_vote_state_1_14_11_view( fd_vote_state_1_14_11_view_t * view, uchar const * data, ulong data_sz ) {
+  fd_bincode_decode_ctx_t ctx = { .data = data, .dataend = data + data_sz };
+  ulong total_sz = 0UL;
+  int err = fd_vote_state_1_14_11_decode_footprint_inner( &ctx, &total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  if( FD_UNLIKELY( ctx.data>ctx.dataend ) ) return FD_BINCODE_ERR_OVERFLOW;
+  view->data    = data;
+  view->data_sz = (ulong)ctx.data - (ulong)data;
+  return FD_BINCODE_SUCCESS;
+}
 void fd_vote_state_1_14_11_new(fd_vote_state_1_14_11_t * self) {
   fd_memset( self, 0, sizeof(fd_vote_state_1_14_11_t) );
   fd_pubkey_new( &self->node_pubkey );
@@ -8145,19 +9059,59 @@ int fd_vote_state_encode( fd_vote_state_t const * self, fd_bincode_encode_ctx_t
     err = fd_bincode_uint64_encode( epoch_credits_len, ctx );
     if( FD_UNLIKELY( err ) ) return err;
   }
-  err = fd_vote_block_timestamp_encode( &self->last_timestamp, ctx );
+  err = fd_vote_block_timestamp_encode( &self->last_timestamp, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return FD_BINCODE_SUCCESS;
+}
+int fd_vote_state_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_state_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_state_decode_footprint_inner( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
+int fd_vote_state_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 65UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong votes_len;
+  err = fd_bincode_uint64_decode( &votes_len, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong votes_max = fd_ulong_max( votes_len, 32 );
+  *total_sz += deq_fd_landed_vote_t_align() + deq_fd_landed_vote_t_footprint( votes_max );
+  ulong votes_sz;
+  if( FD_UNLIKELY( __builtin_umull_overflow( votes_len, 13, &votes_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
+  err = fd_bincode_bytes_decode_footprint( votes_sz, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  {
+    uchar o;
+    err = fd_bincode_bool_decode( &o, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    if( o ) {
+      err = fd_bincode_uint64_decode_footprint( ctx );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_vote_authorized_voters_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  return FD_BINCODE_SUCCESS;
-}
-int fd_vote_state_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
-  *total_sz += sizeof(fd_vote_state_t);
-  void const * start_data = ctx->data;
-  int err = fd_vote_state_decode_footprint_inner( ctx, total_sz );
-  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
-  ctx->data = start_data;
-  return err;
+  err = fd_vote_prior_voters_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong epoch_credits_len;
+  err = fd_bincode_uint64_decode( &epoch_credits_len, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong epoch_credits_max = fd_ulong_max( epoch_credits_len, 64 );
+  *total_sz += deq_fd_vote_epoch_credits_t_align() + deq_fd_vote_epoch_credits_t_footprint( epoch_credits_max );
+  ulong epoch_credits_sz;
+  if( FD_UNLIKELY( __builtin_umull_overflow( epoch_credits_len, 24, &epoch_credits_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
+  err = fd_bincode_bytes_decode_footprint( epoch_credits_sz, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 16UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
 }
-int fd_vote_state_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+static int fd_vote_state_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -8201,6 +9155,14 @@ int fd_vote_state_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong *
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_vote_state_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_state_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_state_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_vote_state_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_state_t * self = (fd_vote_state_t *)mem;
   fd_vote_state_new( self );
@@ -8244,6 +9206,16 @@ void fd_vote_state_decode_inner( void * struct_mem, void * * alloc_mem, fd_binco
   }
   fd_vote_block_timestamp_decode_inner( &self->last_timestamp, alloc_mem, ctx );
 }
+int fd_vote_state_view( fd_vote_state_view_t * view, uchar const * data, ulong data_sz ) {
+  fd_bincode_decode_ctx_t ctx = { .data = data, .dataend = data + data_sz };
+  ulong total_sz = 0UL;
+  int err = fd_vote_state_decode_footprint_inner( &ctx, &total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  if( FD_UNLIKELY( ctx.data>ctx.dataend ) ) return FD_BINCODE_ERR_OVERFLOW;
+  view->data    = data;
+  view->data_sz = (ulong)ctx.data - (ulong)data;
+  return FD_BINCODE_SUCCESS;
+}
 void fd_vote_state_new(fd_vote_state_t * self) {
   fd_memset( self, 0, sizeof(fd_vote_state_t) );
   fd_pubkey_new( &self->node_pubkey );
@@ -8431,6 +9403,16 @@ void * fd_vote_state_versioned_decode( void * mem, fd_bincode_decode_ctx_t * ctx
   fd_vote_state_versioned_decode_inner( mem, alloc_mem, ctx );
   return self;
 }
+int fd_vote_state_versioned_view( fd_vote_state_versioned_view_t * view, uchar const * data, ulong data_sz ) {
+  fd_bincode_decode_ctx_t ctx = { .data = data, .dataend = data + data_sz };
+  ulong total_sz = 0UL;
+  int err = fd_vote_state_versioned_decode_footprint_inner( &ctx, &total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  if( FD_UNLIKELY( ctx.data>ctx.dataend ) ) return FD_BINCODE_ERR_OVERFLOW;
+  view->data    = data;
+  view->data_sz = (ulong)ctx.data - (ulong)data;
+  return FD_BINCODE_SUCCESS;
+}
 void fd_vote_state_versioned_inner_new( fd_vote_state_versioned_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -8589,6 +9571,40 @@ int fd_vote_state_update_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_vote_state_update_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  ulong lockouts_len;
+  err = fd_bincode_uint64_decode( &lockouts_len, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong lockouts_max = fd_ulong_max( lockouts_len, 32 );
+  *total_sz += deq_fd_vote_lockout_t_align() + deq_fd_vote_lockout_t_footprint( lockouts_max );
+  ulong lockouts_sz;
+  if( FD_UNLIKELY( __builtin_umull_overflow( lockouts_len, 12, &lockouts_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
+  err = fd_bincode_bytes_decode_footprint( lockouts_sz, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  {
+    uchar o;
+    err = fd_bincode_bool_decode( &o, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    if( o ) {
+      err = fd_bincode_uint64_decode_footprint( ctx );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  {
+    uchar o;
+    err = fd_bincode_bool_decode( &o, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    if( o ) {
+      err = fd_bincode_int64_decode_footprint( ctx );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  return 0;
+}
+static int fd_vote_state_update_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   ulong lockouts_len;
@@ -8622,6 +9638,14 @@ int fd_vote_state_update_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   }
   return 0;
 }
+int fd_vote_state_update_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_state_update_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_state_update_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_vote_state_update_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_state_update_t * self = (fd_vote_state_update_t *)mem;
   fd_vote_state_update_new( self );
@@ -8766,6 +9790,34 @@ int fd_compact_vote_state_update_decode_footprint( fd_bincode_decode_ctx_t * ctx
   return err;
 }
 int fd_compact_vote_state_update_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  ushort lockouts_len;
+  err = fd_bincode_compact_u16_decode( &lockouts_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( lockouts_len ) {
+    *total_sz += FD_LOCKOUT_OFFSET_ALIGN + FD_LOCKOUT_OFFSET_FOOTPRINT*lockouts_len;
+    for( ulong i=0; i < lockouts_len; i++ ) {
+      err = fd_lockout_offset_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  {
+    uchar o;
+    err = fd_bincode_bool_decode( &o, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    if( o ) {
+      err = fd_bincode_int64_decode_footprint( ctx );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  return 0;
+}
+static int fd_compact_vote_state_update_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -8793,6 +9845,14 @@ int fd_compact_vote_state_update_decode_footprint_inner( fd_bincode_decode_ctx_t
   }
   return 0;
 }
+int fd_compact_vote_state_update_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_compact_vote_state_update_t);
+  void const * start_data = ctx->data;
+  int err = fd_compact_vote_state_update_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_compact_vote_state_update_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_compact_vote_state_update_t * self = (fd_compact_vote_state_update_t *)mem;
   fd_compact_vote_state_update_new( self );
@@ -8895,6 +9955,15 @@ int fd_compact_vote_state_update_switch_decode_footprint( fd_bincode_decode_ctx_
   return err;
 }
 int fd_compact_vote_state_update_switch_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_compact_vote_state_update_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_compact_vote_state_update_switch_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_compact_vote_state_update_decode_footprint_inner( ctx, total_sz );
@@ -8903,6 +9972,14 @@ int fd_compact_vote_state_update_switch_decode_footprint_inner( fd_bincode_decod
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_compact_vote_state_update_switch_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_compact_vote_state_update_switch_t);
+  void const * start_data = ctx->data;
+  int err = fd_compact_vote_state_update_switch_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_compact_vote_state_update_switch_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_compact_vote_state_update_switch_t * self = (fd_compact_vote_state_update_switch_t *)mem;
   fd_compact_vote_state_update_switch_new( self );
@@ -8981,6 +10058,35 @@ int fd_compact_tower_sync_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_compact_tower_sync_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  ushort lockout_offsets_len;
+  err = fd_bincode_compact_u16_decode( &lockout_offsets_len, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong lockout_offsets_max = fd_ulong_max( lockout_offsets_len, 32 );
+  *total_sz += deq_fd_lockout_offset_t_align() + deq_fd_lockout_offset_t_footprint( lockout_offsets_max );
+  for( ulong i = 0; i < lockout_offsets_len; ++i ) {
+    err = fd_lockout_offset_decode_footprint_inner( ctx, total_sz );
+    if( FD_UNLIKELY( err ) ) return err;
+  }
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  {
+    uchar o;
+    err = fd_bincode_bool_decode( &o, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    if( o ) {
+      err = fd_bincode_int64_decode_footprint( ctx );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_compact_tower_sync_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -9009,6 +10115,14 @@ int fd_compact_tower_sync_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_compact_tower_sync_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_compact_tower_sync_t);
+  void const * start_data = ctx->data;
+  int err = fd_compact_tower_sync_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_compact_tower_sync_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_compact_tower_sync_t * self = (fd_compact_tower_sync_t *)mem;
   fd_compact_tower_sync_new( self );
@@ -9210,6 +10324,15 @@ int fd_tower_sync_switch_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_tower_sync_switch_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_tower_sync_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_tower_sync_switch_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_tower_sync_decode_footprint_inner( ctx, total_sz );
@@ -9218,6 +10341,14 @@ int fd_tower_sync_switch_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_tower_sync_switch_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_tower_sync_switch_t);
+  void const * start_data = ctx->data;
+  int err = fd_tower_sync_switch_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_tower_sync_switch_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_tower_sync_switch_t * self = (fd_tower_sync_switch_t *)mem;
   fd_tower_sync_switch_new( self );
@@ -9520,6 +10651,13 @@ int fd_slot_hash_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_
   return err;
 }
 int fd_slot_hash_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 40UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_slot_hash_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -9528,6 +10666,14 @@ int fd_slot_hash_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong *
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_slot_hash_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_slot_hash_t);
+  void const * start_data = ctx->data;
+  int err = fd_slot_hash_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_slot_hash_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_slot_hash_t * self = (fd_slot_hash_t *)mem;
   fd_slot_hash_new( self );
@@ -9558,12 +10704,7 @@ void fd_slot_hash_walk( void * w, fd_slot_hash_t const * self, fd_types_walk_fn_
   fd_hash_walk( w, &self->hash, fun, "hash", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_slot_hash", level-- );
 }
-ulong fd_slot_hash_size( fd_slot_hash_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += fd_hash_size( &self->hash );
-  return size;
-}
+ulong fd_slot_hash_size( fd_slot_hash_t const * self ) { (void)self; return 40UL; }
 
 int fd_slot_hashes_encode( fd_slot_hashes_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -9690,6 +10831,13 @@ int fd_block_block_hash_entry_decode_footprint( fd_bincode_decode_ctx_t * ctx, u
   return err;
 }
 int fd_block_block_hash_entry_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 40UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_block_block_hash_entry_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_hash_decode_footprint_inner( ctx, total_sz );
@@ -9698,6 +10846,14 @@ int fd_block_block_hash_entry_decode_footprint_inner( fd_bincode_decode_ctx_t *
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_block_block_hash_entry_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_block_block_hash_entry_t);
+  void const * start_data = ctx->data;
+  int err = fd_block_block_hash_entry_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_block_block_hash_entry_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_block_block_hash_entry_t * self = (fd_block_block_hash_entry_t *)mem;
   fd_block_block_hash_entry_new( self );
@@ -9730,12 +10886,7 @@ void fd_block_block_hash_entry_walk( void * w, fd_block_block_hash_entry_t const
   fd_fee_calculator_walk( w, &self->fee_calculator, fun, "fee_calculator", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_block_block_hash_entry", level-- );
 }
-ulong fd_block_block_hash_entry_size( fd_block_block_hash_entry_t const * self ) {
-  ulong size = 0;
-  size += fd_hash_size( &self->blockhash );
-  size += fd_fee_calculator_size( &self->fee_calculator );
-  return size;
-}
+ulong fd_block_block_hash_entry_size( fd_block_block_hash_entry_t const * self ) { (void)self; return 40UL; }
 
 int fd_recent_block_hashes_encode( fd_recent_block_hashes_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -9886,6 +11037,35 @@ int fd_slot_meta_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_
   return err;
 }
 int fd_slot_meta_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 48UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong next_slot_len;
+  err = fd_bincode_uint64_decode( &next_slot_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( next_slot_len ) {
+    *total_sz += 8UL + sizeof(ulong)*next_slot_len;
+    for( ulong i=0; i < next_slot_len; i++ ) {
+      err = fd_bincode_uint64_decode_footprint( ctx );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_bincode_uint8_decode_footprint( ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong entry_end_indexes_len;
+  err = fd_bincode_uint64_decode( &entry_end_indexes_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( entry_end_indexes_len ) {
+    *total_sz += 8UL + sizeof(uint)*entry_end_indexes_len;
+    for( ulong i=0; i < entry_end_indexes_len; i++ ) {
+      err = fd_bincode_uint32_decode_footprint( ctx );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  return 0;
+}
+static int fd_slot_meta_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -9924,6 +11104,14 @@ int fd_slot_meta_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong *
   }
   return 0;
 }
+int fd_slot_meta_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_slot_meta_t);
+  void const * start_data = ctx->data;
+  int err = fd_slot_meta_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_slot_meta_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_slot_meta_t * self = (fd_slot_meta_t *)mem;
   fd_slot_meta_new( self );
@@ -10039,6 +11227,13 @@ int fd_clock_timestamp_vote_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulo
   return err;
 }
 int fd_clock_timestamp_vote_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 48UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_clock_timestamp_vote_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -10049,6 +11244,14 @@ int fd_clock_timestamp_vote_decode_footprint_inner( fd_bincode_decode_ctx_t * ct
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_clock_timestamp_vote_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_clock_timestamp_vote_t);
+  void const * start_data = ctx->data;
+  int err = fd_clock_timestamp_vote_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_clock_timestamp_vote_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_clock_timestamp_vote_t * self = (fd_clock_timestamp_vote_t *)mem;
   fd_clock_timestamp_vote_new( self );
@@ -10081,13 +11284,7 @@ void fd_clock_timestamp_vote_walk( void * w, fd_clock_timestamp_vote_t const * s
   fun( w, &self->slot, "slot", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_clock_timestamp_vote", level-- );
 }
-ulong fd_clock_timestamp_vote_size( fd_clock_timestamp_vote_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->pubkey );
-  size += sizeof(long);
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_clock_timestamp_vote_size( fd_clock_timestamp_vote_t const * self ) { (void)self; return 48UL; }
 
 int fd_clock_timestamp_votes_encode( fd_clock_timestamp_votes_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -10200,12 +11397,27 @@ int fd_sysvar_fees_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * tota
   return err;
 }
 int fd_sysvar_fees_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 8UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_sysvar_fees_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_fee_calculator_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_sysvar_fees_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_sysvar_fees_t);
+  void const * start_data = ctx->data;
+  int err = fd_sysvar_fees_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_sysvar_fees_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_sysvar_fees_t * self = (fd_sysvar_fees_t *)mem;
   fd_sysvar_fees_new( self );
@@ -10234,11 +11446,7 @@ void fd_sysvar_fees_walk( void * w, fd_sysvar_fees_t const * self, fd_types_walk
   fd_fee_calculator_walk( w, &self->fee_calculator, fun, "fee_calculator", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_sysvar_fees", level-- );
 }
-ulong fd_sysvar_fees_size( fd_sysvar_fees_t const * self ) {
-  ulong size = 0;
-  size += fd_fee_calculator_size( &self->fee_calculator );
-  return size;
-}
+ulong fd_sysvar_fees_size( fd_sysvar_fees_t const * self ) { (void)self; return 8UL; }
 
 int fd_sysvar_epoch_rewards_encode( fd_sysvar_epoch_rewards_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -10267,6 +11475,15 @@ int fd_sysvar_epoch_rewards_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulo
   return err;
 }
 int fd_sysvar_epoch_rewards_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 80UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bool_decode_footprint( ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_sysvar_epoch_rewards_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -10285,6 +11502,14 @@ int fd_sysvar_epoch_rewards_decode_footprint_inner( fd_bincode_decode_ctx_t * ct
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_sysvar_epoch_rewards_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_sysvar_epoch_rewards_t);
+  void const * start_data = ctx->data;
+  int err = fd_sysvar_epoch_rewards_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_sysvar_epoch_rewards_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_sysvar_epoch_rewards_t * self = (fd_sysvar_epoch_rewards_t *)mem;
   fd_sysvar_epoch_rewards_new( self );
@@ -10325,17 +11550,7 @@ void fd_sysvar_epoch_rewards_walk( void * w, fd_sysvar_epoch_rewards_t const * s
   fun( w, &self->active, "active", FD_FLAMENCO_TYPE_BOOL, "bool", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_sysvar_epoch_rewards", level-- );
 }
-ulong fd_sysvar_epoch_rewards_size( fd_sysvar_epoch_rewards_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += fd_hash_size( &self->parent_blockhash );
-  size += sizeof(uint128);
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += sizeof(char);
-  return size;
-}
+ulong fd_sysvar_epoch_rewards_size( fd_sysvar_epoch_rewards_t const * self ) { (void)self; return 81UL; }
 
 int fd_config_keys_pair_encode( fd_config_keys_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -10354,6 +11569,15 @@ int fd_config_keys_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong *
   return err;
 }
 int fd_config_keys_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bool_decode_footprint( ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_config_keys_pair_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -10362,6 +11586,14 @@ int fd_config_keys_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, u
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_config_keys_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_config_keys_pair_t);
+  void const * start_data = ctx->data;
+  int err = fd_config_keys_pair_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_config_keys_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_config_keys_pair_t * self = (fd_config_keys_pair_t *)mem;
   fd_config_keys_pair_new( self );
@@ -10392,12 +11624,7 @@ void fd_config_keys_pair_walk( void * w, fd_config_keys_pair_t const * self, fd_
   fun( w, &self->signer, "signer", FD_FLAMENCO_TYPE_BOOL, "bool", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_config_keys_pair", level-- );
 }
-ulong fd_config_keys_pair_size( fd_config_keys_pair_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->key );
-  size += sizeof(char);
-  return size;
-}
+ulong fd_config_keys_pair_size( fd_config_keys_pair_t const * self ) { (void)self; return 33UL; }
 
 int fd_stake_config_encode( fd_stake_config_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -10424,6 +11651,23 @@ int fd_stake_config_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * tot
   return err;
 }
 int fd_stake_config_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  ushort config_keys_len;
+  err = fd_bincode_compact_u16_decode( &config_keys_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( config_keys_len ) {
+    *total_sz += FD_CONFIG_KEYS_PAIR_ALIGN + FD_CONFIG_KEYS_PAIR_FOOTPRINT*config_keys_len;
+    for( ulong i=0; i < config_keys_len; i++ ) {
+      err = fd_config_keys_pair_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_bincode_bytes_decode_footprint( 9UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_stake_config_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   ushort config_keys_len;
@@ -10442,6 +11686,14 @@ int fd_stake_config_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_stake_config_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_stake_config_t);
+  void const * start_data = ctx->data;
+  int err = fd_stake_config_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_stake_config_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_stake_config_t * self = (fd_stake_config_t *)mem;
   fd_stake_config_new( self );
@@ -10528,6 +11780,25 @@ int fd_feature_entry_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * to
   return err;
 }
 int fd_feature_entry_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong description_len;
+  err = fd_bincode_uint64_decode( &description_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  *total_sz += description_len;
+  if( description_len ) {
+    err = fd_bincode_bytes_decode_footprint( description_len, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    err = !fd_utf8_verify( (char const *) ctx->data - description_len, description_len );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  }
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  return 0;
+}
+static int fd_feature_entry_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -10546,6 +11817,14 @@ int fd_feature_entry_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulon
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_feature_entry_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_feature_entry_t);
+  void const * start_data = ctx->data;
+  int err = fd_feature_entry_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_feature_entry_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_feature_entry_t * self = (fd_feature_entry_t *)mem;
   fd_feature_entry_new( self );
@@ -10659,6 +11938,27 @@ int fd_firedancer_bank_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong *
   return err;
 }
 int fd_firedancer_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_stakes_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_recent_block_hashes_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_clock_timestamp_votes_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 241UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 33UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_vote_accounts_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 8UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_firedancer_bank_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_stakes_decode_footprint_inner( ctx, total_sz );
@@ -10711,6 +12011,14 @@ int fd_firedancer_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ul
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_firedancer_bank_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_firedancer_bank_t);
+  void const * start_data = ctx->data;
+  int err = fd_firedancer_bank_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_firedancer_bank_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_firedancer_bank_t * self = (fd_firedancer_bank_t *)mem;
   fd_firedancer_bank_new( self );
@@ -11036,6 +12344,23 @@ int fd_epoch_bank_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total
   return err;
 }
 int fd_epoch_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_stakes_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 104UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 89UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_vote_accounts_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_epoch_bank_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_stakes_decode_footprint_inner( ctx, total_sz );
@@ -11078,6 +12403,14 @@ int fd_epoch_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong *
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_epoch_bank_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_epoch_bank_t);
+  void const * start_data = ctx->data;
+  int err = fd_epoch_bank_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_epoch_bank_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_epoch_bank_t * self = (fd_epoch_bank_t *)mem;
   fd_epoch_bank_new( self );
@@ -11249,6 +12582,40 @@ int fd_slot_bank_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_
   return err;
 }
 int fd_slot_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_clock_timestamp_votes_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 193UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_vote_accounts_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 8UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_account_keys_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_account_keys_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 2064UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_block_hash_queue_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 48UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  {
+    uchar o;
+    err = fd_bincode_bool_decode( &o, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    if( o ) {
+      err = fd_bincode_uint64_decode_footprint( ctx );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_hard_forks_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_slot_bank_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_clock_timestamp_votes_decode_footprint_inner( ctx, total_sz );
@@ -11312,6 +12679,14 @@ int fd_slot_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong *
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_slot_bank_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_slot_bank_t);
+  void const * start_data = ctx->data;
+  int err = fd_slot_bank_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_slot_bank_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_slot_bank_t * self = (fd_slot_bank_t *)mem;
   fd_slot_bank_new( self );
@@ -11483,6 +12858,13 @@ int fd_prev_epoch_inflation_rewards_decode_footprint( fd_bincode_decode_ctx_t *
   return err;
 }
 int fd_prev_epoch_inflation_rewards_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_prev_epoch_inflation_rewards_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -11495,6 +12877,14 @@ int fd_prev_epoch_inflation_rewards_decode_footprint_inner( fd_bincode_decode_ct
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_prev_epoch_inflation_rewards_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_prev_epoch_inflation_rewards_t);
+  void const * start_data = ctx->data;
+  int err = fd_prev_epoch_inflation_rewards_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_prev_epoch_inflation_rewards_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_prev_epoch_inflation_rewards_t * self = (fd_prev_epoch_inflation_rewards_t *)mem;
   fd_prev_epoch_inflation_rewards_new( self );
@@ -11527,14 +12917,7 @@ void fd_prev_epoch_inflation_rewards_walk( void * w, fd_prev_epoch_inflation_rew
   fun( w, &self->foundation_rate, "foundation_rate", FD_FLAMENCO_TYPE_DOUBLE, "double", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_prev_epoch_inflation_rewards", level-- );
 }
-ulong fd_prev_epoch_inflation_rewards_size( fd_prev_epoch_inflation_rewards_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += sizeof(double);
-  size += sizeof(double);
-  size += sizeof(double);
-  return size;
-}
+ulong fd_prev_epoch_inflation_rewards_size( fd_prev_epoch_inflation_rewards_t const * self ) { (void)self; return 32UL; }
 
 int fd_vote_encode( fd_vote_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -11573,6 +12956,32 @@ int fd_vote_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz )
   return err;
 }
 int fd_vote_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  ulong slots_len;
+  err = fd_bincode_uint64_decode( &slots_len, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong slots_max = slots_len == 0 ? 1 : slots_len;
+  *total_sz += deq_ulong_align() + deq_ulong_footprint( slots_max ) ;
+  ulong slots_sz;
+  if( FD_UNLIKELY( __builtin_umull_overflow( slots_len, 8, &slots_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
+  err = fd_bincode_bytes_decode_footprint( slots_sz, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  {
+    uchar o;
+    err = fd_bincode_bool_decode( &o, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    if( o ) {
+    *total_sz += 8UL + sizeof(long);
+      err = fd_bincode_int64_decode_footprint( ctx );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  return 0;
+}
+static int fd_vote_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   ulong slots_len;
@@ -11598,6 +13007,14 @@ int fd_vote_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total
   }
   return 0;
 }
+int fd_vote_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_vote_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_t * self = (fd_vote_t *)mem;
   fd_vote_new( self );
@@ -11708,6 +13125,13 @@ int fd_vote_init_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_
   return err;
 }
 int fd_vote_init_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 97UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_vote_init_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -11720,6 +13144,14 @@ int fd_vote_init_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong *
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_vote_init_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_init_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_init_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_vote_init_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_init_t * self = (fd_vote_init_t *)mem;
   fd_vote_init_new( self );
@@ -11758,14 +13190,7 @@ void fd_vote_init_walk( void * w, fd_vote_init_t const * self, fd_types_walk_fn_
   fun( w, &self->commission, "commission", FD_FLAMENCO_TYPE_UCHAR, "uchar", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_vote_init", level-- );
 }
-ulong fd_vote_init_size( fd_vote_init_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->node_pubkey );
-  size += fd_pubkey_size( &self->authorized_voter );
-  size += fd_pubkey_size( &self->authorized_withdrawer );
-  size += sizeof(char);
-  return size;
-}
+ulong fd_vote_init_size( fd_vote_init_t const * self ) { (void)self; return 97UL; }
 
 FD_FN_PURE uchar fd_vote_authorize_is_voter(fd_vote_authorize_t const * self) {
   return self->discriminant == 0;
@@ -11903,6 +13328,15 @@ int fd_vote_authorize_pubkey_decode_footprint( fd_bincode_decode_ctx_t * ctx, ul
   return err;
 }
 int fd_vote_authorize_pubkey_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_vote_authorize_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_vote_authorize_pubkey_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -11911,6 +13345,14 @@ int fd_vote_authorize_pubkey_decode_footprint_inner( fd_bincode_decode_ctx_t * c
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_vote_authorize_pubkey_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_authorize_pubkey_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_authorize_pubkey_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_vote_authorize_pubkey_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_authorize_pubkey_t * self = (fd_vote_authorize_pubkey_t *)mem;
   fd_vote_authorize_pubkey_new( self );
@@ -11939,16 +13381,11 @@ ulong fd_vote_authorize_pubkey_align( void ){ return FD_VOTE_AUTHORIZE_PUBKEY_AL
 
 void fd_vote_authorize_pubkey_walk( void * w, fd_vote_authorize_pubkey_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_vote_authorize_pubkey", level++ );
-  fd_pubkey_walk( w, &self->pubkey, fun, "pubkey", level );
-  fd_vote_authorize_walk( w, &self->vote_authorize, fun, "vote_authorize", level );
-  fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_vote_authorize_pubkey", level-- );
-}
-ulong fd_vote_authorize_pubkey_size( fd_vote_authorize_pubkey_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->pubkey );
-  size += fd_vote_authorize_size( &self->vote_authorize );
-  return size;
+  fd_pubkey_walk( w, &self->pubkey, fun, "pubkey", level );
+  fd_vote_authorize_walk( w, &self->vote_authorize, fun, "vote_authorize", level );
+  fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_vote_authorize_pubkey", level-- );
 }
+ulong fd_vote_authorize_pubkey_size( fd_vote_authorize_pubkey_t const * self ) { (void)self; return 36UL; }
 
 int fd_vote_switch_encode( fd_vote_switch_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -11967,6 +13404,15 @@ int fd_vote_switch_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * tota
   return err;
 }
 int fd_vote_switch_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_vote_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_vote_switch_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_vote_decode_footprint_inner( ctx, total_sz );
@@ -11975,6 +13421,14 @@ int fd_vote_switch_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_vote_switch_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_switch_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_switch_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_vote_switch_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_switch_t * self = (fd_vote_switch_t *)mem;
   fd_vote_switch_new( self );
@@ -12031,6 +13485,15 @@ int fd_update_vote_state_switch_decode_footprint( fd_bincode_decode_ctx_t * ctx,
   return err;
 }
 int fd_update_vote_state_switch_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_vote_state_update_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_update_vote_state_switch_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_vote_state_update_decode_footprint_inner( ctx, total_sz );
@@ -12039,6 +13502,14 @@ int fd_update_vote_state_switch_decode_footprint_inner( fd_bincode_decode_ctx_t
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_update_vote_state_switch_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_update_vote_state_switch_t);
+  void const * start_data = ctx->data;
+  int err = fd_update_vote_state_switch_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_update_vote_state_switch_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_update_vote_state_switch_t * self = (fd_update_vote_state_switch_t *)mem;
   fd_update_vote_state_switch_new( self );
@@ -12103,6 +13574,27 @@ int fd_vote_authorize_with_seed_args_decode_footprint( fd_bincode_decode_ctx_t *
   return err;
 }
 int fd_vote_authorize_with_seed_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_vote_authorize_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong current_authority_derived_key_seed_len;
+  err = fd_bincode_uint64_decode( &current_authority_derived_key_seed_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  *total_sz += current_authority_derived_key_seed_len;
+  if( current_authority_derived_key_seed_len ) {
+    err = fd_bincode_bytes_decode_footprint( current_authority_derived_key_seed_len, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    err = !fd_utf8_verify( (char const *) ctx->data - current_authority_derived_key_seed_len, current_authority_derived_key_seed_len );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  }
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_vote_authorize_with_seed_args_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_vote_authorize_decode_footprint_inner( ctx, total_sz );
@@ -12123,6 +13615,14 @@ int fd_vote_authorize_with_seed_args_decode_footprint_inner( fd_bincode_decode_c
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_vote_authorize_with_seed_args_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_authorize_with_seed_args_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_authorize_with_seed_args_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_vote_authorize_with_seed_args_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_authorize_with_seed_args_t * self = (fd_vote_authorize_with_seed_args_t *)mem;
   fd_vote_authorize_with_seed_args_new( self );
@@ -12205,6 +13705,25 @@ int fd_vote_authorize_checked_with_seed_args_decode_footprint( fd_bincode_decode
   return err;
 }
 int fd_vote_authorize_checked_with_seed_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_vote_authorize_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong current_authority_derived_key_seed_len;
+  err = fd_bincode_uint64_decode( &current_authority_derived_key_seed_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  *total_sz += current_authority_derived_key_seed_len;
+  if( current_authority_derived_key_seed_len ) {
+    err = fd_bincode_bytes_decode_footprint( current_authority_derived_key_seed_len, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    err = !fd_utf8_verify( (char const *) ctx->data - current_authority_derived_key_seed_len, current_authority_derived_key_seed_len );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  }
+  return 0;
+}
+static int fd_vote_authorize_checked_with_seed_args_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_vote_authorize_decode_footprint_inner( ctx, total_sz );
@@ -12223,6 +13742,14 @@ int fd_vote_authorize_checked_with_seed_args_decode_footprint_inner( fd_bincode_
   }
   return 0;
 }
+int fd_vote_authorize_checked_with_seed_args_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_authorize_checked_with_seed_args_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_authorize_checked_with_seed_args_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_vote_authorize_checked_with_seed_args_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_authorize_checked_with_seed_args_t * self = (fd_vote_authorize_checked_with_seed_args_t *)mem;
   fd_vote_authorize_checked_with_seed_args_new( self );
@@ -12908,6 +14435,13 @@ int fd_system_program_instruction_create_account_decode_footprint( fd_bincode_de
   return err;
 }
 int fd_system_program_instruction_create_account_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 48UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_system_program_instruction_create_account_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -12918,6 +14452,14 @@ int fd_system_program_instruction_create_account_decode_footprint_inner( fd_binc
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_system_program_instruction_create_account_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_system_program_instruction_create_account_t);
+  void const * start_data = ctx->data;
+  int err = fd_system_program_instruction_create_account_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_system_program_instruction_create_account_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_system_program_instruction_create_account_t * self = (fd_system_program_instruction_create_account_t *)mem;
   fd_system_program_instruction_create_account_new( self );
@@ -12950,13 +14492,7 @@ void fd_system_program_instruction_create_account_walk( void * w, fd_system_prog
   fd_pubkey_walk( w, &self->owner, fun, "owner", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_system_program_instruction_create_account", level-- );
 }
-ulong fd_system_program_instruction_create_account_size( fd_system_program_instruction_create_account_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += fd_pubkey_size( &self->owner );
-  return size;
-}
+ulong fd_system_program_instruction_create_account_size( fd_system_program_instruction_create_account_t const * self ) { (void)self; return 48UL; }
 
 int fd_system_program_instruction_create_account_with_seed_encode( fd_system_program_instruction_create_account_with_seed_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -12985,6 +14521,25 @@ int fd_system_program_instruction_create_account_with_seed_decode_footprint( fd_
   return err;
 }
 int fd_system_program_instruction_create_account_with_seed_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong seed_len;
+  err = fd_bincode_uint64_decode( &seed_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  *total_sz += seed_len;
+  if( seed_len ) {
+    err = fd_bincode_bytes_decode_footprint( seed_len, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    err = !fd_utf8_verify( (char const *) ctx->data - seed_len, seed_len );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  }
+  err = fd_bincode_bytes_decode_footprint( 48UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_system_program_instruction_create_account_with_seed_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -13007,6 +14562,14 @@ int fd_system_program_instruction_create_account_with_seed_decode_footprint_inne
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_system_program_instruction_create_account_with_seed_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_system_program_instruction_create_account_with_seed_t);
+  void const * start_data = ctx->data;
+  int err = fd_system_program_instruction_create_account_with_seed_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_system_program_instruction_create_account_with_seed_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_system_program_instruction_create_account_with_seed_t * self = (fd_system_program_instruction_create_account_with_seed_t *)mem;
   fd_system_program_instruction_create_account_with_seed_new( self );
@@ -13092,6 +14655,25 @@ int fd_system_program_instruction_allocate_with_seed_decode_footprint( fd_bincod
   return err;
 }
 int fd_system_program_instruction_allocate_with_seed_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong seed_len;
+  err = fd_bincode_uint64_decode( &seed_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  *total_sz += seed_len;
+  if( seed_len ) {
+    err = fd_bincode_bytes_decode_footprint( seed_len, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    err = !fd_utf8_verify( (char const *) ctx->data - seed_len, seed_len );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  }
+  err = fd_bincode_bytes_decode_footprint( 40UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_system_program_instruction_allocate_with_seed_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -13112,6 +14694,14 @@ int fd_system_program_instruction_allocate_with_seed_decode_footprint_inner( fd_
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_system_program_instruction_allocate_with_seed_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_system_program_instruction_allocate_with_seed_t);
+  void const * start_data = ctx->data;
+  int err = fd_system_program_instruction_allocate_with_seed_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_system_program_instruction_allocate_with_seed_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_system_program_instruction_allocate_with_seed_t * self = (fd_system_program_instruction_allocate_with_seed_t *)mem;
   fd_system_program_instruction_allocate_with_seed_new( self );
@@ -13192,6 +14782,25 @@ int fd_system_program_instruction_assign_with_seed_decode_footprint( fd_bincode_
   return err;
 }
 int fd_system_program_instruction_assign_with_seed_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong seed_len;
+  err = fd_bincode_uint64_decode( &seed_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  *total_sz += seed_len;
+  if( seed_len ) {
+    err = fd_bincode_bytes_decode_footprint( seed_len, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    err = !fd_utf8_verify( (char const *) ctx->data - seed_len, seed_len );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  }
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_system_program_instruction_assign_with_seed_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -13210,6 +14819,14 @@ int fd_system_program_instruction_assign_with_seed_decode_footprint_inner( fd_bi
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_system_program_instruction_assign_with_seed_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_system_program_instruction_assign_with_seed_t);
+  void const * start_data = ctx->data;
+  int err = fd_system_program_instruction_assign_with_seed_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_system_program_instruction_assign_with_seed_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_system_program_instruction_assign_with_seed_t * self = (fd_system_program_instruction_assign_with_seed_t *)mem;
   fd_system_program_instruction_assign_with_seed_new( self );
@@ -13287,6 +14904,25 @@ int fd_system_program_instruction_transfer_with_seed_decode_footprint( fd_bincod
   return err;
 }
 int fd_system_program_instruction_transfer_with_seed_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  ulong from_seed_len;
+  err = fd_bincode_uint64_decode( &from_seed_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  *total_sz += from_seed_len;
+  if( from_seed_len ) {
+    err = fd_bincode_bytes_decode_footprint( from_seed_len, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    err = !fd_utf8_verify( (char const *) ctx->data - from_seed_len, from_seed_len );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  }
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_system_program_instruction_transfer_with_seed_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -13305,6 +14941,14 @@ int fd_system_program_instruction_transfer_with_seed_decode_footprint_inner( fd_
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_system_program_instruction_transfer_with_seed_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_system_program_instruction_transfer_with_seed_t);
+  void const * start_data = ctx->data;
+  int err = fd_system_program_instruction_transfer_with_seed_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_system_program_instruction_transfer_with_seed_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_system_program_instruction_transfer_with_seed_t * self = (fd_system_program_instruction_transfer_with_seed_t *)mem;
   fd_system_program_instruction_transfer_with_seed_new( self );
@@ -14095,6 +15739,13 @@ int fd_stake_authorized_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong *
   return err;
 }
 int fd_stake_authorized_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 64UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_stake_authorized_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -14103,6 +15754,14 @@ int fd_stake_authorized_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, u
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_stake_authorized_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_stake_authorized_t);
+  void const * start_data = ctx->data;
+  int err = fd_stake_authorized_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_stake_authorized_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_stake_authorized_t * self = (fd_stake_authorized_t *)mem;
   fd_stake_authorized_new( self );
@@ -14116,6 +15775,16 @@ void fd_stake_authorized_decode_inner( void * struct_mem, void * * alloc_mem, fd
   fd_pubkey_decode_inner( &self->staker, alloc_mem, ctx );
   fd_pubkey_decode_inner( &self->withdrawer, alloc_mem, ctx );
 }
+int fd_stake_authorized_view( fd_stake_authorized_view_t * view, uchar const * data, ulong data_sz ) {
+  fd_bincode_decode_ctx_t ctx = { .data = data, .dataend = data + data_sz };
+  ulong total_sz = 0UL;
+  int err = fd_stake_authorized_decode_footprint_inner( &ctx, &total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  if( FD_UNLIKELY( ctx.data>ctx.dataend ) ) return FD_BINCODE_ERR_OVERFLOW;
+  view->data    = data;
+  view->data_sz = (ulong)ctx.data - (ulong)data;
+  return FD_BINCODE_SUCCESS;
+}
 void fd_stake_authorized_new(fd_stake_authorized_t * self) {
   fd_memset( self, 0, sizeof(fd_stake_authorized_t) );
   fd_pubkey_new( &self->staker );
@@ -14135,12 +15804,7 @@ void fd_stake_authorized_walk( void * w, fd_stake_authorized_t const * self, fd_
   fd_pubkey_walk( w, &self->withdrawer, fun, "withdrawer", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_stake_authorized", level-- );
 }
-ulong fd_stake_authorized_size( fd_stake_authorized_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->staker );
-  size += fd_pubkey_size( &self->withdrawer );
-  return size;
-}
+ulong fd_stake_authorized_size( fd_stake_authorized_t const * self ) { (void)self; return 64UL; }
 
 int fd_stake_lockup_encode( fd_stake_lockup_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -14161,6 +15825,13 @@ int fd_stake_lockup_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * tot
   return err;
 }
 int fd_stake_lockup_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 48UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_stake_lockup_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -14171,6 +15842,14 @@ int fd_stake_lockup_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_stake_lockup_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_stake_lockup_t);
+  void const * start_data = ctx->data;
+  int err = fd_stake_lockup_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_stake_lockup_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_stake_lockup_t * self = (fd_stake_lockup_t *)mem;
   fd_stake_lockup_new( self );
@@ -14185,6 +15864,16 @@ void fd_stake_lockup_decode_inner( void * struct_mem, void * * alloc_mem, fd_bin
   fd_bincode_uint64_decode_unsafe( &self->epoch, ctx );
   fd_pubkey_decode_inner( &self->custodian, alloc_mem, ctx );
 }
+int fd_stake_lockup_view( fd_stake_lockup_view_t * view, uchar const * data, ulong data_sz ) {
+  fd_bincode_decode_ctx_t ctx = { .data = data, .dataend = data + data_sz };
+  ulong total_sz = 0UL;
+  int err = fd_stake_lockup_decode_footprint_inner( &ctx, &total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  if( FD_UNLIKELY( ctx.data>ctx.dataend ) ) return FD_BINCODE_ERR_OVERFLOW;
+  view->data    = data;
+  view->data_sz = (ulong)ctx.data - (ulong)data;
+  return FD_BINCODE_SUCCESS;
+}
 void fd_stake_lockup_new(fd_stake_lockup_t * self) {
   fd_memset( self, 0, sizeof(fd_stake_lockup_t) );
   fd_pubkey_new( &self->custodian );
@@ -14203,13 +15892,7 @@ void fd_stake_lockup_walk( void * w, fd_stake_lockup_t const * self, fd_types_wa
   fd_pubkey_walk( w, &self->custodian, fun, "custodian", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_stake_lockup", level-- );
 }
-ulong fd_stake_lockup_size( fd_stake_lockup_t const * self ) {
-  ulong size = 0;
-  size += sizeof(long);
-  size += sizeof(ulong);
-  size += fd_pubkey_size( &self->custodian );
-  return size;
-}
+ulong fd_stake_lockup_size( fd_stake_lockup_t const * self ) { (void)self; return 48UL; }
 
 int fd_stake_instruction_initialize_encode( fd_stake_instruction_initialize_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -14228,6 +15911,13 @@ int fd_stake_instruction_initialize_decode_footprint( fd_bincode_decode_ctx_t *
   return err;
 }
 int fd_stake_instruction_initialize_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 112UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_stake_instruction_initialize_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_stake_authorized_decode_footprint_inner( ctx, total_sz );
@@ -14236,6 +15926,14 @@ int fd_stake_instruction_initialize_decode_footprint_inner( fd_bincode_decode_ct
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_stake_instruction_initialize_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_stake_instruction_initialize_t);
+  void const * start_data = ctx->data;
+  int err = fd_stake_instruction_initialize_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_stake_instruction_initialize_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_stake_instruction_initialize_t * self = (fd_stake_instruction_initialize_t *)mem;
   fd_stake_instruction_initialize_new( self );
@@ -14268,12 +15966,7 @@ void fd_stake_instruction_initialize_walk( void * w, fd_stake_instruction_initia
   fd_stake_lockup_walk( w, &self->lockup, fun, "lockup", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_stake_instruction_initialize", level-- );
 }
-ulong fd_stake_instruction_initialize_size( fd_stake_instruction_initialize_t const * self ) {
-  ulong size = 0;
-  size += fd_stake_authorized_size( &self->authorized );
-  size += fd_stake_lockup_size( &self->lockup );
-  return size;
-}
+ulong fd_stake_instruction_initialize_size( fd_stake_instruction_initialize_t const * self ) { (void)self; return 112UL; }
 
 int fd_stake_lockup_custodian_args_encode( fd_stake_lockup_custodian_args_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -14290,17 +15983,34 @@ int fd_stake_lockup_custodian_args_encode( fd_stake_lockup_custodian_args_t cons
     err = fd_bincode_bool_encode( 0, ctx );
     if( FD_UNLIKELY( err ) ) return err;
   }
-  return FD_BINCODE_SUCCESS;
-}
-int fd_stake_lockup_custodian_args_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
-  *total_sz += sizeof(fd_stake_lockup_custodian_args_t);
-  void const * start_data = ctx->data;
-  int err = fd_stake_lockup_custodian_args_decode_footprint_inner( ctx, total_sz );
-  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
-  ctx->data = start_data;
-  return err;
+  return FD_BINCODE_SUCCESS;
+}
+int fd_stake_lockup_custodian_args_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_stake_lockup_custodian_args_t);
+  void const * start_data = ctx->data;
+  int err = fd_stake_lockup_custodian_args_decode_footprint_inner( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
+int fd_stake_lockup_custodian_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 88UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  {
+    uchar o;
+    err = fd_bincode_bool_decode( &o, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    if( o ) {
+    *total_sz += FD_PUBKEY_ALIGN + FD_PUBKEY_FOOTPRINT;
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  return 0;
 }
-int fd_stake_lockup_custodian_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+static int fd_stake_lockup_custodian_args_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_stake_lockup_decode_footprint_inner( ctx, total_sz );
@@ -14319,6 +16029,14 @@ int fd_stake_lockup_custodian_args_decode_footprint_inner( fd_bincode_decode_ctx
   }
   return 0;
 }
+int fd_stake_lockup_custodian_args_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_stake_lockup_custodian_args_t);
+  void const * start_data = ctx->data;
+  int err = fd_stake_lockup_custodian_args_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_stake_lockup_custodian_args_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_stake_lockup_custodian_args_t * self = (fd_stake_lockup_custodian_args_t *)mem;
   fd_stake_lockup_custodian_args_new( self );
@@ -14520,6 +16238,15 @@ int fd_stake_instruction_authorize_decode_footprint( fd_bincode_decode_ctx_t * c
   return err;
 }
 int fd_stake_instruction_authorize_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_stake_authorize_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_stake_instruction_authorize_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -14528,6 +16255,14 @@ int fd_stake_instruction_authorize_decode_footprint_inner( fd_bincode_decode_ctx
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_stake_instruction_authorize_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_stake_instruction_authorize_t);
+  void const * start_data = ctx->data;
+  int err = fd_stake_instruction_authorize_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_stake_instruction_authorize_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_stake_instruction_authorize_t * self = (fd_stake_instruction_authorize_t *)mem;
   fd_stake_instruction_authorize_new( self );
@@ -14560,12 +16295,7 @@ void fd_stake_instruction_authorize_walk( void * w, fd_stake_instruction_authori
   fd_stake_authorize_walk( w, &self->stake_authorize, fun, "stake_authorize", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_stake_instruction_authorize", level-- );
 }
-ulong fd_stake_instruction_authorize_size( fd_stake_instruction_authorize_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->pubkey );
-  size += fd_stake_authorize_size( &self->stake_authorize );
-  return size;
-}
+ulong fd_stake_instruction_authorize_size( fd_stake_instruction_authorize_t const * self ) { (void)self; return 36UL; }
 
 int fd_authorize_with_seed_args_encode( fd_authorize_with_seed_args_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -14592,6 +16322,27 @@ int fd_authorize_with_seed_args_decode_footprint( fd_bincode_decode_ctx_t * ctx,
   return err;
 }
 int fd_authorize_with_seed_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_stake_authorize_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong authority_seed_len;
+  err = fd_bincode_uint64_decode( &authority_seed_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  *total_sz += authority_seed_len;
+  if( authority_seed_len ) {
+    err = fd_bincode_bytes_decode_footprint( authority_seed_len, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    err = !fd_utf8_verify( (char const *) ctx->data - authority_seed_len, authority_seed_len );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  }
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_authorize_with_seed_args_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -14612,6 +16363,14 @@ int fd_authorize_with_seed_args_decode_footprint_inner( fd_bincode_decode_ctx_t
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_authorize_with_seed_args_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_authorize_with_seed_args_t);
+  void const * start_data = ctx->data;
+  int err = fd_authorize_with_seed_args_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_authorize_with_seed_args_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_authorize_with_seed_args_t * self = (fd_authorize_with_seed_args_t *)mem;
   fd_authorize_with_seed_args_new( self );
@@ -14694,6 +16453,25 @@ int fd_authorize_checked_with_seed_args_decode_footprint( fd_bincode_decode_ctx_
   return err;
 }
 int fd_authorize_checked_with_seed_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_stake_authorize_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong authority_seed_len;
+  err = fd_bincode_uint64_decode( &authority_seed_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  *total_sz += authority_seed_len;
+  if( authority_seed_len ) {
+    err = fd_bincode_bytes_decode_footprint( authority_seed_len, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    err = !fd_utf8_verify( (char const *) ctx->data - authority_seed_len, authority_seed_len );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  }
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_authorize_checked_with_seed_args_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_stake_authorize_decode_footprint_inner( ctx, total_sz );
@@ -14712,6 +16490,14 @@ int fd_authorize_checked_with_seed_args_decode_footprint_inner( fd_bincode_decod
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_authorize_checked_with_seed_args_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_authorize_checked_with_seed_args_t);
+  void const * start_data = ctx->data;
+  int err = fd_authorize_checked_with_seed_args_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_authorize_checked_with_seed_args_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_authorize_checked_with_seed_args_t * self = (fd_authorize_checked_with_seed_args_t *)mem;
   fd_authorize_checked_with_seed_args_new( self );
@@ -15662,6 +17448,13 @@ int fd_stake_meta_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total
   return err;
 }
 int fd_stake_meta_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 120UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_stake_meta_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -15672,6 +17465,14 @@ int fd_stake_meta_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong *
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_stake_meta_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_stake_meta_t);
+  void const * start_data = ctx->data;
+  int err = fd_stake_meta_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_stake_meta_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_stake_meta_t * self = (fd_stake_meta_t *)mem;
   fd_stake_meta_new( self );
@@ -15686,6 +17487,16 @@ void fd_stake_meta_decode_inner( void * struct_mem, void * * alloc_mem, fd_binco
   fd_stake_authorized_decode_inner( &self->authorized, alloc_mem, ctx );
   fd_stake_lockup_decode_inner( &self->lockup, alloc_mem, ctx );
 }
+int fd_stake_meta_view( fd_stake_meta_view_t * view, uchar const * data, ulong data_sz ) {
+  fd_bincode_decode_ctx_t ctx = { .data = data, .dataend = data + data_sz };
+  ulong total_sz = 0UL;
+  int err = fd_stake_meta_decode_footprint_inner( &ctx, &total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  if( FD_UNLIKELY( ctx.data>ctx.dataend ) ) return FD_BINCODE_ERR_OVERFLOW;
+  view->data    = data;
+  view->data_sz = (ulong)ctx.data - (ulong)data;
+  return FD_BINCODE_SUCCESS;
+}
 void fd_stake_meta_new(fd_stake_meta_t * self) {
   fd_memset( self, 0, sizeof(fd_stake_meta_t) );
   fd_stake_authorized_new( &self->authorized );
@@ -15706,13 +17517,7 @@ void fd_stake_meta_walk( void * w, fd_stake_meta_t const * self, fd_types_walk_f
   fd_stake_lockup_walk( w, &self->lockup, fun, "lockup", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_stake_meta", level-- );
 }
-ulong fd_stake_meta_size( fd_stake_meta_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += fd_stake_authorized_size( &self->authorized );
-  size += fd_stake_lockup_size( &self->lockup );
-  return size;
-}
+ulong fd_stake_meta_size( fd_stake_meta_t const * self ) { (void)self; return 120UL; }
 
 int fd_stake_flags_encode( fd_stake_flags_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -15747,6 +17552,16 @@ void fd_stake_flags_decode_inner( void * struct_mem, void * * alloc_mem, fd_binc
   fd_stake_flags_t * self = (fd_stake_flags_t *)struct_mem;
   fd_bincode_uint8_decode_unsafe( &self->bits, ctx );
 }
+int fd_stake_flags_view( fd_stake_flags_view_t * view, uchar const * data, ulong data_sz ) {
+  fd_bincode_decode_ctx_t ctx = { .data = data, .dataend = data + data_sz };
+  ulong total_sz = 0UL;
+  int err = fd_stake_flags_decode_footprint_inner( &ctx, &total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  if( FD_UNLIKELY( ctx.data>ctx.dataend ) ) return FD_BINCODE_ERR_OVERFLOW;
+  view->data    = data;
+  view->data_sz = (ulong)ctx.data - (ulong)data;
+  return FD_BINCODE_SUCCESS;
+}
 void fd_stake_flags_new(fd_stake_flags_t * self) {
   fd_memset( self, 0, sizeof(fd_stake_flags_t) );
 }
@@ -15761,11 +17576,7 @@ void fd_stake_flags_walk( void * w, fd_stake_flags_t const * self, fd_types_walk
   fun( w, &self->bits, "bits", FD_FLAMENCO_TYPE_UCHAR, "uchar", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_stake_flags", level-- );
 }
-ulong fd_stake_flags_size( fd_stake_flags_t const * self ) {
-  ulong size = 0;
-  size += sizeof(char);
-  return size;
-}
+ulong fd_stake_flags_size( fd_stake_flags_t const * self ) { (void)self; return 1UL; }
 
 int fd_stake_state_v2_initialized_encode( fd_stake_state_v2_initialized_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -15782,12 +17593,27 @@ int fd_stake_state_v2_initialized_decode_footprint( fd_bincode_decode_ctx_t * ct
   return err;
 }
 int fd_stake_state_v2_initialized_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 120UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_stake_state_v2_initialized_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_stake_meta_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_stake_state_v2_initialized_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_stake_state_v2_initialized_t);
+  void const * start_data = ctx->data;
+  int err = fd_stake_state_v2_initialized_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_stake_state_v2_initialized_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_stake_state_v2_initialized_t * self = (fd_stake_state_v2_initialized_t *)mem;
   fd_stake_state_v2_initialized_new( self );
@@ -15800,6 +17626,16 @@ void fd_stake_state_v2_initialized_decode_inner( void * struct_mem, void * * all
   fd_stake_state_v2_initialized_t * self = (fd_stake_state_v2_initialized_t *)struct_mem;
   fd_stake_meta_decode_inner( &self->meta, alloc_mem, ctx );
 }
+int fd_stake_state_v2_initialized_view( fd_stake_state_v2_initialized_view_t * view, uchar const * data, ulong data_sz ) {
+  fd_bincode_decode_ctx_t ctx = { .data = data, .dataend = data + data_sz };
+  ulong total_sz = 0UL;
+  int err = fd_stake_state_v2_initialized_decode_footprint_inner( &ctx, &total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  if( FD_UNLIKELY( ctx.data>ctx.dataend ) ) return FD_BINCODE_ERR_OVERFLOW;
+  view->data    = data;
+  view->data_sz = (ulong)ctx.data - (ulong)data;
+  return FD_BINCODE_SUCCESS;
+}
 void fd_stake_state_v2_initialized_new(fd_stake_state_v2_initialized_t * self) {
   fd_memset( self, 0, sizeof(fd_stake_state_v2_initialized_t) );
   fd_stake_meta_new( &self->meta );
@@ -15816,11 +17652,7 @@ void fd_stake_state_v2_initialized_walk( void * w, fd_stake_state_v2_initialized
   fd_stake_meta_walk( w, &self->meta, fun, "meta", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_stake_state_v2_initialized", level-- );
 }
-ulong fd_stake_state_v2_initialized_size( fd_stake_state_v2_initialized_t const * self ) {
-  ulong size = 0;
-  size += fd_stake_meta_size( &self->meta );
-  return size;
-}
+ulong fd_stake_state_v2_initialized_size( fd_stake_state_v2_initialized_t const * self ) { (void)self; return 120UL; }
 
 int fd_stake_state_v2_stake_encode( fd_stake_state_v2_stake_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -15841,6 +17673,13 @@ int fd_stake_state_v2_stake_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulo
   return err;
 }
 int fd_stake_state_v2_stake_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 193UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_stake_state_v2_stake_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_stake_meta_decode_footprint_inner( ctx, total_sz );
@@ -15851,6 +17690,14 @@ int fd_stake_state_v2_stake_decode_footprint_inner( fd_bincode_decode_ctx_t * ct
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_stake_state_v2_stake_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_stake_state_v2_stake_t);
+  void const * start_data = ctx->data;
+  int err = fd_stake_state_v2_stake_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_stake_state_v2_stake_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_stake_state_v2_stake_t * self = (fd_stake_state_v2_stake_t *)mem;
   fd_stake_state_v2_stake_new( self );
@@ -15865,6 +17712,16 @@ void fd_stake_state_v2_stake_decode_inner( void * struct_mem, void * * alloc_mem
   fd_stake_decode_inner( &self->stake, alloc_mem, ctx );
   fd_stake_flags_decode_inner( &self->stake_flags, alloc_mem, ctx );
 }
+int fd_stake_state_v2_stake_view( fd_stake_state_v2_stake_view_t * view, uchar const * data, ulong data_sz ) {
+  fd_bincode_decode_ctx_t ctx = { .data = data, .dataend = data + data_sz };
+  ulong total_sz = 0UL;
+  int err = fd_stake_state_v2_stake_decode_footprint_inner( &ctx, &total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  if( FD_UNLIKELY( ctx.data>ctx.dataend ) ) return FD_BINCODE_ERR_OVERFLOW;
+  view->data    = data;
+  view->data_sz = (ulong)ctx.data - (ulong)data;
+  return FD_BINCODE_SUCCESS;
+}
 void fd_stake_state_v2_stake_new(fd_stake_state_v2_stake_t * self) {
   fd_memset( self, 0, sizeof(fd_stake_state_v2_stake_t) );
   fd_stake_meta_new( &self->meta );
@@ -15887,13 +17744,7 @@ void fd_stake_state_v2_stake_walk( void * w, fd_stake_state_v2_stake_t const * s
   fd_stake_flags_walk( w, &self->stake_flags, fun, "stake_flags", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_stake_state_v2_stake", level-- );
 }
-ulong fd_stake_state_v2_stake_size( fd_stake_state_v2_stake_t const * self ) {
-  ulong size = 0;
-  size += fd_stake_meta_size( &self->meta );
-  size += fd_stake_size( &self->stake );
-  size += fd_stake_flags_size( &self->stake_flags );
-  return size;
-}
+ulong fd_stake_state_v2_stake_size( fd_stake_state_v2_stake_t const * self ) { (void)self; return 193UL; }
 
 FD_FN_PURE uchar fd_stake_state_v2_is_uninitialized(fd_stake_state_v2_t const * self) {
   return self->discriminant == 0;
@@ -15976,6 +17827,16 @@ void * fd_stake_state_v2_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_stake_state_v2_decode_inner( mem, alloc_mem, ctx );
   return self;
 }
+int fd_stake_state_v2_view( fd_stake_state_v2_view_t * view, uchar const * data, ulong data_sz ) {
+  fd_bincode_decode_ctx_t ctx = { .data = data, .dataend = data + data_sz };
+  ulong total_sz = 0UL;
+  int err = fd_stake_state_v2_decode_footprint_inner( &ctx, &total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  if( FD_UNLIKELY( ctx.data>ctx.dataend ) ) return FD_BINCODE_ERR_OVERFLOW;
+  view->data    = data;
+  view->data_sz = (ulong)ctx.data - (ulong)data;
+  return FD_BINCODE_SUCCESS;
+}
 void fd_stake_state_v2_inner_new( fd_stake_state_v2_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -16104,6 +17965,13 @@ int fd_nonce_data_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total
   return err;
 }
 int fd_nonce_data_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 72UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_nonce_data_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -16114,6 +17982,14 @@ int fd_nonce_data_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong *
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_nonce_data_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_nonce_data_t);
+  void const * start_data = ctx->data;
+  int err = fd_nonce_data_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_nonce_data_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_nonce_data_t * self = (fd_nonce_data_t *)mem;
   fd_nonce_data_new( self );
@@ -16150,13 +18026,7 @@ void fd_nonce_data_walk( void * w, fd_nonce_data_t const * self, fd_types_walk_f
   fd_fee_calculator_walk( w, &self->fee_calculator, fun, "fee_calculator", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_nonce_data", level-- );
 }
-ulong fd_nonce_data_size( fd_nonce_data_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->authority );
-  size += fd_hash_size( &self->durable_nonce );
-  size += fd_fee_calculator_size( &self->fee_calculator );
-  return size;
-}
+ulong fd_nonce_data_size( fd_nonce_data_t const * self ) { (void)self; return 72UL; }
 
 FD_FN_PURE uchar fd_nonce_state_is_uninitialized(fd_nonce_state_t const * self) {
   return self->discriminant == 0;
@@ -16473,6 +18343,13 @@ int fd_compute_budget_program_instruction_request_units_deprecated_decode_footpr
   return err;
 }
 int fd_compute_budget_program_instruction_request_units_deprecated_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 8UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_compute_budget_program_instruction_request_units_deprecated_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint32_decode_footprint( ctx );
@@ -16481,6 +18358,14 @@ int fd_compute_budget_program_instruction_request_units_deprecated_decode_footpr
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_compute_budget_program_instruction_request_units_deprecated_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_compute_budget_program_instruction_request_units_deprecated_t);
+  void const * start_data = ctx->data;
+  int err = fd_compute_budget_program_instruction_request_units_deprecated_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_compute_budget_program_instruction_request_units_deprecated_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_compute_budget_program_instruction_request_units_deprecated_t * self = (fd_compute_budget_program_instruction_request_units_deprecated_t *)mem;
   fd_compute_budget_program_instruction_request_units_deprecated_new( self );
@@ -16509,12 +18394,7 @@ void fd_compute_budget_program_instruction_request_units_deprecated_walk( void *
   fun( w, &self->additional_fee, "additional_fee", FD_FLAMENCO_TYPE_UINT, "uint", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_compute_budget_program_instruction_request_units_deprecated", level-- );
 }
-ulong fd_compute_budget_program_instruction_request_units_deprecated_size( fd_compute_budget_program_instruction_request_units_deprecated_t const * self ) {
-  ulong size = 0;
-  size += sizeof(uint);
-  size += sizeof(uint);
-  return size;
-}
+ulong fd_compute_budget_program_instruction_request_units_deprecated_size( fd_compute_budget_program_instruction_request_units_deprecated_t const * self ) { (void)self; return 8UL; }
 
 FD_FN_PURE uchar fd_compute_budget_program_instruction_is_request_units_deprecated(fd_compute_budget_program_instruction_t const * self) {
   return self->discriminant == 0;
@@ -17213,11 +19093,7 @@ void fd_loader_v4_program_instruction_truncate_walk( void * w, fd_loader_v4_prog
   fun( w, &self->new_size, "new_size", FD_FLAMENCO_TYPE_UINT, "uint", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_loader_v4_program_instruction_truncate", level-- );
 }
-ulong fd_loader_v4_program_instruction_truncate_size( fd_loader_v4_program_instruction_truncate_t const * self ) {
-  ulong size = 0;
-  size += sizeof(uint);
-  return size;
-}
+ulong fd_loader_v4_program_instruction_truncate_size( fd_loader_v4_program_instruction_truncate_t const * self ) { (void)self; return 4UL; }
 
 FD_FN_PURE uchar fd_loader_v4_program_instruction_is_write(fd_loader_v4_program_instruction_t const * self) {
   return self->discriminant == 0;
@@ -17570,11 +19446,7 @@ void fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_walk
   fun( w, &self->max_data_len, "max_data_len", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len", level-- );
 }
-ulong fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_size( fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_size( fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_t const * self ) { (void)self; return 8UL; }
 
 int fd_bpf_upgradeable_loader_program_instruction_extend_program_encode( fd_bpf_upgradeable_loader_program_instruction_extend_program_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -17623,11 +19495,7 @@ void fd_bpf_upgradeable_loader_program_instruction_extend_program_walk( void * w
   fun( w, &self->additional_bytes, "additional_bytes", FD_FLAMENCO_TYPE_UINT, "uint", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_bpf_upgradeable_loader_program_instruction_extend_program", level-- );
 }
-ulong fd_bpf_upgradeable_loader_program_instruction_extend_program_size( fd_bpf_upgradeable_loader_program_instruction_extend_program_t const * self ) {
-  ulong size = 0;
-  size += sizeof(uint);
-  return size;
-}
+ulong fd_bpf_upgradeable_loader_program_instruction_extend_program_size( fd_bpf_upgradeable_loader_program_instruction_extend_program_t const * self ) { (void)self; return 4UL; }
 
 FD_FN_PURE uchar fd_bpf_upgradeable_loader_program_instruction_is_initialize_buffer(fd_bpf_upgradeable_loader_program_instruction_t const * self) {
   return self->discriminant == 0;
@@ -18007,12 +19875,27 @@ int fd_bpf_upgradeable_loader_state_program_decode_footprint( fd_bincode_decode_
   return err;
 }
 int fd_bpf_upgradeable_loader_state_program_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_bpf_upgradeable_loader_state_program_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_bpf_upgradeable_loader_state_program_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_bpf_upgradeable_loader_state_program_t);
+  void const * start_data = ctx->data;
+  int err = fd_bpf_upgradeable_loader_state_program_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_bpf_upgradeable_loader_state_program_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_bpf_upgradeable_loader_state_program_t * self = (fd_bpf_upgradeable_loader_state_program_t *)mem;
   fd_bpf_upgradeable_loader_state_program_new( self );
@@ -18041,11 +19924,7 @@ void fd_bpf_upgradeable_loader_state_program_walk( void * w, fd_bpf_upgradeable_
   fd_pubkey_walk( w, &self->programdata_address, fun, "programdata_address", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_bpf_upgradeable_loader_state_program", level-- );
 }
-ulong fd_bpf_upgradeable_loader_state_program_size( fd_bpf_upgradeable_loader_state_program_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->programdata_address );
-  return size;
-}
+ulong fd_bpf_upgradeable_loader_state_program_size( fd_bpf_upgradeable_loader_state_program_t const * self ) { (void)self; return 32UL; }
 
 int fd_bpf_upgradeable_loader_state_program_data_encode( fd_bpf_upgradeable_loader_state_program_data_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -18372,6 +20251,13 @@ int fd_loader_v4_state_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong *
   return err;
 }
 int fd_loader_v4_state_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 48UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_loader_v4_state_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -18382,6 +20268,14 @@ int fd_loader_v4_state_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ul
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_loader_v4_state_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_loader_v4_state_t);
+  void const * start_data = ctx->data;
+  int err = fd_loader_v4_state_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_loader_v4_state_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_loader_v4_state_t * self = (fd_loader_v4_state_t *)mem;
   fd_loader_v4_state_new( self );
@@ -18414,13 +20308,7 @@ void fd_loader_v4_state_walk( void * w, fd_loader_v4_state_t const * self, fd_ty
   fun( w, &self->status, "status", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_loader_v4_state", level-- );
 }
-ulong fd_loader_v4_state_size( fd_loader_v4_state_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += fd_pubkey_size( &self->authority_address_or_next_version );
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_loader_v4_state_size( fd_loader_v4_state_t const * self ) { (void)self; return 48UL; }
 
 int fd_frozen_hash_status_encode( fd_frozen_hash_status_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -18439,6 +20327,15 @@ int fd_frozen_hash_status_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_frozen_hash_status_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bool_decode_footprint( ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_frozen_hash_status_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_hash_decode_footprint_inner( ctx, total_sz );
@@ -18447,6 +20344,14 @@ int fd_frozen_hash_status_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_frozen_hash_status_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_frozen_hash_status_t);
+  void const * start_data = ctx->data;
+  int err = fd_frozen_hash_status_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_frozen_hash_status_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_frozen_hash_status_t * self = (fd_frozen_hash_status_t *)mem;
   fd_frozen_hash_status_new( self );
@@ -18477,12 +20382,7 @@ void fd_frozen_hash_status_walk( void * w, fd_frozen_hash_status_t const * self,
   fun( w, &self->is_duplicate_confirmed, "is_duplicate_confirmed", FD_FLAMENCO_TYPE_BOOL, "bool", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_frozen_hash_status", level-- );
 }
-ulong fd_frozen_hash_status_size( fd_frozen_hash_status_t const * self ) {
-  ulong size = 0;
-  size += fd_hash_size( &self->frozen_hash );
-  size += sizeof(char);
-  return size;
-}
+ulong fd_frozen_hash_status_size( fd_frozen_hash_status_t const * self ) { (void)self; return 33UL; }
 
 FD_FN_PURE uchar fd_frozen_hash_versioned_is_current(fd_frozen_hash_versioned_t const * self) {
   return self->discriminant == 0;
@@ -18635,6 +20535,24 @@ int fd_lookup_table_meta_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_lookup_table_meta_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 17UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  {
+    uchar o;
+    err = fd_bincode_bool_decode( &o, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    if( o ) {
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_bincode_uint16_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  return 0;
+}
+static int fd_lookup_table_meta_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -18656,6 +20574,14 @@ int fd_lookup_table_meta_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_lookup_table_meta_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_lookup_table_meta_t);
+  void const * start_data = ctx->data;
+  int err = fd_lookup_table_meta_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_lookup_table_meta_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_lookup_table_meta_t * self = (fd_lookup_table_meta_t *)mem;
   fd_lookup_table_meta_new( self );
@@ -19274,6 +21200,13 @@ int fd_gossip_ping_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * tota
   return err;
 }
 int fd_gossip_ping_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 128UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_gossip_ping_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -19284,6 +21217,14 @@ int fd_gossip_ping_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_gossip_ping_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_ping_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_ping_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_ping_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_ping_t * self = (fd_gossip_ping_t *)mem;
   fd_gossip_ping_new( self );
@@ -19320,13 +21261,7 @@ void fd_gossip_ping_walk( void * w, fd_gossip_ping_t const * self, fd_types_walk
   fd_signature_walk( w, &self->signature, fun, "signature", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_gossip_ping", level-- );
 }
-ulong fd_gossip_ping_size( fd_gossip_ping_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->from );
-  size += fd_hash_size( &self->token );
-  size += fd_signature_size( &self->signature );
-  return size;
-}
+ulong fd_gossip_ping_size( fd_gossip_ping_t const * self ) { (void)self; return 128UL; }
 
 FD_FN_PURE uchar fd_gossip_ip_addr_is_ip4(fd_gossip_ip_addr_t const * self) {
   return self->discriminant == 0;
@@ -19515,6 +21450,25 @@ int fd_gossip_prune_data_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_gossip_prune_data_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong prunes_len;
+  err = fd_bincode_uint64_decode( &prunes_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( prunes_len ) {
+    *total_sz += FD_PUBKEY_ALIGN + FD_PUBKEY_FOOTPRINT*prunes_len;
+    for( ulong i=0; i < prunes_len; i++ ) {
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_bincode_bytes_decode_footprint( 104UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_gossip_prune_data_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -19537,6 +21491,14 @@ int fd_gossip_prune_data_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_gossip_prune_data_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_prune_data_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_prune_data_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_prune_data_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_prune_data_t * self = (fd_gossip_prune_data_t *)mem;
   fd_gossip_prune_data_new( self );
@@ -19638,6 +21600,25 @@ int fd_gossip_prune_sign_data_decode_footprint( fd_bincode_decode_ctx_t * ctx, u
   return err;
 }
 int fd_gossip_prune_sign_data_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong prunes_len;
+  err = fd_bincode_uint64_decode( &prunes_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( prunes_len ) {
+    *total_sz += FD_PUBKEY_ALIGN + FD_PUBKEY_FOOTPRINT*prunes_len;
+    for( ulong i=0; i < prunes_len; i++ ) {
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_bincode_bytes_decode_footprint( 40UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_gossip_prune_sign_data_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -19658,6 +21639,14 @@ int fd_gossip_prune_sign_data_decode_footprint_inner( fd_bincode_decode_ctx_t *
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_gossip_prune_sign_data_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_prune_sign_data_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_prune_sign_data_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_prune_sign_data_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_prune_sign_data_t * self = (fd_gossip_prune_sign_data_t *)mem;
   fd_gossip_prune_sign_data_new( self );
@@ -19958,6 +21947,15 @@ int fd_gossip_socket_addr_ip6_decode_footprint( fd_bincode_decode_ctx_t * ctx, u
   return err;
 }
 int fd_gossip_socket_addr_ip6_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_gossip_ip6_addr_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 10UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_gossip_socket_addr_ip6_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_gossip_ip6_addr_decode_footprint_inner( ctx, total_sz );
@@ -19970,6 +21968,14 @@ int fd_gossip_socket_addr_ip6_decode_footprint_inner( fd_bincode_decode_ctx_t *
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_gossip_socket_addr_ip6_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_socket_addr_ip6_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_socket_addr_ip6_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_socket_addr_ip6_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_socket_addr_ip6_t * self = (fd_gossip_socket_addr_ip6_t *)mem;
   fd_gossip_socket_addr_ip6_new( self );
@@ -20210,6 +22216,35 @@ int fd_gossip_contact_info_v1_decode_footprint( fd_bincode_decode_ctx_t * ctx, u
   return err;
 }
 int fd_gossip_contact_info_v1_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 10UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_gossip_contact_info_v1_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -20240,6 +22275,14 @@ int fd_gossip_contact_info_v1_decode_footprint_inner( fd_bincode_decode_ctx_t *
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_gossip_contact_info_v1_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_contact_info_v1_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_contact_info_v1_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_contact_info_v1_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_contact_info_v1_t * self = (fd_gossip_contact_info_v1_t *)mem;
   fd_gossip_contact_info_v1_new( self );
@@ -20351,6 +22394,17 @@ int fd_gossip_vote_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * tota
   return err;
 }
 int fd_gossip_vote_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 33UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_flamenco_txn_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  return 0;
+}
+static int fd_gossip_vote_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint8_decode_footprint( ctx );
@@ -20363,6 +22417,14 @@ int fd_gossip_vote_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_gossip_vote_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_vote_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_vote_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_vote_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_vote_t * self = (fd_gossip_vote_t *)mem;
   fd_gossip_vote_new( self );
@@ -20440,6 +22502,25 @@ int fd_gossip_lowest_slot_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_gossip_lowest_slot_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 49UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong slots_len;
+  err = fd_bincode_uint64_decode( &slots_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( slots_len ) {
+    *total_sz += 8UL + sizeof(ulong)*slots_len;
+    for( ulong i=0; i < slots_len; i++ ) {
+      err = fd_bincode_uint64_decode_footprint( ctx );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_bincode_bytes_decode_footprint( 16UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_gossip_lowest_slot_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint8_decode_footprint( ctx );
@@ -20466,6 +22547,14 @@ int fd_gossip_lowest_slot_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_gossip_lowest_slot_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_lowest_slot_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_lowest_slot_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_lowest_slot_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_lowest_slot_t * self = (fd_gossip_lowest_slot_t *)mem;
   fd_gossip_lowest_slot_new( self );
@@ -20563,6 +22652,25 @@ int fd_gossip_slot_hashes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_gossip_slot_hashes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong hashes_len;
+  err = fd_bincode_uint64_decode( &hashes_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( hashes_len ) {
+    *total_sz += FD_SLOT_HASH_ALIGN + FD_SLOT_HASH_FOOTPRINT*hashes_len;
+    for( ulong i=0; i < hashes_len; i++ ) {
+      err = fd_slot_hash_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  return 0;
+}
+static int fd_gossip_slot_hashes_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -20581,6 +22689,14 @@ int fd_gossip_slot_hashes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_gossip_slot_hashes_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_slot_hashes_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_slot_hashes_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_slot_hashes_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_slot_hashes_t * self = (fd_gossip_slot_hashes_t *)mem;
   fd_gossip_slot_hashes_new( self );
@@ -20664,6 +22780,15 @@ int fd_gossip_slots_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * tot
   return err;
 }
 int fd_gossip_slots_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 16UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_gossip_bitvec_u8_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_gossip_slots_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -20674,6 +22799,14 @@ int fd_gossip_slots_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_gossip_slots_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_slots_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_slots_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_slots_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_slots_t * self = (fd_gossip_slots_t *)mem;
   fd_gossip_slots_new( self );
@@ -20737,6 +22870,21 @@ int fd_gossip_flate2_slots_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulon
   return err;
 }
 int fd_gossip_flate2_slots_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 16UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong compressed_len;
+  err = fd_bincode_uint64_decode( &compressed_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( compressed_len ) {
+    *total_sz += 8UL + compressed_len;
+    err = fd_bincode_bytes_decode_footprint( compressed_len, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  }
+  return 0;
+}
+static int fd_gossip_flate2_slots_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -20753,6 +22901,14 @@ int fd_gossip_flate2_slots_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx
   }
   return 0;
 }
+int fd_gossip_flate2_slots_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_flate2_slots_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_flate2_slots_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_flate2_slots_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_flate2_slots_t * self = (fd_gossip_flate2_slots_t *)mem;
   fd_gossip_flate2_slots_new( self );
@@ -20988,6 +23144,25 @@ int fd_gossip_epoch_slots_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_gossip_epoch_slots_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 33UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong slots_len;
+  err = fd_bincode_uint64_decode( &slots_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( slots_len ) {
+    *total_sz += FD_GOSSIP_SLOTS_ENUM_ALIGN + FD_GOSSIP_SLOTS_ENUM_FOOTPRINT*slots_len;
+    for( ulong i=0; i < slots_len; i++ ) {
+      err = fd_gossip_slots_enum_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  return 0;
+}
+static int fd_gossip_epoch_slots_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint8_decode_footprint( ctx );
@@ -21008,6 +23183,14 @@ int fd_gossip_epoch_slots_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_gossip_epoch_slots_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_epoch_slots_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_epoch_slots_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_epoch_slots_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_epoch_slots_t * self = (fd_gossip_epoch_slots_t *)mem;
   fd_gossip_epoch_slots_new( self );
@@ -21104,6 +23287,22 @@ int fd_gossip_version_v1_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_gossip_version_v1_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 46UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  {
+    uchar o;
+    err = fd_bincode_bool_decode( &o, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    if( o ) {
+      err = fd_bincode_uint32_decode_footprint( ctx );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  return 0;
+}
+static int fd_gossip_version_v1_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -21127,6 +23326,14 @@ int fd_gossip_version_v1_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   }
   return 0;
 }
+int fd_gossip_version_v1_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_version_v1_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_version_v1_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_version_v1_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_version_v1_t * self = (fd_gossip_version_v1_t *)mem;
   fd_gossip_version_v1_new( self );
@@ -21223,7 +23430,25 @@ int fd_gossip_version_v2_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   ctx->data = start_data;
   return err;
 }
-int fd_gossip_version_v2_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+int fd_gossip_version_v2_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 46UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  {
+    uchar o;
+    err = fd_bincode_bool_decode( &o, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    if( o ) {
+      err = fd_bincode_uint32_decode_footprint( ctx );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_bincode_uint32_decode_footprint( ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_gossip_version_v2_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -21249,6 +23474,14 @@ int fd_gossip_version_v2_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_gossip_version_v2_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_version_v2_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_version_v2_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_version_v2_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_version_v2_t * self = (fd_gossip_version_v2_t *)mem;
   fd_gossip_version_v2_new( self );
@@ -21343,6 +23576,21 @@ int fd_gossip_version_v3_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_gossip_version_v3_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  do { ushort _tmp; err = fd_bincode_compact_u16_decode( &_tmp, ctx ); } while(0);
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  do { ushort _tmp; err = fd_bincode_compact_u16_decode( &_tmp, ctx ); } while(0);
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  do { ushort _tmp; err = fd_bincode_compact_u16_decode( &_tmp, ctx ); } while(0);
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 8UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  do { ushort _tmp; err = fd_bincode_compact_u16_decode( &_tmp, ctx ); } while(0);
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  return 0;
+}
+static int fd_gossip_version_v3_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   do { ushort _tmp; err = fd_bincode_compact_u16_decode( &_tmp, ctx ); } while(0);
@@ -21359,6 +23607,14 @@ int fd_gossip_version_v3_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_gossip_version_v3_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_version_v3_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_version_v3_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_version_v3_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_version_v3_t * self = (fd_gossip_version_v3_t *)mem;
   fd_gossip_version_v3_new( self );
@@ -21427,6 +23683,13 @@ int fd_gossip_node_instance_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulo
   return err;
 }
 int fd_gossip_node_instance_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 56UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_gossip_node_instance_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -21439,6 +23702,14 @@ int fd_gossip_node_instance_decode_footprint_inner( fd_bincode_decode_ctx_t * ct
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_gossip_node_instance_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_node_instance_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_node_instance_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_node_instance_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_node_instance_t * self = (fd_gossip_node_instance_t *)mem;
   fd_gossip_node_instance_new( self );
@@ -21473,14 +23744,7 @@ void fd_gossip_node_instance_walk( void * w, fd_gossip_node_instance_t const * s
   fun( w, &self->token, "token", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_gossip_node_instance", level-- );
 }
-ulong fd_gossip_node_instance_size( fd_gossip_node_instance_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->from );
-  size += sizeof(ulong);
-  size += sizeof(long);
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_gossip_node_instance_size( fd_gossip_node_instance_t const * self ) { (void)self; return 56UL; }
 
 int fd_gossip_duplicate_shred_encode( fd_gossip_duplicate_shred_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -21517,6 +23781,21 @@ int fd_gossip_duplicate_shred_decode_footprint( fd_bincode_decode_ctx_t * ctx, u
   return err;
 }
 int fd_gossip_duplicate_shred_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 57UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong chunk_len;
+  err = fd_bincode_uint64_decode( &chunk_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( chunk_len ) {
+    *total_sz += 8UL + chunk_len;
+    err = fd_bincode_bytes_decode_footprint( chunk_len, ctx );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  }
+  return 0;
+}
+static int fd_gossip_duplicate_shred_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint16_decode_footprint( ctx );
@@ -21545,6 +23824,14 @@ int fd_gossip_duplicate_shred_decode_footprint_inner( fd_bincode_decode_ctx_t *
   }
   return 0;
 }
+int fd_gossip_duplicate_shred_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_duplicate_shred_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_duplicate_shred_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_duplicate_shred_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_duplicate_shred_t * self = (fd_gossip_duplicate_shred_t *)mem;
   fd_gossip_duplicate_shred_new( self );
@@ -21642,6 +23929,25 @@ int fd_gossip_incremental_snapshot_hashes_decode_footprint( fd_bincode_decode_ct
   return err;
 }
 int fd_gossip_incremental_snapshot_hashes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 72UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong hashes_len;
+  err = fd_bincode_uint64_decode( &hashes_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( hashes_len ) {
+    *total_sz += FD_SLOT_HASH_ALIGN + FD_SLOT_HASH_FOOTPRINT*hashes_len;
+    for( ulong i=0; i < hashes_len; i++ ) {
+      err = fd_slot_hash_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  err = fd_bincode_uint64_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  return 0;
+}
+static int fd_gossip_incremental_snapshot_hashes_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -21662,6 +23968,14 @@ int fd_gossip_incremental_snapshot_hashes_decode_footprint_inner( fd_bincode_dec
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_gossip_incremental_snapshot_hashes_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_incremental_snapshot_hashes_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_incremental_snapshot_hashes_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_incremental_snapshot_hashes_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_incremental_snapshot_hashes_t * self = (fd_gossip_incremental_snapshot_hashes_t *)mem;
   fd_gossip_incremental_snapshot_hashes_new( self );
@@ -21750,6 +24064,15 @@ int fd_gossip_socket_entry_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulon
   return err;
 }
 int fd_gossip_socket_entry_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 2UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  do { ushort _tmp; err = fd_bincode_compact_u16_decode( &_tmp, ctx ); } while(0);
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  return 0;
+}
+static int fd_gossip_socket_entry_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint8_decode_footprint( ctx );
@@ -21760,6 +24083,14 @@ int fd_gossip_socket_entry_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_gossip_socket_entry_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_socket_entry_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_socket_entry_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_socket_entry_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_socket_entry_t * self = (fd_gossip_socket_entry_t *)mem;
   fd_gossip_socket_entry_new( self );
@@ -21844,6 +24175,49 @@ int fd_gossip_contact_info_v2_decode_footprint( fd_bincode_decode_ctx_t * ctx, u
   return err;
 }
 int fd_gossip_contact_info_v2_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_varint_decode_footprint( ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 10UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_gossip_version_v3_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  ushort addrs_len;
+  err = fd_bincode_compact_u16_decode( &addrs_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( addrs_len ) {
+    *total_sz += FD_GOSSIP_IP_ADDR_ALIGN + FD_GOSSIP_IP_ADDR_FOOTPRINT*addrs_len;
+    for( ulong i=0; i < addrs_len; i++ ) {
+      err = fd_gossip_ip_addr_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  ushort sockets_len;
+  err = fd_bincode_compact_u16_decode( &sockets_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( sockets_len ) {
+    *total_sz += FD_GOSSIP_SOCKET_ENTRY_ALIGN + FD_GOSSIP_SOCKET_ENTRY_FOOTPRINT*sockets_len;
+    for( ulong i=0; i < sockets_len; i++ ) {
+      err = fd_gossip_socket_entry_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  ushort extensions_len;
+  err = fd_bincode_compact_u16_decode( &extensions_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( extensions_len ) {
+    *total_sz += 8UL + sizeof(uint)*extensions_len;
+    for( ulong i=0; i < extensions_len; i++ ) {
+      err = fd_bincode_uint32_decode_footprint( ctx );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  return 0;
+}
+static int fd_gossip_contact_info_v2_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -21888,6 +24262,14 @@ int fd_gossip_contact_info_v2_decode_footprint_inner( fd_bincode_decode_ctx_t *
   }
   return 0;
 }
+int fd_gossip_contact_info_v2_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_contact_info_v2_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_contact_info_v2_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_contact_info_v2_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_contact_info_v2_t * self = (fd_gossip_contact_info_v2_t *)mem;
   fd_gossip_contact_info_v2_new( self );
@@ -22563,6 +24945,17 @@ int fd_gossip_restart_last_voted_fork_slots_decode_footprint( fd_bincode_decode_
   return err;
 }
 int fd_gossip_restart_last_voted_fork_slots_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 40UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_restart_slots_offsets_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 42UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_gossip_restart_last_voted_fork_slots_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -22579,6 +24972,14 @@ int fd_gossip_restart_last_voted_fork_slots_decode_footprint_inner( fd_bincode_d
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_gossip_restart_last_voted_fork_slots_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_restart_last_voted_fork_slots_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_restart_last_voted_fork_slots_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_restart_last_voted_fork_slots_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_restart_last_voted_fork_slots_t * self = (fd_gossip_restart_last_voted_fork_slots_t *)mem;
   fd_gossip_restart_last_voted_fork_slots_new( self );
@@ -22657,6 +25058,13 @@ int fd_gossip_restart_heaviest_fork_decode_footprint( fd_bincode_decode_ctx_t *
   return err;
 }
 int fd_gossip_restart_heaviest_fork_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 90UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_gossip_restart_heaviest_fork_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -22673,6 +25081,14 @@ int fd_gossip_restart_heaviest_fork_decode_footprint_inner( fd_bincode_decode_ct
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_gossip_restart_heaviest_fork_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_restart_heaviest_fork_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_restart_heaviest_fork_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_restart_heaviest_fork_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_restart_heaviest_fork_t * self = (fd_gossip_restart_heaviest_fork_t *)mem;
   fd_gossip_restart_heaviest_fork_new( self );
@@ -22713,16 +25129,7 @@ void fd_gossip_restart_heaviest_fork_walk( void * w, fd_gossip_restart_heaviest_
   fun( w, &self->shred_version, "shred_version", FD_FLAMENCO_TYPE_USHORT, "ushort", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_gossip_restart_heaviest_fork", level-- );
 }
-ulong fd_gossip_restart_heaviest_fork_size( fd_gossip_restart_heaviest_fork_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->from );
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += fd_hash_size( &self->last_slot_hash );
-  size += sizeof(ulong);
-  size += sizeof(ushort);
-  return size;
-}
+ulong fd_gossip_restart_heaviest_fork_size( fd_gossip_restart_heaviest_fork_t const * self ) { (void)self; return 90UL; }
 
 FD_FN_PURE uchar fd_crds_data_is_contact_info_v1(fd_crds_data_t const * self) {
   return self->discriminant == 0;
@@ -23411,6 +25818,15 @@ int fd_crds_filter_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * tota
   return err;
 }
 int fd_crds_filter_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_crds_bloom_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 12UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_crds_filter_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_crds_bloom_decode_footprint_inner( ctx, total_sz );
@@ -23421,6 +25837,14 @@ int fd_crds_filter_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_crds_filter_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_crds_filter_t);
+  void const * start_data = ctx->data;
+  int err = fd_crds_filter_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_crds_filter_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_crds_filter_t * self = (fd_crds_filter_t *)mem;
   fd_crds_filter_new( self );
@@ -23478,6 +25902,15 @@ int fd_crds_value_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total
   return err;
 }
 int fd_crds_value_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 64UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_crds_data_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_crds_value_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_signature_decode_footprint_inner( ctx, total_sz );
@@ -23486,6 +25919,14 @@ int fd_crds_value_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong *
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_crds_value_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_crds_value_t);
+  void const * start_data = ctx->data;
+  int err = fd_crds_value_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_crds_value_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_crds_value_t * self = (fd_crds_value_t *)mem;
   fd_crds_value_new( self );
@@ -23612,6 +26053,23 @@ int fd_gossip_pull_resp_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong *
   return err;
 }
 int fd_gossip_pull_resp_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong crds_len;
+  err = fd_bincode_uint64_decode( &crds_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( crds_len ) {
+    *total_sz += FD_CRDS_VALUE_ALIGN + FD_CRDS_VALUE_FOOTPRINT*crds_len;
+    for( ulong i=0; i < crds_len; i++ ) {
+      err = fd_crds_value_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  return 0;
+}
+static int fd_gossip_pull_resp_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -23628,6 +26086,14 @@ int fd_gossip_pull_resp_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, u
   }
   return 0;
 }
+int fd_gossip_pull_resp_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_pull_resp_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_pull_resp_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_pull_resp_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_pull_resp_t * self = (fd_gossip_pull_resp_t *)mem;
   fd_gossip_pull_resp_new( self );
@@ -23712,6 +26178,23 @@ int fd_gossip_push_msg_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong *
   return err;
 }
 int fd_gossip_push_msg_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  ulong crds_len;
+  err = fd_bincode_uint64_decode( &crds_len, ctx );
+  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+  if( crds_len ) {
+    *total_sz += FD_CRDS_VALUE_ALIGN + FD_CRDS_VALUE_FOOTPRINT*crds_len;
+    for( ulong i=0; i < crds_len; i++ ) {
+      err = fd_crds_value_decode_footprint_inner( ctx, total_sz );
+      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    }
+  }
+  return 0;
+}
+static int fd_gossip_push_msg_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -23728,6 +26211,14 @@ int fd_gossip_push_msg_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ul
   }
   return 0;
 }
+int fd_gossip_push_msg_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_push_msg_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_push_msg_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_push_msg_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_push_msg_t * self = (fd_gossip_push_msg_t *)mem;
   fd_gossip_push_msg_new( self );
@@ -23806,6 +26297,15 @@ int fd_gossip_prune_msg_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong *
   return err;
 }
 int fd_gossip_prune_msg_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_gossip_prune_data_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_gossip_prune_msg_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -23814,6 +26314,14 @@ int fd_gossip_prune_msg_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, u
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_gossip_prune_msg_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_gossip_prune_msg_t);
+  void const * start_data = ctx->data;
+  int err = fd_gossip_prune_msg_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_gossip_prune_msg_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_prune_msg_t * self = (fd_gossip_prune_msg_t *)mem;
   fd_gossip_prune_msg_new( self );
@@ -24164,6 +26672,13 @@ int fd_addrlut_create_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * t
   return err;
 }
 int fd_addrlut_create_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 9UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_addrlut_create_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -24172,6 +26687,14 @@ int fd_addrlut_create_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulo
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_addrlut_create_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_addrlut_create_t);
+  void const * start_data = ctx->data;
+  int err = fd_addrlut_create_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_addrlut_create_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_addrlut_create_t * self = (fd_addrlut_create_t *)mem;
   fd_addrlut_create_new( self );
@@ -24200,12 +26723,7 @@ void fd_addrlut_create_walk( void * w, fd_addrlut_create_t const * self, fd_type
   fun( w, &self->bump_seed, "bump_seed", FD_FLAMENCO_TYPE_UCHAR, "uchar", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_addrlut_create", level-- );
 }
-ulong fd_addrlut_create_size( fd_addrlut_create_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += sizeof(char);
-  return size;
-}
+ulong fd_addrlut_create_size( fd_addrlut_create_t const * self ) { (void)self; return 9UL; }
 
 int fd_addrlut_extend_encode( fd_addrlut_extend_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -24527,6 +27045,13 @@ int fd_repair_request_header_decode_footprint( fd_bincode_decode_ctx_t * ctx, ul
   return err;
 }
 int fd_repair_request_header_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 140UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_repair_request_header_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_signature_decode_footprint_inner( ctx, total_sz );
@@ -24541,6 +27066,14 @@ int fd_repair_request_header_decode_footprint_inner( fd_bincode_decode_ctx_t * c
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_repair_request_header_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_repair_request_header_t);
+  void const * start_data = ctx->data;
+  int err = fd_repair_request_header_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_repair_request_header_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_repair_request_header_t * self = (fd_repair_request_header_t *)mem;
   fd_repair_request_header_new( self );
@@ -24581,15 +27114,7 @@ void fd_repair_request_header_walk( void * w, fd_repair_request_header_t const *
   fun( w, &self->nonce, "nonce", FD_FLAMENCO_TYPE_UINT, "uint", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_repair_request_header", level-- );
 }
-ulong fd_repair_request_header_size( fd_repair_request_header_t const * self ) {
-  ulong size = 0;
-  size += fd_signature_size( &self->signature );
-  size += fd_pubkey_size( &self->sender );
-  size += fd_pubkey_size( &self->recipient );
-  size += sizeof(long);
-  size += sizeof(uint);
-  return size;
-}
+ulong fd_repair_request_header_size( fd_repair_request_header_t const * self ) { (void)self; return 140UL; }
 
 int fd_repair_window_index_encode( fd_repair_window_index_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -24610,6 +27135,13 @@ int fd_repair_window_index_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulon
   return err;
 }
 int fd_repair_window_index_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 156UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_repair_window_index_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_repair_request_header_decode_footprint_inner( ctx, total_sz );
@@ -24620,6 +27152,14 @@ int fd_repair_window_index_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_repair_window_index_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_repair_window_index_t);
+  void const * start_data = ctx->data;
+  int err = fd_repair_window_index_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_repair_window_index_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_repair_window_index_t * self = (fd_repair_window_index_t *)mem;
   fd_repair_window_index_new( self );
@@ -24652,13 +27192,7 @@ void fd_repair_window_index_walk( void * w, fd_repair_window_index_t const * sel
   fun( w, &self->shred_index, "shred_index", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_repair_window_index", level-- );
 }
-ulong fd_repair_window_index_size( fd_repair_window_index_t const * self ) {
-  ulong size = 0;
-  size += fd_repair_request_header_size( &self->header );
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_repair_window_index_size( fd_repair_window_index_t const * self ) { (void)self; return 156UL; }
 
 int fd_repair_highest_window_index_encode( fd_repair_highest_window_index_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -24679,6 +27213,13 @@ int fd_repair_highest_window_index_decode_footprint( fd_bincode_decode_ctx_t * c
   return err;
 }
 int fd_repair_highest_window_index_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 156UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_repair_highest_window_index_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_repair_request_header_decode_footprint_inner( ctx, total_sz );
@@ -24689,6 +27230,14 @@ int fd_repair_highest_window_index_decode_footprint_inner( fd_bincode_decode_ctx
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_repair_highest_window_index_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_repair_highest_window_index_t);
+  void const * start_data = ctx->data;
+  int err = fd_repair_highest_window_index_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_repair_highest_window_index_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_repair_highest_window_index_t * self = (fd_repair_highest_window_index_t *)mem;
   fd_repair_highest_window_index_new( self );
@@ -24721,13 +27270,7 @@ void fd_repair_highest_window_index_walk( void * w, fd_repair_highest_window_ind
   fun( w, &self->shred_index, "shred_index", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_repair_highest_window_index", level-- );
 }
-ulong fd_repair_highest_window_index_size( fd_repair_highest_window_index_t const * self ) {
-  ulong size = 0;
-  size += fd_repair_request_header_size( &self->header );
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_repair_highest_window_index_size( fd_repair_highest_window_index_t const * self ) { (void)self; return 156UL; }
 
 int fd_repair_orphan_encode( fd_repair_orphan_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -24746,6 +27289,13 @@ int fd_repair_orphan_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * to
   return err;
 }
 int fd_repair_orphan_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 148UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_repair_orphan_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_repair_request_header_decode_footprint_inner( ctx, total_sz );
@@ -24754,6 +27304,14 @@ int fd_repair_orphan_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulon
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_repair_orphan_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_repair_orphan_t);
+  void const * start_data = ctx->data;
+  int err = fd_repair_orphan_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_repair_orphan_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_repair_orphan_t * self = (fd_repair_orphan_t *)mem;
   fd_repair_orphan_new( self );
@@ -24784,12 +27342,7 @@ void fd_repair_orphan_walk( void * w, fd_repair_orphan_t const * self, fd_types_
   fun( w, &self->slot, "slot", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_repair_orphan", level-- );
 }
-ulong fd_repair_orphan_size( fd_repair_orphan_t const * self ) {
-  ulong size = 0;
-  size += fd_repair_request_header_size( &self->header );
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_repair_orphan_size( fd_repair_orphan_t const * self ) { (void)self; return 148UL; }
 
 int fd_repair_ancestor_hashes_encode( fd_repair_ancestor_hashes_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -24808,6 +27361,13 @@ int fd_repair_ancestor_hashes_decode_footprint( fd_bincode_decode_ctx_t * ctx, u
   return err;
 }
 int fd_repair_ancestor_hashes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 148UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_repair_ancestor_hashes_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_repair_request_header_decode_footprint_inner( ctx, total_sz );
@@ -24816,6 +27376,14 @@ int fd_repair_ancestor_hashes_decode_footprint_inner( fd_bincode_decode_ctx_t *
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_repair_ancestor_hashes_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_repair_ancestor_hashes_t);
+  void const * start_data = ctx->data;
+  int err = fd_repair_ancestor_hashes_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_repair_ancestor_hashes_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_repair_ancestor_hashes_t * self = (fd_repair_ancestor_hashes_t *)mem;
   fd_repair_ancestor_hashes_new( self );
@@ -24846,12 +27414,7 @@ void fd_repair_ancestor_hashes_walk( void * w, fd_repair_ancestor_hashes_t const
   fun( w, &self->slot, "slot", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_repair_ancestor_hashes", level-- );
 }
-ulong fd_repair_ancestor_hashes_size( fd_repair_ancestor_hashes_t const * self ) {
-  ulong size = 0;
-  size += fd_repair_request_header_size( &self->header );
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_repair_ancestor_hashes_size( fd_repair_ancestor_hashes_t const * self ) { (void)self; return 148UL; }
 
 FD_FN_PURE uchar fd_repair_protocol_is_LegacyWindowIndex(fd_repair_protocol_t const * self) {
   return self->discriminant == 0;
@@ -27316,6 +29879,15 @@ int fd_cache_status_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * tot
   return err;
 }
 int fd_cache_status_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 20UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_txn_result_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_cache_status_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_bytes_decode_footprint( 20, ctx );
@@ -27324,6 +29896,14 @@ int fd_cache_status_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_cache_status_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_cache_status_t);
+  void const * start_data = ctx->data;
+  int err = fd_cache_status_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_cache_status_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_cache_status_t * self = (fd_cache_status_t *)mem;
   fd_cache_status_new( self );
@@ -27476,6 +30056,15 @@ int fd_status_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * tota
   return err;
 }
 int fd_status_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_status_value_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_status_pair_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_hash_decode_footprint_inner( ctx, total_sz );
@@ -27484,6 +30073,14 @@ int fd_status_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_status_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_status_pair_t);
+  void const * start_data = ctx->data;
+  int err = fd_status_pair_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_status_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_status_pair_t * self = (fd_status_pair_t *)mem;
   fd_status_pair_new( self );
@@ -27736,6 +30333,15 @@ int fd_pubkey_rewardinfo_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, u
   return err;
 }
 int fd_pubkey_rewardinfo_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_reward_info_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_pubkey_rewardinfo_pair_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -27744,6 +30350,14 @@ int fd_pubkey_rewardinfo_pair_decode_footprint_inner( fd_bincode_decode_ctx_t *
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_pubkey_rewardinfo_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_pubkey_rewardinfo_pair_t);
+  void const * start_data = ctx->data;
+  int err = fd_pubkey_rewardinfo_pair_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_pubkey_rewardinfo_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_rewardinfo_pair_t * self = (fd_pubkey_rewardinfo_pair_t *)mem;
   fd_pubkey_rewardinfo_pair_new( self );
@@ -27776,12 +30390,7 @@ void fd_pubkey_rewardinfo_pair_walk( void * w, fd_pubkey_rewardinfo_pair_t const
   fd_reward_info_walk( w, &self->reward_info, fun, "reward_info", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_pubkey_rewardinfo_pair", level-- );
 }
-ulong fd_pubkey_rewardinfo_pair_size( fd_pubkey_rewardinfo_pair_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->pubkey );
-  size += fd_reward_info_size( &self->reward_info );
-  return size;
-}
+ulong fd_pubkey_rewardinfo_pair_size( fd_pubkey_rewardinfo_pair_t const * self ) { (void)self; return 60UL; }
 
 int fd_optional_account_encode( fd_optional_account_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -27893,6 +30502,13 @@ int fd_calculated_stake_points_decode_footprint( fd_bincode_decode_ctx_t * ctx,
   return err;
 }
 int fd_calculated_stake_points_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 25UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_calculated_stake_points_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint128_decode_footprint( ctx );
@@ -27903,6 +30519,14 @@ int fd_calculated_stake_points_decode_footprint_inner( fd_bincode_decode_ctx_t *
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_calculated_stake_points_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_calculated_stake_points_t);
+  void const * start_data = ctx->data;
+  int err = fd_calculated_stake_points_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_calculated_stake_points_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_calculated_stake_points_t * self = (fd_calculated_stake_points_t *)mem;
   fd_calculated_stake_points_new( self );
@@ -27933,13 +30557,7 @@ void fd_calculated_stake_points_walk( void * w, fd_calculated_stake_points_t con
   fun( w, &self->force_credits_update_with_skipped_reward, "force_credits_update_with_skipped_reward", FD_FLAMENCO_TYPE_UCHAR, "uchar", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_calculated_stake_points", level-- );
 }
-ulong fd_calculated_stake_points_size( fd_calculated_stake_points_t const * self ) {
-  ulong size = 0;
-  size += sizeof(uint128);
-  size += sizeof(ulong);
-  size += sizeof(char);
-  return size;
-}
+ulong fd_calculated_stake_points_size( fd_calculated_stake_points_t const * self ) { (void)self; return 25UL; }
 
 int fd_calculated_stake_rewards_encode( fd_calculated_stake_rewards_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -27960,6 +30578,13 @@ int fd_calculated_stake_rewards_decode_footprint( fd_bincode_decode_ctx_t * ctx,
   return err;
 }
 int fd_calculated_stake_rewards_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 24UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_calculated_stake_rewards_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
@@ -27970,6 +30595,14 @@ int fd_calculated_stake_rewards_decode_footprint_inner( fd_bincode_decode_ctx_t
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_calculated_stake_rewards_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_calculated_stake_rewards_t);
+  void const * start_data = ctx->data;
+  int err = fd_calculated_stake_rewards_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_calculated_stake_rewards_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_calculated_stake_rewards_t * self = (fd_calculated_stake_rewards_t *)mem;
   fd_calculated_stake_rewards_new( self );
@@ -28000,13 +30633,7 @@ void fd_calculated_stake_rewards_walk( void * w, fd_calculated_stake_rewards_t c
   fun( w, &self->new_credits_observed, "new_credits_observed", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_calculated_stake_rewards", level-- );
 }
-ulong fd_calculated_stake_rewards_size( fd_calculated_stake_rewards_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_calculated_stake_rewards_size( fd_calculated_stake_rewards_t const * self ) { (void)self; return 24UL; }
 
 int fd_duplicate_slot_proof_encode( fd_duplicate_slot_proof_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -28129,6 +30756,13 @@ int fd_epoch_info_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong *
   return err;
 }
 int fd_epoch_info_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 104UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_epoch_info_pair_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -28137,6 +30771,14 @@ int fd_epoch_info_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ul
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_epoch_info_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_epoch_info_pair_t);
+  void const * start_data = ctx->data;
+  int err = fd_epoch_info_pair_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_epoch_info_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_epoch_info_pair_t * self = (fd_epoch_info_pair_t *)mem;
   fd_epoch_info_pair_new( self );
@@ -28169,12 +30811,7 @@ void fd_epoch_info_pair_walk( void * w, fd_epoch_info_pair_t const * self, fd_ty
   fd_stake_walk( w, &self->stake, fun, "stake", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_epoch_info_pair", level-- );
 }
-ulong fd_epoch_info_pair_size( fd_epoch_info_pair_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->account );
-  size += fd_stake_size( &self->stake );
-  return size;
-}
+ulong fd_epoch_info_pair_size( fd_epoch_info_pair_t const * self ) { (void)self; return 104UL; }
 
 int fd_vote_info_pair_encode( fd_vote_info_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -28193,6 +30830,15 @@ int fd_vote_info_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * t
   return err;
 }
 int fd_vote_info_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 32UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_vote_state_versioned_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_vote_info_pair_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
@@ -28201,6 +30847,14 @@ int fd_vote_info_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulo
   if( FD_UNLIKELY( err ) ) return err;
   return 0;
 }
+int fd_vote_info_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_vote_info_pair_t);
+  void const * start_data = ctx->data;
+  int err = fd_vote_info_pair_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_vote_info_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_info_pair_t * self = (fd_vote_info_pair_t *)mem;
   fd_vote_info_pair_new( self );
@@ -28412,6 +31066,13 @@ int fd_usage_cost_details_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_usage_cost_details_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 48UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_usage_cost_details_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -28427,6 +31088,14 @@ int fd_usage_cost_details_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_usage_cost_details_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_usage_cost_details_t);
+  void const * start_data = ctx->data;
+  int err = fd_usage_cost_details_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_usage_cost_details_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_usage_cost_details_t * self = (fd_usage_cost_details_t *)mem;
   fd_usage_cost_details_new( self );
@@ -28463,16 +31132,7 @@ void fd_usage_cost_details_walk( void * w, fd_usage_cost_details_t const * self,
   fun( w, &self->allocated_accounts_data_size, "allocated_accounts_data_size", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_usage_cost_details", level-- );
 }
-ulong fd_usage_cost_details_size( fd_usage_cost_details_t const * self ) {
-  ulong size = 0;
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_usage_cost_details_size( fd_usage_cost_details_t const * self ) { (void)self; return 48UL; }
 
 FD_FN_PURE uchar fd_transaction_cost_is_simple_vote(fd_transaction_cost_t const * self) {
   return self->discriminant == 0;
@@ -28628,6 +31288,13 @@ int fd_account_costs_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong
   return err;
 }
 int fd_account_costs_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 40UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_account_costs_pair_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
@@ -28635,6 +31302,14 @@ int fd_account_costs_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_account_costs_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_account_costs_pair_t);
+  void const * start_data = ctx->data;
+  int err = fd_account_costs_pair_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_account_costs_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_account_costs_pair_t * self = (fd_account_costs_pair_t *)mem;
   fd_account_costs_pair_new( self );
@@ -28665,12 +31340,7 @@ void fd_account_costs_pair_walk( void * w, fd_account_costs_pair_t const * self,
   fun( w, &self->cost, "cost", FD_FLAMENCO_TYPE_ULONG, "ulong", level );
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "fd_account_costs_pair", level-- );
 }
-ulong fd_account_costs_pair_size( fd_account_costs_pair_t const * self ) {
-  ulong size = 0;
-  size += fd_pubkey_size( &self->key );
-  size += sizeof(ulong);
-  return size;
-}
+ulong fd_account_costs_pair_size( fd_account_costs_pair_t const * self ) { (void)self; return 40UL; }
 
 int fd_account_costs_encode( fd_account_costs_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
@@ -28802,6 +31472,17 @@ int fd_cost_tracker_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * tot
   return err;
 }
 int fd_cost_tracker_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  int err = 0;
+  err = fd_bincode_bytes_decode_footprint( 24UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_account_costs_decode_footprint_inner( ctx, total_sz );
+  if( FD_UNLIKELY( err ) ) return err;
+  err = fd_bincode_bytes_decode_footprint( 64UL, ctx );
+  if( FD_UNLIKELY( err ) ) return err;
+  return 0;
+}
+static int fd_cost_tracker_decode_footprint_inner_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  if( ctx->data>=ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
   int err = 0;
   err = fd_bincode_uint64_decode_footprint( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -28829,6 +31510,14 @@ int fd_cost_tracker_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return 0;
 }
+int fd_cost_tracker_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  *total_sz += sizeof(fd_cost_tracker_t);
+  void const * start_data = ctx->data;
+  int err = fd_cost_tracker_decode_footprint_inner_ref( ctx, total_sz );
+  if( ctx->data>ctx->dataend ) { return FD_BINCODE_ERR_OVERFLOW; };
+  ctx->data = start_data;
+  return err;
+}
 void * fd_cost_tracker_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {
   fd_cost_tracker_t * self = (fd_cost_tracker_t *)mem;
   fd_cost_tracker_new( self );
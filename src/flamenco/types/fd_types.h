@@ -710,6 +710,13 @@ typedef struct fd_delegation_off fd_delegation_off_t;
 #define FD_DELEGATION_OFF_FOOTPRINT sizeof(fd_delegation_off_t)
 #define FD_DELEGATION_OFF_ALIGN (8UL)
 
+/* fd_delegation_view_t reads the fields of an encoded fd_delegation_t in place */
+struct fd_delegation_view {
+  uchar const * data;
+  ulong         data_sz; /* Encoded size */
+};
+typedef struct fd_delegation_view fd_delegation_view_t;
+
 /* Encoded Size: Fixed (96 bytes) */
 struct __attribute__((aligned(8UL))) fd_delegation_pair {
   fd_pubkey_t account;
@@ -745,6 +752,13 @@ typedef struct fd_stake_off fd_stake_off_t;
 #define FD_STAKE_OFF_FOOTPRINT sizeof(fd_stake_off_t)
 #define FD_STAKE_OFF_ALIGN (8UL)
 
+/* fd_stake_view_t reads the fields of an encoded fd_stake_t in place */
+struct fd_stake_view {
+  uchar const * data;
+  ulong         data_sz; /* Encoded size */
+};
+typedef struct fd_stake_view fd_stake_view_t;
+
 /* Encoded Size: Fixed (104 bytes) */
 struct __attribute__((aligned(8UL))) fd_stake_pair {
   fd_pubkey_t account;
@@ -1775,6 +1789,13 @@ typedef struct fd_vote_block_timestamp_off fd_vote_block_timestamp_off_t;
 #define FD_VOTE_BLOCK_TIMESTAMP_OFF_FOOTPRINT sizeof(fd_vote_block_timestamp_off_t)
 #define FD_VOTE_BLOCK_TIMESTAMP_OFF_ALIGN (8UL)
 
+/* fd_vote_block_timestamp_view_t reads the fields of an encoded fd_vote_block_timestamp_t in place */
+struct fd_vote_block_timestamp_view {
+  uchar const * data;
+  ulong         data_sz; /* Encoded size */
+};
+typedef struct fd_vote_block_timestamp_view fd_vote_block_timestamp_view_t;
+
 /* https://github.com/solana-labs/solana/blob/8f2c8b8388a495d2728909e30460aa40dcc5d733/programs/vote/src/vote_state/mod.rs#L268 */
 /* Encoded Size: Fixed (1545 bytes) */
 struct __attribute__((aligned(8UL))) fd_vote_prior_voters {
@@ -1906,6 +1927,13 @@ typedef struct fd_vote_state_0_23_5_off fd_vote_state_0_23_5_off_t;
 #define FD_VOTE_STATE_0_23_5_OFF_FOOTPRINT sizeof(fd_vote_state_0_23_5_off_t)
 #define FD_VOTE_STATE_0_23_5_OFF_ALIGN (8UL)
 
+/* fd_vote_state_0_23_5_view_t reads the fields of an encoded fd_vote_state_0_23_5_t in place */
+struct fd_vote_state_0_23_5_view {
+  uchar const * data;
+  ulong         data_sz; /* Encoded size */
+};
+typedef struct fd_vote_state_0_23_5_view fd_vote_state_0_23_5_view_t;
+
 #define FD_VOTE_AUTHORIZED_VOTERS_MIN 64
 #define POOL_NAME fd_vote_authorized_voters_pool
 #define POOL_T fd_vote_authorized_voter_t
@@ -2001,6 +2029,13 @@ typedef struct fd_vote_state_1_14_11_off fd_vote_state_1_14_11_off_t;
 #define FD_VOTE_STATE_1_14_11_OFF_FOOTPRINT sizeof(fd_vote_state_1_14_11_off_t)
 #define FD_VOTE_STATE_1_14_11_OFF_ALIGN (8UL)
 
+/* fd_vote_state_1_14_11_view_t reads the fields of an encoded fd_vote_state_1_14_11_t in place */
+struct fd_vote_state_1_14_11_view {
+  uchar const * data;
+  ulong         data_sz; /* Encoded size */
+};
+typedef struct fd_vote_state_1_14_11_view fd_vote_state_1_14_11_view_t;
+
 #define DEQUE_NAME deq_fd_landed_vote_t
 #define DEQUE_T fd_landed_vote_t
 #include "../../util/tmpl/fd_deque_dynamic.c"
@@ -2054,6 +2089,13 @@ typedef struct fd_vote_state_off fd_vote_state_off_t;
 #define FD_VOTE_STATE_OFF_FOOTPRINT sizeof(fd_vote_state_off_t)
 #define FD_VOTE_STATE_OFF_ALIGN (8UL)
 
+/* fd_vote_state_view_t reads the fields of an encoded fd_vote_state_t in place */
+struct fd_vote_state_view {
+  uchar const * data;
+  ulong         data_sz; /* Encoded size */
+};
+typedef struct fd_vote_state_view fd_vote_state_view_t;
+
 union fd_vote_state_versioned_inner {
   fd_vote_state_0_23_5_t v0_23_5;
   fd_vote_state_1_14_11_t v1_14_11;
@@ -2086,6 +2128,13 @@ typedef struct fd_vote_state_versioned_off fd_vote_state_versioned_off_t;
 #define FD_VOTE_STATE_VERSIONED_OFF_FOOTPRINT sizeof(fd_vote_state_versioned_off_t)
 #define FD_VOTE_STATE_VERSIONED_OFF_ALIGN (8UL)
 
+/* fd_vote_state_versioned_view_t reads the fields of an encoded fd_vote_state_versioned_t in place */
+struct fd_vote_state_versioned_view {
+  uchar const * data;
+  ulong         data_sz; /* Encoded size */
+};
+typedef struct fd_vote_state_versioned_view fd_vote_state_versioned_view_t;
+
 /* https://github.com/solana-labs/solana/blob/8f2c8b8388a495d2728909e30460aa40dcc5d733/programs/vote/src/vote_state/mod.rs#L185 */
 /* Encoded Size: Dynamic */
 struct __attribute__((aligned(8UL))) fd_vote_state_update {
@@ -3175,6 +3224,13 @@ typedef struct fd_stake_authorized_off fd_stake_authorized_off_t;
 #define FD_STAKE_AUTHORIZED_OFF_FOOTPRINT sizeof(fd_stake_authorized_off_t)
 #define FD_STAKE_AUTHORIZED_OFF_ALIGN (8UL)
 
+/* fd_stake_authorized_view_t reads the fields of an encoded fd_stake_authorized_t in place */
+struct fd_stake_authorized_view {
+  uchar const * data;
+  ulong         data_sz; /* Encoded size */
+};
+typedef struct fd_stake_authorized_view fd_stake_authorized_view_t;
+
 /* https://github.com/solana-labs/solana/blob/8f2c8b8388a495d2728909e30460aa40dcc5d733/sdk/program/src/stake/state.rs#L135 */
 /* Encoded Size: Fixed (48 bytes) */
 struct __attribute__((aligned(8UL))) fd_stake_lockup {
@@ -3195,6 +3251,13 @@ typedef struct fd_stake_lockup_off fd_stake_lockup_off_t;
 #define FD_STAKE_LOCKUP_OFF_FOOTPRINT sizeof(fd_stake_lockup_off_t)
 #define FD_STAKE_LOCKUP_OFF_ALIGN (8UL)
 
+/* fd_stake_lockup_view_t reads the fields of an encoded fd_stake_lockup_t in place */
+struct fd_stake_lockup_view {
+  uchar const * data;
+  ulong         data_sz; /* Encoded size */
+};
+typedef struct fd_stake_lockup_view fd_stake_lockup_view_t;
+
 /* https://github.com/solana-labs/solana/blob/8f2c8b8388a495d2728909e30460aa40dcc5d733/sdk/program/src/stake/instruction.rs#L68 */
 /* Encoded Size: Fixed (112 bytes) */
 struct __attribute__((aligned(8UL))) fd_stake_instruction_initialize {
@@ -3391,6 +3454,13 @@ typedef struct fd_stake_meta_off fd_stake_meta_off_t;
 #define FD_STAKE_META_OFF_FOOTPRINT sizeof(fd_stake_meta_off_t)
 #define FD_STAKE_META_OFF_ALIGN (8UL)
 
+/* fd_stake_meta_view_t reads the fields of an encoded fd_stake_meta_t in place */
+struct fd_stake_meta_view {
+  uchar const * data;
+  ulong         data_sz; /* Encoded size */
+};
+typedef struct fd_stake_meta_view fd_stake_meta_view_t;
+
 /* https://github.com/firedancer-io/solana/blob/v1.17/sdk/program/src/stake/stake_flags.rs#L21 */
 /* Encoded Size: Fixed (1 bytes) */
 struct __attribute__((aligned(8UL))) fd_stake_flags {
@@ -3407,6 +3477,13 @@ typedef struct fd_stake_flags_off fd_stake_flags_off_t;
 #define FD_STAKE_FLAGS_OFF_FOOTPRINT sizeof(fd_stake_flags_off_t)
 #define FD_STAKE_FLAGS_OFF_ALIGN (8UL)
 
+/* fd_stake_flags_view_t reads the fields of an encoded fd_stake_flags_t in place */
+struct fd_stake_flags_view {
+  uchar const * data;
+  ulong         data_sz; /* Encoded size */
+};
+typedef struct fd_stake_flags_view fd_stake_flags_view_t;
+
 /* https://github.com/firedancer-io/solana/blob/v1.17/sdk/program/src/stake/state.rs#L135 */
 /* Encoded Size: Fixed (120 bytes) */
 struct __attribute__((aligned(8UL))) fd_stake_state_v2_initialized {
@@ -3423,6 +3500,13 @@ typedef struct fd_stake_state_v2_initialized_off fd_stake_state_v2_initialized_o
 #define FD_STAKE_STATE_V2_INITIALIZED_OFF_FOOTPRINT sizeof(fd_stake_state_v2_initialized_off_t)
 #define FD_STAKE_STATE_V2_INITIALIZED_OFF_ALIGN (8UL)
 
+/* fd_stake_state_v2_initialized_view_t reads the fields of an encoded fd_stake_state_v2_initialized_t in place */
+struct fd_stake_state_v2_initialized_view {
+  uchar const * data;
+  ulong         data_sz; /* Encoded size */
+};
+typedef struct fd_stake_state_v2_initialized_view fd_stake_state_v2_initialized_view_t;
+
 /* https://github.com/firedancer-io/solana/blob/v1.17/sdk/program/src/stake/state.rs#L136 */
 /* Encoded Size: Fixed (193 bytes) */
 struct __attribute__((aligned(8UL))) fd_stake_state_v2_stake {
@@ -3443,6 +3527,13 @@ typedef struct fd_stake_state_v2_stake_off fd_stake_state_v2_stake_off_t;
 #define FD_STAKE_STATE_V2_STAKE_OFF_FOOTPRINT sizeof(fd_stake_state_v2_stake_off_t)
 #define FD_STAKE_STATE_V2_STAKE_OFF_ALIGN (8UL)
 
+/* fd_stake_state_v2_stake_view_t reads the fields of an encoded fd_stake_state_v2_stake_t in place */
+struct fd_stake_state_v2_stake_view {
+  uchar const * data;
+  ulong         data_sz; /* Encoded size */
+};
+typedef struct fd_stake_state_v2_stake_view fd_stake_state_v2_stake_view_t;
+
 union fd_stake_state_v2_inner {
   fd_stake_state_v2_initialized_t initialized;
   fd_stake_state_v2_stake_t stake;
@@ -3458,6 +3549,13 @@ typedef struct fd_stake_state_v2 fd_stake_state_v2_t;
 #define FD_STAKE_STATE_V2_FOOTPRINT sizeof(fd_stake_state_v2_t)
 #define FD_STAKE_STATE_V2_ALIGN (8UL)
 
+/* fd_stake_state_v2_view_t reads the fields of an encoded fd_stake_state_v2_t in place */
+struct fd_stake_state_v2_view {
+  uchar const * data;
+  ulong         data_sz; /* Encoded size */
+};
+typedef struct fd_stake_state_v2_view fd_stake_state_v2_view_t;
+
 /* https://github.com/solana-labs/solana/blob/8f2c8b8388a495d2728909e30460aa40dcc5d733/sdk/program/src/nonce/state/current.rs#L17 */
 /* Encoded Size: Fixed (72 bytes) */
 struct __attribute__((aligned(8UL))) fd_nonce_data {
@@ -5538,6 +5636,7 @@ ulong fd_hash_age_footprint( void );
 ulong fd_hash_age_align( void );
 int fd_hash_age_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_hash_age_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_hash_age_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_hash_age_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_hash_age_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5550,6 +5649,7 @@ ulong fd_hash_hash_age_pair_footprint( void );
 ulong fd_hash_hash_age_pair_align( void );
 int fd_hash_hash_age_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_hash_hash_age_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_hash_hash_age_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_hash_hash_age_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_hash_hash_age_pair_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5586,6 +5686,7 @@ ulong fd_fee_rate_governor_footprint( void );
 ulong fd_fee_rate_governor_align( void );
 int fd_fee_rate_governor_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_fee_rate_governor_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_fee_rate_governor_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_fee_rate_governor_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_fee_rate_governor_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5598,6 +5699,7 @@ ulong fd_slot_pair_footprint( void );
 ulong fd_slot_pair_align( void );
 int fd_slot_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_slot_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_slot_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_slot_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_slot_pair_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5622,6 +5724,7 @@ ulong fd_inflation_footprint( void );
 ulong fd_inflation_align( void );
 int fd_inflation_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_inflation_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_inflation_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_inflation_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_inflation_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5634,6 +5737,7 @@ ulong fd_rent_footprint( void );
 ulong fd_rent_align( void );
 int fd_rent_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_rent_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_rent_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_rent_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_rent_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5646,6 +5750,7 @@ ulong fd_epoch_schedule_footprint( void );
 ulong fd_epoch_schedule_align( void );
 int fd_epoch_schedule_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_epoch_schedule_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_epoch_schedule_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_epoch_schedule_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_epoch_schedule_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5658,6 +5763,7 @@ ulong fd_rent_collector_footprint( void );
 ulong fd_rent_collector_align( void );
 int fd_rent_collector_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_rent_collector_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_rent_collector_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_rent_collector_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_rent_collector_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5670,6 +5776,7 @@ ulong fd_stake_history_entry_footprint( void );
 ulong fd_stake_history_entry_align( void );
 int fd_stake_history_entry_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_stake_history_entry_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_history_entry_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_stake_history_entry_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_stake_history_entry_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5694,6 +5801,7 @@ ulong fd_solana_account_footprint( void );
 ulong fd_solana_account_align( void );
 int fd_solana_account_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_solana_account_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_solana_account_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_solana_account_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_solana_account_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5706,6 +5814,7 @@ ulong fd_vote_accounts_pair_footprint( void );
 ulong fd_vote_accounts_pair_align( void );
 int fd_vote_accounts_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_vote_accounts_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_accounts_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_vote_accounts_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_vote_accounts_pair_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5718,6 +5827,7 @@ ulong fd_vote_accounts_pair_serializable_footprint( void );
 ulong fd_vote_accounts_pair_serializable_align( void );
 int fd_vote_accounts_pair_serializable_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_vote_accounts_pair_serializable_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_accounts_pair_serializable_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_vote_accounts_pair_serializable_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_vote_accounts_pair_serializable_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5754,6 +5864,7 @@ ulong fd_account_keys_pair_footprint( void );
 ulong fd_account_keys_pair_align( void );
 int fd_account_keys_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_account_keys_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_account_keys_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_account_keys_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_account_keys_pair_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5778,6 +5889,7 @@ ulong fd_stake_weight_footprint( void );
 ulong fd_stake_weight_align( void );
 int fd_stake_weight_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_stake_weight_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_weight_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_stake_weight_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_stake_weight_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5802,9 +5914,17 @@ ulong fd_delegation_footprint( void );
 ulong fd_delegation_align( void );
 int fd_delegation_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_delegation_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_delegation_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_delegation_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_delegation_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
+int fd_delegation_view( fd_delegation_view_t * view, uchar const * data, ulong data_sz );
+static inline fd_pubkey_t const * fd_delegation_view_voter_pubkey( fd_delegation_view_t const * view ) { return (fd_pubkey_t const *)( view->data + 0UL ); }
+static inline ulong fd_delegation_view_stake( fd_delegation_view_t const * view ) { return FD_LOAD( ulong, view->data + 32UL ); }
+static inline ulong fd_delegation_view_activation_epoch( fd_delegation_view_t const * view ) { return FD_LOAD( ulong, view->data + 40UL ); }
+static inline ulong fd_delegation_view_deactivation_epoch( fd_delegation_view_t const * view ) { return FD_LOAD( ulong, view->data + 48UL ); }
+static inline double fd_delegation_view_warmup_cooldown_rate( fd_delegation_view_t const * view ) { return FD_LOAD( double, view->data + 56UL ); }
+
 void fd_delegation_pair_new( fd_delegation_pair_t * self );
 int fd_delegation_pair_encode( fd_delegation_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_delegation_pair_destroy( fd_delegation_pair_t * self );
@@ -5814,6 +5934,7 @@ ulong fd_delegation_pair_footprint( void );
 ulong fd_delegation_pair_align( void );
 int fd_delegation_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_delegation_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_delegation_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_delegation_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_delegation_pair_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5826,9 +5947,17 @@ ulong fd_stake_footprint( void );
 ulong fd_stake_align( void );
 int fd_stake_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_stake_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_stake_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_stake_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
+int fd_stake_view( fd_stake_view_t * view, uchar const * data, ulong data_sz );
+static inline fd_delegation_view_t fd_stake_view_delegation( fd_stake_view_t const * view ) {
+  fd_delegation_view_t sub = { .data = view->data + 0UL, .data_sz = 64UL };
+  return sub;
+}
+static inline ulong fd_stake_view_credits_observed( fd_stake_view_t const * view ) { return FD_LOAD( ulong, view->data + 64UL ); }
+
 void fd_stake_pair_new( fd_stake_pair_t * self );
 int fd_stake_pair_encode( fd_stake_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_pair_destroy( fd_stake_pair_t * self );
@@ -5838,6 +5967,7 @@ ulong fd_stake_pair_footprint( void );
 ulong fd_stake_pair_align( void );
 int fd_stake_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_stake_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_stake_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_stake_pair_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5850,6 +5980,7 @@ ulong fd_stakes_footprint( void );
 ulong fd_stakes_align( void );
 int fd_stakes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_stakes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stakes_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_stakes_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_stakes_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5862,6 +5993,7 @@ ulong fd_stakes_serializable_footprint( void );
 ulong fd_stakes_serializable_align( void );
 int fd_stakes_serializable_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_stakes_serializable_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stakes_serializable_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_stakes_serializable_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_stakes_serializable_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5874,6 +6006,7 @@ ulong fd_stakes_stake_footprint( void );
 ulong fd_stakes_stake_align( void );
 int fd_stakes_stake_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_stakes_stake_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stakes_stake_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_stakes_stake_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_stakes_stake_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5886,6 +6019,7 @@ ulong fd_bank_incremental_snapshot_persistence_footprint( void );
 ulong fd_bank_incremental_snapshot_persistence_align( void );
 int fd_bank_incremental_snapshot_persistence_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_bank_incremental_snapshot_persistence_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_bank_incremental_snapshot_persistence_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_bank_incremental_snapshot_persistence_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_bank_incremental_snapshot_persistence_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5910,6 +6044,7 @@ ulong fd_pubkey_node_vote_accounts_pair_footprint( void );
 ulong fd_pubkey_node_vote_accounts_pair_align( void );
 int fd_pubkey_node_vote_accounts_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_pubkey_node_vote_accounts_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_pubkey_node_vote_accounts_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_pubkey_node_vote_accounts_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_pubkey_node_vote_accounts_pair_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5922,6 +6057,7 @@ ulong fd_pubkey_pubkey_pair_footprint( void );
 ulong fd_pubkey_pubkey_pair_align( void );
 int fd_pubkey_pubkey_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_pubkey_pubkey_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_pubkey_pubkey_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_pubkey_pubkey_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_pubkey_pubkey_pair_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5958,6 +6094,7 @@ ulong fd_pubkey_u64_pair_footprint( void );
 ulong fd_pubkey_u64_pair_align( void );
 int fd_pubkey_u64_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_pubkey_u64_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_pubkey_u64_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_pubkey_u64_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_pubkey_u64_pair_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5982,6 +6119,7 @@ ulong fd_deserializable_versioned_bank_footprint( void );
 ulong fd_deserializable_versioned_bank_align( void );
 int fd_deserializable_versioned_bank_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_deserializable_versioned_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_deserializable_versioned_bank_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_deserializable_versioned_bank_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_deserializable_versioned_bank_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -5994,6 +6132,7 @@ ulong fd_serializable_versioned_bank_footprint( void );
 ulong fd_serializable_versioned_bank_align( void );
 int fd_serializable_versioned_bank_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_serializable_versioned_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_serializable_versioned_bank_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_serializable_versioned_bank_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_serializable_versioned_bank_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6006,6 +6145,7 @@ ulong fd_bank_hash_stats_footprint( void );
 ulong fd_bank_hash_stats_align( void );
 int fd_bank_hash_stats_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_bank_hash_stats_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_bank_hash_stats_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_bank_hash_stats_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_bank_hash_stats_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6018,6 +6158,7 @@ ulong fd_bank_hash_info_footprint( void );
 ulong fd_bank_hash_info_align( void );
 int fd_bank_hash_info_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_bank_hash_info_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_bank_hash_info_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_bank_hash_info_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_bank_hash_info_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6030,6 +6171,7 @@ ulong fd_slot_map_pair_footprint( void );
 ulong fd_slot_map_pair_align( void );
 int fd_slot_map_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_slot_map_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_slot_map_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_slot_map_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_slot_map_pair_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6042,6 +6184,7 @@ ulong fd_snapshot_acc_vec_footprint( void );
 ulong fd_snapshot_acc_vec_align( void );
 int fd_snapshot_acc_vec_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_snapshot_acc_vec_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_snapshot_acc_vec_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_snapshot_acc_vec_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_snapshot_acc_vec_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6089,6 +6232,7 @@ ulong fd_solana_accounts_db_fields_footprint( void );
 ulong fd_solana_accounts_db_fields_align( void );
 int fd_solana_accounts_db_fields_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_solana_accounts_db_fields_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_solana_accounts_db_fields_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_solana_accounts_db_fields_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_solana_accounts_db_fields_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6142,6 +6286,7 @@ ulong fd_reward_info_footprint( void );
 ulong fd_reward_info_align( void );
 int fd_reward_info_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_reward_info_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_reward_info_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_reward_info_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_reward_info_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6190,6 +6335,7 @@ ulong fd_rust_duration_footprint( void );
 ulong fd_rust_duration_align( void );
 int fd_rust_duration_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_rust_duration_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_rust_duration_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_rust_duration_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_rust_duration_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6202,6 +6348,7 @@ ulong fd_poh_config_footprint( void );
 ulong fd_poh_config_align( void );
 int fd_poh_config_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_poh_config_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_poh_config_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_poh_config_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_poh_config_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6214,6 +6361,7 @@ ulong fd_string_pubkey_pair_footprint( void );
 ulong fd_string_pubkey_pair_align( void );
 int fd_string_pubkey_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_string_pubkey_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_string_pubkey_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_string_pubkey_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_string_pubkey_pair_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6226,6 +6374,7 @@ ulong fd_pubkey_account_pair_footprint( void );
 ulong fd_pubkey_account_pair_align( void );
 int fd_pubkey_account_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_pubkey_account_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_pubkey_account_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_pubkey_account_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_pubkey_account_pair_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6238,6 +6387,7 @@ ulong fd_genesis_solana_footprint( void );
 ulong fd_genesis_solana_align( void );
 int fd_genesis_solana_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_genesis_solana_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_genesis_solana_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_genesis_solana_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_genesis_solana_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6250,6 +6400,7 @@ ulong fd_sol_sysvar_clock_footprint( void );
 ulong fd_sol_sysvar_clock_align( void );
 int fd_sol_sysvar_clock_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_sol_sysvar_clock_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_sol_sysvar_clock_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_sol_sysvar_clock_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_sol_sysvar_clock_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6274,6 +6425,7 @@ ulong fd_vote_lockout_footprint( void );
 ulong fd_vote_lockout_align( void );
 int fd_vote_lockout_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_vote_lockout_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_lockout_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_vote_lockout_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_vote_lockout_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6298,6 +6450,7 @@ ulong fd_vote_authorized_voter_footprint( void );
 ulong fd_vote_authorized_voter_align( void );
 int fd_vote_authorized_voter_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_vote_authorized_voter_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_authorized_voter_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_vote_authorized_voter_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_vote_authorized_voter_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6310,6 +6463,7 @@ ulong fd_vote_prior_voter_footprint( void );
 ulong fd_vote_prior_voter_align( void );
 int fd_vote_prior_voter_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_vote_prior_voter_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_prior_voter_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_vote_prior_voter_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_vote_prior_voter_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6322,6 +6476,7 @@ ulong fd_vote_prior_voter_0_23_5_footprint( void );
 ulong fd_vote_prior_voter_0_23_5_align( void );
 int fd_vote_prior_voter_0_23_5_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_vote_prior_voter_0_23_5_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_prior_voter_0_23_5_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_vote_prior_voter_0_23_5_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_vote_prior_voter_0_23_5_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6334,6 +6489,7 @@ ulong fd_vote_epoch_credits_footprint( void );
 ulong fd_vote_epoch_credits_align( void );
 int fd_vote_epoch_credits_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_vote_epoch_credits_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_epoch_credits_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_vote_epoch_credits_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_vote_epoch_credits_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6346,9 +6502,14 @@ ulong fd_vote_block_timestamp_footprint( void );
 ulong fd_vote_block_timestamp_align( void );
 int fd_vote_block_timestamp_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_vote_block_timestamp_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_block_timestamp_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_vote_block_timestamp_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_vote_block_timestamp_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
+int fd_vote_block_timestamp_view( fd_vote_block_timestamp_view_t * view, uchar const * data, ulong data_sz );
+static inline ulong fd_vote_block_timestamp_view_slot( fd_vote_block_timestamp_view_t const * view ) { return FD_LOAD( ulong, view->data + 0UL ); }
+static inline long fd_vote_block_timestamp_view_timestamp( fd_vote_block_timestamp_view_t const * view ) { return FD_LOAD( long, view->data + 8UL ); }
+
 void fd_vote_prior_voters_new( fd_vote_prior_voters_t * self );
 int fd_vote_prior_voters_encode( fd_vote_prior_voters_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_prior_voters_destroy( fd_vote_prior_voters_t * self );
@@ -6358,6 +6519,7 @@ ulong fd_vote_prior_voters_footprint( void );
 ulong fd_vote_prior_voters_align( void );
 int fd_vote_prior_voters_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_vote_prior_voters_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_prior_voters_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_vote_prior_voters_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_vote_prior_voters_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6370,6 +6532,7 @@ ulong fd_vote_prior_voters_0_23_5_footprint( void );
 ulong fd_vote_prior_voters_0_23_5_align( void );
 int fd_vote_prior_voters_0_23_5_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_vote_prior_voters_0_23_5_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_prior_voters_0_23_5_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_vote_prior_voters_0_23_5_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_vote_prior_voters_0_23_5_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6382,6 +6545,7 @@ ulong fd_landed_vote_footprint( void );
 ulong fd_landed_vote_align( void );
 int fd_landed_vote_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_landed_vote_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_landed_vote_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_landed_vote_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_landed_vote_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6394,9 +6558,21 @@ ulong fd_vote_state_0_23_5_footprint( void );
 ulong fd_vote_state_0_23_5_align( void );
 int fd_vote_state_0_23_5_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_vote_state_0_23_5_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_state_0_23_5_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_vote_state_0_23_5_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_vote_state_0_23_5_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
+int fd_vote_state_0_23_5_view( fd_vote_state_0_23_5_view_t * view, uchar const * data, ulong data_sz );
+static inline fd_pubkey_t const * fd_vote_state_0_23_5_view_node_pubkey( fd_vote_state_0_23_5_view_t const * view ) { return (fd_pubkey_t const *)( view->data + 0UL ); }
+static inline fd_pubkey_t const * fd_vote_state_0_23_5_view_authorized_voter( fd_vote_state_0_23_5_view_t const * view ) { return (fd_pubkey_t const *)( view->data + 32UL ); }
+static inline ulong fd_vote_state_0_23_5_view_authorized_voter_epoch( fd_vote_state_0_23_5_view_t const * view ) { return FD_LOAD( ulong, view->data + 64UL ); }
+static inline fd_pubkey_t const * fd_vote_state_0_23_5_view_authorized_withdrawer( fd_vote_state_0_23_5_view_t const * view ) { return (fd_pubkey_t const *)( view->data + 1872UL ); }
+static inline uchar fd_vote_state_0_23_5_view_commission( fd_vote_state_0_23_5_view_t const * view ) { return FD_LOAD( uchar, view->data + 1904UL ); }
+static inline fd_vote_block_timestamp_view_t fd_vote_state_0_23_5_view_last_timestamp( fd_vote_state_0_23_5_view_t const * view ) {
+  fd_vote_block_timestamp_view_t sub = { .data = view->data + view->data_sz - 16UL, .data_sz = 16UL };
+  return sub;
+}
+
 void fd_vote_authorized_voters_new( fd_vote_authorized_voters_t * self );
 int fd_vote_authorized_voters_encode( fd_vote_authorized_voters_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_authorized_voters_destroy( fd_vote_authorized_voters_t * self );
@@ -6418,9 +6594,19 @@ ulong fd_vote_state_1_14_11_footprint( void );
 ulong fd_vote_state_1_14_11_align( void );
 int fd_vote_state_1_14_11_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_vote_state_1_14_11_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_state_1_14_11_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_vote_state_1_14_11_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_vote_state_1_14_11_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
+int fd_vote_state_1_14_11_view( fd_vote_state_1_14_11_view_t * view, uchar const * data, ulong data_sz );
+static inline fd_pubkey_t const * fd_vote_state_1_14_11_view_node_pubkey( fd_vote_state_1_14_11_view_t const * view ) { return (fd_pubkey_t const *)( view->data + 0UL ); }
+static inline fd_pubkey_t const * fd_vote_state_1_14_11_view_authorized_withdrawer( fd_vote_state_1_14_11_view_t const * view ) { return (fd_pubkey_t const *)( view->data + 32UL ); }
+static inline uchar fd_vote_state_1_14_11_view_commission( fd_vote_state_1_14_11_view_t const * view ) { return FD_LOAD( uchar, view->data + 64UL ); }
+static inline fd_vote_block_timestamp_view_t fd_vote_state_1_14_11_view_last_timestamp( fd_vote_state_1_14_11_view_t const * view ) {
+  fd_vote_block_timestamp_view_t sub = { .data = view->data + view->data_sz - 16UL, .data_sz = 16UL };
+  return sub;
+}
+
 void fd_vote_state_new( fd_vote_state_t * self );
 int fd_vote_state_encode( fd_vote_state_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_state_destroy( fd_vote_state_t * self );
@@ -6430,9 +6616,19 @@ ulong fd_vote_state_footprint( void );
 ulong fd_vote_state_align( void );
 int fd_vote_state_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_vote_state_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_state_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_vote_state_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_vote_state_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
+int fd_vote_state_view( fd_vote_state_view_t * view, uchar const * data, ulong data_sz );
+static inline fd_pubkey_t const * fd_vote_state_view_node_pubkey( fd_vote_state_view_t const * view ) { return (fd_pubkey_t const *)( view->data + 0UL ); }
+static inline fd_pubkey_t const * fd_vote_state_view_authorized_withdrawer( fd_vote_state_view_t const * view ) { return (fd_pubkey_t const *)( view->data + 32UL ); }
+static inline uchar fd_vote_state_view_commission( fd_vote_state_view_t const * view ) { return FD_LOAD( uchar, view->data + 64UL ); }
+static inline fd_vote_block_timestamp_view_t fd_vote_state_view_last_timestamp( fd_vote_state_view_t const * view ) {
+  fd_vote_block_timestamp_view_t sub = { .data = view->data + view->data_sz - 16UL, .data_sz = 16UL };
+  return sub;
+}
+
 void fd_vote_state_versioned_new_disc( fd_vote_state_versioned_t * self, uint discriminant );
 void fd_vote_state_versioned_new( fd_vote_state_versioned_t * self );
 int fd_vote_state_versioned_encode( fd_vote_state_versioned_t const * self, fd_bincode_encode_ctx_t * ctx );
@@ -6454,6 +6650,21 @@ fd_vote_state_versioned_enum_v0_23_5 = 0,
 fd_vote_state_versioned_enum_v1_14_11 = 1,
 fd_vote_state_versioned_enum_current = 2,
 };
+int fd_vote_state_versioned_view( fd_vote_state_versioned_view_t * view, uchar const * data, ulong data_sz );
+static inline uint fd_vote_state_versioned_view_discriminant( fd_vote_state_versioned_view_t const * view ) { return FD_LOAD( uint, view->data ); }
+static inline fd_vote_state_0_23_5_view_t fd_vote_state_versioned_view_v0_23_5( fd_vote_state_versioned_view_t const * view ) {
+  fd_vote_state_0_23_5_view_t sub = { .data = view->data + sizeof(uint), .data_sz = view->data_sz - sizeof(uint) };
+  return sub;
+}
+static inline fd_vote_state_1_14_11_view_t fd_vote_state_versioned_view_v1_14_11( fd_vote_state_versioned_view_t const * view ) {
+  fd_vote_state_1_14_11_view_t sub = { .data = view->data + sizeof(uint), .data_sz = view->data_sz - sizeof(uint) };
+  return sub;
+}
+static inline fd_vote_state_view_t fd_vote_state_versioned_view_current( fd_vote_state_versioned_view_t const * view ) {
+  fd_vote_state_view_t sub = { .data = view->data + sizeof(uint), .data_sz = view->data_sz - sizeof(uint) };
+  return sub;
+}
+
 void fd_vote_state_update_new( fd_vote_state_update_t * self );
 int fd_vote_state_update_encode( fd_vote_state_update_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_state_update_destroy( fd_vote_state_update_t * self );
@@ -6463,6 +6674,7 @@ ulong fd_vote_state_update_footprint( void );
 ulong fd_vote_state_update_align( void );
 int fd_vote_state_update_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_vote_state_update_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_state_update_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_vote_state_update_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_vote_state_update_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6475,6 +6687,7 @@ ulong fd_compact_vote_state_update_footprint( void );
 ulong fd_compact_vote_state_update_align( void );
 int fd_compact_vote_state_update_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_compact_vote_state_update_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_compact_vote_state_update_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_compact_vote_state_update_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_compact_vote_state_update_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6487,6 +6700,7 @@ ulong fd_compact_vote_state_update_switch_footprint( void );
 ulong fd_compact_vote_state_update_switch_align( void );
 int fd_compact_vote_state_update_switch_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_compact_vote_state_update_switch_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_compact_vote_state_update_switch_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_compact_vote_state_update_switch_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_compact_vote_state_update_switch_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6499,6 +6713,7 @@ ulong fd_compact_tower_sync_footprint( void );
 ulong fd_compact_tower_sync_align( void );
 int fd_compact_tower_sync_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_compact_tower_sync_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_compact_tower_sync_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_compact_tower_sync_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_compact_tower_sync_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6523,6 +6738,7 @@ ulong fd_tower_sync_switch_footprint( void );
 ulong fd_tower_sync_switch_align( void );
 int fd_tower_sync_switch_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_tower_sync_switch_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_tower_sync_switch_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_tower_sync_switch_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_tower_sync_switch_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6571,6 +6787,7 @@ ulong fd_slot_hash_footprint( void );
 ulong fd_slot_hash_align( void );
 int fd_slot_hash_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_slot_hash_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_slot_hash_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_slot_hash_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_slot_hash_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6595,6 +6812,7 @@ ulong fd_block_block_hash_entry_footprint( void );
 ulong fd_block_block_hash_entry_align( void );
 int fd_block_block_hash_entry_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_block_block_hash_entry_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_block_block_hash_entry_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_block_block_hash_entry_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_block_block_hash_entry_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6619,6 +6837,7 @@ ulong fd_slot_meta_footprint( void );
 ulong fd_slot_meta_align( void );
 int fd_slot_meta_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_slot_meta_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_slot_meta_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_slot_meta_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_slot_meta_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6631,6 +6850,7 @@ ulong fd_clock_timestamp_vote_footprint( void );
 ulong fd_clock_timestamp_vote_align( void );
 int fd_clock_timestamp_vote_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_clock_timestamp_vote_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_clock_timestamp_vote_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_clock_timestamp_vote_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_clock_timestamp_vote_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6655,6 +6875,7 @@ ulong fd_sysvar_fees_footprint( void );
 ulong fd_sysvar_fees_align( void );
 int fd_sysvar_fees_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_sysvar_fees_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_sysvar_fees_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_sysvar_fees_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_sysvar_fees_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6667,6 +6888,7 @@ ulong fd_sysvar_epoch_rewards_footprint( void );
 ulong fd_sysvar_epoch_rewards_align( void );
 int fd_sysvar_epoch_rewards_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_sysvar_epoch_rewards_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_sysvar_epoch_rewards_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_sysvar_epoch_rewards_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_sysvar_epoch_rewards_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6679,6 +6901,7 @@ ulong fd_config_keys_pair_footprint( void );
 ulong fd_config_keys_pair_align( void );
 int fd_config_keys_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_config_keys_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_config_keys_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_config_keys_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_config_keys_pair_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6691,6 +6914,7 @@ ulong fd_stake_config_footprint( void );
 ulong fd_stake_config_align( void );
 int fd_stake_config_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_stake_config_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_config_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_stake_config_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_stake_config_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6703,6 +6927,7 @@ ulong fd_feature_entry_footprint( void );
 ulong fd_feature_entry_align( void );
 int fd_feature_entry_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_feature_entry_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_feature_entry_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_feature_entry_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_feature_entry_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6715,6 +6940,7 @@ ulong fd_firedancer_bank_footprint( void );
 ulong fd_firedancer_bank_align( void );
 int fd_firedancer_bank_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_firedancer_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_firedancer_bank_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_firedancer_bank_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_firedancer_bank_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6750,6 +6976,7 @@ ulong fd_epoch_bank_footprint( void );
 ulong fd_epoch_bank_align( void );
 int fd_epoch_bank_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_epoch_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_epoch_bank_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_epoch_bank_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_epoch_bank_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6762,6 +6989,7 @@ ulong fd_slot_bank_footprint( void );
 ulong fd_slot_bank_align( void );
 int fd_slot_bank_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_slot_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_slot_bank_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_slot_bank_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_slot_bank_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6774,6 +7002,7 @@ ulong fd_prev_epoch_inflation_rewards_footprint( void );
 ulong fd_prev_epoch_inflation_rewards_align( void );
 int fd_prev_epoch_inflation_rewards_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_prev_epoch_inflation_rewards_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_prev_epoch_inflation_rewards_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_prev_epoch_inflation_rewards_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_prev_epoch_inflation_rewards_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6786,6 +7015,7 @@ ulong fd_vote_footprint( void );
 ulong fd_vote_align( void );
 int fd_vote_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_vote_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_vote_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_vote_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6798,6 +7028,7 @@ ulong fd_vote_init_footprint( void );
 ulong fd_vote_init_align( void );
 int fd_vote_init_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_vote_init_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_init_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_vote_init_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_vote_init_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6829,6 +7060,7 @@ ulong fd_vote_authorize_pubkey_footprint( void );
 ulong fd_vote_authorize_pubkey_align( void );
 int fd_vote_authorize_pubkey_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_vote_authorize_pubkey_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_authorize_pubkey_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_vote_authorize_pubkey_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_vote_authorize_pubkey_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6841,6 +7073,7 @@ ulong fd_vote_switch_footprint( void );
 ulong fd_vote_switch_align( void );
 int fd_vote_switch_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_vote_switch_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_switch_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_vote_switch_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_vote_switch_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6853,6 +7086,7 @@ ulong fd_update_vote_state_switch_footprint( void );
 ulong fd_update_vote_state_switch_align( void );
 int fd_update_vote_state_switch_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_update_vote_state_switch_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_update_vote_state_switch_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_update_vote_state_switch_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_update_vote_state_switch_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6865,6 +7099,7 @@ ulong fd_vote_authorize_with_seed_args_footprint( void );
 ulong fd_vote_authorize_with_seed_args_align( void );
 int fd_vote_authorize_with_seed_args_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_vote_authorize_with_seed_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_authorize_with_seed_args_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_vote_authorize_with_seed_args_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_vote_authorize_with_seed_args_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6877,6 +7112,7 @@ ulong fd_vote_authorize_checked_with_seed_args_footprint( void );
 ulong fd_vote_authorize_checked_with_seed_args_align( void );
 int fd_vote_authorize_checked_with_seed_args_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_vote_authorize_checked_with_seed_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_authorize_checked_with_seed_args_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_vote_authorize_checked_with_seed_args_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_vote_authorize_checked_with_seed_args_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6936,6 +7172,7 @@ ulong fd_system_program_instruction_create_account_footprint( void );
 ulong fd_system_program_instruction_create_account_align( void );
 int fd_system_program_instruction_create_account_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_system_program_instruction_create_account_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_system_program_instruction_create_account_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_system_program_instruction_create_account_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_system_program_instruction_create_account_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6948,6 +7185,7 @@ ulong fd_system_program_instruction_create_account_with_seed_footprint( void );
 ulong fd_system_program_instruction_create_account_with_seed_align( void );
 int fd_system_program_instruction_create_account_with_seed_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_system_program_instruction_create_account_with_seed_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_system_program_instruction_create_account_with_seed_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_system_program_instruction_create_account_with_seed_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_system_program_instruction_create_account_with_seed_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6960,6 +7198,7 @@ ulong fd_system_program_instruction_allocate_with_seed_footprint( void );
 ulong fd_system_program_instruction_allocate_with_seed_align( void );
 int fd_system_program_instruction_allocate_with_seed_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_system_program_instruction_allocate_with_seed_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_system_program_instruction_allocate_with_seed_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_system_program_instruction_allocate_with_seed_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_system_program_instruction_allocate_with_seed_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6972,6 +7211,7 @@ ulong fd_system_program_instruction_assign_with_seed_footprint( void );
 ulong fd_system_program_instruction_assign_with_seed_align( void );
 int fd_system_program_instruction_assign_with_seed_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_system_program_instruction_assign_with_seed_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_system_program_instruction_assign_with_seed_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_system_program_instruction_assign_with_seed_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_system_program_instruction_assign_with_seed_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -6984,6 +7224,7 @@ ulong fd_system_program_instruction_transfer_with_seed_footprint( void );
 ulong fd_system_program_instruction_transfer_with_seed_align( void );
 int fd_system_program_instruction_transfer_with_seed_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_system_program_instruction_transfer_with_seed_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_system_program_instruction_transfer_with_seed_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_system_program_instruction_transfer_with_seed_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_system_program_instruction_transfer_with_seed_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7070,9 +7311,14 @@ ulong fd_stake_authorized_footprint( void );
 ulong fd_stake_authorized_align( void );
 int fd_stake_authorized_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_stake_authorized_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_authorized_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_stake_authorized_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_stake_authorized_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
+int fd_stake_authorized_view( fd_stake_authorized_view_t * view, uchar const * data, ulong data_sz );
+static inline fd_pubkey_t const * fd_stake_authorized_view_staker( fd_stake_authorized_view_t const * view ) { return (fd_pubkey_t const *)( view->data + 0UL ); }
+static inline fd_pubkey_t const * fd_stake_authorized_view_withdrawer( fd_stake_authorized_view_t const * view ) { return (fd_pubkey_t const *)( view->data + 32UL ); }
+
 void fd_stake_lockup_new( fd_stake_lockup_t * self );
 int fd_stake_lockup_encode( fd_stake_lockup_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_lockup_destroy( fd_stake_lockup_t * self );
@@ -7082,9 +7328,15 @@ ulong fd_stake_lockup_footprint( void );
 ulong fd_stake_lockup_align( void );
 int fd_stake_lockup_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_stake_lockup_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_lockup_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_stake_lockup_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_stake_lockup_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
+int fd_stake_lockup_view( fd_stake_lockup_view_t * view, uchar const * data, ulong data_sz );
+static inline long fd_stake_lockup_view_unix_timestamp( fd_stake_lockup_view_t const * view ) { return FD_LOAD( long, view->data + 0UL ); }
+static inline ulong fd_stake_lockup_view_epoch( fd_stake_lockup_view_t const * view ) { return FD_LOAD( ulong, view->data + 8UL ); }
+static inline fd_pubkey_t const * fd_stake_lockup_view_custodian( fd_stake_lockup_view_t const * view ) { return (fd_pubkey_t const *)( view->data + 16UL ); }
+
 void fd_stake_instruction_initialize_new( fd_stake_instruction_initialize_t * self );
 int fd_stake_instruction_initialize_encode( fd_stake_instruction_initialize_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_instruction_initialize_destroy( fd_stake_instruction_initialize_t * self );
@@ -7094,6 +7346,7 @@ ulong fd_stake_instruction_initialize_footprint( void );
 ulong fd_stake_instruction_initialize_align( void );
 int fd_stake_instruction_initialize_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_stake_instruction_initialize_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_instruction_initialize_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_stake_instruction_initialize_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_stake_instruction_initialize_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7106,6 +7359,7 @@ ulong fd_stake_lockup_custodian_args_footprint( void );
 ulong fd_stake_lockup_custodian_args_align( void );
 int fd_stake_lockup_custodian_args_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_stake_lockup_custodian_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_lockup_custodian_args_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_stake_lockup_custodian_args_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_stake_lockup_custodian_args_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7137,6 +7391,7 @@ ulong fd_stake_instruction_authorize_footprint( void );
 ulong fd_stake_instruction_authorize_align( void );
 int fd_stake_instruction_authorize_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_stake_instruction_authorize_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_instruction_authorize_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_stake_instruction_authorize_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_stake_instruction_authorize_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7149,6 +7404,7 @@ ulong fd_authorize_with_seed_args_footprint( void );
 ulong fd_authorize_with_seed_args_align( void );
 int fd_authorize_with_seed_args_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_authorize_with_seed_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_authorize_with_seed_args_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_authorize_with_seed_args_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_authorize_with_seed_args_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7161,6 +7417,7 @@ ulong fd_authorize_checked_with_seed_args_footprint( void );
 ulong fd_authorize_checked_with_seed_args_align( void );
 int fd_authorize_checked_with_seed_args_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_authorize_checked_with_seed_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_authorize_checked_with_seed_args_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_authorize_checked_with_seed_args_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_authorize_checked_with_seed_args_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7248,9 +7505,21 @@ ulong fd_stake_meta_footprint( void );
 ulong fd_stake_meta_align( void );
 int fd_stake_meta_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_stake_meta_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_meta_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_stake_meta_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_stake_meta_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
+int fd_stake_meta_view( fd_stake_meta_view_t * view, uchar const * data, ulong data_sz );
+static inline ulong fd_stake_meta_view_rent_exempt_reserve( fd_stake_meta_view_t const * view ) { return FD_LOAD( ulong, view->data + 0UL ); }
+static inline fd_stake_authorized_view_t fd_stake_meta_view_authorized( fd_stake_meta_view_t const * view ) {
+  fd_stake_authorized_view_t sub = { .data = view->data + 8UL, .data_sz = 64UL };
+  return sub;
+}
+static inline fd_stake_lockup_view_t fd_stake_meta_view_lockup( fd_stake_meta_view_t const * view ) {
+  fd_stake_lockup_view_t sub = { .data = view->data + 72UL, .data_sz = 48UL };
+  return sub;
+}
+
 void fd_stake_flags_new( fd_stake_flags_t * self );
 int fd_stake_flags_encode( fd_stake_flags_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_flags_destroy( fd_stake_flags_t * self );
@@ -7263,6 +7532,9 @@ int fd_stake_flags_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong
 void * fd_stake_flags_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_stake_flags_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
+int fd_stake_flags_view( fd_stake_flags_view_t * view, uchar const * data, ulong data_sz );
+static inline uchar fd_stake_flags_view_bits( fd_stake_flags_view_t const * view ) { return FD_LOAD( uchar, view->data + 0UL ); }
+
 void fd_stake_state_v2_initialized_new( fd_stake_state_v2_initialized_t * self );
 int fd_stake_state_v2_initialized_encode( fd_stake_state_v2_initialized_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_state_v2_initialized_destroy( fd_stake_state_v2_initialized_t * self );
@@ -7272,9 +7544,16 @@ ulong fd_stake_state_v2_initialized_footprint( void );
 ulong fd_stake_state_v2_initialized_align( void );
 int fd_stake_state_v2_initialized_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_stake_state_v2_initialized_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_state_v2_initialized_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_stake_state_v2_initialized_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_stake_state_v2_initialized_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
+int fd_stake_state_v2_initialized_view( fd_stake_state_v2_initialized_view_t * view, uchar const * data, ulong data_sz );
+static inline fd_stake_meta_view_t fd_stake_state_v2_initialized_view_meta( fd_stake_state_v2_initialized_view_t const * view ) {
+  fd_stake_meta_view_t sub = { .data = view->data + 0UL, .data_sz = 120UL };
+  return sub;
+}
+
 void fd_stake_state_v2_stake_new( fd_stake_state_v2_stake_t * self );
 int fd_stake_state_v2_stake_encode( fd_stake_state_v2_stake_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_state_v2_stake_destroy( fd_stake_state_v2_stake_t * self );
@@ -7284,9 +7563,24 @@ ulong fd_stake_state_v2_stake_footprint( void );
 ulong fd_stake_state_v2_stake_align( void );
 int fd_stake_state_v2_stake_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_stake_state_v2_stake_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_state_v2_stake_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_stake_state_v2_stake_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_stake_state_v2_stake_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
+int fd_stake_state_v2_stake_view( fd_stake_state_v2_stake_view_t * view, uchar const * data, ulong data_sz );
+static inline fd_stake_meta_view_t fd_stake_state_v2_stake_view_meta( fd_stake_state_v2_stake_view_t const * view ) {
+  fd_stake_meta_view_t sub = { .data = view->data + 0UL, .data_sz = 120UL };
+  return sub;
+}
+static inline fd_stake_view_t fd_stake_state_v2_stake_view_stake( fd_stake_state_v2_stake_view_t const * view ) {
+  fd_stake_view_t sub = { .data = view->data + 120UL, .data_sz = 72UL };
+  return sub;
+}
+static inline fd_stake_flags_view_t fd_stake_state_v2_stake_view_stake_flags( fd_stake_state_v2_stake_view_t const * view ) {
+  fd_stake_flags_view_t sub = { .data = view->data + 192UL, .data_sz = 1UL };
+  return sub;
+}
+
 void fd_stake_state_v2_new_disc( fd_stake_state_v2_t * self, uint discriminant );
 void fd_stake_state_v2_new( fd_stake_state_v2_t * self );
 int fd_stake_state_v2_encode( fd_stake_state_v2_t const * self, fd_bincode_encode_ctx_t * ctx );
@@ -7310,6 +7604,17 @@ fd_stake_state_v2_enum_initialized = 1,
 fd_stake_state_v2_enum_stake = 2,
 fd_stake_state_v2_enum_rewards_pool = 3,
 };
+int fd_stake_state_v2_view( fd_stake_state_v2_view_t * view, uchar const * data, ulong data_sz );
+static inline uint fd_stake_state_v2_view_discriminant( fd_stake_state_v2_view_t const * view ) { return FD_LOAD( uint, view->data ); }
+static inline fd_stake_state_v2_initialized_view_t fd_stake_state_v2_view_initialized( fd_stake_state_v2_view_t const * view ) {
+  fd_stake_state_v2_initialized_view_t sub = { .data = view->data + sizeof(uint), .data_sz = view->data_sz - sizeof(uint) };
+  return sub;
+}
+static inline fd_stake_state_v2_stake_view_t fd_stake_state_v2_view_stake( fd_stake_state_v2_view_t const * view ) {
+  fd_stake_state_v2_stake_view_t sub = { .data = view->data + sizeof(uint), .data_sz = view->data_sz - sizeof(uint) };
+  return sub;
+}
+
 void fd_nonce_data_new( fd_nonce_data_t * self );
 int fd_nonce_data_encode( fd_nonce_data_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_nonce_data_destroy( fd_nonce_data_t * self );
@@ -7319,6 +7624,7 @@ ulong fd_nonce_data_footprint( void );
 ulong fd_nonce_data_align( void );
 int fd_nonce_data_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_nonce_data_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_nonce_data_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_nonce_data_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_nonce_data_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7369,6 +7675,7 @@ ulong fd_compute_budget_program_instruction_request_units_deprecated_footprint(
 ulong fd_compute_budget_program_instruction_request_units_deprecated_align( void );
 int fd_compute_budget_program_instruction_request_units_deprecated_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_compute_budget_program_instruction_request_units_deprecated_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_compute_budget_program_instruction_request_units_deprecated_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_compute_budget_program_instruction_request_units_deprecated_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_compute_budget_program_instruction_request_units_deprecated_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7579,6 +7886,7 @@ ulong fd_bpf_upgradeable_loader_state_program_footprint( void );
 ulong fd_bpf_upgradeable_loader_state_program_align( void );
 int fd_bpf_upgradeable_loader_state_program_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_bpf_upgradeable_loader_state_program_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_bpf_upgradeable_loader_state_program_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_bpf_upgradeable_loader_state_program_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_bpf_upgradeable_loader_state_program_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7626,6 +7934,7 @@ ulong fd_loader_v4_state_footprint( void );
 ulong fd_loader_v4_state_align( void );
 int fd_loader_v4_state_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_loader_v4_state_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_loader_v4_state_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_loader_v4_state_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_loader_v4_state_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7638,6 +7947,7 @@ ulong fd_frozen_hash_status_footprint( void );
 ulong fd_frozen_hash_status_align( void );
 int fd_frozen_hash_status_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_frozen_hash_status_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_frozen_hash_status_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_frozen_hash_status_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_frozen_hash_status_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7667,6 +7977,7 @@ ulong fd_lookup_table_meta_footprint( void );
 ulong fd_lookup_table_meta_align( void );
 int fd_lookup_table_meta_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_lookup_table_meta_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_lookup_table_meta_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_lookup_table_meta_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_lookup_table_meta_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7758,6 +8069,7 @@ ulong fd_gossip_ping_footprint( void );
 ulong fd_gossip_ping_align( void );
 int fd_gossip_ping_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_ping_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_ping_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_ping_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_ping_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7789,6 +8101,7 @@ ulong fd_gossip_prune_data_footprint( void );
 ulong fd_gossip_prune_data_align( void );
 int fd_gossip_prune_data_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_prune_data_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_prune_data_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_prune_data_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_prune_data_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7801,6 +8114,7 @@ ulong fd_gossip_prune_sign_data_footprint( void );
 ulong fd_gossip_prune_sign_data_align( void );
 int fd_gossip_prune_sign_data_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_prune_sign_data_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_prune_sign_data_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_prune_sign_data_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_prune_sign_data_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7849,6 +8163,7 @@ ulong fd_gossip_socket_addr_ip6_footprint( void );
 ulong fd_gossip_socket_addr_ip6_align( void );
 int fd_gossip_socket_addr_ip6_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_socket_addr_ip6_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_socket_addr_ip6_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_socket_addr_ip6_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_socket_addr_ip6_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7880,6 +8195,7 @@ ulong fd_gossip_contact_info_v1_footprint( void );
 ulong fd_gossip_contact_info_v1_align( void );
 int fd_gossip_contact_info_v1_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_contact_info_v1_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_contact_info_v1_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_contact_info_v1_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_contact_info_v1_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7892,6 +8208,7 @@ ulong fd_gossip_vote_footprint( void );
 ulong fd_gossip_vote_align( void );
 int fd_gossip_vote_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_vote_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_vote_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_vote_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_vote_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7904,6 +8221,7 @@ ulong fd_gossip_lowest_slot_footprint( void );
 ulong fd_gossip_lowest_slot_align( void );
 int fd_gossip_lowest_slot_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_lowest_slot_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_lowest_slot_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_lowest_slot_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_lowest_slot_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7916,6 +8234,7 @@ ulong fd_gossip_slot_hashes_footprint( void );
 ulong fd_gossip_slot_hashes_align( void );
 int fd_gossip_slot_hashes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_slot_hashes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_slot_hashes_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_slot_hashes_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_slot_hashes_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7928,6 +8247,7 @@ ulong fd_gossip_slots_footprint( void );
 ulong fd_gossip_slots_align( void );
 int fd_gossip_slots_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_slots_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_slots_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_slots_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_slots_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7940,6 +8260,7 @@ ulong fd_gossip_flate2_slots_footprint( void );
 ulong fd_gossip_flate2_slots_align( void );
 int fd_gossip_flate2_slots_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_flate2_slots_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_flate2_slots_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_flate2_slots_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_flate2_slots_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7971,6 +8292,7 @@ ulong fd_gossip_epoch_slots_footprint( void );
 ulong fd_gossip_epoch_slots_align( void );
 int fd_gossip_epoch_slots_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_epoch_slots_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_epoch_slots_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_epoch_slots_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_epoch_slots_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7983,6 +8305,7 @@ ulong fd_gossip_version_v1_footprint( void );
 ulong fd_gossip_version_v1_align( void );
 int fd_gossip_version_v1_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_version_v1_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_version_v1_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_version_v1_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_version_v1_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -7995,6 +8318,7 @@ ulong fd_gossip_version_v2_footprint( void );
 ulong fd_gossip_version_v2_align( void );
 int fd_gossip_version_v2_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_version_v2_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_version_v2_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_version_v2_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_version_v2_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8007,6 +8331,7 @@ ulong fd_gossip_version_v3_footprint( void );
 ulong fd_gossip_version_v3_align( void );
 int fd_gossip_version_v3_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_version_v3_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_version_v3_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_version_v3_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_version_v3_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8019,6 +8344,7 @@ ulong fd_gossip_node_instance_footprint( void );
 ulong fd_gossip_node_instance_align( void );
 int fd_gossip_node_instance_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_node_instance_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_node_instance_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_node_instance_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_node_instance_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8031,6 +8357,7 @@ ulong fd_gossip_duplicate_shred_footprint( void );
 ulong fd_gossip_duplicate_shred_align( void );
 int fd_gossip_duplicate_shred_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_duplicate_shred_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_duplicate_shred_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_duplicate_shred_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_duplicate_shred_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8043,6 +8370,7 @@ ulong fd_gossip_incremental_snapshot_hashes_footprint( void );
 ulong fd_gossip_incremental_snapshot_hashes_align( void );
 int fd_gossip_incremental_snapshot_hashes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_incremental_snapshot_hashes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_incremental_snapshot_hashes_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_incremental_snapshot_hashes_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_incremental_snapshot_hashes_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8055,6 +8383,7 @@ ulong fd_gossip_socket_entry_footprint( void );
 ulong fd_gossip_socket_entry_align( void );
 int fd_gossip_socket_entry_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_socket_entry_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_socket_entry_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_socket_entry_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_socket_entry_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8067,6 +8396,7 @@ ulong fd_gossip_contact_info_v2_footprint( void );
 ulong fd_gossip_contact_info_v2_align( void );
 int fd_gossip_contact_info_v2_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_contact_info_v2_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_contact_info_v2_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_contact_info_v2_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_contact_info_v2_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8158,6 +8488,7 @@ ulong fd_gossip_restart_last_voted_fork_slots_footprint( void );
 ulong fd_gossip_restart_last_voted_fork_slots_align( void );
 int fd_gossip_restart_last_voted_fork_slots_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_restart_last_voted_fork_slots_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_restart_last_voted_fork_slots_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_restart_last_voted_fork_slots_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_restart_last_voted_fork_slots_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8170,6 +8501,7 @@ ulong fd_gossip_restart_heaviest_fork_footprint( void );
 ulong fd_gossip_restart_heaviest_fork_align( void );
 int fd_gossip_restart_heaviest_fork_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_restart_heaviest_fork_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_restart_heaviest_fork_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_restart_heaviest_fork_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_restart_heaviest_fork_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8237,6 +8569,7 @@ ulong fd_crds_filter_footprint( void );
 ulong fd_crds_filter_align( void );
 int fd_crds_filter_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_crds_filter_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_crds_filter_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_crds_filter_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_crds_filter_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8249,6 +8582,7 @@ ulong fd_crds_value_footprint( void );
 ulong fd_crds_value_align( void );
 int fd_crds_value_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_crds_value_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_crds_value_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_crds_value_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_crds_value_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8273,6 +8607,7 @@ ulong fd_gossip_pull_resp_footprint( void );
 ulong fd_gossip_pull_resp_align( void );
 int fd_gossip_pull_resp_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_pull_resp_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_pull_resp_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_pull_resp_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_pull_resp_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8285,6 +8620,7 @@ ulong fd_gossip_push_msg_footprint( void );
 ulong fd_gossip_push_msg_align( void );
 int fd_gossip_push_msg_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_push_msg_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_push_msg_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_push_msg_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_push_msg_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8297,6 +8633,7 @@ ulong fd_gossip_prune_msg_footprint( void );
 ulong fd_gossip_prune_msg_align( void );
 int fd_gossip_prune_msg_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_gossip_prune_msg_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_prune_msg_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_gossip_prune_msg_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_prune_msg_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8336,6 +8673,7 @@ ulong fd_addrlut_create_footprint( void );
 ulong fd_addrlut_create_align( void );
 int fd_addrlut_create_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_addrlut_create_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_addrlut_create_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_addrlut_create_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_addrlut_create_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8385,6 +8723,7 @@ ulong fd_repair_request_header_footprint( void );
 ulong fd_repair_request_header_align( void );
 int fd_repair_request_header_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_repair_request_header_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_repair_request_header_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_repair_request_header_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_repair_request_header_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8397,6 +8736,7 @@ ulong fd_repair_window_index_footprint( void );
 ulong fd_repair_window_index_align( void );
 int fd_repair_window_index_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_repair_window_index_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_repair_window_index_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_repair_window_index_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_repair_window_index_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8409,6 +8749,7 @@ ulong fd_repair_highest_window_index_footprint( void );
 ulong fd_repair_highest_window_index_align( void );
 int fd_repair_highest_window_index_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_repair_highest_window_index_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_repair_highest_window_index_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_repair_highest_window_index_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_repair_highest_window_index_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8421,6 +8762,7 @@ ulong fd_repair_orphan_footprint( void );
 ulong fd_repair_orphan_align( void );
 int fd_repair_orphan_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_repair_orphan_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_repair_orphan_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_repair_orphan_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_repair_orphan_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8433,6 +8775,7 @@ ulong fd_repair_ancestor_hashes_footprint( void );
 ulong fd_repair_ancestor_hashes_align( void );
 int fd_repair_ancestor_hashes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_repair_ancestor_hashes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_repair_ancestor_hashes_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_repair_ancestor_hashes_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_repair_ancestor_hashes_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8744,6 +9087,7 @@ ulong fd_cache_status_footprint( void );
 ulong fd_cache_status_align( void );
 int fd_cache_status_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_cache_status_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_cache_status_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_cache_status_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_cache_status_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8768,6 +9112,7 @@ ulong fd_status_pair_footprint( void );
 ulong fd_status_pair_align( void );
 int fd_status_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_status_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_status_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_status_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_status_pair_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8804,6 +9149,7 @@ ulong fd_pubkey_rewardinfo_pair_footprint( void );
 ulong fd_pubkey_rewardinfo_pair_align( void );
 int fd_pubkey_rewardinfo_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_pubkey_rewardinfo_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_pubkey_rewardinfo_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_pubkey_rewardinfo_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_pubkey_rewardinfo_pair_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8828,6 +9174,7 @@ ulong fd_calculated_stake_points_footprint( void );
 ulong fd_calculated_stake_points_align( void );
 int fd_calculated_stake_points_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_calculated_stake_points_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_calculated_stake_points_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_calculated_stake_points_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_calculated_stake_points_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8840,6 +9187,7 @@ ulong fd_calculated_stake_rewards_footprint( void );
 ulong fd_calculated_stake_rewards_align( void );
 int fd_calculated_stake_rewards_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_calculated_stake_rewards_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_calculated_stake_rewards_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_calculated_stake_rewards_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_calculated_stake_rewards_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8864,6 +9212,7 @@ ulong fd_epoch_info_pair_footprint( void );
 ulong fd_epoch_info_pair_align( void );
 int fd_epoch_info_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_epoch_info_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_epoch_info_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_epoch_info_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_epoch_info_pair_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8876,6 +9225,7 @@ ulong fd_vote_info_pair_footprint( void );
 ulong fd_vote_info_pair_align( void );
 int fd_vote_info_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_vote_info_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_info_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_vote_info_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_vote_info_pair_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8900,6 +9250,7 @@ ulong fd_usage_cost_details_footprint( void );
 ulong fd_usage_cost_details_align( void );
 int fd_usage_cost_details_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_usage_cost_details_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_usage_cost_details_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_usage_cost_details_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_usage_cost_details_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8931,6 +9282,7 @@ ulong fd_account_costs_pair_footprint( void );
 ulong fd_account_costs_pair_align( void );
 int fd_account_costs_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_account_costs_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_account_costs_pair_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_account_costs_pair_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_account_costs_pair_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
@@ -8955,6 +9307,7 @@ ulong fd_cost_tracker_footprint( void );
 ulong fd_cost_tracker_align( void );
 int fd_cost_tracker_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 int fd_cost_tracker_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_cost_tracker_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
 void * fd_cost_tracker_decode( void * mem, fd_bincode_decode_ctx_t * ctx );
 void fd_cost_tracker_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );
 
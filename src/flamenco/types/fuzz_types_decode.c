@@ -61,6 +61,8 @@ int fd_flamenco_type_lookup(const char *type, fd_types_funcs_t * t) {
   return 0;
 }
 
+typedef int (* fd_decode_footprint_ref_fn_t)( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+
 static inline void
 fd_scratch_detach_null( void ) {
   fd_scratch_detach( NULL );
@@ -106,6 +108,27 @@ fd_decode_fuzz_data( char  const * type_name,
     int   err      = type_meta.decode_footprint_fun( &decode_ctx, &total_sz );
     __asm__ volatile( "" : "+m,r"(err) : : "memory" ); /* prevent optimization */
 
+    /* Types whose decode_footprint validates fixed size runs of fields
+       with a single bounds check also have a field by field reference.
+       Both must accept the same inputs with the same footprint (error
+       codes for truncated inputs may differ). */
+
+    char ref_name[ 255 ];
+    sprintf( ref_name, "%s_decode_footprint_ref", type_name );
+    fd_decode_footprint_ref_fn_t ref_fun = (fd_decode_footprint_ref_fn_t)dlsym( RTLD_DEFAULT, ref_name );
+    if( ref_fun ) {
+      fd_bincode_decode_ctx_t ref_ctx = {
+        .data    = data,
+        .dataend = data + size,
+      };
+      ulong ref_total_sz = 0UL;
+      int   ref_err      = ref_fun( &ref_ctx, &ref_total_sz );
+      if( FD_UNLIKELY( !err!=!ref_err || ( !err && total_sz!=ref_total_sz ) ) ) {
+        FD_LOG_CRIT(( "%s: decode_footprint (err %d, total_sz %lu) differs from reference (err %d, total_sz %lu)",
+                      type_name, err, total_sz, ref_err, ref_total_sz ));
+      }
+    }
+
     if( err ) {
       return;
     }
@@ -85,6 +85,89 @@ fuzzytypes = {
     "uchar[2048]",
 }
 
+# Primitive types for which any encoding is valid
+flatprimitives = {
+    "char", "uchar", "short", "ushort", "int", "uint", "long", "ulong",
+    "double", "uint128", "char[32]", "uchar[32]", "uchar[128]", "uchar[2048]",
+}
+
+# Fixed size types for which any encoding is valid (i.e. no bools,
+# enums, options or collections).  Runs of such members are validated
+# with a single bounds check instead of walking them field by field.
+flattypes = set()
+
+def isFlat(f):
+    if isinstance(f, PrimitiveMember):
+        return not f.varint and f.decode and f.encode and f.type in flatprimitives
+    if isinstance(f, StructMember):
+        return not f.ignore_underflow and f.type in flattypes
+    if isinstance(f, ArrayMember):
+        return f.element in flatprimitives or f.element in flattypes
+    return False
+
+# Types that get a zero-copy view (see "view" in fd_types.json) and
+# opaque types with a fixed size, which views hand out in place
+viewtypes = set()
+opaquetypes = set()
+
+# Map from primitive types to the C type a view accessor returns
+viewloadtypes = {
+    "bool" :    "uchar",
+    "char" :    "char",
+    "uchar" :   "uchar",
+    "short" :   "short",
+    "ushort" :  "ushort",
+    "int" :     "int",
+    "uint" :    "uint",
+    "long" :    "long",
+    "ulong" :   "ulong",
+    "double" :  "double",
+    "uint128" : "uint128",
+}
+
+def emitViewAccessor(n, f, off):
+    """Emits an accessor of view type n for member f found at the encoded
+       offset off (a C expression).  Members that can't be read in place
+       get no accessor."""
+    if isinstance(f, PrimitiveMember):
+        if f.varint or not f.decode:
+            return
+        if f.type in viewloadtypes:
+            t = viewloadtypes[f.type]
+            print(f'static inline {t} {n}_view_{f.name}( {n}_view_t const * view ) {{ return FD_LOAD( {t}, view->data + {off} ); }}', file=header)
+        elif f.type.startswith("uchar["):
+            print(f'static inline uchar const * {n}_view_{f.name}( {n}_view_t const * view ) {{ return view->data + {off}; }}', file=header)
+    elif isinstance(f, StructMember):
+        m = f'{namespace}_{f.type}'
+        if f.type in viewtypes:
+            print(f'static inline {m}_view_t {n}_view_{f.name}( {n}_view_t const * view ) {{', file=header)
+            print(f'  {m}_view_t sub = {{ .data = view->data + {off}, .data_sz = {f.fixedSize()}UL }};', file=header)
+            print(f'  return sub;', file=header)
+            print(f'}}', file=header)
+        elif f.type in opaquetypes:
+            print(f'static inline {m}_t const * {n}_view_{f.name}( {n}_view_t const * view ) {{ return ({m}_t const *)( view->data + {off} ); }}', file=header)
+
+def emitViewHeader(n):
+    print(f'/* {n}_view_t reads the fields of an encoded {n}_t in place */', file=header)
+    print(f'struct {n}_view {{', file=header)
+    print(f'  uchar const * data;', file=header)
+    print(f'  ulong         data_sz; /* Encoded size */', file=header)
+    print(f'}};', file=header)
+    print(f'typedef struct {n}_view {n}_view_t;', file=header)
+    print("", file=header)
+
+def emitViewImpl(n):
+    print(f'int {n}_view( {n}_view_t * view, uchar const * data, ulong data_sz ) {{', file=body)
+    print(f'  fd_bincode_decode_ctx_t ctx = {{ .data = data, .dataend = data + data_sz }};', file=body)
+    print(f'  ulong total_sz = 0UL;', file=body)
+    print(f'  int err = {n}_decode_footprint_inner( &ctx, &total_sz );', file=body)
+    print(f'  if( FD_UNLIKELY( err ) ) return err;', file=body)
+    print(f'  if( FD_UNLIKELY( ctx.data>ctx.dataend ) ) return FD_BINCODE_ERR_OVERFLOW;', file=body)
+    print(f'  view->data    = data;', file=body)
+    print(f'  view->data_sz = (ulong)ctx.data - (ulong)data;', file=body)
+    print(f'  return FD_BINCODE_SUCCESS;', file=body)
+    print(f'}}', file=body)
+
 class TypeNode:
     def __init__(self, json):
         self.name = json["name"]
@@ -1846,6 +1929,7 @@ class StructType(TypeNode):
             index = index + 1
         self.comment = (json["comment"] if "comment" in json else None)
         self.nomethods = ("attribute" in json)
+        self.view = (bool(json["view"]) if "view" in json else False)
         self.encoders = (json["encoders"] if "encoders" in json else None)
         if "alignment" in json:
             self.attribute = f'__attribute__((aligned({json["alignment"]}UL))) '
@@ -1863,6 +1947,45 @@ class StructType(TypeNode):
                 return False
         return True
 
+    def isFlat(self):
+        return len(self.fields)>0 and all(isFlat(f) for f in self.fields)
+
+    def flatRuns(self):
+        """Splits fields into runs that are validated with a single bounds
+           check (lists of flat members) and members validated on their own"""
+        runs = []
+        run = []
+        for f in self.fields:
+            if isFlat(f):
+                run.append(f)
+                continue
+            if run:
+                runs.append(run)
+                run = []
+            runs.append(f)
+        if run:
+            runs.append(run)
+        # A lone primitive is checked the same way either way
+        return [ (r[0] if len(r)==1 and isinstance(r[0], PrimitiveMember) else r) if isinstance(r, list) else r for r in runs ]
+
+    def hasFastFootprint(self):
+        return any(isinstance(r, list) for r in self.flatRuns())
+
+    def emitDecodeFootprintInner(self, n, fast):
+        print(f'{"static " if not fast else ""}int {n}_decode_footprint_inner{"" if fast else "_ref"}( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {{', file=body)
+        print(f'  if( ctx->data>=ctx->dataend ) {{ return FD_BINCODE_ERR_OVERFLOW; }};', file=body)
+        print(f'  int err = 0;', file=body)
+        for r in (self.flatRuns() if fast else self.fields):
+            if isinstance(r, list):
+                print(f'  err = fd_bincode_bytes_decode_footprint( {sum(f.fixedSize() for f in r)}UL, ctx );', file=body)
+                print(f'  if( FD_UNLIKELY( err ) ) return err;', file=body)
+                continue
+            if hasattr(r, "ignore_underflow") and r.ignore_underflow:
+                print('  if( ctx->data == ctx->dataend ) return FD_BINCODE_SUCCESS;', file=body)
+            r.emitDecodeFootprint()
+        print(f'  return 0;', file=body)
+        print(f'}}', file=body)
+
     def fixedSize(self):
         size = 0
         for f in self.fields:
@@ -1910,6 +2033,36 @@ class StructType(TypeNode):
         print(f"#define {n.upper()}_OFF_ALIGN ({self.alignment}UL)", file=header)
         print("", file=header)
 
+        if self.view:
+            emitViewHeader(n)
+
+    def emitViewPrototypes(self):
+        n = self.fullname
+        print(f'int {n}_view( {n}_view_t * view, uchar const * data, ulong data_sz );', file=header)
+
+        # Members up to the first one of dynamic size are at a fixed offset
+        # from the start, members after the last one from the end
+        off = 0
+        prefix_cnt = 0
+        for f in self.fields:
+            if (hasattr(f, "ignore_underflow") and f.ignore_underflow) or not f.isFixedSize():
+                break
+            emitViewAccessor(n, f, f'{off}UL')
+            off += f.fixedSize()
+            prefix_cnt += 1
+
+        if prefix_cnt<len(self.fields) and not any(hasattr(f, "ignore_underflow") and f.ignore_underflow for f in self.fields):
+            suffix = []
+            off = 0
+            for f in reversed(self.fields[prefix_cnt:]):
+                if not f.isFixedSize():
+                    break
+                off += f.fixedSize()
+                suffix.append((f, off))
+            for f, off in reversed(suffix):
+                emitViewAccessor(n, f, f'view->data_sz - {off}UL')
+        print("", file=header)
+
     def emitPrototypes(self):
         if self.nomethods:
             return
@@ -1923,9 +2076,13 @@ class StructType(TypeNode):
         print(f'ulong {n}_align( void );', file=header)
         print(f'int {n}_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );', file=header)
         print(f'int {n}_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );', file=header)
+        if self.encoders is not False and self.hasFastFootprint():
+            print(f'int {n}_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );', file=header)
         print(f'void * {n}_decode( void * mem, fd_bincode_decode_ctx_t * ctx );', file=header)
         print(f'void {n}_decode_inner( void * struct_mem, void * * alloc_mem, fd_bincode_decode_ctx_t * ctx );', file=header)
         print("", file=header)
+        if self.view:
+            self.emitViewPrototypes()
 
     def emitEncodes(self):
         n = self.fullname
@@ -1959,15 +2116,19 @@ class StructType(TypeNode):
             print(f'  return err;', file=body)
             print(f'}}', file=body)
 
-            print(f'int {n}_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {{', file=body)
-            print(f'  if( ctx->data>=ctx->dataend ) {{ return FD_BINCODE_ERR_OVERFLOW; }};', file=body)
-            print(f'  int err = 0;', file=body)
-            for f in self.fields:
-                if hasattr(f, "ignore_underflow") and f.ignore_underflow:
-                    print('  if( ctx->data == ctx->dataend ) return FD_BINCODE_SUCCESS;', file=body)
-                f.emitDecodeFootprint()
-            print(f'  return 0;', file=body)
-            print(f'}}', file=body)
+            self.emitDecodeFootprintInner(n, True)
+
+            # Field by field reference for the differential fuzzer
+            if self.hasFastFootprint():
+                self.emitDecodeFootprintInner(n, False)
+                print(f'int {n}_decode_footprint_ref( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {{', file=body)
+                print(f'  *total_sz += sizeof({n}_t);', file=body)
+                print(f'  void const * start_data = ctx->data;', file=body)
+                print(f'  int err = {n}_decode_footprint_inner_ref( ctx, total_sz );', file=body)
+                print(f'  if( ctx->data>ctx->dataend ) {{ return FD_BINCODE_ERR_OVERFLOW; }};', file=body)
+                print(f'  ctx->data = start_data;', file=body)
+                print(f'  return err;', file=body)
+                print(f'}}', file=body)
 
             print(f'void * {n}_decode( void * mem, fd_bincode_decode_ctx_t * ctx ) {{', file=body)
             print(f'  {n}_t * self = ({n}_t *)mem;', file=body)
@@ -1986,6 +2147,9 @@ class StructType(TypeNode):
                 f.emitDecodeInner()
             print(f'}}', file=body)
 
+            if self.view:
+                emitViewImpl(n)
+
         print(f'void {n}_new({n}_t * self) {{', file=body)
         print(f'  fd_memset( self, 0, sizeof({n}_t) );', file=body)
         for f in self.fields:
@@ -2009,6 +2173,11 @@ class StructType(TypeNode):
         print(f'  fun( w, self, name, FD_FLAMENCO_TYPE_MAP_END, "{n}", level-- );', file=body)
         print("}", file=body)
 
+        if self.encoders is not False and self.isFixedSize():
+            print(f'ulong {n}_size( {n}_t const * self ) {{ (void)self; return {self.fixedSize()}UL; }}', file=body)
+            print("", file=body)
+            return
+
         print(f'ulong {n}_size( {n}_t const * self ) {{', file=body)
         print('  ulong size = 0;', file=body)
         for f in self.fields:
@@ -2044,6 +2213,9 @@ class EnumType:
             self.attribute = ''
             self.alignment = 8
         self.compact = (json["compact"] if "compact" in json else False)
+        self.view = (bool(json["view"]) if "view" in json else False)
+        if self.view and self.compact:
+            raise ValueError(f'{self.fullname}: views of compact enums are not supported')
 
         # Current supported repr types for enum are uint and ulong
         self.repr = (json["repr"] if "repr" in json else "uint")
@@ -2127,6 +2299,24 @@ class EnumType:
             print(f"#define {n.upper()}_OFF_ALIGN ({self.alignment}UL)", file=header)
             print("", file=header)
 
+        if self.view:
+            emitViewHeader(n)
+
+    def emitViewPrototypes(self):
+        n = self.fullname
+        print(f'int {n}_view( {n}_view_t * view, uchar const * data, ulong data_sz );', file=header)
+        print(f'static inline {self.repr} {n}_view_discriminant( {n}_view_t const * view ) {{ return FD_LOAD( {self.repr}, view->data ); }}', file=header)
+
+        # Variant views are only valid for the matching discriminant
+        for v in self.variants:
+            if isinstance(v, StructMember) and v.type in viewtypes:
+                m = f'{namespace}_{v.type}'
+                print(f'static inline {m}_view_t {n}_view_{v.name}( {n}_view_t const * view ) {{', file=header)
+                print(f'  {m}_view_t sub = {{ .data = view->data + sizeof({self.repr}), .data_sz = view->data_sz - sizeof({self.repr}) }};', file=header)
+                print(f'  return sub;', file=header)
+                print(f'}}', file=header)
+        print("", file=header)
+
     def emitPrototypes(self):
         n = self.fullname
         print(f"void {n}_new_disc( {n}_t * self, {self.repr} discriminant );", file=header)
@@ -2154,6 +2344,9 @@ class EnumType:
             print(f'{n}_enum_{name} = {i},', file=header)
         print("};", file=header)
 
+        if self.view:
+            self.emitViewPrototypes()
+
     def emitImpls(self):
         global indent
 
@@ -2233,6 +2426,9 @@ class EnumType:
         print(f'  return self;', file=body)
         print(f'}}', file=body)
 
+        if self.view:
+            emitViewImpl(n)
+
         print(f'void {n}_inner_new( {n}_inner_t * self, {self.repr} discriminant ) {{', file=body)
         print('  switch( discriminant ) {', file=body)
         for i, v in enumerate(self.variants):
@@ -2360,6 +2556,13 @@ def main():
             fixedsizetypes[typeinfo.name] = typeinfo.fixedSize()
         if typeinfo.isFuzzy():
             fuzzytypes.add(typeinfo.name)
+        if getattr(typeinfo, 'view', False):
+            viewtypes.add(typeinfo.name)
+        if isinstance(typeinfo, OpaqueType) and typeinfo.isFixedSize():
+            opaquetypes.add(typeinfo.name)
+            flattypes.add(typeinfo.name)
+        if isinstance(typeinfo, StructType) and typeinfo.isFlat():
+            flattypes.add(typeinfo.name)
     for t in alltypes:
         t.emitHeader()
 
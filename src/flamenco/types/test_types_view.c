@@ -0,0 +1,351 @@
+#include "fd_types.h"
+
+/* Tests that generated views read the same fields as a full decode and
+   that decode footprints agree with their field by field reference, and
+   benchmarks reading vote state fields with a decode and a view. */
+
+#define BUF_MAX (16384UL)
+
+static uchar enc_buf[ BUF_MAX ];
+static uchar dec_buf[ 1UL<<20 ] __attribute__((aligned(128UL)));
+
+/* Minimal bincode writer */
+
+static uchar * w_u8 ( uchar * p, uchar v ) { *p = v;                return p+1UL; }
+static uchar * w_u32( uchar * p, uint  v ) { FD_STORE( uint,  p, v ); return p+4UL; }
+static uchar * w_u64( uchar * p, ulong v ) { FD_STORE( ulong, p, v ); return p+8UL; }
+
+static uchar *
+w_rand( uchar *    p,
+        fd_rng_t * rng,
+        ulong      sz ) {
+  for( ulong i=0UL; i<sz; i++ ) p[i] = fd_rng_uchar( rng );
+  return p+sz;
+}
+
+/* encode_vote_state writes a random vote state of the given version and
+   returns its encoded size.  The node pubkey and last timestamp are
+   returned at node_pubkey and ts. */
+
+static ulong
+encode_vote_state( uint                        version,
+                   fd_rng_t *                  rng,
+                   uchar *                     node_pubkey,
+                   fd_vote_block_timestamp_t * ts ) {
+  uchar * p = enc_buf;
+  p = w_u32( p, version );
+
+  uchar * node = p;
+  p = w_rand( p, rng, 32UL );                       /* node_pubkey */
+  fd_memcpy( node_pubkey, node, 32UL );
+
+  ulong vote_cnt   = fd_rng_ulong_roll( rng, 32UL );
+  ulong credit_cnt = fd_rng_ulong_roll( rng, 64UL );
+  ulong voter_cnt  = 1UL + fd_rng_ulong_roll( rng, 4UL );
+
+  switch( version ) {
+  case fd_vote_state_versioned_enum_v0_23_5:
+    p = w_rand( p, rng, 32UL );                     /* authorized_voter */
+    p = w_u64 ( p, fd_rng_ulong( rng ) );           /* authorized_voter_epoch */
+    fd_memset( p, 0, 1800UL ); p += 1800UL;         /* prior_voters */
+    p = w_rand( p, rng, 32UL );                     /* authorized_withdrawer */
+    p = w_u8  ( p, fd_rng_uchar( rng ) );           /* commission */
+    p = w_u64 ( p, vote_cnt );
+    for( ulong i=0UL; i<vote_cnt; i++ ) { p = w_u64( p, fd_rng_ulong( rng ) ); p = w_u32( p, fd_rng_uint( rng ) ); }
+    break;
+  case fd_vote_state_versioned_enum_v1_14_11:
+  case fd_vote_state_versioned_enum_current:
+    p = w_rand( p, rng, 32UL );                     /* authorized_withdrawer */
+    p = w_u8  ( p, fd_rng_uchar( rng ) );           /* commission */
+    p = w_u64 ( p, vote_cnt );
+    for( ulong i=0UL; i<vote_cnt; i++ ) {
+      if( version==fd_vote_state_versioned_enum_current ) p = w_u8( p, fd_rng_uchar( rng ) ); /* latency */
+      p = w_u64( p, fd_rng_ulong( rng ) );
+      p = w_u32( p, fd_rng_uint( rng ) );
+    }
+    break;
+  default:
+    FD_LOG_ERR(( "unexpected version %u", version ));
+  }
+
+  p = w_u8( p, 1 );                                 /* root_slot */
+  p = w_u64( p, fd_rng_ulong( rng ) );
+
+  if( version!=fd_vote_state_versioned_enum_v0_23_5 ) {
+    p = w_u64( p, voter_cnt );                      /* authorized_voters */
+    for( ulong i=0UL; i<voter_cnt; i++ ) { p = w_u64( p, i ); p = w_rand( p, rng, 32UL ); }
+    fd_memset( p, 0, 1544UL ); p += 1544UL;         /* prior_voters */
+    p = w_u8( p, 1 );                               /* is_empty */
+  }
+
+  p = w_u64( p, credit_cnt );                       /* epoch_credits */
+  p = w_rand( p, rng, 24UL*credit_cnt );
+
+  ts->slot      = fd_rng_ulong( rng );
+  ts->timestamp = (long)fd_rng_ulong( rng );
+  p = w_u64( p, ts->slot );
+  p = w_u64( p, (ulong)ts->timestamp );
+
+  return (ulong)( p-enc_buf );
+}
+
+static fd_vote_block_timestamp_t
+view_last_timestamp( fd_vote_state_versioned_view_t const * view ) {
+  fd_vote_block_timestamp_view_t ts;
+  switch( fd_vote_state_versioned_view_discriminant( view ) ) {
+  case fd_vote_state_versioned_enum_v0_23_5: {
+    fd_vote_state_0_23_5_view_t vs = fd_vote_state_versioned_view_v0_23_5( view );
+    ts = fd_vote_state_0_23_5_view_last_timestamp( &vs );
+    break;
+  }
+  case fd_vote_state_versioned_enum_v1_14_11: {
+    fd_vote_state_1_14_11_view_t vs = fd_vote_state_versioned_view_v1_14_11( view );
+    ts = fd_vote_state_1_14_11_view_last_timestamp( &vs );
+    break;
+  }
+  default: {
+    fd_vote_state_view_t vs = fd_vote_state_versioned_view_current( view );
+    ts = fd_vote_state_view_last_timestamp( &vs );
+    break;
+  }
+  }
+  fd_vote_block_timestamp_t out = {
+    .slot      = fd_vote_block_timestamp_view_slot( &ts ),
+    .timestamp = fd_vote_block_timestamp_view_timestamp( &ts )
+  };
+  return out;
+}
+
+static fd_vote_block_timestamp_t const *
+decoded_last_timestamp( fd_vote_state_versioned_t const * vsv ) {
+  switch( vsv->discriminant ) {
+  case fd_vote_state_versioned_enum_v0_23_5:  return &vsv->inner.v0_23_5.last_timestamp;
+  case fd_vote_state_versioned_enum_v1_14_11: return &vsv->inner.v1_14_11.last_timestamp;
+  default:                                    return &vsv->inner.current.last_timestamp;
+  }
+}
+
+/* check_footprint_ref checks that decode_footprint and its field by
+   field reference agree on data truncated at random points */
+
+typedef int (* decode_footprint_fn_t)( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+
+static void
+check_footprint_ref( decode_footprint_fn_t fast,
+                     decode_footprint_fn_t ref,
+                     uchar const *         data,
+                     ulong                 sz,
+                     fd_rng_t *            rng ) {
+  for( ulong trunc=0UL; trunc<=sz; trunc+=1UL+fd_rng_ulong_roll( rng, 32UL ) ) {
+    ulong trunc_sz = trunc>=sz-8UL ? sz : trunc; /* always check the full size */
+    fd_bincode_decode_ctx_t ctx0 = { .data = data, .dataend = data+trunc_sz };
+    fd_bincode_decode_ctx_t ctx1 = { .data = data, .dataend = data+trunc_sz };
+    ulong total_sz0 = 0UL; int err0 = fast( &ctx0, &total_sz0 );
+    ulong total_sz1 = 0UL; int err1 = ref ( &ctx1, &total_sz1 );
+    FD_TEST( !err0==!err1 );
+    FD_TEST( err0 || total_sz0==total_sz1 );
+    if( trunc_sz==sz ) break;
+  }
+}
+
+static void
+test_vote_state( fd_rng_t * rng ) {
+  for( uint version=0U; version<3U; version++ ) {
+    for( ulong iter=0UL; iter<64UL; iter++ ) {
+      uchar                     node_pubkey[ 32 ];
+      fd_vote_block_timestamp_t ts;
+      ulong sz = encode_vote_state( version, rng, node_pubkey, &ts );
+
+      /* Trailing padding (as in vote accounts) is not part of the view */
+
+      ulong pad = fd_rng_ulong_roll( rng, 128UL );
+      fd_memset( enc_buf+sz, 0, pad );
+
+      fd_vote_state_versioned_view_t view[1];
+      FD_TEST( fd_vote_state_versioned_view( view, enc_buf, sz+pad )==FD_BINCODE_SUCCESS );
+      FD_TEST( view->data==enc_buf && view->data_sz==sz );
+      FD_TEST( fd_vote_state_versioned_view_discriminant( view )==version );
+
+      fd_bincode_decode_ctx_t ctx = { .data = enc_buf, .dataend = enc_buf+sz+pad };
+      ulong total_sz = 0UL;
+      FD_TEST( fd_vote_state_versioned_decode_footprint( &ctx, &total_sz )==FD_BINCODE_SUCCESS );
+      FD_TEST( total_sz<=sizeof(dec_buf) );
+      fd_vote_state_versioned_t * vsv = fd_vote_state_versioned_decode( dec_buf, &ctx );
+
+      static decode_footprint_fn_t const fast[3] = { fd_vote_state_0_23_5_decode_footprint, fd_vote_state_1_14_11_decode_footprint, fd_vote_state_decode_footprint };
+      static decode_footprint_fn_t const ref [3] = { fd_vote_state_0_23_5_decode_footprint_ref, fd_vote_state_1_14_11_decode_footprint_ref, fd_vote_state_decode_footprint_ref };
+      check_footprint_ref( fast[ version ], ref[ version ], enc_buf+4UL, sz-4UL, rng );
+
+      fd_vote_block_timestamp_t view_ts = view_last_timestamp( view );
+      FD_TEST( view_ts.slot==ts.slot && view_ts.timestamp==ts.timestamp );
+      FD_TEST( view_ts.slot==decoded_last_timestamp( vsv )->slot );
+      FD_TEST( view_ts.timestamp==decoded_last_timestamp( vsv )->timestamp );
+
+      switch( version ) {
+      case fd_vote_state_versioned_enum_v0_23_5: {
+        fd_vote_state_0_23_5_view_t vs = fd_vote_state_versioned_view_v0_23_5( view );
+        fd_vote_state_0_23_5_t const * d = &vsv->inner.v0_23_5;
+        FD_TEST( !memcmp( fd_vote_state_0_23_5_view_node_pubkey( &vs ), node_pubkey, 32UL ) );
+        FD_TEST( !memcmp( fd_vote_state_0_23_5_view_node_pubkey( &vs ), &d->node_pubkey, 32UL ) );
+        FD_TEST( !memcmp( fd_vote_state_0_23_5_view_authorized_voter( &vs ), &d->authorized_voter, 32UL ) );
+        FD_TEST( fd_vote_state_0_23_5_view_authorized_voter_epoch( &vs )==d->authorized_voter_epoch );
+        FD_TEST( !memcmp( fd_vote_state_0_23_5_view_authorized_withdrawer( &vs ), &d->authorized_withdrawer, 32UL ) );
+        FD_TEST( fd_vote_state_0_23_5_view_commission( &vs )==d->commission );
+        break;
+      }
+      case fd_vote_state_versioned_enum_v1_14_11: {
+        fd_vote_state_1_14_11_view_t vs = fd_vote_state_versioned_view_v1_14_11( view );
+        fd_vote_state_1_14_11_t const * d = &vsv->inner.v1_14_11;
+        FD_TEST( !memcmp( fd_vote_state_1_14_11_view_node_pubkey( &vs ), &d->node_pubkey, 32UL ) );
+        FD_TEST( !memcmp( fd_vote_state_1_14_11_view_authorized_withdrawer( &vs ), &d->authorized_withdrawer, 32UL ) );
+        FD_TEST( fd_vote_state_1_14_11_view_commission( &vs )==d->commission );
+        break;
+      }
+      default: {
+        fd_vote_state_view_t vs = fd_vote_state_versioned_view_current( view );
+        fd_vote_state_t const * d = &vsv->inner.current;
+        FD_TEST( !memcmp( fd_vote_state_view_node_pubkey( &vs ), &d->node_pubkey, 32UL ) );
+        FD_TEST( !memcmp( fd_vote_state_view_authorized_withdrawer( &vs ), &d->authorized_withdrawer, 32UL ) );
+        FD_TEST( fd_vote_state_view_commission( &vs )==d->commission );
+        break;
+      }
+      }
+
+      /* Truncated data is rejected and leaves the view untouched */
+
+      fd_vote_state_versioned_view_t bad[1] = {{ .data = NULL, .data_sz = 0UL }};
+      for( ulong trunc=0UL; trunc<sz; trunc+=1UL+fd_rng_ulong_roll( rng, 64UL ) ) {
+        FD_TEST( fd_vote_state_versioned_view( bad, enc_buf, trunc )!=FD_BINCODE_SUCCESS );
+      }
+      FD_TEST( fd_vote_state_versioned_view( bad, enc_buf, sz-1UL )!=FD_BINCODE_SUCCESS );
+      FD_TEST( !bad->data && !bad->data_sz );
+    }
+  }
+
+  /* Unknown discriminant */
+
+  fd_vote_state_versioned_view_t view[1];
+  FD_STORE( uint, enc_buf, 3U );
+  FD_TEST( fd_vote_state_versioned_view( view, enc_buf, BUF_MAX )!=FD_BINCODE_SUCCESS );
+}
+
+static void
+test_stake_state( fd_rng_t * rng ) {
+  for( ulong iter=0UL; iter<64UL; iter++ ) {
+    uchar * p = enc_buf;
+    p = w_u32 ( p, fd_stake_state_v2_enum_stake );
+    p = w_rand( p, rng, 120UL );                    /* meta */
+    p = w_rand( p, rng, 72UL  );                    /* stake */
+    p = w_u8  ( p, fd_rng_uchar( rng ) );           /* stake_flags */
+    ulong sz = (ulong)( p-enc_buf );
+    FD_TEST( sz==197UL );
+
+    check_footprint_ref( fd_stake_state_v2_stake_decode_footprint, fd_stake_state_v2_stake_decode_footprint_ref, enc_buf+4UL, sz-4UL, rng );
+
+    fd_stake_state_v2_view_t view[1];
+    FD_TEST( fd_stake_state_v2_view( view, enc_buf, sz )==FD_BINCODE_SUCCESS );
+    FD_TEST( view->data_sz==sz );
+    FD_TEST( fd_stake_state_v2_view_discriminant( view )==fd_stake_state_v2_enum_stake );
+
+    fd_bincode_decode_ctx_t ctx = { .data = enc_buf, .dataend = enc_buf+sz };
+    ulong total_sz = 0UL;
+    FD_TEST( fd_stake_state_v2_decode_footprint( &ctx, &total_sz )==FD_BINCODE_SUCCESS );
+    fd_stake_state_v2_t * state = fd_stake_state_v2_decode( dec_buf, &ctx );
+    fd_stake_state_v2_stake_t const * d = &state->inner.stake;
+
+    fd_stake_state_v2_stake_view_t s          = fd_stake_state_v2_view_stake( view );
+    fd_stake_meta_view_t           meta       = fd_stake_state_v2_stake_view_meta( &s );
+    fd_stake_authorized_view_t     authorized = fd_stake_meta_view_authorized( &meta );
+    fd_stake_lockup_view_t         lockup     = fd_stake_meta_view_lockup( &meta );
+    fd_stake_view_t                stake      = fd_stake_state_v2_stake_view_stake( &s );
+    fd_delegation_view_t           delegation = fd_stake_view_delegation( &stake );
+    fd_stake_flags_view_t          flags      = fd_stake_state_v2_stake_view_stake_flags( &s );
+
+    FD_TEST( fd_stake_meta_view_rent_exempt_reserve( &meta )==d->meta.rent_exempt_reserve );
+    FD_TEST( !memcmp( fd_stake_authorized_view_staker    ( &authorized ), &d->meta.authorized.staker,     32UL ) );
+    FD_TEST( !memcmp( fd_stake_authorized_view_withdrawer( &authorized ), &d->meta.authorized.withdrawer, 32UL ) );
+    FD_TEST( fd_stake_lockup_view_unix_timestamp( &lockup )==d->meta.lockup.unix_timestamp );
+    FD_TEST( fd_stake_lockup_view_epoch         ( &lockup )==d->meta.lockup.epoch          );
+    FD_TEST( !memcmp( fd_stake_lockup_view_custodian( &lockup ), &d->meta.lockup.custodian, 32UL ) );
+    FD_TEST( !memcmp( fd_delegation_view_voter_pubkey( &delegation ), &d->stake.delegation.voter_pubkey, 32UL ) );
+    FD_TEST( fd_delegation_view_stake             ( &delegation )==d->stake.delegation.stake              );
+    FD_TEST( fd_delegation_view_activation_epoch  ( &delegation )==d->stake.delegation.activation_epoch   );
+    FD_TEST( fd_delegation_view_deactivation_epoch( &delegation )==d->stake.delegation.deactivation_epoch );
+    FD_TEST( !memcmp( &(double){ fd_delegation_view_warmup_cooldown_rate( &delegation ) },
+                      &d->stake.delegation.warmup_cooldown_rate, sizeof(double) ) );
+    FD_TEST( fd_stake_view_credits_observed( &stake )==d->stake.credits_observed );
+    FD_TEST( fd_stake_flags_view_bits( &flags )==d->stake_flags.bits );
+
+    for( ulong trunc=0UL; trunc<sz; trunc++ ) FD_TEST( fd_stake_state_v2_view( view, enc_buf, trunc )!=FD_BINCODE_SUCCESS );
+  }
+
+  /* Variants without data */
+
+  fd_stake_state_v2_view_t view[1];
+  FD_STORE( uint, enc_buf, fd_stake_state_v2_enum_uninitialized );
+  FD_TEST( fd_stake_state_v2_view( view, enc_buf, BUF_MAX )==FD_BINCODE_SUCCESS );
+  FD_TEST( view->data_sz==4UL );
+  FD_STORE( uint, enc_buf, 4U );
+  FD_TEST( fd_stake_state_v2_view( view, enc_buf, BUF_MAX )!=FD_BINCODE_SUCCESS );
+}
+
+static void
+bench_vote_state( fd_rng_t * rng,
+                  ulong      bench_cnt ) {
+  static char const * version_name[3] = { "v0_23_5", "v1_14_11", "current" };
+  for( uint version=0U; version<3U; version++ ) {
+    uchar                     node_pubkey[ 32 ];
+    fd_vote_block_timestamp_t ts;
+    ulong sz = encode_vote_state( version, rng, node_pubkey, &ts );
+
+    /* Full decode */
+
+    ulong total_sz = 0UL;
+    ulong acc      = 0UL;
+    long  dt       = -fd_log_wallclock();
+    for( ulong rem=bench_cnt; rem; rem-- ) {
+      fd_bincode_decode_ctx_t ctx = { .data = enc_buf, .dataend = enc_buf+sz };
+      total_sz = 0UL;
+      FD_TEST( !fd_vote_state_versioned_decode_footprint( &ctx, &total_sz ) );
+      fd_vote_state_versioned_t * vsv = fd_vote_state_versioned_decode( dec_buf, &ctx );
+      acc += decoded_last_timestamp( vsv )->slot;
+      FD_COMPILER_FORGET( acc );
+    }
+    dt += fd_log_wallclock();
+    FD_LOG_NOTICE(( "%-8s decode: %6.1f ns/op, %lu bytes allocated (%lu bytes encoded)",
+                    version_name[ version ], (double)dt/(double)bench_cnt, total_sz, sz ));
+
+    /* View */
+
+    dt = -fd_log_wallclock();
+    for( ulong rem=bench_cnt; rem; rem-- ) {
+      fd_vote_state_versioned_view_t view[1];
+      FD_TEST( !fd_vote_state_versioned_view( view, enc_buf, sz ) );
+      acc += view_last_timestamp( view ).slot;
+      FD_COMPILER_FORGET( acc );
+    }
+    dt += fd_log_wallclock();
+    FD_LOG_NOTICE(( "%-8s view:   %6.1f ns/op, 0 bytes allocated",
+                    version_name[ version ], (double)dt/(double)bench_cnt ));
+  }
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  ulong bench_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--bench-cnt", NULL, 10000UL );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  test_vote_state ( rng );
+  test_stake_state( rng );
+  bench_vote_state( rng, bench_cnt );
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -221,17 +221,24 @@ fd_vm_syscall_sol_get_sysvar( /**/            void *  _vm,
     return FD_VM_SUCCESS;
   }
 
-  FD_TXN_ACCOUNT_DECL( sysvar_account );
-  err = fd_acc_mgr_view( vm->instr_ctx->slot_ctx->acc_mgr, vm->instr_ctx->slot_ctx->funk_txn, sysvar_id, sysvar_account );
-  if( FD_UNLIKELY( err ) ) {
-    *_ret = 2UL;
-    return FD_VM_SUCCESS;
+  /* The sysvar cache holds the account data of the sysvars it was last
+     restored from, so the account is only read from the accounts DB if
+     the sysvar has no image in the cache. */
+  ulong         sysvar_buf_len = 0UL;
+  uchar const * sysvar_buf     = fd_sysvar_cache_data( vm->instr_ctx->slot_ctx->sysvar_cache, sysvar_id, &sysvar_buf_len );
+  if( FD_UNLIKELY( !sysvar_buf ) ) {
+    FD_TXN_ACCOUNT_DECL( sysvar_account );
+    err = fd_acc_mgr_view( vm->instr_ctx->slot_ctx->acc_mgr, vm->instr_ctx->slot_ctx->funk_txn, sysvar_id, sysvar_account );
+    if( FD_UNLIKELY( err ) ) {
+      *_ret = 2UL;
+      return FD_VM_SUCCESS;
+    }
+    sysvar_buf     = sysvar_account->const_data;
+    sysvar_buf_len = sysvar_account->const_meta->dlen;
   }
 
   /* https://github.com/anza-xyz/agave/blob/v2.1.0/programs/bpf_loader/src/syscalls/sysvar.rs#L223-L228
      Note the length check is at the very end to fail after performing sufficient checks. */
-  const uchar * sysvar_buf     = sysvar_account->const_data;
-  ulong         sysvar_buf_len = sysvar_account->const_meta->dlen;
 
   if( FD_UNLIKELY( offset_length>sysvar_buf_len ) ) {
     *_ret = 1UL;
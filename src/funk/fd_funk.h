@@ -257,6 +257,13 @@ struct __attribute__((aligned(FD_FUNK_ALIGN))) fd_funk_private {
 
   ulong alloc_gaddr; /* Non-zero wksp gaddr with tag wksp tag */
 
+  /* checkpt_seq is the sequence number of the last incremental
+     checkpoint written from or restored into this funk (0 if none).
+     Incremental checkpoints are chained by this value (see
+     fd_funk_checkpt.h). */
+
+  ulong checkpt_seq;
+
   /* Padding to FD_FUNK_ALIGN here */
 };
 
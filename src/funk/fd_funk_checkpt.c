@@ -0,0 +1,390 @@
+#include "fd_funk_checkpt.h"
+
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+/* An incremental checkpoint is 3 frames:
+
+     hdr  (RAW):         fd_funk_checkpt_incr_hdr_t
+     recs (frame_style): rec_cnt x ( fd_funk_checkpt_incr_rec_t, val_sz bytes of value )
+     ftr  (RAW):         fd_funk_checkpt_incr_ftr_t
+
+   Records are written in the order they appear in the last published
+   transaction's record list.  Erased records (tombstones) are written
+   with no value bytes. */
+
+struct fd_funk_checkpt_incr_hdr {
+  ulong             magic;       /* ==FD_FUNK_CHECKPT_INCR_MAGIC */
+  int               frame_style; /* Frame style of the recs frame */
+  uint              reserved;
+  ulong             seed;        /* Funk seed at checkpt (informational) */
+  ulong             base_seq;    /* Funk checkpt_seq this applies to */
+  ulong             seq;         /* Funk checkpt_seq after applying, ==base_seq+1 */
+  ulong             rec_cnt;     /* Number of records in the recs frame */
+  fd_funk_txn_xid_t last_publish[1]; /* Funk last published xid at checkpt */
+};
+
+typedef struct fd_funk_checkpt_incr_hdr fd_funk_checkpt_incr_hdr_t;
+
+struct fd_funk_checkpt_incr_rec {
+  fd_funk_rec_key_t key[1];
+  ulong             flags;  /* Record flags (without FD_FUNK_REC_FLAG_DIRTY) */
+  uint              part;   /* Record partition */
+  uint              val_sz; /* Value bytes following, 0 if ERASE set */
+};
+
+typedef struct fd_funk_checkpt_incr_rec fd_funk_checkpt_incr_rec_t;
+
+struct fd_funk_checkpt_incr_ftr {
+  ulong magic;      /* ==FD_FUNK_CHECKPT_INCR_MAGIC */
+  ulong rec_cnt;    /* ==hdr rec_cnt */
+  ulong val_sz_tot; /* Total value bytes in the recs frame */
+  ulong seq;        /* ==hdr seq */
+};
+
+typedef struct fd_funk_checkpt_incr_ftr fd_funk_checkpt_incr_ftr_t;
+
+ulong
+fd_funk_checkpt_dirty_cnt( fd_funk_t * funk ) {
+  fd_funk_rec_t const * rec_map = fd_funk_rec_map( funk, fd_funk_wksp( funk ) );
+  ulong cnt = 0UL;
+  for( ulong rec_idx = funk->rec_head_idx; !fd_funk_rec_idx_is_null( rec_idx ); rec_idx = rec_map[ rec_idx ].next_idx ) {
+    cnt += (ulong)!!(rec_map[ rec_idx ].flags & FD_FUNK_REC_FLAG_DIRTY);
+  }
+  return cnt;
+}
+
+void
+fd_funk_checkpt_dirty_clear( fd_funk_t * funk ) {
+  fd_funk_check_write( funk );
+  fd_funk_rec_t * rec_map = fd_funk_rec_map( funk, fd_funk_wksp( funk ) );
+  for( ulong rec_idx = funk->rec_head_idx; !fd_funk_rec_idx_is_null( rec_idx ); rec_idx = rec_map[ rec_idx ].next_idx ) {
+    rec_map[ rec_idx ].flags &= ~FD_FUNK_REC_FLAG_DIRTY;
+  }
+}
+
+int
+fd_funk_checkpt_incr( fd_funk_t *  funk,
+                      char const * path,
+                      ulong        mode,
+                      int          frame_style,
+                      ulong *      _rec_cnt ) {
+
+  if( FD_UNLIKELY( !funk ) ) { FD_LOG_WARNING(( "NULL funk" )); return FD_FUNK_ERR_INVAL; }
+  if( FD_UNLIKELY( !path ) ) { FD_LOG_WARNING(( "NULL path" )); return FD_FUNK_ERR_INVAL; }
+
+  frame_style = fd_int_if( !!frame_style, frame_style, FD_CHECKPT_FRAME_STYLE_DEFAULT );
+  if( FD_UNLIKELY( !fd_checkpt_frame_style_is_supported( frame_style ) ) ) {
+    FD_LOG_WARNING(( "frame_style %i not supported on this target", frame_style ));
+    return FD_FUNK_ERR_INVAL;
+  }
+
+  fd_funk_check_write( funk );
+
+  fd_wksp_t *     wksp    = fd_funk_wksp( funk );
+  fd_funk_rec_t * rec_map = fd_funk_rec_map( funk, wksp );
+  ulong           rec_max = funk->rec_max;
+
+  int            err_fail = FD_FUNK_ERR_SYS;
+  int            fd       = -1;
+  fd_checkpt_t * checkpt  = NULL;
+
+  /* Count the dirty records up front (validating the record list as we
+     go) so the header can tell restore how many to expect. */
+
+  ulong rec_cnt = 0UL;
+  for( ulong rec_idx = funk->rec_head_idx; !fd_funk_rec_idx_is_null( rec_idx ); rec_idx = rec_map[ rec_idx ].next_idx ) {
+    if( FD_UNLIKELY( rec_idx>=rec_max ) ) FD_LOG_CRIT(( "memory corruption detected (bad idx)" ));
+    rec_cnt += (ulong)!!(rec_map[ rec_idx ].flags & FD_FUNK_REC_FLAG_DIRTY);
+  }
+
+  /* Create the checkpt file */
+
+  {
+    mode_t old_mask = umask( (mode_t)0 );
+    fd = open( path, O_CREAT|O_EXCL|O_WRONLY, (mode_t)mode );
+    umask( old_mask );
+    if( FD_UNLIKELY( fd==-1 ) ) {
+      FD_LOG_WARNING(( "incremental checkpt to \"%s\" failed opening file with flags O_CREAT|O_EXCL|O_WRONLY in mode 0%03lo (%i-%s)",
+                       path, mode, errno, fd_io_strerror( errno ) ));
+      goto fail;
+    }
+  }
+
+  fd_checkpt_t _checkpt[ 1 ];
+  uchar        wbuf[ FD_CHECKPT_WBUF_MIN ];
+
+  checkpt = fd_checkpt_init_stream( _checkpt, fd, wbuf, FD_CHECKPT_WBUF_MIN ); /* logs details */
+  if( FD_UNLIKELY( !checkpt ) ) goto fail;
+
+# define CHECKPT_TEST( c ) do {                                                  \
+    if( FD_UNLIKELY( !(c) ) ) {                                                  \
+      FD_LOG_WARNING(( "incremental checkpt to \"%s\" failed (%s)", path, #c )); \
+      goto fail;                                                                 \
+    }                                                                            \
+  } while(0)
+
+  /* Checkpt the header */
+
+  fd_funk_checkpt_incr_hdr_t hdr[1];
+  memset( hdr, 0, sizeof(fd_funk_checkpt_incr_hdr_t) );
+  hdr->magic       = FD_FUNK_CHECKPT_INCR_MAGIC;
+  hdr->frame_style = frame_style;
+  hdr->seed        = funk->seed;
+  hdr->base_seq    = funk->checkpt_seq;
+  hdr->seq         = funk->checkpt_seq + 1UL;
+  hdr->rec_cnt     = rec_cnt;
+  fd_funk_txn_xid_copy( hdr->last_publish, funk->last_publish );
+
+  CHECKPT_TEST( !fd_checkpt_open ( checkpt, FD_CHECKPT_FRAME_STYLE_RAW            ) );
+  CHECKPT_TEST( !fd_checkpt_meta ( checkpt, hdr, sizeof(fd_funk_checkpt_incr_hdr_t) ) );
+  CHECKPT_TEST( !fd_checkpt_close( checkpt                                        ) );
+
+  /* Checkpt the dirty records.  Values are written zero copy from the
+     wksp (they are not modified until the frame is closed as there are
+     no concurrent operations on funk). */
+
+  ulong val_sz_tot = 0UL;
+
+  CHECKPT_TEST( !fd_checkpt_open( checkpt, frame_style ) );
+  for( ulong rec_idx = funk->rec_head_idx; !fd_funk_rec_idx_is_null( rec_idx ); rec_idx = rec_map[ rec_idx ].next_idx ) {
+    fd_funk_rec_t const * rec = rec_map + rec_idx;
+    if( !(rec->flags & FD_FUNK_REC_FLAG_DIRTY) ) continue;
+
+    int   erase  = !!(rec->flags & FD_FUNK_REC_FLAG_ERASE);
+    ulong val_sz = fd_ulong_if( erase, 0UL, (ulong)fd_funk_val_sz( rec ) );
+
+    fd_funk_checkpt_incr_rec_t meta[1];
+    memset( meta, 0, sizeof(fd_funk_checkpt_incr_rec_t) );
+    fd_funk_rec_key_copy( meta->key, rec->pair.key );
+    meta->flags  = rec->flags & ~FD_FUNK_REC_FLAG_DIRTY;
+    meta->part   = rec->part;
+    meta->val_sz = (uint)val_sz;
+
+    CHECKPT_TEST( !fd_checkpt_meta( checkpt, meta, sizeof(fd_funk_checkpt_incr_rec_t) ) );
+    if( val_sz ) CHECKPT_TEST( !fd_checkpt_data( checkpt, fd_funk_val_const( rec, wksp ), val_sz ) );
+    val_sz_tot += val_sz;
+  }
+  CHECKPT_TEST( !fd_checkpt_close( checkpt ) );
+
+  /* Checkpt the footer */
+
+  fd_funk_checkpt_incr_ftr_t ftr[1];
+  ftr->magic      = FD_FUNK_CHECKPT_INCR_MAGIC;
+  ftr->rec_cnt    = rec_cnt;
+  ftr->val_sz_tot = val_sz_tot;
+  ftr->seq        = hdr->seq;
+
+  CHECKPT_TEST( !fd_checkpt_open ( checkpt, FD_CHECKPT_FRAME_STYLE_RAW            ) );
+  CHECKPT_TEST( !fd_checkpt_meta ( checkpt, ftr, sizeof(fd_funk_checkpt_incr_ftr_t) ) );
+  CHECKPT_TEST( !fd_checkpt_close( checkpt                                        ) );
+
+# undef CHECKPT_TEST
+
+  /* Flush and close the file */
+
+  checkpt = NULL;
+  if( FD_UNLIKELY( !fd_checkpt_fini( _checkpt ) ) ) goto fail; /* logs details */
+
+  if( FD_UNLIKELY( close( fd ) ) ) {
+    FD_LOG_WARNING(( "incremental checkpt to \"%s\" failed closing file (%i-%s)", path, errno, fd_io_strerror( errno ) ));
+    fd = -1;
+    goto fail;
+  }
+  fd = -1;
+
+  /* The checkpoint is durable.  Commit the new checkpt state to the
+     funk. */
+
+  fd_funk_checkpt_dirty_clear( funk );
+  funk->checkpt_seq = hdr->seq;
+
+  FD_LOG_INFO(( "incremental checkpt %lu to \"%s\": %lu records, %lu value bytes", hdr->seq, path, rec_cnt, val_sz_tot ));
+
+  if( _rec_cnt ) *_rec_cnt = rec_cnt;
+  return FD_FUNK_SUCCESS;
+
+fail:
+
+  /* Release resources that might be reserved */
+
+  if( FD_LIKELY( checkpt ) ) {
+    if( FD_UNLIKELY( fd_checkpt_in_frame( checkpt ) ) && FD_UNLIKELY( fd_checkpt_close( checkpt ) ) )
+      FD_LOG_WARNING(( "fd_checkpt_close failed; attempting to continue" ));
+
+    if( FD_UNLIKELY( !fd_checkpt_fini( checkpt ) ) ) /* logs details */
+      FD_LOG_WARNING(( "fd_checkpt_fini failed; attempting to continue" ));
+  }
+
+  if( FD_LIKELY( fd!=-1 ) && FD_UNLIKELY( close( fd ) ) )
+    FD_LOG_WARNING(( "close(\"%s\") failed (%i-%s); attempting to continue", path, errno, fd_io_strerror( errno ) ));
+  return err_fail;
+}
+
+int
+fd_funk_checkpt_incr_restore( fd_funk_t *  funk,
+                              char const * path,
+                              ulong *      _rec_cnt ) {
+
+  if( FD_UNLIKELY( !funk ) ) { FD_LOG_WARNING(( "NULL funk" )); return FD_FUNK_ERR_INVAL; }
+  if( FD_UNLIKELY( !path ) ) { FD_LOG_WARNING(( "NULL path" )); return FD_FUNK_ERR_INVAL; }
+
+  fd_funk_check_write( funk );
+
+  if( FD_UNLIKELY( fd_funk_last_publish_is_frozen( funk ) ) ) {
+    FD_LOG_WARNING(( "incremental restore from \"%s\" failed because funk has transactions in preparation", path ));
+    return FD_FUNK_ERR_FROZEN;
+  }
+
+  fd_wksp_t *  wksp  = fd_funk_wksp( funk );
+  fd_alloc_t * alloc = fd_funk_alloc( funk, wksp );
+
+  int            err_fail = FD_FUNK_ERR_INVAL;
+  int            fd       = -1;
+  fd_restore_t * restore  = NULL;
+
+  fd = open( path, O_RDONLY, (mode_t)0 );
+  if( FD_UNLIKELY( fd==-1 ) ) {
+    FD_LOG_WARNING(( "incremental restore from \"%s\" failed opening file (%i-%s)", path, errno, fd_io_strerror( errno ) ));
+    return FD_FUNK_ERR_SYS;
+  }
+
+  fd_restore_t _restore[ 1 ];
+  uchar        rbuf[ FD_RESTORE_RBUF_MIN ];
+
+  restore = fd_restore_init_stream( _restore, fd, rbuf, FD_RESTORE_RBUF_MIN ); /* logs details */
+  if( FD_UNLIKELY( !restore ) ) { err_fail = FD_FUNK_ERR_SYS; goto fail; }
+
+# define RESTORE_TEST( c ) do {                                                    \
+    if( FD_UNLIKELY( !(c) ) ) {                                                    \
+      FD_LOG_WARNING(( "incremental restore from \"%s\" failed (%s)", path, #c )); \
+      goto fail;                                                                   \
+    }                                                                              \
+  } while(0)
+
+  /* Restore and validate the header */
+
+  fd_funk_checkpt_incr_hdr_t hdr[1];
+  RESTORE_TEST( !fd_restore_open ( restore, FD_CHECKPT_FRAME_STYLE_RAW            ) );
+  RESTORE_TEST( !fd_restore_meta ( restore, hdr, sizeof(fd_funk_checkpt_incr_hdr_t) ) );
+  RESTORE_TEST( !fd_restore_close( restore                                        ) );
+
+  RESTORE_TEST( hdr->magic==FD_FUNK_CHECKPT_INCR_MAGIC                      );
+  RESTORE_TEST( fd_checkpt_frame_style_is_supported( hdr->frame_style )     );
+  RESTORE_TEST( hdr->seq==hdr->base_seq+1UL                                 );
+  RESTORE_TEST( hdr->base_seq==funk->checkpt_seq                            );
+
+  /* Apply the records.  From here on, failures leave the funk in an
+     intermediate state. */
+
+  ulong val_sz_tot = 0UL;
+
+  RESTORE_TEST( !fd_restore_open( restore, hdr->frame_style ) );
+  for( ulong rec_rem=hdr->rec_cnt; rec_rem; rec_rem-- ) {
+    fd_funk_checkpt_incr_rec_t meta[1];
+    RESTORE_TEST( !fd_restore_meta( restore, meta, sizeof(fd_funk_checkpt_incr_rec_t) ) );
+    RESTORE_TEST( !(meta->flags & FD_FUNK_REC_FLAG_DIRTY) );
+
+    int erase = !!(meta->flags & FD_FUNK_REC_FLAG_ERASE);
+    RESTORE_TEST( !(erase && meta->val_sz) );
+
+    /* Find or create the record in the last published transaction
+       (fd_funk_rec_query includes tombstones, insert revives them). */
+
+    fd_funk_rec_t * rec = fd_funk_rec_modify( funk, fd_funk_rec_query( funk, NULL, meta->key ) );
+    if( !rec ) {
+      int err = FD_FUNK_SUCCESS;
+      rec = fd_funk_rec_modify( funk, fd_funk_rec_insert( funk, NULL, meta->key, &err ) );
+      if( FD_UNLIKELY( !rec ) ) {
+        FD_LOG_WARNING(( "incremental restore from \"%s\" failed inserting record (%i-%s)", path, err, fd_funk_strerror( err ) ));
+        err_fail = err;
+        goto fail;
+      }
+    }
+
+    if( erase ) {
+
+      int err = fd_funk_rec_remove( funk, rec, 0UL );
+      if( FD_UNLIKELY( err ) ) {
+        FD_LOG_WARNING(( "incremental restore from \"%s\" failed removing record (%i-%s)", path, err, fd_funk_strerror( err ) ));
+        err_fail = err;
+        goto fail;
+      }
+
+    } else {
+
+      int err = FD_FUNK_SUCCESS;
+      rec->flags &= ~FD_FUNK_REC_FLAG_ERASE;
+      if( FD_UNLIKELY( !fd_funk_val_truncate( rec, (ulong)meta->val_sz, alloc, wksp, &err ) ) ) {
+        FD_LOG_WARNING(( "incremental restore from \"%s\" failed sizing record value (%i-%s)", path, err, fd_funk_strerror( err ) ));
+        err_fail = err;
+        goto fail;
+      }
+
+      /* Note: the value allocation is stable until frame close */
+
+      if( meta->val_sz ) RESTORE_TEST( !fd_restore_data( restore, fd_funk_val( rec, wksp ), (ulong)meta->val_sz ) );
+
+      if( FD_UNLIKELY( rec->part!=meta->part ) ) {
+        err = fd_funk_part_set( funk, rec, meta->part );
+        if( FD_UNLIKELY( err ) ) {
+          FD_LOG_WARNING(( "incremental restore from \"%s\" failed setting record partition %u (%i-%s)",
+                           path, meta->part, err, fd_funk_strerror( err ) ));
+          err_fail = err;
+          goto fail;
+        }
+      }
+
+    }
+
+    rec->flags  = meta->flags;
+    val_sz_tot += (ulong)meta->val_sz;
+  }
+  RESTORE_TEST( !fd_restore_close( restore ) );
+
+  /* Restore and validate the footer */
+
+  fd_funk_checkpt_incr_ftr_t ftr[1];
+  RESTORE_TEST( !fd_restore_open ( restore, FD_CHECKPT_FRAME_STYLE_RAW            ) );
+  RESTORE_TEST( !fd_restore_meta ( restore, ftr, sizeof(fd_funk_checkpt_incr_ftr_t) ) );
+  RESTORE_TEST( !fd_restore_close( restore                                        ) );
+
+  RESTORE_TEST( ftr->magic     ==FD_FUNK_CHECKPT_INCR_MAGIC );
+  RESTORE_TEST( ftr->rec_cnt   ==hdr->rec_cnt               );
+  RESTORE_TEST( ftr->val_sz_tot==val_sz_tot                 );
+  RESTORE_TEST( ftr->seq       ==hdr->seq                   );
+
+# undef RESTORE_TEST
+
+  restore = NULL;
+  if( FD_UNLIKELY( !fd_restore_fini( _restore ) ) ) goto fail; /* logs details */
+
+  if( FD_UNLIKELY( close( fd ) ) )
+    FD_LOG_WARNING(( "close(\"%s\") failed (%i-%s); attempting to continue", path, errno, fd_io_strerror( errno ) ));
+
+  fd_funk_txn_xid_copy( funk->last_publish, hdr->last_publish );
+  funk->checkpt_seq = hdr->seq;
+
+  FD_LOG_INFO(( "incremental restore %lu from \"%s\": %lu records, %lu value bytes", hdr->seq, path, hdr->rec_cnt, val_sz_tot ));
+
+  if( _rec_cnt ) *_rec_cnt = hdr->rec_cnt;
+  return FD_FUNK_SUCCESS;
+
+fail:
+
+  /* Release resources that might be reserved */
+
+  if( FD_LIKELY( restore ) ) {
+    if( FD_UNLIKELY( fd_restore_in_frame( restore ) ) && FD_UNLIKELY( fd_restore_close( restore ) ) )
+      FD_LOG_WARNING(( "fd_restore_close failed; attempting to continue" ));
+
+    if( FD_UNLIKELY( !fd_restore_fini( restore ) ) ) /* logs details */
+      FD_LOG_WARNING(( "fd_restore_fini failed; attempting to continue" ));
+  }
+
+  if( FD_UNLIKELY( close( fd ) ) )
+    FD_LOG_WARNING(( "close(\"%s\") failed (%i-%s); attempting to continue", path, errno, fd_io_strerror( errno ) ));
+  return err_fail;
+}
@@ -0,0 +1,112 @@
+#ifndef HEADER_fd_src_funk_fd_funk_checkpt_h
+#define HEADER_fd_src_funk_fd_funk_checkpt_h
+
+/* APIs for incremental funk checkpoints.
+
+   A full checkpoint of a funk is a wksp checkpoint of the wksp backing
+   it (fd_wksp_checkpt / fd_funk_recover_checkpoint).  For large funks,
+   this writes many GiB on every checkpoint even if only a tiny fraction
+   of records changed since the last one.
+
+   An incremental checkpoint instead only contains the records of the
+   last published transaction that were dirtied (created, updated or
+   erased) by a fd_funk_txn_publish since the previous checkpoint.  A
+   restore is then a full restore of a base checkpoint followed by
+   applying the incremental checkpoints taken after it in order:
+
+     fd_funk_t * funk = fd_funk_recover_checkpoint( NULL, wksp_tag, "base.wksp", &close_args );
+     fd_funk_start_write( funk );
+     for( ulong i=0UL; i<incr_cnt; i++ ) fd_funk_checkpt_incr_restore( funk, incr_path[i], NULL );
+     fd_funk_end_write( funk );
+
+   Incremental checkpoints are chained by funk->checkpt_seq.  Writing an
+   incremental checkpoint of a funk whose checkpt_seq is N produces a
+   checkpoint with seq N+1 that can only be applied to a funk whose
+   checkpt_seq is N (and applying it advances the funk's checkpt_seq to
+   N+1 and its last published xid to the xid at the time the
+   checkpoint was written).  A full checkpoint captures checkpt_seq
+   along with the rest of the funk so the first incremental checkpoint
+   taken after a full checkpoint chains onto it.
+
+   IMPORTANT SAFETY TIP!  Only changes made by publishing are tracked.
+   Records of the last published transaction modified directly (e.g.
+   while loading a snapshot into a childless funk) and tombstones
+   removed with fd_funk_rec_forget before they were captured by a
+   checkpoint are not.  Take a full checkpoint (followed by
+   fd_funk_checkpt_dirty_clear) after doing such operations. */
+
+#include "fd_funk.h"
+#include "../util/checkpt/fd_checkpt.h"
+
+/* FD_FUNK_CHECKPT_INCR_MAGIC identifies an incremental funk
+   checkpoint. */
+
+#define FD_FUNK_CHECKPT_INCR_MAGIC (0xf17eda2ce7c4c101UL) /* firedancer funk incr checkpt version 1 */
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_funk_checkpt_dirty_cnt returns the number of records of the last
+   published transaction that would be written by the next incremental
+   checkpoint.  Assumes funk is a current local join.  This is
+   O(number of records in the last published transaction). */
+
+FD_FN_PURE ulong
+fd_funk_checkpt_dirty_cnt( fd_funk_t * funk );
+
+/* fd_funk_checkpt_dirty_clear marks all records of the last published
+   transaction as clean.  Typically used immediately after a successful
+   full checkpoint such that the next incremental checkpoint only
+   contains changes made after it.  Assumes funk is a current local join
+   and the caller is in a write block. */
+
+void
+fd_funk_checkpt_dirty_clear( fd_funk_t * funk );
+
+/* fd_funk_checkpt_incr writes an incremental checkpoint of funk to the
+   file at path.  The file will be created with the given permissions
+   and must not already exist.  frame_style is the FD_CHECKPT_FRAME_STYLE
+   to use for the record data (0 indicates the default).  Assumes funk
+   is a current local join, the caller is in a write block and there are
+   no concurrent operations on funk.
+
+   On success, returns FD_FUNK_SUCCESS, the funk's records are all clean
+   and the funk's checkpt_seq has been incremented.  If _rec_cnt is
+   non-NULL, *_rec_cnt will hold the number of records written.  On
+   failure, returns a FD_FUNK_ERR_* (logs details), the funk is
+   unchanged and the partially written file (if any) should be
+   discarded.  Reasons for failure include INVAL (bad input args,
+   unsupported frame style) and SYS (file I/O errors). */
+
+int
+fd_funk_checkpt_incr( fd_funk_t *  funk,
+                      char const * path,
+                      ulong        mode,
+                      int          frame_style,
+                      ulong *      _rec_cnt );
+
+/* fd_funk_checkpt_incr_restore applies the incremental checkpoint at
+   path to funk.  The funk should be childless and its checkpt_seq
+   should match the checkpt_seq of the funk the checkpoint was taken
+   from at the time it was taken.  Assumes funk is a current local join,
+   the caller is in a write block and there are no concurrent operations
+   on funk.
+
+   On success, returns FD_FUNK_SUCCESS.  If _rec_cnt is non-NULL,
+   *_rec_cnt will hold the number of records applied.  The funk's
+   checkpt_seq and last published xid will match those recorded in the
+   checkpoint.  On failure, returns a FD_FUNK_ERR_* (logs details).
+   Reasons for failure include INVAL (bad input args, corrupt checkpoint
+   or sequence mismatch), FROZEN (funk has children), REC / MEM (funk
+   too small to hold the restored records) and SYS (file I/O errors).
+   If the failure happened while records were being applied, the funk
+   is in an intermediate state and should be restored from a full
+   checkpoint again. */
+
+int
+fd_funk_checkpt_incr_restore( fd_funk_t *  funk,
+                              char const * path,
+                              ulong *      _rec_cnt );
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_funk_fd_funk_checkpt_h */
@@ -20,9 +20,15 @@
    - ERASE indicates a record in an in-preparation transaction should be
    erased if and when the in-preparation transaction is published. If
    set on a published record, it serves as a tombstone.
-   If set, there will be no value resources used by this record. */
+   If set, there will be no value resources used by this record.
+
+   - DIRTY indicates a record of the last published transaction was
+   created, updated or erased by a publish since the last incremental
+   checkpoint (see fd_funk_checkpt.h).  It is only ever set on records
+   of the last published transaction. */
 
 #define FD_FUNK_REC_FLAG_ERASE (1UL<<0)
+#define FD_FUNK_REC_FLAG_DIRTY (1UL<<1)
 
 /* FD_FUNK_REC_IDX_NULL gives the map record idx value used to represent
    NULL.  This value also set a limit on how large rec_max can be. */
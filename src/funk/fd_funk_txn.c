@@ -583,6 +583,11 @@ fd_funk_txn_update( ulong *                   _dst_rec_head_idx, /* Pointer to t
     rec->pair.xid[0] = *dst_xid;
     rec->txn_cidx = fd_funk_txn_cidx( dst_txn_idx );
 
+    /* Publishing into the last published transaction dirties the
+       record for the next incremental checkpoint. */
+
+    rec->flags |= fd_ulong_if( fd_funk_txn_idx_is_null( dst_txn_idx ), FD_FUNK_REC_FLAG_DIRTY, 0UL );
+
     if( fd_funk_rec_idx_is_null( *_dst_rec_head_idx ) ) {
       *_dst_rec_head_idx = rec_idx;
       rec->prev_idx = FD_FUNK_REC_IDX_NULL;
@@ -0,0 +1,226 @@
+#include "fd_funk_checkpt.h"
+
+#if FD_HAS_HOSTED
+
+#include <stdio.h>
+#include <unistd.h>
+
+#define KEY_MAX (256UL)
+
+static fd_funk_rec_key_t *
+key_set( fd_funk_rec_key_t * key,
+         ulong               k ) {
+  memset( key, 0, sizeof(fd_funk_rec_key_t) );
+  key->ul[0] = k;
+  return key;
+}
+
+/* rec_set writes a value derived from (k,v) to key k in txn (NULL for
+   the last published transaction). */
+
+static void
+rec_set( fd_funk_t *     funk,
+         fd_funk_txn_t * txn,
+         ulong           k,
+         ulong           v ) {
+  fd_wksp_t *       wksp = fd_funk_wksp( funk );
+  fd_funk_rec_key_t key[1];
+  ulong             sz   = 8UL*(1UL + (v % 67UL));
+  fd_funk_rec_t *   rec  = fd_funk_rec_write_prepare( funk, txn, key_set( key, k ), 0UL, 1, NULL, NULL ); FD_TEST( rec );
+  FD_TEST( fd_funk_val_truncate( rec, sz, fd_funk_alloc( funk, wksp ), wksp, NULL ) );
+  ulong * val = (ulong *)fd_funk_val( rec, wksp );
+  for( ulong i=0UL; i<sz/8UL; i++ ) val[i] = fd_ulong_hash( k ^ (v<<20) ^ i );
+}
+
+static void
+rec_del( fd_funk_t *     funk,
+         fd_funk_txn_t * txn,
+         ulong           k ) {
+  fd_funk_rec_key_t     key[1];
+  fd_funk_rec_t const * rec = fd_funk_rec_query( funk, txn, key_set( key, k ) );
+  if( !rec ) {
+    if( !fd_funk_rec_query_global( funk, txn, key, NULL ) ) return;
+    rec = fd_funk_rec_insert( funk, txn, key, NULL ); FD_TEST( rec );
+  }
+  FD_TEST( !fd_funk_rec_remove( funk, fd_funk_rec_modify( funk, rec ), k ) );
+}
+
+/* funk_eq tests that the last published transactions of funk a and b
+   hold identical records. */
+
+static void
+funk_eq( fd_funk_t * a,
+         fd_funk_t * b ) {
+  fd_wksp_t * wksp_a = fd_funk_wksp( a );
+  fd_wksp_t * wksp_b = fd_funk_wksp( b );
+  FD_TEST( fd_funk_txn_xid_eq( fd_funk_last_publish( a ), fd_funk_last_publish( b ) ) );
+  FD_TEST( a->checkpt_seq==b->checkpt_seq );
+  for( ulong k=0UL; k<KEY_MAX; k++ ) {
+    fd_funk_rec_key_t     key[1];
+    fd_funk_rec_t const * ra = fd_funk_rec_query( a, NULL, key_set( key, k ) );
+    fd_funk_rec_t const * rb = fd_funk_rec_query( b, NULL, key );
+    FD_TEST( !ra==!rb );
+    if( !ra ) continue;
+    FD_TEST( (ra->flags & ~FD_FUNK_REC_FLAG_DIRTY)==(rb->flags & ~FD_FUNK_REC_FLAG_DIRTY) );
+    if( ra->flags & FD_FUNK_REC_FLAG_ERASE ) continue;
+    FD_TEST( fd_funk_val_sz( ra )==fd_funk_val_sz( rb ) );
+    FD_TEST( !memcmp( fd_funk_val_const( ra, wksp_a ), fd_funk_val_const( rb, wksp_b ), fd_funk_val_sz( ra ) ) );
+  }
+}
+
+static fd_funk_t *
+funk_create( fd_wksp_t * wksp,
+             ulong       wksp_tag,
+             ulong       seed ) {
+  fd_funk_t * funk = fd_funk_join( fd_funk_new( fd_wksp_alloc_laddr( wksp, fd_funk_align(), fd_funk_footprint(), wksp_tag ),
+                                                wksp_tag, seed, 64UL, 4096UL ) );
+  FD_TEST( funk );
+  return funk;
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  char const * _page_sz = fd_env_strip_cmdline_cstr ( &argc, &argv, "--page-sz",  NULL,      "gigantic" );
+  ulong        page_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--page-cnt", NULL,             1UL );
+  ulong        near_cpu = fd_env_strip_cmdline_ulong( &argc, &argv, "--near-cpu", NULL, fd_log_cpu_id() );
+  ulong        wksp_tag = fd_env_strip_cmdline_ulong( &argc, &argv, "--wksp-tag", NULL,          1234UL );
+  ulong        seed     = fd_env_strip_cmdline_ulong( &argc, &argv, "--seed",     NULL,          5678UL );
+  ulong        iter_max = fd_env_strip_cmdline_ulong( &argc, &argv, "--iter-max", NULL,            16UL );
+
+  FD_LOG_NOTICE(( "Using --page-sz %s --page-cnt %lu --near-cpu %lu --wksp-tag %lu --seed %lu --iter-max %lu",
+                  _page_sz, page_cnt, near_cpu, wksp_tag, seed, iter_max ));
+
+  fd_wksp_t * wksp = fd_wksp_new_anonymous( fd_cstr_to_shmem_page_sz( _page_sz ), page_cnt, near_cpu, "wksp", 0UL );
+  FD_TEST( wksp );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  /* src is the live funk, dst starts from the same base state and is
+     brought up to date by incremental checkpoints of src only */
+
+  fd_funk_t * src = funk_create( wksp, wksp_tag, seed );
+  fd_funk_t * dst = funk_create( wksp, wksp_tag, seed );
+
+  /* Load the same base state directly into the last published
+     transaction of both (this does not dirty records).  Note that funk
+     write blocks are process wide so src and dst are written in
+     separate blocks. */
+
+  fd_funk_start_write( src ); for( ulong k=0UL; k<KEY_MAX; k+=2UL ) rec_set( src, NULL, k, 0UL ); fd_funk_end_write( src );
+  fd_funk_start_write( dst ); for( ulong k=0UL; k<KEY_MAX; k+=2UL ) rec_set( dst, NULL, k, 0UL ); fd_funk_end_write( dst );
+  FD_TEST( !fd_funk_checkpt_dirty_cnt( src ) );
+  funk_eq( src, dst );
+
+  char path[ 2 ][ 64 ];
+  for( ulong i=0UL; i<2UL; i++ ) {
+    snprintf( path[i], 64UL, "/tmp/test_funk_checkpt.%i.%lu", (int)getpid(), i );
+    unlink( path[i] );
+  }
+
+  /* Bad args */
+
+  fd_funk_start_write( src );
+  FD_TEST( fd_funk_checkpt_incr( NULL, path[0], 0600UL, 0, NULL )==FD_FUNK_ERR_INVAL );
+  FD_TEST( fd_funk_checkpt_incr( src,  NULL,    0600UL, 0, NULL )==FD_FUNK_ERR_INVAL );
+  FD_TEST( fd_funk_checkpt_incr( src,  path[0], 0600UL, -1, NULL )==FD_FUNK_ERR_INVAL );
+  fd_funk_end_write( src );
+
+  fd_funk_start_write( dst );
+  FD_TEST( fd_funk_checkpt_incr_restore( NULL, path[0], NULL )==FD_FUNK_ERR_INVAL );
+  FD_TEST( fd_funk_checkpt_incr_restore( dst,  NULL,    NULL )==FD_FUNK_ERR_INVAL );
+  FD_TEST( fd_funk_checkpt_incr_restore( dst,  path[0], NULL )==FD_FUNK_ERR_SYS   ); /* No file */
+  fd_funk_end_write( dst );
+
+  ulong slot = 1UL;
+  for( ulong iter=0UL; iter<iter_max; iter++ ) {
+
+    /* Publish a few slots worth of random changes on src */
+
+    fd_funk_start_write( src );
+    ulong slot_cnt = 1UL + fd_rng_ulong_roll( rng, 4UL );
+    for( ulong s=0UL; s<slot_cnt; s++ ) {
+      fd_funk_txn_xid_t xid[1] = {{ .ul = { slot, slot } }};
+      fd_funk_txn_t * txn = fd_funk_txn_prepare( src, NULL, xid, 1 ); FD_TEST( txn );
+      ulong op_cnt = fd_rng_ulong_roll( rng, 64UL );
+      for( ulong op=0UL; op<op_cnt; op++ ) {
+        ulong k = fd_rng_ulong_roll( rng, KEY_MAX );
+        if( fd_rng_uint_roll( rng, 4U ) ) rec_set( src, txn, k, slot );
+        else                              rec_del( src, txn, k );
+      }
+      FD_TEST( fd_funk_txn_publish( src, txn, 1 )==1UL );
+      slot++;
+    }
+
+    /* Incrementally checkpt src and layer it onto dst */
+
+    char const * p = path[ iter & 1UL ];
+
+    ulong dirty_cnt = fd_funk_checkpt_dirty_cnt( src );
+    ulong seq       = src->checkpt_seq;
+    ulong rec_cnt   = ULONG_MAX;
+    FD_TEST( !fd_funk_checkpt_incr( src, p, 0600UL, 0, &rec_cnt ) );
+    FD_TEST( rec_cnt==dirty_cnt );
+    FD_TEST( src->checkpt_seq==seq+1UL );
+    FD_TEST( !fd_funk_checkpt_dirty_cnt( src ) );
+
+    FD_TEST( fd_funk_checkpt_incr( src, p, 0600UL, 0, NULL )==FD_FUNK_ERR_SYS ); /* File exists */
+    FD_TEST( src->checkpt_seq==seq+1UL );
+    fd_funk_end_write( src );
+
+    fd_funk_start_write( dst );
+    rec_cnt = ULONG_MAX;
+    FD_TEST( !fd_funk_checkpt_incr_restore( dst, p, &rec_cnt ) );
+    FD_TEST( rec_cnt==dirty_cnt );
+    funk_eq( src, dst );
+    FD_TEST( !fd_funk_verify( dst ) );
+
+    /* Reapplying out of sequence fails without modifying dst */
+
+    FD_TEST( fd_funk_checkpt_incr_restore( dst, p, NULL )==FD_FUNK_ERR_INVAL );
+    if( iter ) FD_TEST( fd_funk_checkpt_incr_restore( dst, path[ (iter+1UL) & 1UL ], NULL )==FD_FUNK_ERR_INVAL );
+    funk_eq( src, dst );
+    fd_funk_end_write( dst );
+
+    FD_TEST( !unlink( path[ (iter+1UL) & 1UL ] ) || iter==0UL );
+  }
+
+  /* A frozen dst can't be restored into */
+
+  fd_funk_start_write( src );
+  FD_TEST( !fd_funk_checkpt_incr( src, path[ iter_max & 1UL ], 0600UL, 0, NULL ) );
+  FD_TEST( !fd_funk_verify( src ) );
+  fd_funk_end_write( src );
+
+  fd_funk_start_write( dst );
+  fd_funk_txn_xid_t xid[1] = {{ .ul = { slot, slot } }};
+  FD_TEST( fd_funk_txn_prepare( dst, NULL, xid, 1 ) );
+  FD_TEST( fd_funk_checkpt_incr_restore( dst, path[ iter_max & 1UL ], NULL )==FD_FUNK_ERR_FROZEN );
+  fd_funk_end_write( dst );
+
+  for( ulong i=0UL; i<2UL; i++ ) unlink( path[i] );
+
+  fd_wksp_free_laddr( fd_funk_delete( fd_funk_leave( dst ) ) );
+  fd_wksp_free_laddr( fd_funk_delete( fd_funk_leave( src ) ) );
+  fd_rng_delete( fd_rng_leave( rng ) );
+  fd_wksp_delete_anonymous( wksp );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
+
+#else
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+  FD_LOG_WARNING(( "skip: unit test requires FD_HAS_HOSTED capabilities" ));
+  fd_halt();
+  return 0;
+}
+
+#endif
@@ -993,6 +993,15 @@ fd_wksp_pod_unmap( void * obj );
    will make a best effort to clean up after any partially written
    checkpt file.
 
+   For styles that support it (e.g. V2 and V3), the checkpt is written
+   in parallel: each thread compresses a load balanced block of the
+   wksp's allocations and blocks written by threads other than t0 are
+   staged in temporary files next to path (removed on creation, so
+   nothing is left behind on failure) and then appended in order.  The
+   file system holding path should have room for about twice the
+   checkpt size while a parallel checkpt is in progress.  The resulting
+   checkpt is the same regardless of the number of threads used.
+
    fd_wksp_checkpt is a convenience wrapper for serial checkpts. */
 
 int
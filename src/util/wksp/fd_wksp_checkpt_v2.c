@@ -1,6 +1,7 @@
 #include "fd_wksp_private.h"
 
 #include <errno.h>
+#include <limits.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <sys/stat.h>
@@ -10,6 +11,206 @@
 
 #define FD_WKSP_CHECKPT_V2_CGROUP_MAX (1024UL)
 
+/* fd_wksp_private_checkpt_v2_cgroup writes the cgroup frame for the
+   wksp partitions in the linked list headed by head_cidx (linked via
+   stack_cidx and sorted by gaddr_lo) to checkpt.  Assumes all inputs
+   are valid, the wksp is locked and checkpt is not in a frame.  On
+   success, returns SUCCESS, *_frame_off will hold the offset of the
+   frame in the checkpt and *_frame_off_nxt will hold the offset of the
+   first byte after it.  On failure, returns FAIL (logs details) and
+   checkpt might be in a frame. */
+
+static int
+fd_wksp_private_checkpt_v2_cgroup( fd_wksp_t *    wksp,
+                                   fd_checkpt_t * checkpt,
+                                   int            frame_style_compressed,
+                                   uint           head_cidx,
+                                   ulong *        _frame_off,
+                                   ulong *        _frame_off_nxt ) {
+
+  fd_wksp_private_pinfo_t * pinfo = fd_wksp_private_pinfo( wksp );
+
+  int err = fd_checkpt_open_advanced( checkpt, frame_style_compressed, _frame_off ); /* logs details */
+  if( FD_UNLIKELY( err ) ) goto fail;
+
+  /* Write cgroup commands */
+
+  fd_wksp_checkpt_v2_cmd_t cmd[1];
+
+  ulong part_idx = fd_wksp_private_pinfo_idx( head_cidx );
+  while( !fd_wksp_private_pinfo_idx_is_null( part_idx ) ) {
+
+    /* Command: "meta (tag,gaddr_lo,gaddr_hi)" */
+
+    cmd->meta.tag      = pinfo[ part_idx ].tag;      /* Note: non-zero */
+    cmd->meta.gaddr_lo = pinfo[ part_idx ].gaddr_lo;
+    cmd->meta.gaddr_hi = pinfo[ part_idx ].gaddr_hi;
+
+    err = fd_checkpt_meta( checkpt, cmd, sizeof(fd_wksp_checkpt_v2_cmd_t) ); /* logs details */
+    if( FD_UNLIKELY( err ) ) goto fail;
+
+    part_idx = fd_wksp_private_pinfo_idx( pinfo[ part_idx ].stack_cidx );
+  }
+
+  /* Command: "corresponding data follows" */
+
+  cmd->data.tag        = 0UL;
+  cmd->data.cgroup_cnt = ULONG_MAX;
+  cmd->data.frame_off  = ULONG_MAX;
+
+  err = fd_checkpt_meta( checkpt, cmd, sizeof(fd_wksp_checkpt_v2_cmd_t) ); /* logs details */
+  if( FD_UNLIKELY( err ) ) goto fail;
+
+  /* Write cgroup partition data */
+
+  part_idx = fd_wksp_private_pinfo_idx( head_cidx );
+  while( !fd_wksp_private_pinfo_idx_is_null( part_idx ) ) {
+    ulong gaddr_lo = pinfo[ part_idx ].gaddr_lo;
+    ulong gaddr_hi = pinfo[ part_idx ].gaddr_hi;
+
+    err = fd_checkpt_data( checkpt, fd_wksp_laddr_fast( wksp, gaddr_lo ), gaddr_hi - gaddr_lo ); /* logs details */
+    if( FD_UNLIKELY( err ) ) goto fail;
+
+    part_idx = fd_wksp_private_pinfo_idx( pinfo[ part_idx ].stack_cidx );
+  }
+
+  err = fd_checkpt_close_advanced( checkpt, _frame_off_nxt ); /* logs details */
+  if( FD_UNLIKELY( err ) ) goto fail;
+
+  return FD_WKSP_SUCCESS;
+
+fail:
+  FD_LOG_WARNING(( "checkpt wksp \"%s\" failed when writing a cgroup frame (%i-%s)",
+                   wksp->name, err, fd_checkpt_strerror( err ) ));
+  return FD_WKSP_ERR_FAIL;
+}
+
+/* A fd_wksp_private_checkpt_v2_par_t describes how the cgroup frames
+   of a checkpt are split over tpool threads.  The cgroups are
+   partitioned into block_cnt contiguous blocks.  Block 0 is written by
+   thread t0 directly into the checkpt.  Block block_idx>0 is written by
+   thread t0+block_idx as an independent checkpt stream into a
+   temporary file (unlinked on creation) that is appended to the
+   checkpt by thread t0 after all blocks are done.  Since frames are
+   independently compressed, the resulting checkpt is identical to a
+   serial checkpt of the same wksp. */
+
+struct fd_wksp_private_checkpt_v2_par {
+  fd_wksp_t *    wksp;
+  char const *   path;
+  fd_checkpt_t * checkpt;          /* checkpt for block 0 */
+  int            frame_style_compressed;
+  ulong          t0;               /* thread that handles block 0 */
+  uint const *   cgroup_head_cidx; /* indexed [0,cgroup_cnt) */
+  ulong *        cgroup_frame_off; /* indexed [0,cgroup_cnt), relative to the start of the block's stream */
+  ulong const *  block_cgroup_lo;  /* indexed [0,block_cnt], block block_idx has cgroups [lo[block_idx],lo[block_idx+1]) */
+  int *          block_fd;         /* indexed [0,block_cnt), temporary file for the block (-1 if none) */
+  ulong *        block_sz;         /* indexed [0,block_cnt), size of the block's stream (end offset for block 0) */
+  int *          block_err;        /* indexed [0,block_cnt), SUCCESS or a FD_WKSP_ERR code */
+};
+
+typedef struct fd_wksp_private_checkpt_v2_par fd_wksp_private_checkpt_v2_par_t;
+
+/* fd_wksp_private_checkpt_v2_node dispatches the writing of cgroup
+   blocks to tpool threads [t0,t1).  Thread t writes block t-par->t0.
+   Assumes caller is thread t0 and threads (t0,t1) are available.  The
+   results for each block are returned in par. */
+
+static void
+fd_wksp_private_checkpt_v2_node( void * tpool,
+                                 ulong  tpool_t0,
+                                 ulong  tpool_t1,  /* Assumes t1>t0 */
+                                 void * _par,
+                                 void * reduce,    ulong stride,
+                                 ulong  l0,        ulong l1,
+                                 ulong  m0,        ulong m1,
+                                 ulong  n0,        ulong n1 ) {
+  (void)reduce; (void)stride; (void)l0; (void)l1; (void)m0; (void)m1; (void)n0; (void)n1;
+
+  /* If this node is responsible for more than one thread, split the
+     range into left and right halves, have the first right half thread
+     handle the right half and use this thread to handle the left
+     half. */
+
+  ulong tpool_cnt = tpool_t1 - tpool_t0;
+  if( tpool_cnt>1UL ) {
+    ulong tpool_ts = tpool_t0 + fd_tpool_private_split( tpool_cnt );
+    fd_tpool_exec( (fd_tpool_t *)tpool, tpool_ts, fd_wksp_private_checkpt_v2_node,
+                   tpool, tpool_ts, tpool_t1, _par, NULL, 0UL, 0UL, 0UL, 0UL, 0UL, 0UL, 0UL );
+    fd_wksp_private_checkpt_v2_node( tpool, tpool_t0, tpool_ts, _par, NULL, 0UL, 0UL, 0UL, 0UL, 0UL, 0UL, 0UL );
+    fd_tpool_wait( (fd_tpool_t *)tpool, tpool_ts );
+    return;
+  }
+
+  /* This node is responsible for a single block */
+
+  fd_wksp_private_checkpt_v2_par_t * par = (fd_wksp_private_checkpt_v2_par_t *)_par;
+
+  ulong block_idx = tpool_t0 - par->t0;
+  ulong cgroup_lo = par->block_cgroup_lo[ block_idx     ];
+  ulong cgroup_hi = par->block_cgroup_lo[ block_idx+1UL ];
+
+  int            err     = FD_WKSP_SUCCESS;
+  int            fd      = -1;
+  fd_checkpt_t * checkpt = par->checkpt;
+  ulong          off     = 0UL;
+
+  fd_checkpt_t _checkpt[ 1 ];
+  uchar        wbuf[ FD_CHECKPT_WBUF_MIN ];
+
+  if( block_idx ) {
+
+    /* Create a temporary file for this block next to the checkpt (such
+       that it is likely on the same file system) and unlink it
+       immediately such that it doesn't outlive us. */
+
+    char tmp_path[ PATH_MAX ];
+    if( FD_UNLIKELY( !fd_cstr_printf_check( tmp_path, PATH_MAX, NULL, "%s.%lu", par->path, block_idx ) ) ) {
+      FD_LOG_WARNING(( "checkpt to \"%s\" failed because path is too long for a temporary file", par->path ));
+      err = FD_WKSP_ERR_FAIL;
+      goto done;
+    }
+
+    fd = open( tmp_path, O_CREAT|O_EXCL|O_RDWR, (mode_t)0600 );
+    if( FD_UNLIKELY( fd==-1 ) ) {
+      FD_LOG_WARNING(( "open(\"%s\",O_CREAT|O_EXCL|O_RDWR,0600) failed (%i-%s)", tmp_path, errno, fd_io_strerror( errno ) ));
+      err = FD_WKSP_ERR_FAIL;
+      goto done;
+    }
+
+    if( FD_UNLIKELY( unlink( tmp_path ) ) )
+      FD_LOG_WARNING(( "unlink(\"%s\") failed (%i-%s); attempting to continue", tmp_path, errno, fd_io_strerror( errno ) ));
+
+    checkpt = fd_checkpt_init_stream( _checkpt, fd, wbuf, FD_CHECKPT_WBUF_MIN ); /* logs details */
+    if( FD_UNLIKELY( !checkpt ) ) {
+      err = FD_WKSP_ERR_FAIL;
+      goto done;
+    }
+
+  }
+
+  for( ulong cgroup_idx=cgroup_lo; cgroup_idx<cgroup_hi; cgroup_idx++ ) {
+    err = fd_wksp_private_checkpt_v2_cgroup( par->wksp, checkpt, par->frame_style_compressed, par->cgroup_head_cidx[ cgroup_idx ],
+                                             &par->cgroup_frame_off[ cgroup_idx ], &off ); /* logs details */
+    if( FD_UNLIKELY( err ) ) break;
+  }
+
+  if( block_idx ) {
+    if( FD_UNLIKELY( fd_checkpt_in_frame( checkpt ) ) && FD_UNLIKELY( fd_checkpt_close( checkpt ) ) )
+      FD_LOG_WARNING(( "fd_checkpt_close failed; attempting to continue" ));
+
+    if( FD_UNLIKELY( !fd_checkpt_fini( checkpt ) ) ) { /* logs details */
+      FD_LOG_WARNING(( "fd_checkpt_fini failed" ));
+      err = fd_int_if( !!err, err, FD_WKSP_ERR_FAIL );
+    }
+  }
+
+done:
+  par->block_fd [ block_idx ] = fd;
+  par->block_sz [ block_idx ] = off;
+  par->block_err[ block_idx ] = err;
+}
+
 int
 fd_wksp_private_checkpt_v2( fd_tpool_t * tpool,
                             ulong        t0,
@@ -20,8 +221,6 @@ fd_wksp_private_checkpt_v2( fd_tpool_t * tpool,
                             char const * uinfo,
                             int          frame_style_compressed ) {
 
-  (void)tpool; (void)t0; (void)t1; /* Thread parallelization not currently implemented */
-
   char const * binfo = fd_log_build_info;
 
   if( FD_UNLIKELY( !fd_checkpt_frame_style_is_supported( frame_style_compressed ) ) ) {
@@ -31,9 +230,11 @@ fd_wksp_private_checkpt_v2( fd_tpool_t * tpool,
 
   int err_fail;
 
-  int            locked  =  0;
-  int            fd      = -1;
-  fd_checkpt_t * checkpt = NULL;
+  int            locked    =  0;
+  int            fd        = -1;
+  fd_checkpt_t * checkpt   = NULL;
+  ulong          block_cnt = 0UL;
+  int            block_fd[ FD_WKSP_CHECKPT_V2_CGROUP_MAX ]; /* Temporary files of parallel cgroup blocks, valid for [0,block_cnt) */
 
   fd_wksp_private_pinfo_t * pinfo = fd_wksp_private_pinfo( wksp );
 
@@ -162,13 +363,12 @@ fd_wksp_private_checkpt_v2( fd_tpool_t * tpool,
 
   uint  cgroup_head_cidx[ FD_WKSP_CHECKPT_V2_CGROUP_MAX ]; /* Head of a linked list for partitions assigned to each cgroup */
   ulong cgroup_alloc_cnt[ FD_WKSP_CHECKPT_V2_CGROUP_MAX ]; /* Number of partitions in each cgroup */
+  ulong cgroup_load     [ FD_WKSP_CHECKPT_V2_CGROUP_MAX ]; /* Uncompressed bytes in each cgroup */
 
   {
 
     /* Initialize the cgroups to empty */
 
-    ulong cgroup_load[ FD_WKSP_CHECKPT_V2_CGROUP_MAX ];
-
     uint null_cidx = fd_wksp_private_pinfo_cidx( FD_WKSP_PRIVATE_PINFO_IDX_NULL );
     for( ulong cgroup_idx=0UL; cgroup_idx<cgroup_cnt; cgroup_idx++ ) {
       cgroup_head_cidx[ cgroup_idx ] = null_cidx;
@@ -289,6 +489,7 @@ fd_wksp_private_checkpt_v2( fd_tpool_t * tpool,
 
   ulong frame_off[ FD_WKSP_CHECKPT_V2_CGROUP_MAX+6UL ];
   ulong frame_cnt = 0UL;
+  ulong off_base  = 0UL; /* Offset in the file of the start of checkpt's stream */
 
   fd_checkpt_t  _checkpt[ 1 ];
   uchar         wbuf[ FD_CHECKPT_WBUF_MIN ];
@@ -308,6 +509,7 @@ fd_wksp_private_checkpt_v2( fd_tpool_t * tpool,
       err_fail = FD_WKSP_ERR_FAIL;                                                                                     \
       goto fail;                                                                                                       \
     }                                                                                                                  \
+    frame_off[ frame_cnt ] += off_base;                                                                                \
   } while(0)
 
 # define CHECKPT_CLOSE() do {                                                                                       \
@@ -319,6 +521,7 @@ fd_wksp_private_checkpt_v2( fd_tpool_t * tpool,
       err_fail = FD_WKSP_ERR_FAIL;                                                                                  \
       goto fail;                                                                                                    \
     }                                                                                                               \
+    frame_off[ frame_cnt ] += off_base;                                                                             \
   } while(0)
 
   /* Note: sz must be at most FD_CHECKPT_META_MAX */
@@ -413,60 +616,139 @@ fd_wksp_private_checkpt_v2( fd_tpool_t * tpool,
   /* Checkpt the volume cgroups.  Note: This implementation just
      checkpoints 1 volume with at most CGROUP_MAX cgroup_cnt groups.
 
-     Note: this loop can be parallelized over multiple threads if
-     willing to leave holes in the file (and then maybe do a second pass
-     to compact the holes or maybe do a planning pass and then a real
-     pass or maybe leave the holes and do a second pass of run length
-     and entropy coding or maybe write to separate files and distribute
-     as a multiple files or maybe use non-POSIX filesystem mojo to
-     stitch together the separate files to appear as one file or ...) */
-
-  for( ulong cgroup_idx=0UL; cgroup_idx<cgroup_cnt; cgroup_idx++ ) {
-
-    CHECKPT_OPEN( frame_style_compressed );
-
-    /* Write cgroup commands */
-
-    fd_wksp_checkpt_v2_cmd_t cmd[1];
+     The cgroups are split into block_cnt contiguous blocks with
+     approximately equal load and each block is written by its own tpool
+     thread (see fd_wksp_private_checkpt_v2_par_t).  Block 0 is written
+     directly into the checkpt and the remaining blocks are staged in
+     temporary files and then appended in order.  This costs an extra
+     sequential copy of all but the first block but the copy is cheap
+     relative to compressing it.  The resulting file is compactly stored
+     and bit-for-bit the same regardless of the number of threads used
+     (so it can be restored with streaming or with a different number of
+     threads). */
+
+  ulong off_end = frame_off[ frame_cnt ];
+
+  block_cnt = fd_ulong_min( fd_ulong_if( !!tpool, t1-t0, 1UL ), cgroup_cnt );
+  for( ulong block_idx=0UL; block_idx<block_cnt; block_idx++ ) block_fd[ block_idx ] = -1;
+
+  if( FD_LIKELY( block_cnt ) ) {
+
+    /* Partition the cgroups into block_cnt contiguous non-empty blocks
+       with approximately equal load. */
+
+    ulong block_cgroup_lo[ FD_WKSP_CHECKPT_V2_CGROUP_MAX+1UL ];
+
+    {
+      ulong load_tot = 0UL;
+      for( ulong cgroup_idx=0UL; cgroup_idx<cgroup_cnt; cgroup_idx++ ) load_tot += cgroup_load[ cgroup_idx ];
+
+      ulong cgroup_idx = 0UL;
+      ulong load_sum   = 0UL;
+      block_cgroup_lo[ 0 ] = 0UL;
+      for( ulong block_idx=1UL; block_idx<block_cnt; block_idx++ ) {
+        ulong load_tgt   = (load_tot / block_cnt)*block_idx;
+        ulong cgroup_max = cgroup_cnt - (block_cnt - block_idx); /* Leave at least one cgroup for each remaining block */
+        do load_sum += cgroup_load[ cgroup_idx++ ];
+        while( (cgroup_idx<cgroup_max) && ((load_sum + cgroup_load[ cgroup_idx ])<=load_tgt) );
+        block_cgroup_lo[ block_idx ] = cgroup_idx;
+      }
+      block_cgroup_lo[ block_cnt ] = cgroup_cnt;
+    }
 
-    ulong part_idx = fd_wksp_private_pinfo_idx( cgroup_head_cidx[ cgroup_idx ] );
-    while( !fd_wksp_private_pinfo_idx_is_null( part_idx ) ) {
+    /* Write the blocks */
+
+    ulong block_sz [ FD_WKSP_CHECKPT_V2_CGROUP_MAX ];
+    int   block_err[ FD_WKSP_CHECKPT_V2_CGROUP_MAX ];
+
+    fd_wksp_private_checkpt_v2_par_t par[1];
+
+    par->wksp                   = wksp;
+    par->path                   = path;
+    par->checkpt                = checkpt;
+    par->frame_style_compressed = frame_style_compressed;
+    par->t0                     = t0;
+    par->cgroup_head_cidx       = cgroup_head_cidx;
+    par->cgroup_frame_off       = frame_off + frame_cnt;
+    par->block_cgroup_lo        = block_cgroup_lo;
+    par->block_fd               = block_fd;
+    par->block_sz               = block_sz;
+    par->block_err              = block_err;
+
+    fd_wksp_private_checkpt_v2_node( tpool, t0, t0+block_cnt, par, NULL, 0UL, 0UL, 0UL, 0UL, 0UL, 0UL, 0UL );
+
+    for( ulong block_idx=0UL; block_idx<block_cnt; block_idx++ ) {
+      if( FD_UNLIKELY( block_err[ block_idx ] ) ) {
+        FD_LOG_WARNING(( "checkpt wksp \"%s\" to \"%s\" failed when writing cgroup block %lu; attempting to continue",
+                         name, path, block_idx ));
+        err_fail = block_err[ block_idx ];
+        goto fail;
+      }
+    }
 
-      /* Command: "meta (tag,gaddr_lo,gaddr_hi)" */
+    off_end = block_sz[ 0 ];
 
-      cmd->meta.tag      = pinfo[ part_idx ].tag;      /* Note: non-zero */
-      cmd->meta.gaddr_lo = pinfo[ part_idx ].gaddr_lo;
-      cmd->meta.gaddr_hi = pinfo[ part_idx ].gaddr_hi;
+    /* Append the remaining blocks to the checkpt.  We finish the
+       checkpt's stream first and start a new one afterward as we are
+       writing to its file descriptor behind its back. */
 
-      CHECKPT_META( cmd, sizeof(fd_wksp_checkpt_v2_cmd_t) );
+    if( block_cnt>1UL ) {
 
-      part_idx = fd_wksp_private_pinfo_idx( pinfo[ part_idx ].stack_cidx );
-    }
+      fd_checkpt_t * _fini = fd_checkpt_fini( checkpt ); /* logs details */
+      checkpt = NULL;
+      if( FD_UNLIKELY( !_fini ) ) {
+        FD_LOG_WARNING(( "checkpt wksp \"%s\" to \"%s\" failed when finalizing cgroup block 0; attempting to continue", name, path ));
+        err_fail = FD_WKSP_ERR_FAIL;
+        goto fail;
+      }
 
-    /* Command: "corresponding data follows" */
+      for( ulong block_idx=1UL; block_idx<block_cnt; block_idx++ ) {
+
+        void const * mmio;
+        ulong        mmio_sz;
+        int          err = fd_io_mmio_init( block_fd[ block_idx ], FD_IO_MMIO_MODE_READ_ONLY, &mmio, &mmio_sz );
+        if( FD_UNLIKELY( (!!err) | (mmio_sz!=block_sz[ block_idx ]) ) ) {
+          FD_LOG_WARNING(( "checkpt wksp \"%s\" to \"%s\" failed when mapping cgroup block %lu (%i-%s); attempting to continue",
+                           name, path, block_idx, err, fd_io_strerror( err ) ));
+          if( mmio_sz ) fd_io_mmio_fini( mmio, mmio_sz );
+          err_fail = FD_WKSP_ERR_FAIL;
+          goto fail;
+        }
 
-    cmd->data.tag        = 0UL;
-    cmd->data.cgroup_cnt = ULONG_MAX;
-    cmd->data.frame_off  = ULONG_MAX;
+        ulong wsz;
+        err = fd_io_write( fd, mmio, mmio_sz, mmio_sz, &wsz );
+        fd_io_mmio_fini( mmio, mmio_sz );
+        if( FD_UNLIKELY( err ) ) {
+          FD_LOG_WARNING(( "checkpt wksp \"%s\" to \"%s\" failed when appending cgroup block %lu (%i-%s); attempting to continue",
+                           name, path, block_idx, err, fd_io_strerror( err ) ));
+          err_fail = FD_WKSP_ERR_FAIL;
+          goto fail;
+        }
 
-    CHECKPT_META( cmd, sizeof(fd_wksp_checkpt_v2_cmd_t) );
+        /* Relocate the block's frame offsets */
 
-    /* Write cgroup partition data */
+        for( ulong cgroup_idx=block_cgroup_lo[ block_idx ]; cgroup_idx<block_cgroup_lo[ block_idx+1UL ]; cgroup_idx++ )
+          frame_off[ frame_cnt + cgroup_idx ] += off_end;
+        off_end += block_sz[ block_idx ];
 
-    part_idx = fd_wksp_private_pinfo_idx( cgroup_head_cidx[ cgroup_idx ] );
-    while( !fd_wksp_private_pinfo_idx_is_null( part_idx ) ) {
-      ulong gaddr_lo = pinfo[ part_idx ].gaddr_lo;
-      ulong gaddr_hi = pinfo[ part_idx ].gaddr_hi;
-
-      CHECKPT_DATA( fd_wksp_laddr_fast( wksp, gaddr_lo ), gaddr_hi - gaddr_lo );
+        if( FD_UNLIKELY( close( block_fd[ block_idx ] ) ) )
+          FD_LOG_WARNING(( "close failed (%i-%s); attempting to continue", errno, fd_io_strerror( errno ) ));
+        block_fd[ block_idx ] = -1;
+      }
 
-      part_idx = fd_wksp_private_pinfo_idx( pinfo[ part_idx ].stack_cidx );
+      checkpt = fd_checkpt_init_stream( _checkpt, fd, wbuf, FD_CHECKPT_WBUF_MIN ); /* logs details */
+      if( FD_UNLIKELY( !checkpt ) ) {
+        FD_LOG_WARNING(( "checkpt wksp \"%s\" to \"%s\" failed when reinitializing; attempting to continue", name, path ));
+        err_fail = FD_WKSP_ERR_FAIL;
+        goto fail;
+      }
+      off_base = off_end;
     }
-
-    CHECKPT_CLOSE();
-
   }
 
+  frame_cnt += cgroup_cnt;
+  frame_off[ frame_cnt ] = off_end;
+
   /* Checkpt the volume appendix.  This starts with a command that
      indicates this frame is an appendix for cgroup_cnt cgroups (this
      can be used in a streaming restore to tell when it has reached the
@@ -584,6 +866,10 @@ fail:
   if( FD_LIKELY( fd!=-1 ) && FD_UNLIKELY( close( fd ) ) )
     FD_LOG_WARNING(( "close(\"%s\") failed (%i-%s); attempting to continue", path, errno, fd_io_strerror( errno ) ));
 
+  for( ulong block_idx=0UL; block_idx<block_cnt; block_idx++ )
+    if( FD_UNLIKELY( block_fd[ block_idx ]!=-1 ) && FD_UNLIKELY( close( block_fd[ block_idx ] ) ) )
+      FD_LOG_WARNING(( "close failed (%i-%s); attempting to continue", errno, fd_io_strerror( errno ) ));
+
   if( FD_LIKELY( locked ) ) fd_wksp_private_unlock( wksp );
 
   return err_fail;
@@ -4,4 +4,6 @@ ifdef FD_HAS_LINUX
 $(call add-hdrs,fd_neigh4_netlink.h fd_neigh4_probe.h)
 $(call add-objs,fd_neigh4_netlink fd_neigh4_probe,fd_waltz)
 $(call make-unit-test,test_neigh4_netlink,test_neigh4_netlink,fd_waltz fd_util)
+$(call make-unit-test,test_neigh4_probe,test_neigh4_probe,fd_waltz fd_util)
+$(call run-unit-test,test_neigh4_probe)
 endif
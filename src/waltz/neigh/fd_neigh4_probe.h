@@ -103,6 +103,22 @@ fd_neigh4_probe( fd_neigh4_prober_t * prober,
                  uint                 ip4_addr,
                  long                 now );
 
+/* fd_neigh4_prober_has_spare returns 1 if one more probe can be sent
+   at time now while leaving at least reserve tokens in the global rate
+   limit budget, 0 otherwise.  Does not consume any tokens.  Used by
+   speculative probing (e.g. prefetching) to leave budget to on-demand
+   probes.  Should be checked before every speculative probe, since
+   each probe consumes a token. */
+
+static inline int
+fd_neigh4_prober_has_spare( fd_neigh4_prober_t const * prober,
+                            float                      reserve,
+                            long                       now ) {
+  fd_token_bucket_t const * bucket = &prober->rate_limit;
+  float balance = fminf( bucket->balance + (float)( now - bucket->ts )*bucket->rate, bucket->burst );
+  return balance >= reserve+1.0f;
+}
+
 /* fd_neigh4_probe_rate_limited calls fd_neigh4_probe unless that would
    violate rate limits.  Returns 0 if a probe was sent out.  Returns
    positive errno on probe failure.  Returns -1 if rate limit was hit. */
@@ -0,0 +1,79 @@
+#include "fd_neigh4_probe.h"
+#include "../../util/fd_util.h"
+
+/* Times in this test are in ticks.  The global probe budget refills
+   at 1 token per 1000 ticks, with a burst of 16 tokens. */
+
+static void
+prober_reset( fd_neigh4_prober_t * prober,
+              float                balance ) {
+  memset( prober, 0, sizeof(fd_neigh4_prober_t) );
+  prober->sock_fd            = -1;
+  prober->rate_limit.ts      = 0L;
+  prober->rate_limit.rate    = 1e-3f;
+  prober->rate_limit.burst   = 16.0f;
+  prober->rate_limit.balance = balance;
+}
+
+/* spec_burst mimics a speculative probe burst (see neigh4_prefetch in
+   fd_netlink_tile.c): visits up to burst_max peers needing a probe,
+   stopping once a probe would eat into reserve.  Returns the number
+   of probes taken. */
+
+static ulong
+spec_burst( fd_neigh4_prober_t * prober,
+            float                reserve,
+            ulong                burst_max,
+            long                 now ) {
+  ulong cnt = 0UL;
+  for( ulong j=0UL; j<burst_max; j++ ) {
+    if( !fd_neigh4_prober_has_spare( prober, reserve, now ) ) break;
+    FD_TEST( fd_token_bucket_consume( &prober->rate_limit, 1.0f, now ) );
+    cnt++;
+  }
+  return cnt;
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  fd_neigh4_prober_t prober[1];
+  float const reserve = 8.0f;
+
+  /* A full budget allows probes down to the reserve, not beyond */
+  prober_reset( prober, 16.0f );
+  FD_TEST( spec_burst( prober, reserve, 16UL, 0L )==8UL );
+  FD_TEST( prober->rate_limit.balance>=reserve );
+  FD_TEST( !fd_neigh4_prober_has_spare( prober, reserve, 0L ) );
+
+  /* Just above the reserve, a burst of 16 only gets the excess */
+  prober_reset( prober, 9.5f );
+  FD_TEST( fd_neigh4_prober_has_spare( prober, reserve, 0L ) );
+  FD_TEST( spec_burst( prober, reserve, 16UL, 0L )==1UL );
+  FD_TEST( prober->rate_limit.balance>=reserve );
+
+  /* Refill over time makes room for more probes */
+  FD_TEST( !fd_neigh4_prober_has_spare( prober, reserve, 499L ) );
+  FD_TEST(  fd_neigh4_prober_has_spare( prober, reserve, 500L ) );
+  FD_TEST( spec_burst( prober, reserve, 16UL, 2500L )==3UL );
+  FD_TEST( prober->rate_limit.balance>=reserve );
+
+  /* Refill is capped at the burst size */
+  FD_TEST( spec_burst( prober, reserve, 16UL, 1000000L )==8UL );
+
+  /* has_spare does not consume tokens */
+  prober_reset( prober, 1.0f );
+  for( ulong j=0UL; j<4UL; j++ ) FD_TEST( fd_neigh4_prober_has_spare( prober, 0.0f, 0L ) );
+  FD_TEST( prober->rate_limit.balance==1.0f );
+
+  /* Without reserve, the whole budget can be used */
+  prober_reset( prober, 16.0f );
+  FD_TEST( spec_burst( prober, 0.0f, 32UL, 0L )==16UL );
+  FD_TEST( !fd_neigh4_prober_has_spare( prober, 0.0f, 0L ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
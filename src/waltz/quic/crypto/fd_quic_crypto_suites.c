@@ -128,6 +128,89 @@ fd_quic_gen_keys(
       FD_QUIC_CRYPTO_LABEL_QUIC_IV_LEN );
 }
 
+/* fd_quic_crypto_key_eq returns 1 if the 16 byte keys a and b are
+   equal, 0 otherwise.  The comparison itself is branch-free, but the
+   callers branch on its result: whether a lookup hits reveals if the
+   key equals the one cached in its slot (e.g. after a key update), not
+   which bytes differ. */
+
+static inline int
+fd_quic_crypto_key_eq( uchar const a[ 16 ],
+                       uchar const b[ 16 ] ) {
+  return 0UL==( ( FD_LOAD( ulong, a   ) ^ FD_LOAD( ulong, b   ) ) |
+                ( FD_LOAD( ulong, a+8 ) ^ FD_LOAD( ulong, b+8 ) ) );
+}
+
+/* fd_quic_crypto_gcm returns an AES-GCM cipher for the given packet
+   protection key, initialized for a message with the given nonce.  The
+   cipher is taken from cache slot slot if possible.  Otherwise
+   (including if cache is NULL), the key is expanded into the cache slot
+   or into scratch. */
+
+static fd_aes_gcm_t *
+fd_quic_crypto_gcm( fd_quic_crypto_cache_t * cache,
+                    ulong                    slot,
+                    fd_aes_gcm_t *           scratch,
+                    uchar const              key  [ FD_AES_128_KEY_SZ ],
+                    uchar const              nonce[ FD_QUIC_NONCE_SZ  ] ) {
+  if( !cache ) {
+    fd_aes_128_gcm_init( scratch, key, nonce );
+    return scratch;
+  }
+
+  fd_quic_crypto_cache_gcm_t * ent = &cache->gcm[ slot ];
+  if( FD_LIKELY( ent->valid && fd_quic_crypto_key_eq( ent->key, key ) ) ) {
+    fd_aes_gcm_set_iv( &ent->gcm, nonce );
+  } else {
+    fd_aes_128_gcm_init( &ent->gcm, key, nonce );
+    memcpy( ent->key, key, FD_AES_128_KEY_SZ );
+    ent->valid = 1;
+  }
+  return &ent->gcm;
+}
+
+/* fd_quic_crypto_hp returns an expanded AES-ECB key for the given
+   header protection key.  Works like fd_quic_crypto_gcm. */
+
+static fd_aes_key_t *
+fd_quic_crypto_hp( fd_quic_crypto_cache_t * cache,
+                   ulong                    slot,
+                   fd_aes_key_t *           scratch,
+                   uchar const              key[ FD_AES_128_KEY_SZ ] ) {
+  if( !cache ) {
+    fd_aes_set_encrypt_key( key, 128, scratch );
+    return scratch;
+  }
+
+  fd_quic_crypto_cache_hp_t * ent = &cache->hp[ slot ];
+  if( FD_UNLIKELY( !ent->valid || !fd_quic_crypto_key_eq( ent->key, key ) ) ) {
+    fd_aes_set_encrypt_key( key, 128, &ent->ecb );
+    memcpy( ent->key, key, FD_AES_128_KEY_SZ );
+    ent->valid = 1;
+  }
+  return &ent->ecb;
+}
+
+void
+fd_quic_crypto_cache_evict_pkt( fd_quic_crypto_cache_t * cache,
+                                ulong                    conn_idx,
+                                uchar const              key[ FD_AES_128_KEY_SZ ] ) {
+  for( int tx=0; tx<2; tx++ ) {
+    fd_quic_crypto_cache_gcm_t * ent = &cache->gcm[ fd_quic_crypto_cache_slot( conn_idx, tx ) ];
+    if( ent->valid && fd_quic_crypto_key_eq( ent->key, key ) ) fd_memset_explicit( ent, 0, sizeof(fd_quic_crypto_cache_gcm_t) );
+  }
+}
+
+void
+fd_quic_crypto_cache_evict_hp( fd_quic_crypto_cache_t * cache,
+                               ulong                    conn_idx,
+                               uchar const              key[ FD_AES_128_KEY_SZ ] ) {
+  for( int tx=0; tx<2; tx++ ) {
+    fd_quic_crypto_cache_hp_t * ent = &cache->hp[ fd_quic_crypto_cache_slot( conn_idx, tx ) ];
+    if( ent->valid && fd_quic_crypto_key_eq( ent->key, key ) ) fd_memset_explicit( ent, 0, sizeof(fd_quic_crypto_cache_hp_t) );
+  }
+}
+
 /* encrypt a packet
 
    uses the keys in keys to encrypt the packet "pkt" with header "hdr"
@@ -156,7 +239,7 @@ fd_quic_gen_keys(
      */
 
 int
-fd_quic_crypto_encrypt(
+fd_quic_crypto_encrypt_cached(
     uchar *                        const out,
     ulong *                        const out_sz,
     uchar const *                  const hdr,
@@ -165,7 +248,9 @@ fd_quic_crypto_encrypt(
     ulong                          const pkt_sz,
     fd_quic_crypto_keys_t const *  const pkt_keys,
     fd_quic_crypto_keys_t const *  const hp_keys,
-    ulong                          const pkt_number ) {
+    ulong                          const pkt_number,
+    fd_quic_crypto_cache_t *       const cache,
+    ulong                          const conn_idx ) {
 
 
   /* ensure we have enough space in the output buffer
@@ -203,8 +288,8 @@ fd_quic_crypto_encrypt(
 
   // Initial packets cipher uses AEAD_AES_128_GCM with keys derived from the Destination Connection ID field of the
   // first Initial packet sent by the client; see rfc9001 Section 5.2.
-  fd_aes_gcm_t pkt_cipher[1];
-  fd_aes_128_gcm_init( pkt_cipher, pkt_keys->pkt_key, nonce );
+  fd_aes_gcm_t   _pkt_cipher[1];
+  fd_aes_gcm_t * pkt_cipher = fd_quic_crypto_gcm( cache, fd_quic_crypto_cache_slot( conn_idx, 1 ), _pkt_cipher, pkt_keys->pkt_key, nonce );
 
   /* cipher_text is start of encrypted packet bytes, which starts after the header */
   uchar * cipher_text = out + hdr_sz;
@@ -221,8 +306,8 @@ fd_quic_crypto_encrypt(
      so shorter packet numbers means sample starts later in the cipher text */
   uchar const * sample = pkt_number_ptr + 4;
 
-  fd_aes_key_t ecb[1];
-  fd_aes_set_encrypt_key( hp_keys->hp_key, 128, ecb );
+  fd_aes_key_t   _ecb[1];
+  fd_aes_key_t * ecb = fd_quic_crypto_hp( cache, fd_quic_crypto_cache_slot( conn_idx, 1 ), _ecb, hp_keys->hp_key );
   uchar hp_cipher[16];
   fd_aes_encrypt( sample, hp_cipher, ecb );
 
@@ -242,12 +327,14 @@ fd_quic_crypto_encrypt(
 }
 
 int
-fd_quic_crypto_decrypt(
+fd_quic_crypto_decrypt_cached(
     uchar *                       buf,
     ulong                         buf_sz,
     ulong                         pkt_number_off,
     ulong                         pkt_number,
-    fd_quic_crypto_keys_t const * keys ) {
+    fd_quic_crypto_keys_t const * keys,
+    fd_quic_crypto_cache_t *      cache,
+    ulong                         conn_idx ) {
 
   if( FD_UNLIKELY( ( pkt_number_off >= buf_sz      ) |
                    ( buf_sz < FD_QUIC_SHORTEST_PKT ) ) ) {
@@ -286,8 +373,8 @@ fd_quic_crypto_decrypt(
   uchar * const gcm_tag = buf_end - FD_QUIC_CRYPTO_TAG_SZ;
   ulong   const gcm_sz  = (ulong)( gcm_tag - out );
 
-  fd_aes_gcm_t pkt_cipher[1];
-  fd_aes_128_gcm_init( pkt_cipher, keys->pkt_key, nonce );
+  fd_aes_gcm_t   _pkt_cipher[1];
+  fd_aes_gcm_t * pkt_cipher = fd_quic_crypto_gcm( cache, fd_quic_crypto_cache_slot( conn_idx, 0 ), _pkt_cipher, keys->pkt_key, nonce );
 
   int decrypt_ok =
    fd_aes_gcm_decrypt( pkt_cipher,
@@ -305,11 +392,13 @@ fd_quic_crypto_decrypt(
 
 
 int
-fd_quic_crypto_decrypt_hdr(
+fd_quic_crypto_decrypt_hdr_cached(
     uchar *                        buf,
     ulong                          buf_sz,
     ulong                          pkt_number_off,
-    fd_quic_crypto_keys_t const *  keys ) {
+    fd_quic_crypto_keys_t const *  keys,
+    fd_quic_crypto_cache_t *       cache,
+    ulong                          conn_idx ) {
 
   /* bounds checks */
   if( FD_UNLIKELY( ( buf_sz < FD_QUIC_CRYPTO_TAG_SZ ) |
@@ -331,8 +420,8 @@ fd_quic_crypto_decrypt_hdr(
 
   /* TODO this is hardcoded to AES-128 */
   uchar hp_cipher[16];
-  fd_aes_key_t ecb[1];
-  fd_aes_set_encrypt_key( keys->hp_key, 128, ecb );
+  fd_aes_key_t   _ecb[1];
+  fd_aes_key_t * ecb = fd_quic_crypto_hp( cache, fd_quic_crypto_cache_slot( conn_idx, 0 ), _ecb, keys->hp_key );
   fd_aes_encrypt( sample, hp_cipher, ecb );
 
   /* hp_cipher is mask */
@@ -356,3 +445,36 @@ fd_quic_crypto_decrypt_hdr(
 
   return FD_QUIC_SUCCESS;
 }
+
+int
+fd_quic_crypto_encrypt(
+    uchar *                        const out,
+    ulong *                        const out_sz,
+    uchar const *                  const hdr,
+    ulong                          const hdr_sz,
+    uchar const *                  const pkt,
+    ulong                          const pkt_sz,
+    fd_quic_crypto_keys_t const *  const pkt_keys,
+    fd_quic_crypto_keys_t const *  const hp_keys,
+    ulong                          const pkt_number ) {
+  return fd_quic_crypto_encrypt_cached( out, out_sz, hdr, hdr_sz, pkt, pkt_sz, pkt_keys, hp_keys, pkt_number, NULL, 0UL );
+}
+
+int
+fd_quic_crypto_decrypt(
+    uchar *                       buf,
+    ulong                         buf_sz,
+    ulong                         pkt_number_off,
+    ulong                         pkt_number,
+    fd_quic_crypto_keys_t const * keys ) {
+  return fd_quic_crypto_decrypt_cached( buf, buf_sz, pkt_number_off, pkt_number, keys, NULL, 0UL );
+}
+
+int
+fd_quic_crypto_decrypt_hdr(
+    uchar *                        buf,
+    ulong                          buf_sz,
+    ulong                          pkt_number_off,
+    fd_quic_crypto_keys_t const *  keys ) {
+  return fd_quic_crypto_decrypt_hdr_cached( buf, buf_sz, pkt_number_off, keys, NULL, 0UL );
+}
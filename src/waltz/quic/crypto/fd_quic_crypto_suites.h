@@ -42,6 +42,49 @@ struct fd_quic_crypto_keys {
   uchar hp_key [FD_AES_128_KEY_SZ];
 };
 
+/* fd_quic_crypto_cache_t caches the expanded AES key schedules (and
+   AES-GCM GHASH key powers) of recently used packet protection and
+   header protection keys.  Expanding a key costs a large fraction of
+   decrypting a full-size packet, and connections usually send bursts
+   of packets under the same keys.  The cache is direct-mapped by conn
+   index and direction (see fd_quic_crypto_cache_slot), never by key
+   bytes, such that which slot a key occupies (observable through cache
+   timing) reveals nothing about it.  Each slot remembers its key.  A
+   lookup for a different key expands the key into the slot, so the
+   cache never affects the result of encryption or decryption. */
+
+#define FD_QUIC_CRYPTO_CACHE_CNT (16UL)
+
+struct __attribute__((aligned(FD_AES_GCM_ALIGN))) fd_quic_crypto_cache_gcm {
+  fd_aes_gcm_t gcm;
+  uchar        key[ FD_AES_128_KEY_SZ ];
+  int          valid;
+};
+typedef struct fd_quic_crypto_cache_gcm fd_quic_crypto_cache_gcm_t;
+
+struct fd_quic_crypto_cache_hp {
+  fd_aes_key_t ecb;
+  uchar        key[ FD_AES_128_KEY_SZ ];
+  int          valid;
+};
+typedef struct fd_quic_crypto_cache_hp fd_quic_crypto_cache_hp_t;
+
+struct fd_quic_crypto_cache {
+  fd_quic_crypto_cache_gcm_t gcm[ FD_QUIC_CRYPTO_CACHE_CNT ];
+  fd_quic_crypto_cache_hp_t  hp [ FD_QUIC_CRYPTO_CACHE_CNT ];
+};
+typedef struct fd_quic_crypto_cache fd_quic_crypto_cache_t;
+
+/* fd_quic_crypto_cache_slot returns the cache slot for the keys conn
+   conn_idx uses to receive (tx==0) or send (tx==1) packets.  All enc
+   levels and key phases of a direction share a slot. */
+
+FD_FN_CONST static inline ulong
+fd_quic_crypto_cache_slot( ulong conn_idx,
+                           int   tx ) {
+  return ( (conn_idx<<1) | (ulong)!!tx ) & (FD_QUIC_CRYPTO_CACHE_CNT-1UL);
+}
+
 /* define enums for encryption levels */
 #define fd_quic_enc_level_initial_id    0
 #define fd_quic_enc_level_early_data_id 1
@@ -175,6 +218,25 @@ fd_quic_crypto_encrypt(
     fd_quic_crypto_keys_t const *  const hp_keys,
     ulong                          const pkt_number );
 
+/* fd_quic_crypto_{encrypt,decrypt,decrypt_hdr}_cached are variants of
+   the above that take expanded keys from cache, in the slots of conn
+   conn_idx.  cache may be NULL, in which case keys are expanded on every
+   call. */
+
+int
+fd_quic_crypto_encrypt_cached(
+    uchar *                        const out,
+    ulong *                        const out_sz,
+    uchar const *                  const hdr,
+    ulong                          const hdr_sz,
+    uchar const *                  const pkt,
+    ulong                          const pkt_sz,
+    fd_quic_crypto_keys_t const *  const pkt_keys,
+    fd_quic_crypto_keys_t const *  const hp_keys,
+    ulong                          const pkt_number,
+    fd_quic_crypto_cache_t *       const cache,
+    ulong                          const conn_idx );
+
 
 /* decrypt a quic protected packet
 
@@ -205,6 +267,16 @@ fd_quic_crypto_decrypt(
     ulong                          pkt_number,
     fd_quic_crypto_keys_t const *  keys );
 
+int
+fd_quic_crypto_decrypt_cached(
+    uchar *                        buf,
+    ulong                          buf_sz,
+    ulong                          pkt_number_off,
+    ulong                          pkt_number,
+    fd_quic_crypto_keys_t const *  keys,
+    fd_quic_crypto_cache_t *       cache,
+    ulong                          conn_idx );
+
 
 /* decrypt a quic protected packet header
 
@@ -235,6 +307,31 @@ fd_quic_crypto_decrypt_hdr(
     ulong                          pkt_number_off,
     fd_quic_crypto_keys_t const *  keys );
 
+int
+fd_quic_crypto_decrypt_hdr_cached(
+    uchar *                        buf,
+    ulong                          buf_sz,
+    ulong                          pkt_number_off,
+    fd_quic_crypto_keys_t const *  keys,
+    fd_quic_crypto_cache_t *       cache,
+    ulong                          conn_idx );
+
+/* fd_quic_crypto_cache_evict_{pkt,hp} wipe the cache entry of conn
+   conn_idx holding the expanded form of the given packet protection or
+   header protection key, if any.  Called whenever keys are discarded (key update, enc
+   level abandoned, conn freed) such that expanded key material does not
+   outlive the keys it was derived from. */
+
+void
+fd_quic_crypto_cache_evict_pkt( fd_quic_crypto_cache_t * cache,
+                                ulong                    conn_idx,
+                                uchar const              key[ FD_AES_128_KEY_SZ ] );
+
+void
+fd_quic_crypto_cache_evict_hp( fd_quic_crypto_cache_t * cache,
+                               ulong                    conn_idx,
+                               uchar const              key[ FD_AES_128_KEY_SZ ] );
+
 /* nonce is quic-iv XORed with 62-bits of byte-order packet-number */
 static inline void
 fd_quic_get_nonce(
@@ -405,6 +405,15 @@ fd_quic_init( fd_quic_t * quic ) {
     config->ack_threshold = FD_QUIC_DEFAULT_ACK_THRESHOLD;
   }
 
+  if( FD_UNLIKELY( config->shard_cnt>FD_QUIC_CONN_ID_SHARD_MAX ) ) {
+    FD_LOG_WARNING(( "cfg.shard_cnt too large (%lu>%lu)", config->shard_cnt, FD_QUIC_CONN_ID_SHARD_MAX ));
+    return NULL;
+  }
+  if( FD_UNLIKELY( config->shard_idx>=fd_ulong_max( config->shard_cnt, 1UL ) ) ) {
+    FD_LOG_WARNING(( "invalid cfg.shard_idx %lu (shard_cnt=%lu)", config->shard_idx, config->shard_cnt ));
+    return NULL;
+  }
+
   fd_quic_layout_t layout = {0};
   if( FD_UNLIKELY( !fd_quic_footprint_ext( &quic->limits, &layout ) ) ) {
     FD_LOG_CRIT(( "fd_quic_footprint_ext failed" ));
@@ -537,12 +546,21 @@ fd_quic_init( fd_quic_t * quic ) {
   }
   fd_rng_new( state->_rng, rng_seed, 0UL );
 
-  /* use rng to generate secret bytes for future RETRY token generation */
-  int rng1_ok = !!fd_rng_secure( state->retry_secret, FD_QUIC_RETRY_SECRET_SZ );
-  int rng2_ok = !!fd_rng_secure( state->retry_iv,     FD_QUIC_RETRY_IV_SZ     );
-  if( FD_UNLIKELY( !rng1_ok || !rng2_ok ) ) {
-    FD_LOG_ERR(( "fd_rng_secure failed" ));
-    return NULL;
+  /* use rng to generate secret bytes for future RETRY token generation,
+     unless the user provided them */
+  ulong retry_key_set = 0UL;
+  for( ulong i=0UL; i<FD_QUIC_RETRY_SECRET_SZ; i++ ) retry_key_set |= config->retry_secret[i];
+  for( ulong i=0UL; i<FD_QUIC_RETRY_IV_SZ;     i++ ) retry_key_set |= config->retry_iv    [i];
+  if( retry_key_set ) {
+    fd_memcpy( state->retry_secret, config->retry_secret, FD_QUIC_RETRY_SECRET_SZ );
+    fd_memcpy( state->retry_iv,     config->retry_iv,     FD_QUIC_RETRY_IV_SZ     );
+  } else {
+    int rng1_ok = !!fd_rng_secure( state->retry_secret, FD_QUIC_RETRY_SECRET_SZ );
+    int rng2_ok = !!fd_rng_secure( state->retry_iv,     FD_QUIC_RETRY_IV_SZ     );
+    if( FD_UNLIKELY( !rng1_ok || !rng2_ok ) ) {
+      FD_LOG_ERR(( "fd_rng_secure failed" ));
+      return NULL;
+    }
   }
 
   /* Initialize transport params */
@@ -1290,6 +1308,19 @@ fd_quic_conn_set_rx_max_data( fd_quic_conn_t * conn, ulong rx_max_data ) {
 
 /* packet processing */
 
+/* fd_quic_conn_keys_evict removes the keys of the given enc level of
+   conn from the crypto cache. */
+
+static void
+fd_quic_conn_keys_evict( fd_quic_conn_t * conn,
+                         uint             enc_level ) {
+  fd_quic_crypto_cache_t * cache = &fd_quic_get_state( conn->quic )->crypto_cache;
+  for( ulong k=0UL; k<2UL; k++ ) {
+    fd_quic_crypto_cache_evict_pkt( cache, conn->conn_idx, conn->keys[ enc_level ][ k ].pkt_key );
+    fd_quic_crypto_cache_evict_hp ( cache, conn->conn_idx, conn->keys[ enc_level ][ k ].hp_key  );
+  }
+}
+
 /* fd_quic_abandon_enc_level frees all resources associated encryption
    levels less or equal to enc_level. */
 
@@ -1304,6 +1335,7 @@ fd_quic_abandon_enc_level( fd_quic_conn_t * conn,
   fd_quic_pkt_meta_pool_t * pool = &conn->pkt_meta_pool;
 
   for( uint j = 0; j <= enc_level; ++j ) {
+    if( fd_uint_extract_bit( conn->keys_avail, (int)j ) ) fd_quic_conn_keys_evict( conn, j );
     conn->keys_avail = fd_uint_clear_bit( conn->keys_avail, (int)j );
 
     /* treat all packets as ACKed (freeing handshake data, etc.) */
@@ -1502,13 +1534,13 @@ fd_quic_handle_v1_initial( fd_quic_t *               quic,
 
       /* Handle retry if configured. */
       if( !quic->config.retry ) {
-        scid = fd_rng_ulong( state->_rng );
+        scid = fd_quic_conn_id_local( quic, state->_rng );
       } else {
         fd_quic_metrics_t * metrics = &quic->metrics;
 
         /* This is the initial packet before retry. */
         if( initial->token_len == 0 ) {
-          ulong new_conn_id_u64 = fd_rng_ulong( state->_rng );
+          ulong new_conn_id_u64 = fd_quic_conn_id_local( quic, state->_rng );
           if( FD_UNLIKELY( fd_quic_send_retry(
                 quic, pkt,
                 &odcid, peer_scid, new_conn_id_u64 ) ) ) {
@@ -1529,8 +1561,14 @@ fd_quic_handle_v1_initial( fd_quic_t *               quic,
           return FD_QUIC_PARSE_FAIL;
         };
 
-        /* Continue using the same SCID we used in the Retry packet. */
+        /* Continue using the same SCID we used in the Retry packet.
+           If the Retry was sent by another shard, pick a new SCID
+           owned by this shard instead. */
         scid = retry_src_conn_id;
+        if( FD_UNLIKELY( quic->config.shard_cnt>1UL &&
+                         fd_quic_conn_id_shard( scid )!=quic->config.shard_idx ) ) {
+          scid = fd_quic_conn_id_local( quic, state->_rng );
+        }
 
         /* From rfc 9000:
 
@@ -1653,9 +1691,11 @@ fd_quic_handle_v1_initial( fd_quic_t *               quic,
 # if !FD_QUIC_DISABLE_CRYPTO
   /* this decrypts the header */
   if( FD_UNLIKELY(
-        fd_quic_crypto_decrypt_hdr( cur_ptr, cur_sz,
-                                    pn_offset,
-                                    &conn->keys[0][0] ) != FD_QUIC_SUCCESS ) ) {
+        fd_quic_crypto_decrypt_hdr_cached( cur_ptr, cur_sz,
+                                           pn_offset,
+                                           &conn->keys[0][0],
+                                           &state->crypto_cache,
+                                           conn->conn_idx ) != FD_QUIC_SUCCESS ) ) {
     /* As this is an INITIAL packet, change the status to DEAD, and allow
         it to be reaped */
     FD_DEBUG( FD_LOG_DEBUG(( "fd_quic_crypto_decrypt_hdr failed" )) );
@@ -1678,10 +1718,12 @@ fd_quic_handle_v1_initial( fd_quic_t *               quic,
       It is permitted for some packet numbers to never be used, leaving intentional gaps. */
   /* this decrypts the header and payload */
   if( FD_UNLIKELY(
-        fd_quic_crypto_decrypt( cur_ptr, tot_sz,
-                                pn_offset,
-                                pkt_number,
-                                &conn->keys[0][0] ) != FD_QUIC_SUCCESS ) ) {
+        fd_quic_crypto_decrypt_cached( cur_ptr, tot_sz,
+                                       pn_offset,
+                                       pkt_number,
+                                       &conn->keys[0][0],
+                                       &state->crypto_cache,
+                                       conn->conn_idx ) != FD_QUIC_SUCCESS ) ) {
     FD_DEBUG( FD_LOG_DEBUG(( "fd_quic_crypto_decrypt failed" )) );
     FD_DTRACE_PROBE_3( quic_err_decrypt_initial_pkt, pkt->ip4, conn->our_conn_id, pkt->pkt_number );
     quic->metrics.pkt_decrypt_fail_cnt[ fd_quic_enc_level_initial_id ]++;
@@ -1814,9 +1856,11 @@ fd_quic_handle_v1_handshake(
 # if !FD_QUIC_DISABLE_CRYPTO
   /* this decrypts the header */
   if( FD_UNLIKELY(
-        fd_quic_crypto_decrypt_hdr( cur_ptr, cur_sz,
-                                    pn_offset,
-                                    &conn->keys[2][0] ) != FD_QUIC_SUCCESS ) ) {
+        fd_quic_crypto_decrypt_hdr_cached( cur_ptr, cur_sz,
+                                           pn_offset,
+                                           &conn->keys[2][0],
+                                           &fd_quic_get_state( quic )->crypto_cache,
+                                           conn->conn_idx ) != FD_QUIC_SUCCESS ) ) {
     FD_DEBUG( FD_LOG_DEBUG(( "fd_quic_crypto_decrypt_hdr failed" )) );
     quic->metrics.pkt_decrypt_fail_cnt[ fd_quic_enc_level_handshake_id ]++;
     return FD_QUIC_PARSE_FAIL;
@@ -1839,10 +1883,12 @@ fd_quic_handle_v1_handshake(
 # if !FD_QUIC_DISABLE_CRYPTO
   /* this decrypts the header and payload */
   if( FD_UNLIKELY(
-        fd_quic_crypto_decrypt( cur_ptr, tot_sz,
-                                pn_offset,
-                                pkt_number,
-                                &conn->keys[2][0] ) != FD_QUIC_SUCCESS ) ) {
+        fd_quic_crypto_decrypt_cached( cur_ptr, tot_sz,
+                                       pn_offset,
+                                       pkt_number,
+                                       &conn->keys[2][0],
+                                       &fd_quic_get_state( quic )->crypto_cache,
+                                       conn->conn_idx ) != FD_QUIC_SUCCESS ) ) {
     /* remove connection from map, and insert into free list */
     FD_DEBUG( FD_LOG_DEBUG(( "fd_quic_crypto_decrypt failed" )) );
     FD_DTRACE_PROBE_3( quic_err_decrypt_handshake_pkt, pkt->ip4, conn->our_conn_id, pkt->pkt_number );
@@ -2020,6 +2066,9 @@ fd_quic_key_update_complete( fd_quic_conn_t * conn ) {
   ulong const enc_level = fd_quic_enc_level_appdata_id;
 
   /* Update payload keys */
+  fd_quic_crypto_cache_t * cache = &fd_quic_get_state( conn->quic )->crypto_cache;
+  fd_quic_crypto_cache_evict_pkt( cache, conn->conn_idx, conn->keys[enc_level][0].pkt_key );
+  fd_quic_crypto_cache_evict_pkt( cache, conn->conn_idx, conn->keys[enc_level][1].pkt_key );
   memcpy( conn->keys[enc_level][0].pkt_key, conn->new_keys[0].pkt_key, FD_AES_128_KEY_SZ );
   memcpy( conn->keys[enc_level][0].iv,      conn->new_keys[0].iv,      FD_AES_GCM_IV_SZ  );
   memcpy( conn->keys[enc_level][1].pkt_key, conn->new_keys[1].pkt_key, FD_AES_128_KEY_SZ );
@@ -2067,9 +2116,11 @@ fd_quic_handle_v1_one_rtt( fd_quic_t *      quic,
 
 # if !FD_QUIC_DISABLE_CRYPTO
   if( FD_UNLIKELY(
-        fd_quic_crypto_decrypt_hdr( cur_ptr, tot_sz,
-                                    pn_offset,
-                                    &conn->keys[3][0] ) != FD_QUIC_SUCCESS ) ) {
+        fd_quic_crypto_decrypt_hdr_cached( cur_ptr, tot_sz,
+                                           pn_offset,
+                                           &conn->keys[3][0],
+                                           &fd_quic_get_state( quic )->crypto_cache,
+                                           conn->conn_idx ) != FD_QUIC_SUCCESS ) ) {
     FD_DEBUG( FD_LOG_DEBUG(( "fd_quic_crypto_decrypt_hdr failed" )) );
     quic->metrics.pkt_decrypt_fail_cnt[ fd_quic_enc_level_appdata_id ]++;
     return FD_QUIC_PARSE_FAIL;
@@ -2096,10 +2147,12 @@ fd_quic_handle_v1_one_rtt( fd_quic_t *      quic,
 
   /* this decrypts the header and payload */
   if( FD_UNLIKELY(
-        fd_quic_crypto_decrypt( cur_ptr, tot_sz,
-                                pn_offset,
-                                pkt_number,
-                                keys ) != FD_QUIC_SUCCESS ) ) {
+        fd_quic_crypto_decrypt_cached( cur_ptr, tot_sz,
+                                       pn_offset,
+                                       pkt_number,
+                                       keys,
+                                       &fd_quic_get_state( quic )->crypto_cache,
+                                       conn->conn_idx ) != FD_QUIC_SUCCESS ) ) {
     /* remove connection from map, and insert into free list */
     FD_DTRACE_PROBE_3( quic_err_decrypt_1rtt_pkt, pkt->ip4, conn->our_conn_id, pkt->pkt_number );
     quic->metrics.pkt_decrypt_fail_cnt[ fd_quic_enc_level_appdata_id ]++;
@@ -3801,8 +3854,8 @@ fd_quic_conn_tx( fd_quic_t *      quic,
     fd_quic_crypto_keys_t * hp_keys  = &conn->keys[enc_level][1];
     fd_quic_crypto_keys_t * pkt_keys = key_phase_upd ? &conn->new_keys[1] : &conn->keys[enc_level][1];
 
-    if( FD_UNLIKELY( fd_quic_crypto_encrypt( conn->tx_ptr, &cipher_text_sz, hdr_ptr, hdr_sz,
-          frame_start, frames_sz, pkt_keys, hp_keys, pkt_number ) != FD_QUIC_SUCCESS ) ) {
+    if( FD_UNLIKELY( fd_quic_crypto_encrypt_cached( conn->tx_ptr, &cipher_text_sz, hdr_ptr, hdr_sz,
+          frame_start, frames_sz, pkt_keys, hp_keys, pkt_number, &state->crypto_cache, conn->conn_idx ) != FD_QUIC_SUCCESS ) ) {
       FD_LOG_WARNING(( "fd_quic_crypto_encrypt failed" ));
 
       /* this situation is unlikely to improve, so kill the connection */
@@ -4070,7 +4123,12 @@ fd_quic_conn_free( fd_quic_t *      quic,
 
   quic->metrics.conn_active_cnt--;
 
-  /* clear keys */
+  /* clear keys, including their expanded form in the crypto cache */
+  for( uint j=0U; j<FD_QUIC_NUM_ENC_LEVELS; j++ ) {
+    if( fd_uint_extract_bit( conn->keys_avail, (int)j ) ) fd_quic_conn_keys_evict( conn, j );
+  }
+  fd_quic_crypto_cache_evict_pkt( &state->crypto_cache, conn->conn_idx, conn->new_keys[0].pkt_key );
+  fd_quic_crypto_cache_evict_pkt( &state->crypto_cache, conn->conn_idx, conn->new_keys[1].pkt_key );
   memset( &conn->secrets, 0, sizeof(fd_quic_crypto_secrets_t) );
   memset( conn->keys,     0, sizeof( conn->keys ) );
   memset( conn->new_keys, 0, sizeof( conn->new_keys ) );
@@ -4097,7 +4155,7 @@ fd_quic_connect( fd_quic_t *  quic,
 
   /* create conn ids for us and them
      client creates connection id for the peer, peer immediately replaces it */
-  ulong our_conn_id_u64 = fd_rng_ulong( rng );
+  ulong our_conn_id_u64 = fd_quic_conn_id_local( quic, rng );
   fd_quic_conn_id_t peer_conn_id;  fd_quic_conn_id_rand( &peer_conn_id, rng );
 
   fd_quic_conn_t * conn = fd_quic_conn_create(
@@ -15,6 +15,12 @@
    Scaling is achieved via fd_quic_t instances and steering of RX flows.
    For example, incoming RX that exceeds the throughput of one fd_quic_t
    may be load balanced based on QUIC dest conn ID, or UDP src flow ID.
+   Instances configured with cfg.shard_{idx,cnt} encode their index in
+   the conn IDs they issue, such that packets can be steered by dest
+   conn ID using fd_quic_pkt_shard (see fd_quic_conn_id.h).  Packets
+   without such a conn ID (Initial and 0-RTT) should be steered by UDP
+   src flow ID.  Sharded servers should share the same retry token keys
+   (cfg.retry_secret, cfg.retry_iv).
 
    This implementation aims to be compliant to RFC 9000 and RFC 9001:
    - https://datatracker.ietf.org/doc/html/rfc9000
@@ -179,6 +185,20 @@ struct __attribute__((aligned(16UL))) fd_quic_config {
   ulong retry_ttl;
 # define FD_QUIC_DEFAULT_RETRY_TTL (ulong)(1e9) /* 1s */
 
+  /* retry_{secret,iv}: keys used to protect retry tokens.  If all zero,
+     random keys are generated on init.  fd_quic_t instances sharing an
+     RX port should use the same keys, such that a retry token issued by
+     one instance can be validated by any other. */
+  uchar retry_secret[ FD_QUIC_RETRY_SECRET_SZ ];
+  uchar retry_iv    [ FD_QUIC_RETRY_IV_SZ     ];
+
+  /* shard_{idx,cnt}: If shard_cnt>1, this instance is shard shard_idx
+     of shard_cnt instances sharing an RX port.  All conn IDs issued by
+     this instance then encode shard_idx (see fd_quic_conn_id_shard).
+     shard_cnt<=FD_QUIC_CONN_ID_SHARD_MAX.  Zero is equivalent to one. */
+  ulong shard_idx;
+  ulong shard_cnt;
+
   /* TLS config ********************************************/
 
   /* identity_key: Ed25519 public key of node identity */
@@ -59,6 +59,57 @@ fd_quic_conn_id_rand( fd_quic_conn_id_t * conn_id,
   return conn_id;
 }
 
+/* Conn ID sharding **************************************************/
+
+/* Multiple fd_quic_t instances can share an RX port if each packet is
+   steered to the instance owning its conn.  A sharded instance issues
+   8 byte conn IDs whose most significant byte (i.e. the last byte on
+   the wire) is the instance's shard index.  The other 56 bits are
+   random.  (The low 32 bits must stay random as they are used as the
+   conn map hash.) */
+
+#define FD_QUIC_CONN_ID_SHARD_MAX (256UL)
+
+/* fd_quic_conn_id_shard_set returns conn_id with its shard index set
+   to shard_idx in [0,FD_QUIC_CONN_ID_SHARD_MAX).  fd_quic_conn_id_shard
+   returns the shard index of conn_id. */
+
+FD_FN_CONST static inline ulong
+fd_quic_conn_id_shard_set( ulong conn_id,
+                           ulong shard_idx ) {
+  return ( conn_id & 0x00ffffffffffffffUL ) | ( shard_idx<<56 );
+}
+
+FD_FN_CONST static inline ulong
+fd_quic_conn_id_shard( ulong conn_id ) {
+  return conn_id>>56;
+}
+
+/* fd_quic_pkt_shard returns the shard index encoded in the dest conn
+   ID of the QUIC packet at the start of the UDP payload [data,data+sz).
+   Only 1-RTT and Handshake packets are considered, as the dest conn IDs
+   of those were issued by the server.  Returns ULONG_MAX for Initial
+   and 0-RTT packets, whose dest conn ID may be chosen by the client,
+   and for malformed packets.  Such packets should be steered by UDP
+   flow instead.  Only reads the first 14 bytes of the packet, does not
+   authenticate anything. */
+
+FD_FN_PURE static inline ulong
+fd_quic_pkt_shard( uchar const * data,
+                   ulong         sz ) {
+  if( FD_UNLIKELY( sz<1UL+FD_QUIC_CONN_ID_SZ ) ) return ULONG_MAX;
+  uint b0 = data[ 0 ];
+  if( !( b0 & 0x80U ) ) {
+    /* short header: flags(1) dcid(8) */
+    return data[ FD_QUIC_CONN_ID_SZ ];
+  }
+  /* long header: flags(1) version(4) dcid_len(1) dcid(dcid_len) */
+  if( ( (b0>>4) & 0x3U )!=2U /* handshake */ ) return ULONG_MAX;
+  if( FD_UNLIKELY( sz<6UL+FD_QUIC_CONN_ID_SZ ) ) return ULONG_MAX;
+  if( FD_UNLIKELY( data[ 5 ]!=FD_QUIC_CONN_ID_SZ ) ) return ULONG_MAX;
+  return data[ 5UL+FD_QUIC_CONN_ID_SZ ];
+}
+
 FD_PROTOTYPES_END
 
 /* Defines a NULL connection id
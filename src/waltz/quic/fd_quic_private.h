@@ -108,6 +108,9 @@ struct __attribute__((aligned(16UL))) fd_quic_state_private {
 
   /* Scratch space for packet protection */
   uchar                   crypt_scratch[FD_QUIC_MTU];
+
+  /* Expanded packet and header protection keys */
+  fd_quic_crypto_cache_t  crypto_cache;
 };
 
 /* FD_QUIC_STATE_OFF is the offset of fd_quic_state_t within fd_quic_t. */
@@ -155,6 +158,18 @@ fd_quic_get_state_const( fd_quic_t const * quic ) {
   return (fd_quic_state_t const *)( (ulong)quic + FD_QUIC_STATE_OFF );
 }
 
+/* fd_quic_conn_id_local returns a new random conn ID to be issued by
+   this instance.  If sharding is enabled, the conn ID encodes the
+   shard index of this instance. */
+
+static inline ulong
+fd_quic_conn_id_local( fd_quic_t const * quic,
+                       fd_rng_t *        rng ) {
+  ulong conn_id = fd_rng_ulong( rng );
+  if( quic->config.shard_cnt>1UL ) conn_id = fd_quic_conn_id_shard_set( conn_id, quic->config.shard_idx );
+  return conn_id;
+}
+
 /* fd_quic_conn_service is called periodically to perform pending
    operations and time based operations.
 
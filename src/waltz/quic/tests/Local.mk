@@ -42,6 +42,8 @@ $(call make-unit-test,test_quic_retry_unit,test_quic_retry_unit,$(QUIC_TEST_LIBS
 $(call make-unit-test,test_quic_retry_integration,test_quic_retry_integration,$(QUIC_TEST_LIBS))
 $(call run-unit-test,test_quic_retry_unit)
 $(call run-unit-test,test_quic_retry_integration)
+$(call make-unit-test,test_quic_shard,test_quic_shard,$(QUIC_TEST_LIBS))
+$(call run-unit-test,test_quic_shard)
 
 ifdef FD_HAS_HOSTED
 $(call make-fuzz-test,fuzz_quic,fuzz_quic,$(QUIC_TEST_LIBS))
@@ -127,6 +127,74 @@ test_quic_short_pn( void ) {
   test_quic_crypto_helper(0xff00000002UL, packet_header_short_pn, sizeof( packet_header_short_pn ) );
 }
 
+/* tests that the key cache does not change the result of packet
+   protection, including when conns share a cache slot, and that slots
+   only depend on the conn index */
+static void
+test_quic_crypto_cache( fd_rng_t * rng ) {
+  static fd_quic_crypto_cache_t cache[1];
+
+  fd_quic_crypto_keys_t keys[3];
+  for( ulong j=0UL; j<3UL; j++ ) {
+    for( ulong b=0UL; b<sizeof(fd_quic_crypto_keys_t); b++ ) ((uchar *)&keys[j])[b] = fd_rng_uchar( rng );
+  }
+  /* keys[1] and keys[2] belong to conns that share cache slots */
+  ulong const conn_idx[3] = { 0UL, 1UL, 1UL+FD_QUIC_CRYPTO_CACHE_CNT/2UL };
+  FD_TEST( fd_quic_crypto_cache_slot( conn_idx[1], 0 )==fd_quic_crypto_cache_slot( conn_idx[2], 0 ) );
+  FD_TEST( fd_quic_crypto_cache_slot( conn_idx[1], 1 )==fd_quic_crypto_cache_slot( conn_idx[2], 1 ) );
+  FD_TEST( fd_quic_crypto_cache_slot( conn_idx[0], 0 )!=fd_quic_crypto_cache_slot( conn_idx[0], 1 ) );
+
+  uchar const hdr[ 9 ] = { 0x40, 1, 2, 3, 4, 5, 6, 7, 8 };
+  uchar payload[ 256 ];
+  for( ulong b=0UL; b<sizeof(payload); b++ ) payload[b] = fd_rng_uchar( rng );
+
+  for( ulong i=0UL; i<12UL; i++ ) {
+    fd_quic_crypto_keys_t const * k  = &keys[ i%3UL ];
+    ulong                         ci = conn_idx[ i%3UL ];
+    ulong                         pn = 1000UL+i;
+
+    uchar pkt_ref[ 512 ]; ulong pkt_ref_sz = sizeof(pkt_ref);
+    uchar pkt    [ 512 ]; ulong pkt_sz     = sizeof(pkt);
+    FD_TEST( fd_quic_crypto_encrypt       ( pkt_ref, &pkt_ref_sz, hdr, sizeof(hdr), payload, sizeof(payload), k, k, pn            )==FD_QUIC_SUCCESS );
+    FD_TEST( fd_quic_crypto_encrypt_cached( pkt,     &pkt_sz,     hdr, sizeof(hdr), payload, sizeof(payload), k, k, pn, cache, ci )==FD_QUIC_SUCCESS );
+    FD_TEST( pkt_sz==pkt_ref_sz );
+    FD_TEST( 0==memcmp( pkt, pkt_ref, pkt_sz ) );
+
+    FD_TEST( fd_quic_crypto_decrypt_hdr_cached( pkt, pkt_sz, 8UL,     k, cache, ci )==FD_QUIC_SUCCESS );
+    FD_TEST( fd_quic_crypto_decrypt_cached    ( pkt, pkt_sz, 8UL, pn, k, cache, ci )==FD_QUIC_SUCCESS );
+    FD_TEST( 0==memcmp( pkt,               hdr,     sizeof(hdr)     ) );
+    FD_TEST( 0==memcmp( pkt+sizeof(hdr),   payload, sizeof(payload) ) );
+
+    /* Wrong keys must not decrypt, even through the same conn's slot */
+    FD_TEST( fd_quic_crypto_decrypt_cached( pkt_ref, pkt_ref_sz, 8UL, pn, &keys[ (i+1UL)%3UL ], cache, ci )==FD_QUIC_FAILED );
+  }
+
+  /* Evicting keys wipes their cache entries and leaves others alone */
+
+  uchar pkt[ 512 ]; ulong pkt_sz = sizeof(pkt);
+  FD_TEST( fd_quic_crypto_encrypt_cached( pkt, &pkt_sz, hdr, sizeof(hdr), payload, sizeof(payload), &keys[0], &keys[0], 1UL, cache, conn_idx[0] )==FD_QUIC_SUCCESS );
+  fd_quic_crypto_cache_gcm_t const * gcm_ent = &cache->gcm[ fd_quic_crypto_cache_slot( conn_idx[0], 1 ) ];
+  fd_quic_crypto_cache_hp_t  const * hp_ent  = &cache->hp [ fd_quic_crypto_cache_slot( conn_idx[0], 1 ) ];
+  FD_TEST( gcm_ent->valid && hp_ent->valid );
+  FD_TEST( 0==memcmp( gcm_ent->key, keys[0].pkt_key, FD_AES_128_KEY_SZ ) );
+  FD_TEST( 0==memcmp( hp_ent->key,  keys[0].hp_key,  FD_AES_128_KEY_SZ ) );
+
+  fd_quic_crypto_cache_evict_pkt( cache, conn_idx[0], keys[1].pkt_key );
+  fd_quic_crypto_cache_evict_hp ( cache, conn_idx[0], keys[1].hp_key  );
+  fd_quic_crypto_cache_evict_pkt( cache, conn_idx[1], keys[0].pkt_key );
+  fd_quic_crypto_cache_evict_hp ( cache, conn_idx[1], keys[0].hp_key  );
+  FD_TEST( gcm_ent->valid && hp_ent->valid );
+
+  fd_quic_crypto_cache_evict_pkt( cache, conn_idx[0], keys[0].pkt_key );
+  fd_quic_crypto_cache_evict_hp ( cache, conn_idx[0], keys[0].hp_key  );
+  for( ulong b=0UL; b<sizeof(fd_quic_crypto_cache_gcm_t); b++ ) FD_TEST( !((uchar const *)gcm_ent)[b] );
+  for( ulong b=0UL; b<sizeof(fd_quic_crypto_cache_hp_t);  b++ ) FD_TEST( !((uchar const *)hp_ent )[b] );
+
+  FD_TEST( fd_quic_crypto_decrypt_hdr_cached( pkt, pkt_sz, 8UL,      &keys[0], cache, conn_idx[0] )==FD_QUIC_SUCCESS );
+  FD_TEST( fd_quic_crypto_decrypt_cached    ( pkt, pkt_sz, 8UL, 1UL, &keys[0], cache, conn_idx[0] )==FD_QUIC_SUCCESS );
+  FD_TEST( 0==memcmp( pkt+sizeof(hdr), payload, sizeof(payload) ) );
+}
+
 /* tests that nonce is correctly generated, e.g. from rfc9001 a.5. */
 static void
 test_quic_nonce( void ) {
@@ -341,38 +409,45 @@ main( int     argc,
   for( ulong b=0UL; b<1472UL; b++ ) buf1[b] = fd_rng_uchar( rng );
   for( ulong b=0UL; b<1472UL; b++ ) buf2[b] = fd_rng_uchar( rng );
 
+  static fd_quic_crypto_cache_t _cache[1];
+  fd_quic_crypto_cache_t * const bench_cache[2] = { NULL, _cache };
+
   FD_LOG_NOTICE(( "Benchmarking header+payload decrypt" ));
-  for( ulong idx=0U; idx<2UL; idx++ ) {
-    ulong sz = bench_sz[ idx ];
+  for( ulong idx=0U; idx<4UL; idx++ ) {
+    ulong                    sz    = bench_sz   [ idx&1UL ];
+    fd_quic_crypto_cache_t * cache = bench_cache[ idx>>1  ];
 
     /* warmup */
     for( ulong rem=10UL; rem; rem-- ) {
-      fd_quic_crypto_decrypt_hdr( buf2, sz, 0,       &client_keys );
-      fd_quic_crypto_decrypt    ( buf2, sz, 0, 1234, &client_keys );
+      fd_quic_crypto_decrypt_hdr_cached( buf2, sz, 0,       &client_keys, cache, 0UL );
+      fd_quic_crypto_decrypt_cached    ( buf2, sz, 0, 1234, &client_keys, cache, 0UL );
     }
 
     /* for real */
     ulong iter = 1000000UL;
     long  dt   = -fd_log_wallclock();
     for( ulong rem=iter; rem; rem-- ) {
-      fd_quic_crypto_decrypt_hdr( buf2, sz, 0,       &client_keys );
-      fd_quic_crypto_decrypt    ( buf2, sz, 0, 1234, &client_keys );
+      fd_quic_crypto_decrypt_hdr_cached( buf2, sz, 0,       &client_keys, cache, 0UL );
+      fd_quic_crypto_decrypt_cached    ( buf2, sz, 0, 1234, &client_keys, cache, 0UL );
     }
     dt += fd_log_wallclock();
     float gbps = ((float)(8UL*(70UL+sz)*iter)) / ((float)dt);
-    FD_LOG_NOTICE(( "~%6.3f Gbps Ethernet equiv throughput / core (sz %4lu)", (double)gbps, sz ));
+    float mpps = ((float)iter*1e3f) / ((float)dt);
+    FD_LOG_NOTICE(( "~%6.3f Gbps Ethernet equiv throughput / core, %6.3f Mpps / core (sz %4lu, %s)",
+                    (double)gbps, (double)mpps, sz, cache ? "cached keys" : "uncached keys" ));
   } while(0);
 
   FD_LOG_NOTICE(( "Benchmarking header+payload encrypt" ));
-  for( ulong idx=0U; idx<2UL; idx++ ) {
-    ulong const out_sz = bench_sz[ idx ];
-    ulong const hdr_sz = 22UL;
-    ulong const sz     = out_sz - FD_QUIC_CRYPTO_TAG_SZ - hdr_sz;
+  for( ulong idx=0U; idx<4UL; idx++ ) {
+    ulong const              out_sz = bench_sz   [ idx&1UL ];
+    fd_quic_crypto_cache_t * cache  = bench_cache[ idx>>1  ];
+    ulong const              hdr_sz = 22UL;
+    ulong const              sz     = out_sz - FD_QUIC_CRYPTO_TAG_SZ - hdr_sz;
 
     /* warmup */
     for( ulong rem=10UL; rem; rem-- ) {
       ulong out_sz_ = out_sz;
-      fd_quic_crypto_encrypt( buf2, &out_sz_, hdr, hdr_sz, buf1, sz, &client_keys, &client_keys, 1234 );
+      fd_quic_crypto_encrypt_cached( buf2, &out_sz_, hdr, hdr_sz, buf1, sz, &client_keys, &client_keys, 1234, cache, 0UL );
     }
 
     /* for real */
@@ -380,13 +455,16 @@ main( int     argc,
     long  dt   = -fd_log_wallclock();
     for( ulong rem=iter; rem; rem-- ) {
       ulong out_sz_ = out_sz;
-      fd_quic_crypto_encrypt( buf2, &out_sz_, hdr, hdr_sz, buf1, sz, &client_keys, &client_keys, 1234 );
+      fd_quic_crypto_encrypt_cached( buf2, &out_sz_, hdr, hdr_sz, buf1, sz, &client_keys, &client_keys, 1234, cache, 0UL );
     }
     dt += fd_log_wallclock();
     float gbps = ((float)(8UL*(70UL+out_sz)*iter)) / ((float)dt);
-    FD_LOG_NOTICE(( "~%6.3f Gbps Ethernet equiv throughput / core (sz %4lu)", (double)gbps, out_sz ));
+    FD_LOG_NOTICE(( "~%6.3f Gbps Ethernet equiv throughput / core (sz %4lu, %s)",
+                    (double)gbps, out_sz, cache ? "cached keys" : "uncached keys" ));
   } while(0);
 
+  test_quic_crypto_cache( rng );
+
   test_quic_short_pn();
   test_quic_nonce();
   fd_rng_delete( fd_rng_leave( rng ) );
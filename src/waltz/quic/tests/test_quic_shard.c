@@ -0,0 +1,241 @@
+/* test_quic_shard.c tests RX steering across multiple fd_quic_t server
+   instances sharing an RX port.  Packets are steered by dest conn ID
+   if possible, and by a simulated UDP flow hash otherwise. */
+
+#include "../fd_quic.h"
+#include "../fd_quic_private.h"
+#include "fd_quic_test_helpers.h"
+
+#define SHARD_CNT (2UL)
+
+/* Steering middleware (client->servers) */
+
+struct steer {
+  fd_aio_t    aio;
+  fd_quic_t * servers[ SHARD_CNT ];
+  ulong       flow_shard;            /* shard selected by UDP flow */
+  ulong       rx_cnt[ SHARD_CNT ];
+};
+typedef struct steer steer_t;
+
+static int
+steer_send( void *                    ctx,
+            fd_aio_pkt_info_t const * batch,
+            ulong                     batch_cnt,
+            ulong *                   opt_batch_idx FD_PARAM_UNUSED,
+            int                       flush ) {
+  steer_t * steer = ctx;
+  for( ulong j=0UL; j<batch_cnt; j++ ) {
+    uchar const * ip     = batch[ j ].buf;
+    ulong         hdr_sz = 4UL*(ip[ 0 ]&0xfUL) + 8UL;
+    FD_TEST( batch[ j ].buf_sz>hdr_sz );
+    ulong shard = fd_quic_pkt_shard( ip+hdr_sz, batch[ j ].buf_sz-hdr_sz );
+    if( shard==ULONG_MAX ) shard = steer->flow_shard;
+    FD_TEST( shard<SHARD_CNT );
+    steer->rx_cnt[ shard ]++;
+    fd_aio_send( fd_quic_get_aio_net_rx( steer->servers[ shard ] ), batch+j, 1UL, NULL, flush );
+  }
+  return FD_AIO_SUCCESS;
+}
+
+/* Callbacks */
+
+static fd_quic_conn_t * server_conn[ SHARD_CNT ];
+static ulong            server_rx_sz[ SHARD_CNT ];
+static int              client_complete;
+
+static void
+server_conn_new( fd_quic_conn_t * conn,
+                 void *           quic_ctx ) {
+  server_conn[ (ulong)quic_ctx ] = conn;
+}
+
+static int
+server_stream_rx( fd_quic_conn_t * conn,
+                  ulong            stream_id FD_PARAM_UNUSED,
+                  ulong            offset    FD_PARAM_UNUSED,
+                  uchar const *    data      FD_PARAM_UNUSED,
+                  ulong            data_sz,
+                  int              fin       FD_PARAM_UNUSED ) {
+  server_rx_sz[ conn->quic->config.shard_idx ] += data_sz;
+  return FD_QUIC_SUCCESS;
+}
+
+static void
+client_hs_complete( fd_quic_conn_t * conn     FD_PARAM_UNUSED,
+                    void *           quic_ctx FD_PARAM_UNUSED ) {
+  client_complete = 1;
+}
+
+static ulong now = 123UL;
+
+static ulong
+test_clock( void * ctx FD_PARAM_UNUSED ) {
+  return now;
+}
+
+static void
+service_all( fd_quic_t *  client,
+             fd_quic_t ** servers ) {
+  fd_quic_service( client );
+  for( ulong j=0UL; j<SHARD_CNT; j++ ) fd_quic_service( servers[ j ] );
+}
+
+static void
+test_pkt_shard( void ) {
+  ulong conn_id = fd_quic_conn_id_shard_set( 0x0123456789abcdefUL, 0xa5UL );
+  FD_TEST( conn_id==0xa523456789abcdefUL );
+  FD_TEST( fd_quic_conn_id_shard( conn_id )==0xa5UL );
+
+  uchar pkt[ 32 ] = {0};
+
+  /* 1-RTT: flags, DCID */
+  pkt[ 0 ] = 0x40;
+  FD_STORE( ulong, pkt+1, conn_id );
+  FD_TEST( fd_quic_pkt_shard( pkt, sizeof(pkt) )==0xa5UL );
+  FD_TEST( fd_quic_pkt_shard( pkt, 9UL         )==0xa5UL );
+  FD_TEST( fd_quic_pkt_shard( pkt, 8UL         )==ULONG_MAX );
+  FD_TEST( fd_quic_pkt_shard( pkt, 0UL         )==ULONG_MAX );
+
+  /* Handshake: flags, version, DCID len, DCID */
+  fd_memset( pkt, 0, sizeof(pkt) );
+  pkt[ 0 ] = 0xe0;
+  pkt[ 4 ] = 0x01;
+  pkt[ 5 ] = 8;
+  FD_STORE( ulong, pkt+6, conn_id );
+  FD_TEST( fd_quic_pkt_shard( pkt, sizeof(pkt) )==0xa5UL );
+  FD_TEST( fd_quic_pkt_shard( pkt, 14UL        )==0xa5UL );
+  FD_TEST( fd_quic_pkt_shard( pkt, 13UL        )==ULONG_MAX );
+  pkt[ 5 ] = 20;
+  FD_TEST( fd_quic_pkt_shard( pkt, sizeof(pkt) )==ULONG_MAX );
+  pkt[ 5 ] = 8;
+
+  /* Initial and 0-RTT are steered by flow */
+  pkt[ 0 ] = 0xc0;
+  FD_TEST( fd_quic_pkt_shard( pkt, sizeof(pkt) )==ULONG_MAX );
+  pkt[ 0 ] = 0xd0;
+  FD_TEST( fd_quic_pkt_shard( pkt, sizeof(pkt) )==ULONG_MAX );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot          ( &argc, &argv );
+  fd_quic_test_boot( &argc, &argv );
+
+  test_pkt_shard();
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  ulong cpu_idx = fd_tile_cpu_id( fd_tile_idx() );
+  if( cpu_idx>fd_shmem_cpu_cnt() ) cpu_idx = 0UL;
+
+  char const * _page_sz  = fd_env_strip_cmdline_cstr ( &argc, &argv, "--page-sz",   NULL, "gigantic"                   );
+  ulong        page_cnt  = fd_env_strip_cmdline_ulong( &argc, &argv, "--page-cnt",  NULL, 1UL                          );
+  ulong        numa_idx  = fd_env_strip_cmdline_ulong( &argc, &argv, "--numa-idx",  NULL, fd_shmem_numa_idx( cpu_idx ) );
+
+  ulong page_sz = fd_cstr_to_shmem_page_sz( _page_sz );
+  if( FD_UNLIKELY( !page_sz ) ) FD_LOG_ERR(( "unsupported --page-sz" ));
+
+  FD_LOG_NOTICE(( "Creating workspace (--page-cnt %lu, --page-sz %s, --numa-idx %lu)", page_cnt, _page_sz, numa_idx ));
+  fd_wksp_t * wksp = fd_wksp_new_anonymous( page_sz, page_cnt, fd_shmem_cpu_idx( numa_idx ), "wksp", 0UL );
+  FD_TEST( wksp );
+
+  fd_quic_limits_t const quic_limits = {
+    .conn_cnt           = 4,
+    .conn_id_cnt        = 4,
+    .handshake_cnt      = 4,
+    .stream_id_cnt      = 4,
+    .stream_pool_cnt    = 16,
+    .inflight_pkt_cnt   = 64,
+    .tx_buf_sz          = 1<<12
+  };
+
+  uchar retry_secret[ FD_QUIC_RETRY_SECRET_SZ ]; for( ulong j=0UL; j<sizeof(retry_secret); j++ ) retry_secret[ j ] = fd_rng_uchar( rng );
+  uchar retry_iv    [ FD_QUIC_RETRY_IV_SZ     ]; for( ulong j=0UL; j<sizeof(retry_iv    ); j++ ) retry_iv    [ j ] = fd_rng_uchar( rng );
+
+  fd_quic_t * servers[ SHARD_CNT ];
+  for( ulong j=0UL; j<SHARD_CNT; j++ ) {
+    fd_quic_t * server = fd_quic_new_anonymous( wksp, &quic_limits, FD_QUIC_ROLE_SERVER, rng );
+    FD_TEST( server );
+    server->cb.now                        = test_clock;
+    server->cb.conn_new                   = server_conn_new;
+    server->cb.stream_rx                  = server_stream_rx;
+    server->cb.quic_ctx                   = (void *)j;
+    server->config.retry                  = 1;
+    server->config.shard_idx              = j;
+    server->config.shard_cnt              = SHARD_CNT;
+    server->config.initial_rx_max_stream_data = 1<<12;
+    fd_memcpy( server->config.retry_secret, retry_secret, sizeof(retry_secret) );
+    fd_memcpy( server->config.retry_iv,     retry_iv,     sizeof(retry_iv)     );
+    servers[ j ] = server;
+  }
+
+  fd_quic_t * client = fd_quic_new_anonymous( wksp, &quic_limits, FD_QUIC_ROLE_CLIENT, rng );
+  FD_TEST( client );
+  client->cb.now                        = test_clock;
+  client->cb.conn_hs_complete           = client_hs_complete;
+  client->config.initial_rx_max_stream_data = 1<<12;
+
+  /* Wire up client->steer->servers and servers->client */
+
+  steer_t steer = { .flow_shard = 0UL };
+  for( ulong j=0UL; j<SHARD_CNT; j++ ) steer.servers[ j ] = servers[ j ];
+  FD_TEST( fd_aio_join( fd_aio_new( &steer.aio, &steer, steer_send ) ) );
+  fd_quic_set_aio_net_tx( client, &steer.aio );
+  for( ulong j=0UL; j<SHARD_CNT; j++ ) fd_quic_set_aio_net_tx( servers[ j ], fd_quic_get_aio_net_rx( client ) );
+
+  for( ulong j=0UL; j<SHARD_CNT; j++ ) FD_TEST( fd_quic_init( servers[ j ] ) );
+  FD_TEST( fd_quic_init( client ) );
+
+  /* Shard 0 receives the first Initial and responds with a Retry */
+
+  fd_quic_conn_t * client_conn = fd_quic_connect( client, 0U, 0, 0U, 0 );
+  FD_TEST( client_conn );
+  fd_quic_service( client );
+  FD_TEST( steer.rx_cnt[ 0 ]==1UL && steer.rx_cnt[ 1 ]==0UL );
+  FD_TEST( servers[ 0 ]->metrics.conn_created_cnt==0UL );
+
+  /* The UDP flow changes.  Shard 1 accepts the retry token issued by
+     shard 0 and takes over the conn. */
+
+  steer.flow_shard = 1UL;
+  for( ulong j=0UL; j<20UL && !client_complete; j++ ) service_all( client, servers );
+  FD_TEST( client_complete );
+  FD_TEST( !server_conn[ 0 ] );
+  FD_TEST( server_conn[ 1 ] );
+  FD_TEST( servers[ 0 ]->metrics.conn_created_cnt==0UL );
+  FD_TEST( servers[ 1 ]->metrics.conn_created_cnt==1UL );
+  FD_TEST( servers[ 1 ]->metrics.conn_retry_cnt  ==1UL );
+  FD_TEST( fd_quic_conn_id_shard( server_conn[ 1 ]->our_conn_id )==1UL );
+
+  /* The UDP flow changes again.  Packets of the established conn are
+     still steered to shard 1 by conn ID. */
+
+  steer.flow_shard = 0UL;
+  ulong rx_cnt0 = steer.rx_cnt[ 0 ];
+  fd_quic_stream_t * stream = fd_quic_conn_new_stream( client_conn );
+  FD_TEST( stream );
+  uchar buf[ 512 ] = {0};
+  FD_TEST( fd_quic_stream_send( stream, buf, sizeof(buf), 1 )==FD_QUIC_SUCCESS );
+  for( ulong j=0UL; j<10UL; j++ ) service_all( client, servers );
+  FD_TEST( server_rx_sz[ 1 ]==sizeof(buf) );
+  FD_TEST( server_rx_sz[ 0 ]==0UL );
+  FD_TEST( steer.rx_cnt[ 0 ]==rx_cnt0 );
+
+  FD_LOG_NOTICE(( "Cleaning up" ));
+  fd_quic_set_aio_net_tx( client, NULL );
+  fd_wksp_free_laddr( fd_quic_delete( fd_quic_leave( fd_quic_fini( client ) ) ) );
+  for( ulong j=0UL; j<SHARD_CNT; j++ ) {
+    fd_quic_set_aio_net_tx( servers[ j ], NULL );
+    fd_wksp_free_laddr( fd_quic_delete( fd_quic_leave( fd_quic_fini( servers[ j ] ) ) ) );
+  }
+  fd_aio_delete( fd_aio_leave( &steer.aio ) );
+  fd_wksp_delete_anonymous( wksp );
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_quic_test_halt();
+  fd_halt();
+  return 0;
+}
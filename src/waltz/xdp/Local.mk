@@ -1,11 +1,14 @@
-$(call add-hdrs,fd_xsk.h fd_xdp_redirect_user.h)
+$(call add-hdrs,fd_xsk.h fd_xdp_redirect_user.h fd_xdp_rss.h)
 
 ifdef FD_HAS_HOSTED
 ifdef FD_HAS_LINUX
-$(call add-objs,fd_xsk fd_xdp1 fd_xdp_redirect_user,fd_waltz)
+$(call add-objs,fd_xsk fd_xdp1 fd_xdp_redirect_user fd_xdp_rss,fd_waltz)
 
 $(call make-unit-test,test_xdp_ebpf,test_xdp_ebpf,fd_waltz fd_util)
 $(call run-unit-test,test_xdp_ebpf)
+
+$(call make-unit-test,test_xdp_rss,test_xdp_rss,fd_waltz fd_util)
+$(call run-unit-test,test_xdp_rss)
 endif # FD_HAS_LINUX
 endif # FD_HAS_HOSTED
 
@@ -0,0 +1,150 @@
+#define _GNU_SOURCE
+#include "fd_xdp_rss.h"
+#include "../../util/log/fd_log.h"
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <linux/ethtool.h>
+#include <linux/sockios.h>
+
+union fd_xdp_rss_indir_req {
+  struct ethtool_rxfh_indir hdr;
+  uchar buf[ sizeof(struct ethtool_rxfh_indir) + FD_XDP_RSS_INDIR_MAX*sizeof(uint) ];
+};
+
+typedef union fd_xdp_rss_indir_req fd_xdp_rss_indir_req_t;
+
+static int
+fd_xdp_rss_ethtool( char const * if_name,
+                    void *       req ) {
+  if( FD_UNLIKELY( strlen( if_name )>=IF_NAMESIZE ) ) return EINVAL;
+
+  int sock = socket( AF_INET, SOCK_DGRAM, 0 );
+  if( FD_UNLIKELY( sock<0 ) ) {
+    FD_LOG_WARNING(( "socket(AF_INET,SOCK_DGRAM,0) failed (%i-%s)", errno, fd_io_strerror( errno ) ));
+    return errno;
+  }
+
+  struct ifreq ifr = {0};
+  strncpy( ifr.ifr_name, if_name, IF_NAMESIZE-1 );
+  ifr.ifr_data = req;
+
+  int err = 0;
+  if( FD_UNLIKELY( ioctl( sock, SIOCETHTOOL, &ifr ) ) ) err = errno;
+
+  if( FD_UNLIKELY( close( sock ) ) ) FD_LOG_WARNING(( "close() failed (%i-%s)", errno, fd_io_strerror( errno ) ));
+  return err;
+}
+
+int
+fd_xdp_rss_indir_get( char const * if_name,
+                      uint *       indir,
+                      ulong        indir_max,
+                      ulong *      indir_sz ) {
+  fd_xdp_rss_indir_req_t req;
+
+  /* Query table size */
+
+  req.hdr = (struct ethtool_rxfh_indir){ .cmd = ETHTOOL_GRXFHINDIR, .size = 0U };
+  int err = fd_xdp_rss_ethtool( if_name, &req );
+  if( FD_UNLIKELY( err ) ) {
+    if( err!=EOPNOTSUPP ) FD_LOG_WARNING(( "ioctl(SIOCETHTOOL,ETHTOOL_GRXFHINDIR) failed on interface %s (%i-%s)", if_name, err, fd_io_strerror( err ) ));
+    return err;
+  }
+  ulong sz = req.hdr.size;
+  if( FD_UNLIKELY( !sz ) ) return EOPNOTSUPP;
+  if( FD_UNLIKELY( sz>indir_max || sz>FD_XDP_RSS_INDIR_MAX ) ) return ENOSPC;
+
+  /* Read table */
+
+  req.hdr = (struct ethtool_rxfh_indir){ .cmd = ETHTOOL_GRXFHINDIR, .size = (uint)sz };
+  err = fd_xdp_rss_ethtool( if_name, &req );
+  if( FD_UNLIKELY( err ) ) {
+    FD_LOG_WARNING(( "ioctl(SIOCETHTOOL,ETHTOOL_GRXFHINDIR) failed on interface %s (%i-%s)", if_name, err, fd_io_strerror( err ) ));
+    return err;
+  }
+
+  memcpy( indir, req.hdr.ring_index, sz*sizeof(uint) );
+  *indir_sz = sz;
+  return 0;
+}
+
+int
+fd_xdp_rss_indir_set( char const * if_name,
+                      uint const * indir,
+                      ulong        indir_sz ) {
+  if( FD_UNLIKELY( !indir_sz || indir_sz>FD_XDP_RSS_INDIR_MAX ) ) return EINVAL;
+
+  fd_xdp_rss_indir_req_t req;
+  req.hdr = (struct ethtool_rxfh_indir){ .cmd = ETHTOOL_SRXFHINDIR, .size = (uint)indir_sz };
+  memcpy( req.hdr.ring_index, indir, indir_sz*sizeof(uint) );
+
+  int err = fd_xdp_rss_ethtool( if_name, &req );
+  if( FD_UNLIKELY( err ) ) {
+    FD_LOG_WARNING(( "ioctl(SIOCETHTOOL,ETHTOOL_SRXFHINDIR) failed on interface %s (%i-%s)", if_name, err, fd_io_strerror( err ) ));
+  }
+  return err;
+}
+
+ulong
+fd_xdp_rss_rebalance( uint *        indir,
+                      ulong         indir_sz,
+                      ulong const * load,
+                      ulong         queue_cnt,
+                      double        tolerance ) {
+  if( FD_UNLIKELY( !queue_cnt || queue_cnt>FD_XDP_RSS_QUEUE_MAX ) ) {
+    FD_LOG_WARNING(( "invalid queue_cnt %lu", queue_cnt ));
+    return 0UL;
+  }
+
+  ulong  bucket_cnt[ FD_XDP_RSS_QUEUE_MAX ] = {0};
+  double queue_load[ FD_XDP_RSS_QUEUE_MAX ];
+
+  for( ulong j=0UL; j<indir_sz; j++ ) {
+    if( indir[ j ]<queue_cnt ) bucket_cnt[ indir[ j ] ]++;
+  }
+
+  double load_sum = 0.0;
+  for( ulong q=0UL; q<queue_cnt; q++ ) {
+    queue_load[ q ] = (double)load[ q ];
+    load_sum       += (double)load[ q ];
+  }
+  if( FD_UNLIKELY( load_sum<=0.0 ) ) return 0UL;
+  double load_max = ( load_sum/(double)queue_cnt )*( 1.0+tolerance );
+
+  ulong move_cnt = 0UL;
+  for( ulong iter=0UL; iter<indir_sz; iter++ ) {
+
+    /* Find hottest and coldest queue */
+
+    ulong hot = 0UL;
+    ulong cold = 0UL;
+    for( ulong q=1UL; q<queue_cnt; q++ ) {
+      if( queue_load[ q ]>queue_load[ hot  ] ) hot  = q;
+      if( queue_load[ q ]<queue_load[ cold ] ) cold = q;
+    }
+    if( queue_load[ hot ]<=load_max ) break;
+    if( bucket_cnt[ hot ]<=1UL      ) break;
+
+    /* Move one bucket if that lowers the max load */
+
+    double bucket_load = queue_load[ hot ] / (double)bucket_cnt[ hot ];
+    if( queue_load[ cold ]+bucket_load >= queue_load[ hot ] ) break;
+
+    ulong j = indir_sz;
+    while( j-- ) if( indir[ j ]==hot ) break;
+    indir[ j ] = (uint)cold;
+
+    bucket_cnt[ hot  ]--;
+    bucket_cnt[ cold ]++;
+    queue_load[ hot  ] -= bucket_load;
+    queue_load[ cold ] += bucket_load;
+    move_cnt++;
+  }
+
+  return move_cnt;
+}
@@ -0,0 +1,82 @@
+#ifndef HEADER_fd_src_waltz_xdp_fd_xdp_rss_h
+#define HEADER_fd_src_waltz_xdp_fd_xdp_rss_h
+
+/* fd_xdp_rss.h provides APIs for steering flows across the RX queues of
+   a network device.
+
+   An AF_XDP socket only receives packets from the single device queue
+   it is bound to, so an XDP program cannot redirect a packet to the
+   socket of another queue (bpf_redirect_map to an XSK bound to a
+   different queue drops the packet).  Spreading flows across net tiles
+   therefore has to happen before XDP, when the device hashes each flow
+   onto an RX queue (RSS).  The device picks the queue of a flow by
+   looking up its hash in an indirection table.
+
+   fd_xdp_rss_rebalance adjusts such an indirection table based on the
+   observed load of each queue, moving hash buckets away from hot
+   queues.  fd_xdp_rss_indir_{get,set} read and write the indirection
+   table of a device via ethtool. */
+
+#include "../../util/fd_util_base.h"
+
+/* FD_XDP_RSS_INDIR_MAX is the max supported indirection table size. */
+
+#define FD_XDP_RSS_INDIR_MAX (4096UL)
+
+/* FD_XDP_RSS_QUEUE_MAX is the max number of queues supported by
+   fd_xdp_rss_rebalance.  Matches the size of the XSK map. */
+
+#define FD_XDP_RSS_QUEUE_MAX (256UL)
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_xdp_rss_indir_get reads the RSS indirection table of the network
+   device named if_name into indir.  On success, sets *indir_sz to the
+   number of table entries and returns 0.  On failure, returns errno
+   (EOPNOTSUPP if the device does not support RSS) and logs a warning
+   for unexpected errors.  Fails with ENOSPC if the table has more than
+   indir_max entries. */
+
+int
+fd_xdp_rss_indir_get( char const * if_name,
+                      uint *       indir,
+                      ulong        indir_max,
+                      ulong *      indir_sz );
+
+/* fd_xdp_rss_indir_set replaces the RSS indirection table of the
+   network device named if_name.  indir_sz must match the size reported
+   by fd_xdp_rss_indir_get.  Requires CAP_NET_ADMIN.  Returns 0 on
+   success or errno on failure. */
+
+int
+fd_xdp_rss_indir_set( char const * if_name,
+                      uint const * indir,
+                      ulong        indir_sz );
+
+/* fd_xdp_rss_rebalance moves RSS buckets from overloaded to
+   underloaded queues.  indir is an indirection table with indir_sz
+   entries mapping hash buckets to queue indices.  load[i] is the load
+   (e.g. the number of packets received over the last interval) of
+   queue i in [0,queue_cnt).  Entries referring to queues at or beyond
+   queue_cnt are left untouched.  queue_cnt must be in
+   [1,FD_XDP_RSS_QUEUE_MAX].
+
+   The load of each bucket is assumed to be the load of its queue
+   divided evenly over the queue's buckets.  Buckets are moved from the
+   most loaded to the least loaded queue until no queue exceeds the
+   mean load by more than a factor of (1+tolerance), or until moving
+   another bucket would no longer lower the max queue load.  A queue
+   always keeps at least one bucket.  Returns the number of entries
+   changed.  Since bucket loads are estimates, callers should
+   periodically re-measure load and call this again. */
+
+ulong
+fd_xdp_rss_rebalance( uint *        indir,
+                      ulong         indir_sz,
+                      ulong const * load,
+                      ulong         queue_cnt,
+                      double        tolerance );
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_waltz_xdp_fd_xdp_rss_h */
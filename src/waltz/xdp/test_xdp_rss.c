@@ -0,0 +1,82 @@
+#include "fd_xdp_rss.h"
+#include "../../util/fd_util.h"
+
+#define INDIR_SZ  (128UL)
+#define QUEUE_CNT (4UL)
+
+static void
+indir_default( uint * indir,
+               ulong  queue_cnt ) {
+  for( ulong j=0UL; j<INDIR_SZ; j++ ) indir[ j ] = (uint)( j%queue_cnt );
+}
+
+static void
+bucket_count( uint const * indir,
+              ulong *      cnt ) {
+  for( ulong q=0UL; q<QUEUE_CNT; q++ ) cnt[ q ] = 0UL;
+  for( ulong j=0UL; j<INDIR_SZ; j++ ) {
+    FD_TEST( indir[ j ]<QUEUE_CNT );
+    cnt[ indir[ j ] ]++;
+  }
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  uint  indir[ INDIR_SZ ];
+  ulong cnt  [ QUEUE_CNT ];
+
+  /* Balanced or idle queues are left alone */
+
+  indir_default( indir, QUEUE_CNT );
+  ulong const balanced[ QUEUE_CNT ] = { 100UL, 105UL, 95UL, 100UL };
+  FD_TEST( fd_xdp_rss_rebalance( indir, INDIR_SZ, balanced, QUEUE_CNT, 0.1 )==0UL );
+  ulong const idle[ QUEUE_CNT ] = {0};
+  FD_TEST( fd_xdp_rss_rebalance( indir, INDIR_SZ, idle, QUEUE_CNT, 0.1 )==0UL );
+
+  /* Buckets move away from a hot queue */
+
+  ulong const hot[ QUEUE_CNT ] = { 640UL, 160UL, 160UL, 160UL };
+  ulong move_cnt = fd_xdp_rss_rebalance( indir, INDIR_SZ, hot, QUEUE_CNT, 0.1 );
+  bucket_count( indir, cnt );
+  FD_LOG_INFO(( "moved %lu buckets: %lu %lu %lu %lu", move_cnt, cnt[0], cnt[1], cnt[2], cnt[3] ));
+  FD_TEST( move_cnt>0UL );
+  FD_TEST( cnt[0]+move_cnt==INDIR_SZ/QUEUE_CNT );
+  /* Buckets of queue 0 carry a load of 20 each.  Moving 17 of them
+     brings queue 0 within 10% of the mean load of 280. */
+  FD_TEST( cnt[0]==15UL );
+  FD_TEST( fd_ulong_max( fd_ulong_max( cnt[1], cnt[2] ), cnt[3] ) - fd_ulong_min( fd_ulong_min( cnt[1], cnt[2] ), cnt[3] )<=1UL );
+
+  /* A single bucket carrying all load cannot be split */
+
+  for( ulong j=0UL; j<INDIR_SZ; j++ ) indir[ j ] = 1U;
+  indir[ 0 ] = 0U;
+  ulong const elephant[ QUEUE_CNT ] = { 1000UL, 0UL, 0UL, 0UL };
+  FD_TEST( fd_xdp_rss_rebalance( indir, INDIR_SZ, elephant, QUEUE_CNT, 0.1 )==0UL );
+  FD_TEST( indir[ 0 ]==0U );
+
+  /* Queues without buckets receive some */
+
+  indir_default( indir, 2UL );
+  ulong const unused[ QUEUE_CNT ] = { 100UL, 100UL, 0UL, 0UL };
+  move_cnt = fd_xdp_rss_rebalance( indir, INDIR_SZ, unused, QUEUE_CNT, 0.0 );
+  bucket_count( indir, cnt );
+  FD_TEST( move_cnt==INDIR_SZ/2UL );
+  for( ulong q=0UL; q<QUEUE_CNT; q++ ) FD_TEST( cnt[ q ]==INDIR_SZ/QUEUE_CNT );
+
+  /* Entries of queues not managed by the caller are untouched */
+
+  indir_default( indir, QUEUE_CNT );
+  ulong const hot2[ 2 ] = { 300UL, 100UL };
+  fd_xdp_rss_rebalance( indir, INDIR_SZ, hot2, 2UL, 0.1 );
+  for( ulong j=0UL; j<INDIR_SZ; j++ ) {
+    if( (j%QUEUE_CNT)>=2UL ) FD_TEST( indir[ j ]==(uint)( j%QUEUE_CNT ) );
+    else                     FD_TEST( indir[ j ]<2U );
+  }
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}